@@ -79,20 +79,28 @@ static const char* list_get_name(dirList_t* list, u8 idx);
 static void* list_open_file_name(dirList_t* list, const char* name, const char* mode, u32* size);
 
 
-// fake fread: no size arg, always byte
-static void fake_fread(volatile u8* dst, u32 len, void* fp) {
-  u32 n = 0;
-#if 0
-  // this seems to fail with files over a certain size, or something.
-  // weird because fl_fgetc is just a call to fl_fread with size=1, data=1.
-  fl_fread(&dst, 1, len, fp);
-#else
-  while(n < len) {
-    *dst = fl_fgetc(fp);
-    n++;
-    dst++;
+// read a run of bytes with a single bulk fl_fread.
+// whole sectors go straight from the card into dst;
+// only the unaligned head and tail pass through the sector buffer.
+static void fread_bytes(volatile u8* dst, u32 len, void* fp) {
+  fl_fread((void*)dst, 1, len, fp);
+}
+
+#ifdef SCALER_LE
+// reverse the byte order of each word in a buffer
+static void swap_bytes_32(u32* buf, u32 n) {
+  u32 w;
+  while(n--) {
+    w = *buf;
+    *buf++ = (w >> 24) | ((w >> 8) & 0xff00) | ((w << 8) & 0xff0000) | (w << 24);
   }
+}
 #endif
+
+// ldr_stream source: read a chunk from an open file
+static u32 fread_chunk(void* fp, u8* dst, u32 len) {
+  int n = fl_fread(dst, 1, len, fp);
+  return n > 0 ? (u32)n : 0;
 }
 
 // strip space from the end of a string
@@ -181,9 +189,9 @@ u8 files_load_dsp(u8 idx) {
 u8 files_load_dsp_name(const char* name) {
   void* fp;
   u32 size = 0;
+  u32 sent;
   u8 ret;
   //  char nameTry[DIR_LIST_NAME_LEN];
-  volatile u8* bfinLdrData = NULL;
 
   delay_ms(10);
   app_pause();
@@ -194,30 +202,27 @@ u8 files_load_dsp_name(const char* name) {
 
     if(size > 0) {
 
-      // allocate a RAM buffer
-      bfinLdrData = alloc_mem(size);
-      fake_fread(bfinLdrData, size, fp);
+      // reboot the dsp, streaming the firmware from the card
+      // (two sectors at a time; no RAM copy of the whole file)
+      sent = bfin_load_stream(&fread_chunk, fp, size);
       fl_fclose(fp);
 
-      // reboot the dsp with new firmware in RAM
-      bfin_load_buf((const u8*)bfinLdrData, size);
-
-      // DEBUG uncomment this to send the loaded module back
-      // over serial connection
-      /* app_pause(); */
-      /* serial_bfinProgEcho(bfinLdrData, size); */
-      /* app_resume(); */
-
-      // free the buffer!
-      free_mem(bfinLdrData);
-
-      // write module name in global scene data
-      scene_set_module_name(name);
-
-      render_boot("loading labels descriptor...");
-      files_load_labels(name);
-      render_boot("loading module descriptor...");
-      ret = files_load_desc(name);
+      if(sent != size) {
+	// short read: the dsp didn't get the whole module
+	print_dbg("\r\n files_load_dsp_name(): short dsp load, bytes: ");
+	print_dbg_ulong(sent);
+	print_dbg(" / ");
+	print_dbg_ulong(size);
+	ret = 0;
+      } else {
+	// write module name in global scene data
+	scene_set_module_name(name);
+
+	render_boot("loading labels descriptor...");
+	files_load_labels(name);
+	render_boot("loading module descriptor...");
+	ret = files_load_desc(name);
+      }
 
     } else {
       ret = 0;
@@ -265,7 +270,11 @@ u8 files_load_scene_name(const char* name) {
   fp = list_open_file_name(&sceneList, name, "r", &size);
 
   if( fp != NULL) {	  
-    fake_fread((volatile u8*)sceneData, sizeof(sceneData_t), fp);
+    // v2 scenes are only as long as their contents
+    if(size == 0 || size > sizeof(sceneData_t)) {
+      size = sizeof(sceneData_t);
+    }
+    fread_bytes((volatile u8*)sceneData, size, fp);
     /// copy old name back to descriptor field... dirty.
     strncpy(sceneData->desc.moduleName, oldModuleName, MODULE_NAME_LEN);
     fl_fclose(fp);
@@ -312,7 +321,8 @@ void files_store_scene_name(const char* name/*, u8 ext*/) {
   pScene = (u8*)sceneData;
 
 
-  fl_fwrite((const void*)pScene, sizeof(sceneData_t), 1, fp);
+  // only the used part of the buffer
+  fl_fwrite((const void*)pScene, scene_get_buf_size(), 1, fp);
   fl_fclose(fp);
 
 
@@ -343,79 +353,28 @@ const volatile char* files_get_scaler_name(u8 idx) {
 u8 files_load_scaler_name(const char* name, s32* dst, u32 dstSize) {
   void* fp;
   u32 size = 0;
-  u32 i;
-  union { u32 u; s32 s; u8 b[4]; } swap;
+  u32 n;
   u8 ret = 0;
 
   app_pause();
   fp = list_open_file_name(&scalerList, name, "r", &size);
   if( fp != NULL) {	  
-
+    // header word is the entry count
+    fread_bytes((volatile u8*)&size, 4, fp);
 #ifdef SCALER_LE
-    swap.b[3] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[0] = fl_fgetc(fp);
-#else
-    swap.b[0] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[3] = fl_fgetc(fp);
+    swap_bytes_32((u32*)&size, 1);
 #endif
-    size = swap.u;
 
-
-    if(size > dstSize) {
-      for(i=0; i<dstSize; ++i) {
-
-#ifdef SCALER_LE
-    swap.b[3] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[0] = fl_fgetc(fp);
-#else
-    swap.b[0] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[3] = fl_fgetc(fp);
-#endif
-	*dst++ = swap.s;
-      }
-    } else if (size < dstSize) {
-      for(i=0; i<size; ++i) {
+    n = size > dstSize ? dstSize : size;
+    // entries are stored big-endian, so (unless SCALER_LE)
+    // they can go straight from the file into the table.
+    fread_bytes((volatile u8*)dst, n * 4, fp);
 #ifdef SCALER_LE
-    swap.b[3] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[0] = fl_fgetc(fp);
-#else
-    swap.b[0] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[3] = fl_fgetc(fp);
+    swap_bytes_32((u32*)dst, n);
 #endif
-	*dst++ = swap.s;
-      }
-      // remainder
-      size = dstSize - size;
-      for(i=0; i<size; ++i) {
-	*dst++ = 0;
-      }
-    } else {
-      for(i=0; i<size; ++i) {
-#ifdef SCALER_LE
-    swap.b[3] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[0] = fl_fgetc(fp);
-#else
-    swap.b[0] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[3] = fl_fgetc(fp);
-#endif
-	*dst++ = swap.s;
-      }
+    // zero the remainder
+    for(; n < dstSize; ++n) {
+      dst[n] = 0;
     }
     fl_fclose(fp);
     ret = 1;
@@ -539,7 +498,7 @@ extern u8 files_load_labels(const char* name) {
     // get number of parameters
     scaler_start_parse_labels();
     do {
-      fake_fread(&nbuf, 1, fp);
+      fread_bytes(&nbuf, 1, fp);
       scaler_parse_labels_char(nbuf);
     } while (nbuf != 255);
   }
@@ -582,7 +541,7 @@ extern u8 files_load_desc(const char* name) {
   } else {
 
     // get number of parameters
-    fake_fread(nbuf, 4, fp);
+    fread_bytes(nbuf, 4, fp);
     unpickle_32(nbuf, (u32*)&nparams);
 
     print_dbg("\r\n file_load_desc(): nparams = 0x");
@@ -606,7 +565,7 @@ extern u8 files_load_desc(const char* name) {
 	// to be interleaving network and file manipulation like this...
 	///....
 	// read into desc buffer
-	fake_fread(dbuf, PARAM_DESC_PICKLE_BYTES, fp);
+	fread_bytes(dbuf, PARAM_DESC_PICKLE_BYTES, fp);
 	// unpickle directly into network descriptor memory
 	pdesc_unpickle( &desc, dbuf );
 	// copy descriptor to network and increment count
@@ -49,6 +49,8 @@
 //----- static
 // when unset, node activation will not propagate 
 static u8 netActive = 0;
+// set when the compiled routing table needs a rebuild
+static u8 netRouteDirty = 1;
 
 //---- external
 ctlnet_t* net;
@@ -224,6 +226,8 @@ void net_init(void) {
   net->numIns = 0;
   net->numOuts = 0;
   net->numParams = 0;
+  net->propMode = eNetPropRecursive;
+  netRouteDirty = 1;
 
   // unassign all I/O nodes
   for(i=0; i<NET_INS_MAX; i++) {
@@ -256,7 +260,7 @@ void net_deinit(void) {
   net->numIns = 0;
   net->numOuts = 0;
   net->numParams = 0;
-
+  netRouteDirty = 1;
 
   // unassign all I/O nodes
   for(i=0; i<NET_INS_MAX; i++) {
@@ -290,11 +294,185 @@ void net_init_onode(u16 idx) {
   net->outs[idx].target = -1;
 }
 #ifndef PD
+
+// activation counters
+static net_prop_stats_t propStats;
+
+//---- compiled routing
+// flat table of resolved targets, indexed by global input index.
+// a hop is then op->out[i] -> netRoute[] -> indirect call,
+// instead of walking ins[] / ops[] / in_fn[] on every activation.
+// anything that moves inputs, ops or params sets netRouteDirty;
+// the table is rebuilt before the next activation.
+
+// resolved input target
+typedef struct _netRoute {
+  // input function of target op (NULL if param or unused)
+  op_in_fn fn;
+  // target op
+  op_t* op;
+  // param index (-1 if op input or unused)
+  s16 param;
+} netRoute_t;
+
+static netRoute_t netRoute[NET_INS_MAX + NET_PARAMS_MAX];
+
+// rebuild routing table from input / op / param lists
+static void net_route_compile(void) {
+  u32 i;
+  op_t* op;
+  for(i=0; i<net->numIns; ++i) {
+    op = net->ops[net->ins[i].opIdx];
+    netRoute[i].fn = op->in_fn[net->ins[i].opInIdx];
+    netRoute[i].op = op;
+    netRoute[i].param = -1;
+  }
+  for(i=0; i<net->numParams; ++i) {
+    netRoute[net->numIns + i].fn = NULL;
+    netRoute[net->numIns + i].op = NULL;
+    netRoute[net->numIns + i].param = i;
+  }
+  for(i=net->numIns + net->numParams; i<(NET_INS_MAX + NET_PARAMS_MAX); ++i) {
+    netRoute[i].fn = NULL;
+    netRoute[i].op = NULL;
+    netRoute[i].param = -1;
+  }
+  netRouteDirty = 0;
+}
+
+// deliver a value to an input node (op input or DSP param)
+static void net_deliver(s16 inIdx, const io_t val) {
+  const netRoute_t* r = &(netRoute[inIdx]);
+
+  if(r->fn != NULL) {
+    // this is an op input
+    (*(r->fn))(r->op, val);
+  } else if(r->param >= 0) {
+    // this is a parameter
+    set_param_value(r->param, val);
+  } else {
+    return;
+  }
+  ++propStats.delivered;
+
+  /// only process for play mode if we're in play mode
+  if(pageIdx == ePagePlay) {
+    if(opPlay) {
+      // operators have focus, do nothing
+    } else {
+      // process if play-mode-visibility is set on this input
+      if(net_get_in_play(inIdx)) {
+	play_input(inIdx);
+      }
+    }
+  }  
+}
+
+//---- queued propagation
+// activations are pushed to a FIFO instead of being delivered in place.
+// the first activation of an event drains the queue;
+// activations raised by ops while draining are appended and return at once,
+// so stack depth no longer grows with patch depth.
+// each delivery is logged with the delivery that raised it,
+// so an activation whose input is already on its own chain is a feedback loop
+// and is dropped, while fan-in from separate chains is delivered.
+
+// no parent: raised from outside the drain
+#define NET_PROP_ROOT 0xffff
+
+// pending activation
+typedef struct _netAct {
+  s16 inIdx;
+  // delivery that raised it (log index)
+  u16 parent;
+  io_t val;
+} netAct_t;
+
+// delivered activation
+typedef struct _netActLog {
+  s16 inIdx;
+  u16 parent;
+} netActLog_t;
+
+static netAct_t propQ[NET_PROP_QUEUE_SIZE];
+static u8 propRd = 0;
+static u8 propWr = 0;
+// set while draining
+static u8 propBusy = 0;
+// deliveries in the current event
+static netActLog_t propLog[NET_PROP_BUDGET];
+// delivery in progress (log index)
+static u16 propCur = NET_PROP_ROOT;
+
+// non-zero if the input was delivered on the chain leading to this activation
+static inline u8 net_prop_revisit(const netAct_t* act) {
+  u16 p = act->parent;
+  while(p != NET_PROP_ROOT) {
+    if(propLog[p].inIdx == act->inIdx) {
+      return 1;
+    }
+    p = propLog[p].parent;
+  }
+  return 0;
+}
+
+static void net_prop_push(s16 inIdx, const io_t val) {
+  u8 wr = (propWr + 1) & (NET_PROP_QUEUE_SIZE - 1);
+  if(wr == propRd) {
+    ++propStats.overflow;
+    return;
+  }
+  propQ[propWr].inIdx = inIdx;
+  propQ[propWr].parent = propBusy ? propCur : NET_PROP_ROOT;
+  propQ[propWr].val = val;
+  propWr = wr;
+}
+
+static void net_prop_drain(void) {
+  u16 n = 0;
+  netAct_t act;
+  propBusy = 1;
+  while(propRd != propWr) {
+    if(n == NET_PROP_BUDGET) {
+      // drop the rest of this event
+      propStats.budget += (propWr - propRd) & (NET_PROP_QUEUE_SIZE - 1);
+      propRd = propWr;
+      break;
+    }
+    act = propQ[propRd];
+    propRd = (propRd + 1) & (NET_PROP_QUEUE_SIZE - 1);
+    if(net_prop_revisit(&act)) {
+      ++propStats.cycle;
+      continue;
+    }
+    propLog[n].inIdx = act.inIdx;
+    propLog[n].parent = act.parent;
+    propCur = n;
+    ++n;
+    net_deliver(act.inIdx, act.val);
+  }
+  propCur = NET_PROP_ROOT;
+  propBusy = 0;
+}
+
+// route an activation according to the scene's propagation mode
+static void net_dispatch(s16 inIdx, const io_t val) {
+  if(netRouteDirty) {
+    net_route_compile();
+  }
+  if(net->propMode == eNetPropQueue) {
+    net_prop_push(inIdx, val);
+    if(!propBusy) {
+      net_prop_drain();
+    }
+  } else {
+    net_deliver(inIdx, val);
+  }
+}
+
 // activate an input node with a value
 void net_activate(void *op_void, s16 outIdx, const io_t val) {
-  static inode_t* pIn;
-  s16 pIndex;
-  u8 visIn, visOut;
+  u8 visOut;
   op_t *op = (op_t *)op_void;
   s16 inIdx = op->out[outIdx];
 
@@ -337,42 +515,11 @@ void net_activate(void *op_void, s16 outIdx, const io_t val) {
     return;
   }
 
-  visIn = net_get_in_play(inIdx);
-
-  if(inIdx < net->numIns) {      
-    // this is an op input
-    pIn = &(net->ins[inIdx]);
-    
-    op_set_in_val(net->ops[pIn->opIdx],
-		  pIn->opInIdx,
-		  val);
-    
-  } else { 
-    // this is a parameter
-    //// FIXME this is horrible
-    pIndex = inIdx - net->numIns;
-    if (pIndex >= net->numParams) { return; }
-    set_param_value(pIndex, val);
-  }
-
-  /// only process for play mode if we're in play mode
-  if(pageIdx == ePagePlay) {
-    if(opPlay) {
-      // operators have focus, do nothing
-    } else {
-      // process if play-mode-visibility is set on this input
-      if(visIn) {
-	play_input(inIdx);
-      }
-    }
-  }  
+  net_dispatch(inIdx, val);
 }
 
 // activate an input node with a value
 void net_activate_in(s16 inIdx, const io_t val, void* op) {
-  static inode_t* pIn;
-  s16 pIndex;
-  u8 vis;
 
   /* print_dbg("\r\n net_activate, input idx: "); */
   /* print_dbg_hex(inIdx); */
@@ -392,42 +539,31 @@ void net_activate_in(s16 inIdx, const io_t val, void* op) {
     }
   }
 
-
-
   if(inIdx < 0) {
     return;
   }
 
-  vis = net_get_in_play(inIdx);
+  net_dispatch(inIdx, val);
+}
 
-  if(inIdx < net->numIns) {      
-    // this is an op input
-    pIn = &(net->ins[inIdx]);
-    
-    op_set_in_val(net->ops[pIn->opIdx],
-		  pIn->opInIdx,
-		  val);
-    
-  } else { 
-    // this is a parameter
-    //// FIXME this is horrible
-    pIndex = inIdx - net->numIns;
-    if (pIndex >= net->numParams) { return; }
-    set_param_value(pIndex, val);
+// set propagation mode
+void net_set_prop_mode(net_prop_t mode) {
+  if(mode >= eNetPropNumModes) {
+    mode = eNetPropRecursive;
   }
+  // don't switch engines with activations in flight
+  propRd = propWr;
+  net->propMode = mode;
+}
 
-  /// only process for play mode if we're in play mode
-  if(pageIdx == ePagePlay) {
-    if(opPlay) {
-      // operators have focus, do nothing
-    } else {
-      // process if play-mode-visibility is set on this input
-      if(vis) {
-	play_input(inIdx);
-      }
-    }
-  }  
-  
+// get propagation mode
+net_prop_t net_get_prop_mode(void) {
+  return (net_prop_t)(net->propMode);
+}
+
+// get dropped-activation counters
+const net_prop_stats_t* net_get_prop_stats(void) {
+  return &propStats;
 }
 #endif
 
@@ -545,6 +681,7 @@ s16 net_add_op(op_id_t opId) {
   }
 
   ++(net->numOps);
+  netRouteDirty = 1;
   return net->numOps - 1;
 }
 
@@ -675,6 +812,7 @@ s16 net_add_op_at(op_id_t opId, int opIdx) {
       }
     }
   }
+  netRouteDirty = 1;
   return opIdx;
 }
 
@@ -731,6 +869,7 @@ s16 net_pop_op(void) {
   net->numOuts -= op->numOutputs;
 
   net->numOps -= 1;
+  netRouteDirty = 1;
 
   // FIXME: shift preset param data and connections to params, 
   // since they share an indexing list with inputs and we just changed it.
@@ -824,6 +963,7 @@ s16 net_remove_op(const u32 opIdx) {
   for(i=opIdx; i < net->numOps; i++) {
     net->ops[i] = net->ops[i+1];
   }
+  netRouteDirty = 1;
 
   //HACK try re-indexing all outputs
   for(i=0; i<net->numOuts; i++) {
@@ -1226,6 +1366,7 @@ void net_add_param(u32 idx, const ParamDesc * pdesc) {
 
   //  net->params[net->numParams].preset = 0; 
   net->numParams += 1;
+  netRouteDirty = 1;
 
   // query initial value
   val = bfin_get_param(idx);
@@ -1240,6 +1381,13 @@ void net_add_param(u32 idx, const ParamDesc * pdesc) {
 void net_clear_params(void) {
   print_dbg("\r\n clearing parameter list... ");
   net->numParams = 0;
+  netRouteDirty = 1;
+}
+
+// set parameter count
+void net_set_num_params(u32 n) {
+  net->numParams = (u16)n;
+  netRouteDirty = 1;
 }
 
 // resend existing parameter values
@@ -1248,6 +1396,8 @@ void net_send_params(void) {
   for(i=0; i<net->numParams; i++) {
     set_param_value(i, net->params[i].data.value);
   }
+  // send them all in one batch
+  ctl_param_flush();
 }
 
 // retrigger all inputs
@@ -1260,11 +1410,10 @@ void net_send_params(void) {
 /*   netActive = 1; */
 /* } */
 
-// pickle the network!
-u8* net_pickle(u8* dst) {
+// pickle operator list (shared by scene formats)
+static u8* net_pickle_ops(u8* dst) {
   u32 i;
   op_t* op;
-  u32 val = 0;
 
   // write count of operators
   // ( 4 bytes for alignment)
@@ -1280,6 +1429,29 @@ u8* net_pickle(u8* dst) {
       dst = (*(op->pickle))(op, dst);
     }
   }
+  return dst;
+}
+
+// pickle parameter list (shared by scene formats)
+static u8* net_pickle_params(u8* dst) {
+  u32 i;
+
+  // write count of parameters
+  // 4 bytes for alignment
+  dst = pickle_32((u32)(net->numParams), dst);
+
+  // write parameter nodes (includes value and descriptor)
+  for(i=0; i<net->numParams; ++i) {
+    dst = param_pickle(&(net->params[i]), dst);
+  }
+  return dst;
+}
+
+// pickle the network!
+u8* net_pickle(u8* dst) {
+  u32 i;
+
+  dst = net_pickle_ops(dst);
 
   // write input nodes
   //// all nodes, even unused
@@ -1292,24 +1464,49 @@ u8* net_pickle(u8* dst) {
     dst = onode_pickle(&(net->outs[i]), dst);
   }
 
-  // write count of parameters
-  // 4 bytes for alignment
-  val = (u32)(net->numParams);
-  dst = pickle_32(val, dst);
+  return net_pickle_params(dst);
+}
 
-  // write parameter nodes (includes value and descriptor)
-  for(i=0; i<net->numParams; ++i) {
-    dst = param_pickle(&(net->params[i]), dst);
+// pickle the network, v2 scene format.
+// only live input nodes and connected outputs are written.
+u8* net_pickle_v2(u8* dst) {
+  u32 i, count;
+  u8* pCount;
+
+  dst = net_pickle_ops(dst);
+
+  // propagation mode
+  // (4 bytes for alignment)
+  dst = pickle_32((u32)(net->propMode), dst);
+
+  // input play flags, one byte each, for instantiated inputs only
+  dst = pickle_16(net->numIns, dst);
+  for(i=0; i<net->numIns; ++i) {
+    *dst++ = net->ins[i].play;
+  }
+
+  // connections as (output, target) pairs
+  pCount = dst;
+  dst += 2;
+  count = 0;
+  for(i=0; i<net->numOuts; ++i) {
+    if(net->outs[i].target >= 0) {
+      dst = pickle_16((u16)i, dst);
+      dst = pickle_16((u16)(net->outs[i].target), dst);
+      ++count;
+    }
   }
+  pickle_16((u16)count, pCount);
 
-  return dst;
+  return net_pickle_params(dst);
 }
+
 // XXX HACK - we need this global flag to tell grid ops not to grab
 // focus on init during scene recall
 u8 recallingScene = 0;
 
-// unpickle the network!
-u8* net_unpickle(const u8* src) {
+// unpickle operator list (shared by scene formats)
+static const u8* net_unpickle_ops(const u8* src) {
   u32 i, count, val;
   op_id_t id;
   op_t* op;
@@ -1325,6 +1522,8 @@ u8* net_unpickle(const u8* src) {
   // get count of operators
   // (use 4 bytes for alignment)
   src = unpickle_32(src, &count);
+  // v2 scenes follow with the propagation mode, v1 scenes don't store it
+  net->propMode = eNetPropRecursive;
 
   #ifdef PRINT_PICKLE
     print_dbg("\r\n count of ops: ");
@@ -1360,6 +1559,40 @@ u8* net_unpickle(const u8* src) {
       src = (*(op->unpickle))(op, src);
     }
   }
+  return src;
+}
+
+// unpickle parameter list (shared by scene formats)
+static const u8* net_unpickle_params(const u8* src) {
+  u32 i, val;
+
+  // get count of parameters
+  src = unpickle_32(src, &val);
+  net->numParams = (u16)val;
+  netRouteDirty = 1;
+
+#ifdef PRINT_PICKLE
+  print_dbg("\r\n reading params, count: ");
+  print_dbg_ulong(net->numParams);
+#endif
+
+  // read parameter nodes (includes value and descriptor)
+  for(i=0; i<(net->numParams); ++i) {
+#ifdef PRINT_PICKLE
+    print_dbg("\r\n unpickling param, idx: ");
+    print_dbg_ulong(i);
+#endif
+
+    src = param_unpickle(&(net->params[i]), src);
+  }
+  return src;
+}
+
+// unpickle the network!
+u8* net_unpickle(const u8* src) {
+  u32 i;
+
+  src = net_unpickle_ops(src);
 
   /// copy ALL i/o nodes, even unused!
   print_dbg("\r\n reading all input nodes ");
@@ -1379,26 +1612,45 @@ u8* net_unpickle(const u8* src) {
     }
   }
 
+  src = net_unpickle_params(src);
 
-  // get count of parameters
-  src = unpickle_32(src, &val);
-  net->numParams = (u16)val;
+  update_sys_op_pointers();
+  return (u8*)src;
+}
 
-#ifdef PRINT_PICKLE
-  print_dbg("\r\n reading params, count: ");
-  print_dbg_ulong(net->numParams);
-#endif
+// unpickle the network, v2 scene format
+u8* net_unpickle_v2(const u8* src) {
+  u16 i, count, outIdx, target;
+  u32 mode;
 
-  // read parameter nodes (includes value and descriptor)
-  for(i=0; i<(net->numParams); ++i) {
-#ifdef PRINT_PICKLE
-    print_dbg("\r\n unpickling param, idx: ");
-    print_dbg_ulong(i);
-#endif
+  src = net_unpickle_ops(src);
 
-    src = param_unpickle(&(net->params[i]), src);
+  // propagation mode
+  src = unpickle_32(src, &mode);
+  net->propMode = (mode < eNetPropNumModes) ? (u8)mode : eNetPropRecursive;
+
+  // input play flags
+  src = unpickle_16(src, &count);
+  for(i=0; i<count; ++i) {
+    if(i < NET_INS_MAX) {
+      net->ins[i].play = *src;
+    }
+    ++src;
   }
 
+  // connections
+  src = unpickle_16(src, &count);
+  for(i=0; i<count; ++i) {
+    src = unpickle_16(src, &outIdx);
+    src = unpickle_16(src, &target);
+    if(outIdx < net->numOuts) {
+      // reconnect so the parent operator knows what to do
+      net_connect(outIdx, (s16)target);
+    }
+  }
+
+  src = net_unpickle_params(src);
+
   update_sys_op_pointers();
   return (u8*)src;
 }
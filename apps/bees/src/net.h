@@ -26,6 +26,11 @@
 //! max presets
 #define NET_PRESETS_MAX 32
 
+//! queued propagation: pending activations (power of 2, <= 256)
+#define NET_PROP_QUEUE_SIZE 64
+//! queued propagation: max activations delivered per event
+#define NET_PROP_BUDGET 512
+
 ///////////////////////////////////////////
 
 #include "param_common.h"
@@ -36,6 +41,29 @@
 #include "util.h"
 EXTERN_C_BEGIN
 
+//---- types
+
+//! how activations travel through the network
+typedef enum {
+  //! depth-first: each output calls straight into its target
+  eNetPropRecursive = 0,
+  //! breadth-first through a bounded FIFO
+  eNetPropQueue,
+  eNetPropNumModes
+} net_prop_t;
+
+//! activation counters
+typedef struct _net_prop_stats {
+  //! values delivered to op inputs or params
+  u32 delivered;
+  //! queue was full
+  u32 overflow;
+  //! event used up its budget
+  u32 budget;
+  //! input fired again downstream of itself (feedback loop)
+  u32 cycle;
+} net_prop_stats_t;
+
 
 //---- public functions
 
@@ -67,6 +95,12 @@ extern s16 net_remove_op(const u32 idx);
 extern void net_activate(void* op, s16 outIdx, const io_t val);
 extern void net_activate_in(s16 inIdx, const io_t val, void* srcOp);
 
+//! set / get propagation mode (stored with the scene)
+extern void net_set_prop_mode(net_prop_t mode);
+extern net_prop_t net_get_prop_mode(void);
+//! get activation counters
+extern const net_prop_stats_t* net_get_prop_stats(void);
+
 //! get current count of operators
 extern u16 net_num_ops(void);
 
@@ -168,6 +202,9 @@ extern void net_add_param(u32 idx, const ParamDesc* pdesc);
 //! clear existing parameters
 extern void net_clear_params(void);
 
+//! set parameter count (for readers that fill the list in place)
+extern void net_set_num_params(u32 n);
+
 //! resend all parameter values
 extern void net_send_params(void);
 
@@ -188,6 +225,8 @@ extern u32 net_gather(s32 iIdx, u32(*outs)[NET_OUTS_MAX]);
 //! pickle the network!
 //! return incremented pointer to dst
 extern u8* net_pickle(u8* dst);
+//! pickle the network, compact v2 scene format (live nodes only)
+extern u8* net_pickle_v2(u8* dst);
 
 // XXX HACK - we need this global flag to tell grid ops not to
 // grab focus on init during scene recall
@@ -195,6 +234,8 @@ extern u8 recallingScene;
 //! unpickle the network!
 //! return incremented pointer to src
 extern u8* net_unpickle(const u8* src);
+//! unpickle the network, compact v2 scene format
+extern u8* net_unpickle_v2(const u8* src);
 
 //! clear ops and i/o
 extern void net_clear_user_ops(void);
@@ -66,6 +66,8 @@ typedef struct _ctlnet {
   u16 numOuts;
   //! number of instantiated params
   u16 numParams;
+  //! propagation mode (net_prop_t)
+  u8 propMode;
 
   //! inputs
   inode_t ins[NET_INS_MAX];
@@ -114,6 +114,9 @@ void op_bars_init(void* op) {
   bars->reg.data = (u8*) (bars->regData);
 
   region_fill(&(bars->reg), 0);
+
+  // timer (unlinked)
+  bars->timer.next = NULL;
 }
 
 
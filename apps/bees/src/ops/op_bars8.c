@@ -130,6 +130,9 @@ void op_bars8_init(void* op) {
   bars8->reg.data = (u8*) (bars8->regData);
 
   region_fill(&(bars8->reg), 0);
+
+  // timer (unlinked)
+  bars8->timer.next = NULL;
 }
 
 
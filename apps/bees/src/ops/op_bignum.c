@@ -115,6 +115,9 @@ void op_bignum_init(void* op) {
   bignum->reg.data = (u8*) (bignum->regData);
 
   region_fill(&(bignum->reg), 0);
+
+  // timer (unlinked)
+  bignum->timer.next = NULL;
 }
 
 
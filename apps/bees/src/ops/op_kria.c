@@ -269,6 +269,8 @@ void op_kria_init(void* mem) {
   // init monome drawing
   kria_refresh(&op->monome);
 
+  // timer (unlinked)
+  op->timer.next = NULL;
   op_kria_set_timer(op);
   timer_add(&note0offTimer,10000,&note0offTimer_callback, op);
   timer_add(&note1offTimer,10000,&note1offTimer_callback, op);
@@ -110,6 +110,9 @@ void op_screen_init(void* op) {
   screen->reg.data = (u8*) (screen->regData);
 
   region_fill(&(screen->reg), 0);
+
+  // timer (unlinked)
+  screen->timer.next = NULL;
 }
 
 
@@ -216,6 +216,8 @@ void op_ww_init(void* mem) {
   // init monome drawing
   op_ww_redraw(&op->monome);
 
+  // timer (unlinked)
+  op->timer.next = NULL;
   op_ww_set_timer(op);
 }
 
@@ -20,6 +20,8 @@ parameters / inputs: presets make no distincation between DSP paraemters and op
 #ifdef ARCH_AVR32
 #include "print_funcs.h"
 #endif
+// avr32
+#include "control.h"
 // bees
 #include "net_protected.h"
 #include "pages.h"
@@ -185,6 +187,9 @@ void preset_recall(u32 preIdx) {
   /* } */
 
   
+  // send all recalled param values as one batch
+  ctl_param_flush();
+
   /// process for play mode if we're in play mode
   if(pageIdx == ePagePlay) {
     play_preset(preIdx);
@@ -347,6 +352,90 @@ const u8* presets_unpickle(const u8* src) {
   return src;
 }
 
+// pickle presets, v2 scene format.
+// only enabled entries are written, as (index, value) pairs.
+u8* presets_pickle_v2(u8* dst) {
+  u32 i, j, count;
+  u8* pCount;
+
+  dst = pickle_16(NET_PRESETS_MAX, dst);
+  for(i=0; i<NET_PRESETS_MAX; i++) {
+    // name
+    for(j=0; j<PRESET_NAME_LEN; j++) {
+      *dst++ = presets[i].name[j];
+    }
+    // enabled inputs
+    pCount = dst;
+    dst += 2;
+    count = 0;
+    for(j=0; j < PRESET_INODES_COUNT; ++j) {
+      if(presets[i].ins[j].enabled) {
+	dst = pickle_16((u16)j, dst);
+	dst = pickle_16((u16)(presets[i].ins[j].value), dst);
+	++count;
+      }
+    }
+    pickle_16((u16)count, pCount);
+    // enabled outputs
+    pCount = dst;
+    dst += 2;
+    count = 0;
+    for(j=0; j<NET_OUTS_MAX; j++) {
+      if(presets[i].outs[j].enabled) {
+	dst = pickle_16((u16)j, dst);
+	dst = pickle_16((u16)(presets[i].outs[j].target), dst);
+	++count;
+      }
+    }
+    pickle_16((u16)count, pCount);
+  }
+  return dst;
+}
+
+// unpickle, v2 scene format
+const u8* presets_unpickle_v2(const u8* src) {
+  u16 i, j, numPresets, count, idx, v16;
+
+  src = unpickle_16(src, &numPresets);
+  for(i=0; i<numPresets; i++) {
+    if(i < NET_PRESETS_MAX) {
+      preset_clear(i);
+    }
+    // name
+    for(j=0; j<PRESET_NAME_LEN; j++) {
+      if(i < NET_PRESETS_MAX) {
+	presets[i].name[j] = *src;
+      }
+      ++src;
+    }
+    // enabled inputs
+    src = unpickle_16(src, &count);
+    for(j=0; j<count; j++) {
+      src = unpickle_16(src, &idx);
+      src = unpickle_16(src, &v16);
+      if(i < NET_PRESETS_MAX && idx < PRESET_INODES_COUNT) {
+	presets[i].ins[idx].value = (io_t)v16;
+	presets[i].ins[idx].enabled = 1;
+      }
+    }
+    // enabled outputs
+    src = unpickle_16(src, &count);
+    for(j=0; j<count; j++) {
+      src = unpickle_16(src, &idx);
+      src = unpickle_16(src, &v16);
+      if(i < NET_PRESETS_MAX && idx < NET_OUTS_MAX) {
+	presets[i].outs[idx].target = (s16)v16;
+	presets[i].outs[idx].enabled = 1;
+      }
+    }
+  }
+  // any presets not in the file stay cleared
+  for(; i<NET_PRESETS_MAX; i++) {
+    preset_clear(i);
+  }
+  return src;
+}
+
 // get current read/write selection
 s32 preset_get_select(void) {
   return select;
@@ -76,6 +76,9 @@ extern char* preset_name(u32 id);
 extern u8* presets_pickle(u8* dst);
 // unpickle
 extern const u8* presets_unpickle(const u8* src);
+// pickle / unpickle, compact v2 scene format (enabled entries only)
+extern u8* presets_pickle_v2(u8* dst);
+extern const u8* presets_unpickle_v2(const u8* src);
 
 // get current read/write selection index
 extern s32 preset_get_select(void);
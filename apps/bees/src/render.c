@@ -113,6 +113,17 @@ void region_update(region* r) {
   }
 }
 
+#ifdef BEEKEEP
+// compose a dirty region, to be sent with the next flush.
+// the compositor is in the avr32_sim screen driver, not libavr32
+static void region_compose(region* r) {
+  if(r->dirty) {
+    screen_compose_region(r->x, r->y, r->w, r->h, r->data);
+    r->dirty = 0;
+  }
+}
+#endif
+
 
 //-----------------------
 //---- extern functions
@@ -163,6 +174,21 @@ extern void render_boot(const char* str) {
 void render_update(void) {
   //  app_pause();
 
+#ifdef BEEKEEP
+  // scrolling region
+  if((pageCenterScroll->reg)->dirty) {
+    scroll_compose(pageCenterScroll);
+  }
+  // standard regions
+  region_compose(headRegion);
+  region_compose(footRegion[0]);
+  region_compose(footRegion[1]);
+  region_compose(footRegion[2]);
+  region_compose(footRegion[3]);
+  region_compose(customRegion);
+  // send only what changed
+  screen_flush();
+#else
   // scrolling region
   if((pageCenterScroll->reg)->dirty) {
     scroll_draw(pageCenterScroll);
@@ -174,6 +200,7 @@ void render_update(void) {
   region_update(footRegion[2]);
   region_update(footRegion[3]);
   region_update(customRegion);
+#endif
 
   //  app_resume();
 }
@@ -36,6 +36,11 @@
 #include "types.h"
 
 
+// first word of a v2 scene pickle.
+// v1 scenes start with the scene name, and the low byte here is not ASCII.
+// (high byte bumped when the propagation mode got its own field)
+#define SCENE_PICKLE_MAGIC 0x03c5e5be
+
 #define DEFAULT_SCENE_NAME "default"
 #define CLEAN_SCENE_NAME "clean"
 /// FIXME: this is silly, 
@@ -48,6 +53,12 @@
 // RAM buffer for scene data
 sceneData_t* sceneData;
 
+//-----------------------------
+// ---- static data
+
+// bytes used in pickle by last scene_write_buf()
+static u32 scenePickleBytes = SCENE_PICKLE_SIZE;
+
 //----------------------------------------------
 //----- extern functions
 
@@ -108,6 +119,10 @@ void scene_write_buf(void) {
 
   print_dbg("\r\n writing scene data... ");
 
+  // v2 format tag
+  dst = pickle_32(SCENE_PICKLE_MAGIC, dst);
+  bytes += 4;
+
   // write name
   for(i=0; i<SCENE_NAME_LEN; i++) {
     *dst = sceneData->desc.sceneName[i];
@@ -150,18 +165,19 @@ for(i=0; i<MODULE_NAME_LEN; i++) {
   bytes += 4;
   
   // pickle network
-  newDst = net_pickle(dst);
+  newDst = net_pickle_v2(dst);
   bytes += (newDst - dst);
   print_dbg("\r\n pickled network, bytes written: 0x");
   print_dbg_hex(bytes);
   dst = newDst;
 
   // pickle presets
-  newDst = presets_pickle(dst);
+  newDst = presets_pickle_v2(dst);
   bytes += (newDst - dst);
   print_dbg("\r\n pickled presets, bytes written: 0x");
   print_dbg_hex(bytes);
   dst = newDst;
+  scenePickleBytes = bytes;
 
 #if RELEASEBUILD==1
 #else
@@ -186,9 +202,18 @@ void scene_read_buf(void) {
   ModuleVersion moduleVersion;
   u8 moduleLoadStatus;
   ////
+  u32 magic;
+  u8 v2 = 0;
 
    app_pause();
 
+   // v2 scenes are tagged, v1 scenes start with the name
+   unpickle_32(src, &magic);
+   if(magic == SCENE_PICKLE_MAGIC) {
+     v2 = 1;
+     src += 4;
+   }
+
   // store current mod name in scene desc
    //  memcpy(modName, sceneData->desc.moduleName, MODULE_NAME_LEN);
    
@@ -309,12 +334,20 @@ void scene_read_buf(void) {
   // unpickle network 
   render_boot("reading network");
   print_dbg("\r\n unpickling network for scene recall...");
-  src = net_unpickle(src);
+  if(v2) {
+    src = net_unpickle_v2(src);
+  } else {
+    src = net_unpickle(src);
+  }
     
   // unpickle presets
   render_boot("reading presets");
   print_dbg("\r\n unpickling presets for scene recall...");
-  src = presets_unpickle(src);
+  if(v2) {
+    src = presets_unpickle_v2(src);
+  } else {
+    src = presets_unpickle(src);
+  }
 
   render_boot("scene data stored in RAM");
   print_dbg("\r\n copied stored network and presets to RAM ");
@@ -422,4 +455,10 @@ const char* scene_get_name(void) {
 // get module name
 const char* scene_get_module_name(void) {
   return sceneData->desc.moduleName;
-}
\ No newline at end of file
+}
+
+// get size of scene data filled by last scene_write_buf(),
+// counting from the start of sceneData
+u32 scene_get_buf_size(void) {
+  return (u32)((u8*)(sceneData->pickle) - (u8*)sceneData) + scenePickleBytes;
+}
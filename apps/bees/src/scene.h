@@ -72,6 +72,8 @@ extern void scene_deinit(void);
 extern void scene_write_buf(void);
 // set current state of system from global RAM buffer
 extern void scene_read_buf(void);
+// bytes of RAM buffer used by last scene_write_buf()
+extern u32 scene_get_buf_size(void);
 
 // write current state as default
 extern void scene_write_default(void);
@@ -73,20 +73,10 @@ static const char* list_get_name(dirList_t* list, u8 idx);
 static void* list_open_file_name(dirList_t* list, const char* name, const char* mode, u32* size);
 
 
-// fake fread: no size arg, always byte
-static void fake_fread(volatile u8* dst, u32 len, void* fp) {
-  u32 n = 0;
-#if 0
-  // this seems to fail with files over a certain size, or something.
-  // weird because fl_fgetc is just a call to fl_fread with size=1, data=1.
-  fl_fread(&dst, 1, len, fp);
-#else
-  while(n < len) {
-    *dst = fl_fgetc(fp);
-    n++;
-    dst++;
-  }
-#endif
+// ldr_stream source: read a chunk from an open file
+static u32 fread_chunk(void* fp, u8* dst, u32 len) {
+  int n = fl_fread(dst, 1, len, fp);
+  return n > 0 ? (u32)n : 0;
 }
 
 // strip space from the end of a string
@@ -174,9 +164,9 @@ u8 files_load_dsp(u8 idx) {
 u8 files_load_dsp_name(const char* name) {
   void* fp;
   u32 size = 0;
+  u32 sent;
   u8 ret;
   //  char nameTry[DIR_LIST_NAME_LEN];
-  volatile u8* bfinLdrData = NULL;
 
   delay_ms(10);
   app_pause();
@@ -187,22 +177,21 @@ u8 files_load_dsp_name(const char* name) {
 
     if(size > 0) {
 
-      // allocate a RAM buffer
-      bfinLdrData = alloc_mem(size);
-      fake_fread(bfinLdrData, size, fp);
+      // reboot the dsp, streaming the firmware from the card
+      // (two sectors at a time; no RAM copy of the whole file)
+      sent = bfin_load_stream(&fread_chunk, fp, size);
       fl_fclose(fp);
 
-      // reboot the dsp with new firmware in RAM
-      bfin_load_buf((const u8*)bfinLdrData, size);
-
-      // DEBUG uncomment this to send the loaded module back
-      // over serial connection
-      /* app_pause(); */
-      /* serial_bfinProgEcho(bfinLdrData, size); */
-      /* app_resume(); */
-
-      // free the buffer!
-      free_mem(bfinLdrData);
+      if(sent != size) {
+	// short read: the dsp didn't get the whole module
+	print_dbg("\r\n files_load_dsp_name(): short dsp load, bytes: ");
+	print_dbg_ulong(sent);
+	print_dbg(" / ");
+	print_dbg_ulong(size);
+	ret = 0;
+      } else {
+	ret = 1;
+      }
 
     } else {
       ret = 0;
@@ -9,16 +9,19 @@
 #include "compiler.h"
 #include "delay.h"
 #include "gpio.h"
+#include "pdca.h"
 #include "spi.h"
 
 // aleph/common
 #include "module_common.h"
+#include "param_batch.h"
 #include "param_common.h"
 #include "protocol.h"
 
 // aleph/avr32
 #include "conf_board.h"
 #include "app.h"
+#include "control.h"
 #include "filesystem.h"
 #include "debug.h"
 
@@ -38,6 +41,33 @@ static void bfin_end_transfer(void);
 static void bfin_transfer_byte(u8 data);
 static u32 ldrCurrentByte = 0;
 
+// boot port sink for ldr_stream
+static void bfin_sink_begin(LdrSink* sink, u32 size);
+static void bfin_sink_write(LdrSink* sink, const u8* data, u32 len);
+static void bfin_sink_flush(LdrSink* sink);
+static void bfin_sink_end(LdrSink* sink);
+static void bfin_sink_poll(void);
+// chunk being sent
+static const u8* ldrChunk = NULL;
+static u32 ldrChunkBytes = 0;
+// ping-pong buffers
+static LdrStreamBufs ldrBufs;
+
+// encoded batch message
+static u8 batchBuf[PARAM_BATCH_BYTES(PARAM_BATCH_MAX)];
+
+// queued frames, sent by DMA
+static BfinTxRing txRing;
+// bytes in the DMA transfer in progress (0 == idle)
+static volatile u16 txBusy = 0;
+// chip select is held for queued frames
+static volatile u8 txSelected = 0;
+// chip register, as set up for the blocking transfers
+static u32 txCsr;
+static void bfin_tx_kick(void);
+static void bfin_tx_select(void);
+static void bfin_tx_unselect(void);
+
 //---------------------------------------
 //--- external function definition
 
@@ -56,8 +86,12 @@ void bfin_load_buf(const u8* data, const u32 size) {
 
     print_dbg("\r\n loading dsp...");
 
+    bfin_tx_flush();
     app_pause();
 
+    // queued changes were meant for the old module
+    ctl_param_clear();
+
     ldrCurrentByte = 0;
     bfin_start_transfer();
 
@@ -74,10 +108,29 @@ void bfin_load_buf(const u8* data, const u32 size) {
     print_dbg("\r\n ... done loading.");
 }
 
+// load bfin executable in chunks from a reader
+u32 bfin_load_stream(ldr_read_fn read, void* src, u32 size) {
+    LdrSink sink = {
+        .begin = &bfin_sink_begin,
+        .write = &bfin_sink_write,
+        .flush = &bfin_sink_flush,
+        .end = &bfin_sink_end,
+        .ctx = NULL,
+    };
+    u32 sent;
+
+    print_dbg("\r\n streaming dsp...");
+    sent = ldr_stream(read, src, &sink, &ldrBufs, size);
+    print_dbg("\r\n ... done loading.");
+    return sent;
+}
+
 void bfin_set_param(u8 idx, fix16_t x) {
     ParamValueSwap pval;
     pval.asInt = (s32)x;
 
+    bfin_tx_flush();
+
     /* print_dbg("\r\n bfin_set_param; idx: "); */
     /* print_dbg_hex(idx); */
     /* print_dbg(" ; val: "); */
@@ -119,9 +172,51 @@ void bfin_set_param(u8 idx, fix16_t x) {
     //  app_resume();
 }
 
+// set many parameter values in a single chip-select burst
+u8 bfin_set_params(const u8* idx, const ParamValue* val, u8 count) {
+    u32 bytes;
+
+    if (count == 0) { return 0; }
+    bytes = param_batch_encode(batchBuf, idx, val, count);
+    return bfin_tx_frame(batchBuf, (u16)bytes, NULL, 0);
+}
+
+u8 bfin_tx_frame(const u8* data, u16 len, bfin_tx_done_fn done, u32 arg) {
+    u8 ret = bfin_tx_push(&txRing, data, len, done, arg);
+    bfin_tx_poll();
+    return ret;
+}
+
+void bfin_tx_poll(void) {
+    irqflags_t flags;
+    // the DMA handler also kicks
+    flags = cpu_irq_save();
+    bfin_tx_kick();
+    cpu_irq_restore(flags);
+    bfin_tx_reap(&txRing);
+}
+
+void bfin_tx_flush(void) {
+    while (!bfin_tx_idle(&txRing)) { bfin_tx_poll(); }
+    bfin_tx_unselect();
+    // discard what came back on MISO during the DMA runs
+    (void)(BFIN_SPI->rdr);
+}
+
+// never waits: the SPI spaces the bytes, and a low READY
+// (a full param queue) leaves the rest to the main loop's poll.
+void bfin_tx_dma_done(void) {
+    pdca_disable_interrupt_transfer_complete(BFIN_TX_PDCA_CHANNEL);
+    pdca_disable(BFIN_TX_PDCA_CHANNEL);
+    bfin_tx_advance(&txRing, txBusy);
+    txBusy = 0;
+    bfin_tx_kick();
+}
+
 void bfin_get_num_params(volatile u32* num) {
     u16 x;
 
+    bfin_tx_flush();
     app_pause();
 
     // command
@@ -149,6 +244,7 @@ void bfin_get_module_name(volatile char* buf) {
     u16 x;  // u16 for spi_read()
     u8 i;
 
+    bfin_tx_flush();
     app_pause();
 
     // command
@@ -170,6 +266,7 @@ void bfin_get_module_name(volatile char* buf) {
 void bfin_get_module_version(ModuleVersion* vers) {
     u16 x;
 
+    bfin_tx_flush();
     app_pause();
 
     // command
@@ -211,6 +308,7 @@ void bfin_get_module_version(ModuleVersion* vers) {
 }
 
 void bfin_enable(void) {
+    bfin_tx_flush();
     // enable audio processing
     spi_selectChip(BFIN_SPI, BFIN_SPI_NPCS);
     spi_write(BFIN_SPI, MSG_ENABLE_AUDIO);
@@ -218,6 +316,7 @@ void bfin_enable(void) {
 }
 
 void bfin_disable(void) {
+    bfin_tx_flush();
     // disable audio processing
     spi_selectChip(BFIN_SPI, BFIN_SPI_NPCS);
     spi_write(BFIN_SPI, MSG_DISABLE_AUDIO);
@@ -232,6 +331,53 @@ static void bfin_transfer_byte(u8 data) {
     spi_write(BFIN_SPI, data);
 }
 
+// send the next chunk by DMA if the link is free and the bfin is ready.
+// call with the DMA interrupt masked (or from its handler.)
+// the bfin reads each byte in an ISR with no FIFO behind it;
+// the chip select stays active with a wide gap between bytes,
+// which the SPI keeps across chunks and frames as well.
+static void bfin_tx_kick(void) {
+    const u8* data;
+    u16 n;
+    u8 first;
+
+    if (txBusy) { return; }
+    n = bfin_tx_chunk(&txRing, &data, &first);
+    if (n == 0) { return; }
+    // the next poll will try again
+    if (!gpio_get_pin_value(BFIN_READY_PIN)) { return; }
+    if (n > BFIN_TX_CHUNK_MAX) { n = BFIN_TX_CHUNK_MAX; }
+    bfin_tx_select();
+    txBusy = n;
+    pdca_load_channel(BFIN_TX_PDCA_CHANNEL, (void*)data, n);
+    pdca_enable_interrupt_transfer_complete(BFIN_TX_PDCA_CHANNEL);
+    pdca_enable(BFIN_TX_PDCA_CHANNEL);
+}
+
+// select the bfin for queued frames, with the byte gap set
+static void bfin_tx_select(void) {
+    volatile u32* csr = &(BFIN_SPI->csr0) + BFIN_SPI_NPCS;
+    u32 dlybct;
+    if (txSelected) { return; }
+    // delay between bytes is 32 * DLYBCT peripheral clocks
+    dlybct = ((u32)BFIN_TX_BYTE_GAP_US * (FPBA_HZ / 1000000) + 31) / 32;
+    if (dlybct > 0xff) { dlybct = 0xff; }
+    txCsr = *csr;
+    *csr = (txCsr & ~AVR32_SPI_CSR0_DLYBCT_MASK)
+        | (dlybct << AVR32_SPI_CSR0_DLYBCT_OFFSET);
+    spi_selectChip(BFIN_SPI, BFIN_SPI_NPCS);
+    txSelected = 1;
+}
+
+// release the bfin after queued frames (main loop only; waits for the shifter)
+static void bfin_tx_unselect(void) {
+    volatile u32* csr = &(BFIN_SPI->csr0) + BFIN_SPI_NPCS;
+    if (!txSelected) { return; }
+    spi_unselectChip(BFIN_SPI, BFIN_SPI_NPCS);
+    *csr = txCsr;
+    txSelected = 0;
+}
+
 void bfin_start_transfer(void) {
     print_dbg("\r\n resetting blackfin...");
     gpio_set_gpio_pin(BFIN_RESET_PIN);
@@ -245,6 +391,46 @@ void bfin_start_transfer(void) {
 
 void bfin_end_transfer(void) { spi_unselectChip(BFIN_SPI, BFIN_SPI_NPCS); }
 
+static void bfin_sink_begin(LdrSink* sink, u32 size) {
+    bfin_tx_flush();
+    app_pause();
+    // queued changes were meant for the old module
+    ctl_param_clear();
+    ldrChunk = NULL;
+    ldrChunkBytes = 0;
+    ldrCurrentByte = 0;
+    bfin_start_transfer();
+    // send from the current chunk while the SD read is in flight
+    fsWaitHook = &bfin_sink_poll;
+}
+
+static void bfin_sink_write(LdrSink* sink, const u8* data, u32 len) {
+    ldrChunk = data;
+    ldrChunkBytes = len;
+    ldrCurrentByte = 0;
+}
+
+static void bfin_sink_flush(LdrSink* sink) {
+    while (ldrCurrentByte < ldrChunkBytes) {
+        bfin_transfer_byte(ldrChunk[ldrCurrentByte]);
+        ldrCurrentByte++;
+    }
+}
+
+static void bfin_sink_end(LdrSink* sink) {
+    fsWaitHook = NULL;
+    bfin_end_transfer();
+    app_resume();
+}
+
+// send at most one byte, so the SD wait loop stays responsive
+static void bfin_sink_poll(void) {
+    if (ldrCurrentByte < ldrChunkBytes) {
+        bfin_transfer_byte(ldrChunk[ldrCurrentByte]);
+        ldrCurrentByte++;
+    }
+}
+
 // wait for ready status (e.g. after module init)
 void bfin_wait_ready(void) {
     // use ready pin
@@ -259,6 +445,7 @@ s32 bfin_get_param(u8 idx) {
     ParamValueSwap pval;
     u16 x;
 
+    bfin_tx_flush();
     app_pause();
     bfin_wait();
 
@@ -316,6 +503,7 @@ s32 bfin_get_audio_cpu(void) {
 
     print_dbg("\r\n requesting audio cpu use...");
 
+    bfin_tx_flush();
     bfin_wait();
 
     spi_selectChip(BFIN_SPI, BFIN_SPI_NPCS);
@@ -367,6 +555,7 @@ s32 bfin_get_control_cpu(void) {
     ParamValueSwap pval;
     u16 x;
 
+    bfin_tx_flush();
     app_pause();
     bfin_wait();
 
@@ -404,6 +593,7 @@ s32 bfin_get_control_cpu(void) {
 void bfin_fill_buffer(const s32* src, u32 bytes) {
     u16 x;
 
+    bfin_tx_flush();
     app_pause();
     spi_selectChip(BFIN_SPI, BFIN_SPI_NPCS);
     spi_write(BFIN_SPI, MSG_FILL_BUFFER_COM);
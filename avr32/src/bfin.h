@@ -8,22 +8,55 @@
 #define _BFIN_H_
 
 #include "compiler.h"
+#include "bfin_tx.h"
 #include "fix.h"
+#include "ldr_stream.h"
 #include "module_common.h"
 #include "param_common.h"
 
 //! max size of blackfin ldr file
 #define BFIN_LDR_MAX_BYTES 0x12000
 
+//! DMA channel for queued frames to the bfin (0 and 1 are the sdcard)
+#define BFIN_TX_PDCA_CHANNEL 2
+#define BFIN_TX_PDCA_PID AVR32_PDCA_PID_SPI0_TX
+//! gap the SPI inserts between DMA bytes, so the bfin's SPI ISR
+//! takes each byte before the next; covers an audio frame.
+#define BFIN_TX_BYTE_GAP_US 30
+//! most bytes per DMA load; READY is checked between loads
+#define BFIN_TX_CHUNK_MAX 32
+
 //! wait for busy pin to clear
 void bfin_wait(void);
 
 //! load bfin from RAM buffer
 void bfin_load_buf(const u8* data, const u32 size);
 
+//! load bfin by streaming chunks from a reader (see ldr_stream.h).
+//! bytes go out to the boot port while the next chunk is being read.
+//! returns the number of bytes sent.
+u32 bfin_load_stream(ldr_read_fn read, void* src, u32 size);
+
 //! set a parameter value
 void bfin_set_param(U8 idx, fix16_t val);
 
+//! queue many parameter values as one batch message (see param_batch.h).
+//! returns 0, or 1 if the transmit ring is full (nothing queued).
+u8 bfin_set_params(const u8* idx, const ParamValue* val, u8 count);
+
+//! queue a frame for the bfin (see bfin_tx.h).
+//! never blocks; returns 0, or 1 if the transmit ring is full.
+u8 bfin_tx_frame(const u8* data, u16 len, bfin_tx_done_fn done, u32 arg);
+
+//! start queued transfers and run callbacks for finished frames
+void bfin_tx_poll(void);
+
+//! block until every queued frame has been sent
+void bfin_tx_flush(void);
+
+//! PDCA transfer-complete handler for the transmit channel
+void bfin_tx_dma_done(void);
+
 //! get a parameter value
 fix16_t bfin_get_param(u8 idx);
 
@@ -6,10 +6,77 @@
 #include "control.h"
 #include "delay.h"
 
+//---------------------------------------------
+//---- static variables
+
+// pending param indices, in order of first request
+static u8 pendIdx[CTL_PARAMS_MAX];
+// pending param values
+static ParamValue pendVal[CTL_PARAMS_MAX];
+// position of each param in the pending list (+1; 0 == not pending)
+static u16 pendPos[CTL_PARAMS_MAX];
+// count of pending changes
+static u16 pendCount = 0;
+
+// remove the first n pending changes
+static void ctl_param_drop(u16 n);
+
+//---------------------------------------------
+//---- extern functions
+
 // request a parameter change.
+// changes are held until the next ctl_param_flush(),
+// and repeated requests for the same param only keep the latest value.
 extern u8 ctl_param_change(u32 idx, u32 val) {
-    bfin_wait_ready();
-    delay_us(50);
-    bfin_set_param(idx, val);
+    u16 pos;
+    if (idx >= CTL_PARAMS_MAX) { return 1; }
+    pos = pendPos[idx];
+    if (pos > 0) {
+        pendVal[pos - 1] = (ParamValue)val;
+    } else {
+        pendIdx[pendCount] = (u8)idx;
+        pendVal[pendCount] = (ParamValue)val;
+        ++pendCount;
+        pendPos[idx] = pendCount;
+    }
     return 0;
 }
+
+// queue pending parameter changes for the bfin.
+// never waits on the bus: changes that don't fit in the transmit ring
+// stay pending (and keep coalescing) until the next call.
+extern void ctl_param_flush(void) {
+    u16 n;
+    bfin_tx_poll();
+    while (pendCount > 0) {
+        n = pendCount;
+        if (n > PARAM_BATCH_MAX) { n = PARAM_BATCH_MAX; }
+        if (bfin_set_params(pendIdx, pendVal, (u8)n)) { break; }
+        ctl_param_drop(n);
+    }
+}
+
+// discard all pending parameter changes.
+extern void ctl_param_clear(void) {
+    u16 i;
+    for (i = 0; i < pendCount; ++i) {
+        pendPos[pendIdx[i]] = 0;
+    }
+    pendCount = 0;
+}
+
+//---------------------------------------------
+//---- static functions
+
+static void ctl_param_drop(u16 n) {
+    u16 i;
+    for (i = 0; i < n; ++i) {
+        pendPos[pendIdx[i]] = 0;
+    }
+    pendCount -= n;
+    for (i = 0; i < pendCount; ++i) {
+        pendIdx[i] = pendIdx[i + n];
+        pendVal[i] = pendVal[i + n];
+        pendPos[pendIdx[i]] = i + 1;
+    }
+}
@@ -1,15 +1,13 @@
-
 /*
   control.h
   avr32
   aleph
 
-  FIXME:
-  duplicating param change queue from the blackfin.
-  this is decidedly sub-optimal but lets get things working.
-
   parameter changes are stored in a set structure.
-  maximum one request per parameter enters the queue
+  maximum one request per parameter enters the queue;
+  the queue is handed to the transmit ring as a single batch message
+  (see param_batch.h, bfin_tx.h) once per pass of the event loop;
+  if the ring is full the changes wait for the next pass.
 
  */
 
@@ -17,14 +15,24 @@
 #define _ALEPH_BFIN_CONTROL_H_
 
 //#include "module_custom.h"
+#include "param_batch.h"
 #include "param_common.h"
 #include "types.h"
 
 //---------------------------------------------
 //---- definitions / types
 
+// param indices are single bytes on the wire
+#define CTL_PARAMS_MAX 256
+
 // add param change to buffer
 /// FIXME: uh will this work for params < 0 ?
 extern u8 ctl_param_change(u32 param, u32 value);
 
+// queue pending param changes for the bfin (never blocks)
+extern void ctl_param_flush(void);
+
+// discard all pending param changes
+extern void ctl_param_clear(void);
+
 #endif  // h guard
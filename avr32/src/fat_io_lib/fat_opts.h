@@ -26,7 +26,7 @@
 
 // Number of sectors per FAT_BUFFER (min 1)
 #ifndef FAT_BUFFER_SECTORS
-#define FAT_BUFFER_SECTORS 1
+#define FAT_BUFFER_SECTORS 4
 #endif
 
 // Max FAT sectors to buffer (min 1)
@@ -38,7 +38,9 @@
 // Size of cluster chain cache (can be undefined)
 // Mem used = FAT_CLUSTER_CACHE_ENTRIES * 4 * 2
 // Improves access speed considerably
-//#define FAT_CLUSTER_CACHE_ENTRIES         128
+#ifndef FAT_CLUSTER_CACHE_ENTRIES
+#define FAT_CLUSTER_CACHE_ENTRIES 128
+#endif
 
 // Include support for writing files (1 / 0)?
 #ifndef FATFS_INC_WRITE_SUPPORT
@@ -23,6 +23,9 @@ volatile U8 pdcaTxBuf[FS_BUF_SIZE];
 // Used to indicate the end of PDCA transfer
 volatile u8 fsEndTransfer;
 
+// work to do while waiting on a read
+void (*fsWaitHook)(void) = NULL;
+
 //---- static
 // PDCA Channel pointer
 volatile avr32_pdca_channel_t *pdcaRxChan;
@@ -36,7 +39,7 @@ int media_read(unsigned long sector, unsigned char *buffer,
                unsigned long sector_count);
 int media_read(unsigned long sector, unsigned char *buffer,
                unsigned long sector_count) {
-    unsigned long i;
+    unsigned long i, j;
 
     for (i = 0; i < sector_count; i++) {
         pdca_load_channel(AVR32_PDCA_CHANNEL_SPI_RX, &pdcaRxBuf, FS_BUF_SIZE);
@@ -59,11 +62,12 @@ int media_read(unsigned long sector, unsigned char *buffer,
             pdcaTxChan->cr = AVR32_PDCA_TEN_MASK;  // and TX PDCA transfer
             // wait for signal from ISR
             while (!fsEndTransfer) {
-                ;
-                ;
+                if (fsWaitHook != NULL) { (*fsWaitHook)(); }
             }
-            // copy FIXME: could optimize away
-            for (i = 0; i < FS_BUF_SIZE; i++) { buffer[i] = pdcaRxBuf[i]; }
+            // copy out of the DMA buffer.
+            // (use a separate index: reusing the sector counter here
+            // cut every multi-sector read short after the first sector.)
+            for (j = 0; j < FS_BUF_SIZE; j++) { buffer[j] = pdcaRxBuf[j]; }
         } else {
             print_dbg("\r\n error opening PDCA at sector ");
             print_dbg_ulong(sector);
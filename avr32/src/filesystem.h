@@ -10,6 +10,9 @@
 //==== vars
 // transfer-done flag
 extern volatile u8 fsEndTransfer;
+// if set, called repeatedly while waiting on a sector read
+// (lets other SPI traffic overlap the DMA; runs in the caller's context)
+extern void (*fsWaitHook)(void);
 // Local RAM buffer to store data  to/from the SD/MMC card
 extern volatile U8 pdcaRxBuf[FS_BUF_SIZE];
 extern volatile U8 pdcaTxBuf[FS_BUF_SIZE];
@@ -3,6 +3,12 @@
 
 #include "types.h"
 
+// string cache counters
+typedef struct _fontAaStats {
+  u32 hits;
+  u32 misses;
+} fontAaStats;
+
 
 // render an anti-aliased (4-bit) glyph to a buffer
 // arguments are character, buffer, target row size, invert flag
@@ -11,4 +17,8 @@ extern u8* font_glyph_aa(char ch, u8* buf, u8 w, u8 invert);
 // render a string of ant-aliased glyphs to a buffer
 extern u8* font_string_aa(const char* str, u8* buf, u32 size, u8 w, u8 invert);
 
+// string cache counters
+extern void font_aa_get_stats(fontAaStats* st);
+extern void font_aa_clear_stats(void);
+
 #endif
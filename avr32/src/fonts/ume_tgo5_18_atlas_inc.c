@@ -0,0 +1,748 @@
+// generated by utils/tabletool/glyph_atlas from ume_tgo5_18.c
+#if FONT_UME_TGO5_18_W != 9 || FONT_UME_TGO5_18_H != 19 || FONT_UME_TG05_18_NGLYPHS != 93
+#error "atlas data doesn't match ume_tgo5_18.h"
+#endif
+// glyph 0
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 1
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0xaf,0xff,0xfa}}, {{0x0f,0x8f,0xff,0xf8}},
+  {{0x0f,0x9f,0xff,0xf9}}, {{0x0f,0x9f,0xff,0xf9}}, {{0x0f,0xaf,0xff,0xfa}}, {{0x0f,0xaf,0xff,0xfa}},
+  {{0x0f,0xbf,0xff,0xfa}}, {{0x0f,0xbf,0xff,0xfb}}, {{0x0f,0xbf,0xff,0xfb}}, {{0x3f,0xcf,0xff,0xfc}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xcf,0xff,0xfc}}, {{0x0f,0x8f,0xff,0xf8}}, {{0x0f,0x8f,0xff,0xf8}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 2
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x9f,0x46,0x84,0xfc}}, {{0x6f,0x02,0x60,0xfa}},
+  {{0x7f,0x02,0x60,0xfa}}, {{0xff,0x6f,0x71,0xfb}}, {{0xff,0x2c,0x90,0xfd}}, {{0x7f,0x12,0xe4,0xff}},
+  {{0xcf,0xda,0xfe,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 3
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xde,0xed}}, {{0xaf,0xff,0x3b,0x20}}, {{0xcf,0xff,0x19,0x40}},
+  {{0xef,0xef,0x07,0x60}}, {{0xcd,0xac,0x04,0x71}}, {{0x14,0x11,0x00,0x10}}, {{0xff,0x8f,0x02,0xc5}},
+  {{0xff,0x6e,0x00,0xf7}}, {{0xff,0x4c,0x20,0xfa}}, {{0xdd,0x29,0x30,0xda}}, {{0x01,0x00,0x00,0x00}},
+  {{0xdf,0x06,0x81,0xff}}, {{0xbf,0x04,0xa3,0xff}}, {{0x9f,0x01,0xc5,0xff}}, {{0x7e,0x00,0xe7,0xff}},
+  {{0xdf,0xbb,0xfd,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xcf, 0xf3, 0xff, 0x3d, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 4
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0x7f,0xdf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfb}}, {{0x0f,0x5f,0xdd,0xf5}},
+  {{0x0f,0x0c,0x11,0xd0}}, {{0x0f,0xa3,0x13,0x4a}}, {{0x0f,0xc0,0x68,0x3b}}, {{0x0f,0xc1,0xf7,0xfb}},
+  {{0x0f,0xc5,0xf1,0xf7}}, {{0x0f,0xbe,0xf3,0xf0}}, {{0x0f,0x1f,0xaf,0xf7}}, {{0x0f,0x3f,0x0f,0xbb}},
+  {{0x0f,0xcf,0x4f,0x3b}}, {{0x0b,0xc1,0x8b,0x0b}}, {{0x0e,0xc0,0x65,0x2b}}, {{0x0f,0x48,0x00,0x82}},
+  {{0x0f,0x2f,0x89,0xf2}}, {{0x0f,0xcf,0xff,0xfb}}, {{0x0f,0xcf,0xff,0xfb}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 5
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xee,0x9f}}, {{0xfe,0xf2,0x90,0x09}}, {{0xf7,0xf1,0x26,0x31}},
+  {{0xc3,0xb4,0x0b,0x90}}, {{0xa2,0x44,0x1c,0xf0}}, {{0x82,0x05,0x7c,0xf0}}, {{0x23,0x04,0xdb,0xf0}},
+  {{0x06,0x52,0xc9,0xe0}}, {{0x0c,0x11,0x00,0x21}}, {{0x0f,0x0d,0x9c,0x02}}, {{0x3f,0x0f,0xdb,0x20}},
+  {{0x7f,0x0f,0xe5,0x21}}, {{0x8f,0x0d,0xe0,0x27}}, {{0xaf,0x07,0xd0,0x1d}}, {{0xde,0x01,0x74,0x0f}},
+  {{0xf9,0x80,0x2b,0x6f}}, {{0xfd,0xf9,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xdf, 0xfb, 0xff, 0xff, 0xef, 0x59, 0x34, 0x95, 0xff, 0x0f, } },
+// glyph 6
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x7f,0xef,0xfc,0xf6}}, {{0x2f,0x6d,0xf0,0xf4}},
+  {{0xaf,0x08,0xf0,0xfe}}, {{0xbf,0x07,0xe1,0xff}}, {{0x9f,0x08,0xf1,0xff}}, {{0x2f,0x5c,0xf0,0xfb}},
+  {{0x3f,0xef,0xf3,0xe0}}, {{0xdf,0xf8,0xe0,0x30}}, {{0x5d,0xf0,0xb7,0x14}}, {{0x08,0x91,0x6f,0x5d}},
+  {{0xa7,0x03,0x1f,0xaf}}, {{0xf8,0x31,0x0f,0xcf}}, {{0x4d,0x00,0x45,0x19}}, {{0x3f,0xbb,0xf3,0x60}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0x0f, } },
+// glyph 7
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x9f,0xf8,0xf4,0xf4}}, {{0x6f,0xf5,0xf0,0xf0}},
+  {{0x6f,0xf6,0xf0,0xf0}}, {{0x7f,0xff,0xfb,0xf0}}, {{0xbf,0xff,0xf6,0xf0}}, {{0xff,0xf5,0xf0,0xf5}},
+  {{0xff,0xfb,0xfc,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 8
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xef,0xff}}, {{0xff,0xdf,0x2f,0x5f}}, {{0xef,0x2f,0x2f,0xdf}},
+  {{0x5f,0x0f,0xcf,0xff}}, {{0x0f,0x8f,0xff,0xfb}}, {{0x1f,0xff,0xff,0xf4}}, {{0x6f,0xff,0xfe,0xf0}},
+  {{0xbf,0xff,0xfb,0xf0}}, {{0xdf,0xff,0xf9,0xf0}}, {{0xef,0xff,0xf8,0xf0}}, {{0xdf,0xff,0xf9,0xf0}},
+  {{0xbf,0xff,0xfb,0xf0}}, {{0x7f,0xff,0xfe,0xf0}}, {{0x2f,0xff,0xff,0xf4}}, {{0x0f,0x9f,0xff,0xfa}},
+  {{0x4f,0x1f,0xdf,0xff}}, {{0xdf,0x1f,0x3f,0xef}}, {{0xff,0xcf,0x1f,0x5f}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 9
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xfe,0xff}}, {{0xff,0xf5,0xf1,0xfc}}, {{0xdf,0xfe,0xf2,0xf1}},
+  {{0x3f,0xff,0xfd,0xf1}}, {{0x0f,0xaf,0xff,0xf9}}, {{0x2f,0x3f,0xff,0xff}}, {{0x7f,0x0f,0xdf,0xff}},
+  {{0xbf,0x0f,0xaf,0xff}}, {{0xdf,0x0f,0x8f,0xff}}, {{0xff,0x0f,0x7f,0xff}}, {{0xdf,0x0f,0x8f,0xff}},
+  {{0xbf,0x0f,0xaf,0xff}}, {{0x7f,0x0f,0xdf,0xff}}, {{0x2f,0x3f,0xff,0xff}}, {{0x0f,0xaf,0xff,0xf8}},
+  {{0x4f,0xff,0xfd,0xf0}}, {{0xef,0xfd,0xf2,0xf2}}, {{0xff,0xf5,0xf2,0xfd}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 10
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0xbf,0xff,0xfb}}, {{0x0f,0xbf,0xff,0xfb}},
+  {{0x0f,0xbf,0xff,0xfb}}, {{0x0f,0xc9,0xee,0x9c}}, {{0x0d,0xc0,0x43,0x0c}}, {{0x0f,0x37,0x00,0x63}},
+  {{0x0f,0x0f,0x78,0xf0}}, {{0x0f,0x1f,0xcc,0xf1}}, {{0x0f,0x1b,0x01,0xa1}}, {{0x0d,0xb0,0x21,0x0b}},
+  {{0x0f,0xc5,0xcc,0x4c}}, {{0x0f,0xbf,0xff,0xfb}}, {{0x0f,0xbf,0xff,0xfb}}, {{0x0f,0xaf,0xff,0xfa}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xfc, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 11
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x0f,0xaf,0xff,0xfa}},
+  {{0x0f,0xaf,0xff,0xfa}}, {{0x0f,0xaf,0xff,0xfa}}, {{0x0f,0xaf,0xff,0xfa}}, {{0x0f,0xaf,0xff,0xfa}},
+  {{0x0d,0x7b,0xbb,0xb7}}, {{0x06,0x00,0x00,0x00}}, {{0x0d,0x8b,0xbb,0xb8}}, {{0x0f,0xaf,0xff,0xfa}},
+  {{0x0f,0xaf,0xff,0xfa}}, {{0x0f,0xaf,0xff,0xfa}}, {{0x0f,0xaf,0xff,0xfa}}, {{0x0f,0xaf,0xff,0xfa}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 12
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xcf,0xf8,0xf5,0xf5}}, {{0xbf,0xf5,0xf0,0xf0}}, {{0xbf,0xf5,0xf0,0xf0}}, {{0xbf,0xfd,0xf8,0xf0}},
+  {{0xdf,0xfe,0xf5,0xf0}}, {{0xff,0xf5,0xf0,0xf6}}, {{0xff,0xfa,0xfb,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 13
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x2f,0x26,0x22,0x62}}, {{0xbf,0xbc,0xbb,0xcb}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 14
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xfe,0xfe,0xfe}}, {{0xff,0xf5,0xf0,0xf0}}, {{0xff,0xf5,0xf0,0xf0}}, {{0xff,0xf5,0xf0,0xf0}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 15
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0x9f,0x8f}}, {{0xff,0xff,0x2f,0x3f}}, {{0xff,0xbf,0x0f,0x8f}},
+  {{0xff,0x6f,0x0f,0xdf}}, {{0xff,0x1f,0x4f,0xff}}, {{0xbf,0x0f,0x9f,0xff}}, {{0x5f,0x0f,0xef,0xff}},
+  {{0x1f,0x4f,0xff,0xfe}}, {{0x0f,0xaf,0xff,0xfa}}, {{0x1f,0xef,0xff,0xf4}}, {{0x5f,0xff,0xfe,0xf0}},
+  {{0xbf,0xff,0xf9,0xf0}}, {{0xff,0xff,0xf3,0xf1}}, {{0xff,0xfd,0xf0,0xf6}}, {{0xff,0xf8,0xf0,0xfb}},
+  {{0xff,0xf3,0xf2,0xff}}, {{0xff,0xf9,0xf9,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 16
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x7f,0xee,0xf7}}, {{0x5f,0x0f,0x65,0xf0}},
+  {{0xff,0x8d,0x00,0xd8}}, {{0xff,0xe8,0x00,0x8e}}, {{0xff,0xf5,0x43,0x5f}}, {{0xff,0xf3,0x65,0x3f}},
+  {{0xff,0xf2,0x76,0x2f}}, {{0xff,0xf2,0x77,0x2f}}, {{0xff,0xf3,0x56,0x3f}}, {{0xff,0xf4,0x44,0x4f}},
+  {{0xff,0xe7,0x01,0x7f}}, {{0xff,0x9b,0x00,0xba}}, {{0x9f,0x1f,0x33,0xf2}}, {{0x0f,0x2f,0xdd,0xf2}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 17
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0xdf,0xff,0xfe}}, {{0x0f,0xcf,0xff,0xf7}},
+  {{0x0f,0xcb,0xf2,0xf0}}, {{0x0f,0xcd,0xf8,0xf6}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}},
+  {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}},
+  {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xae,0xcc,0xea}}, {{0x0f,0x0a,0x00,0xa0}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 18
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x6f,0xcc,0xf5}}, {{0x4f,0x1d,0x11,0xd1}},
+  {{0xff,0xe7,0x21,0x6e}}, {{0xff,0xf4,0x65,0x3f}}, {{0xff,0xff,0x5f,0x4f}}, {{0xff,0xff,0x1f,0x6f}},
+  {{0xff,0x9f,0x0f,0xcf}}, {{0xcf,0x1f,0x4f,0xff}}, {{0x1f,0x2f,0xef,0xfc}}, {{0x2f,0xdf,0xfd,0xf1}},
+  {{0xdf,0xff,0xf3,0xf1}}, {{0xff,0xfa,0xf0,0xfa}}, {{0xbf,0xb4,0xb1,0xcb}}, {{0x0f,0x03,0x00,0x30}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 19
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x46,0x44,0x64}}, {{0x7f,0x68,0x07,0x47}},
+  {{0xff,0x5f,0x1f,0xdf}}, {{0x9f,0x0f,0xbf,0xff}}, {{0x0f,0x7f,0xff,0xfc}}, {{0x0f,0x9f,0xff,0xf2}},
+  {{0x4f,0x0f,0x5f,0xf5}}, {{0xff,0xaf,0x0f,0xaf}}, {{0xff,0xff,0x3f,0x5f}}, {{0xff,0xff,0x6f,0x3f}},
+  {{0xff,0xff,0x5f,0x4f}}, {{0xff,0xef,0x1f,0x7f}}, {{0x9f,0x34,0x17,0xda}}, {{0x1f,0x49,0xc3,0xf1}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 20
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0x5f,0x8f,0xff}}, {{0xaf,0x0f,0x6f,0xff}},
+  {{0x3f,0x0f,0x6f,0xff}}, {{0x0f,0x2f,0x6f,0xfb}}, {{0x5f,0x4f,0x6f,0xf4}}, {{0xcf,0x4f,0x6c,0xf0}},
+  {{0xff,0x4f,0x64,0xf4}}, {{0xff,0x4c,0x60,0xfb}}, {{0xff,0x45,0x63,0xff}}, {{0xcd,0x30,0x57,0xcc}},
+  {{0x0a,0x00,0x00,0x00}}, {{0xef,0x4e,0x6e,0xee}}, {{0xff,0x4f,0x6f,0xff}}, {{0xff,0x4f,0x6f,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf8, 0xff, 0xff, 0x0f, } },
+// glyph 21
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x46,0x44,0x64}}, {{0x7f,0x73,0x73,0x87}},
+  {{0xff,0xf3,0xf6,0xff}}, {{0xff,0xf3,0xf6,0xff}}, {{0xdf,0xf3,0xf4,0xfb}}, {{0x0f,0x33,0xc0,0xf0}},
+  {{0xcf,0x3c,0x1e,0xdf}}, {{0xff,0xdf,0x0f,0x7f}}, {{0xff,0xff,0x3f,0x4f}}, {{0xff,0xff,0x4f,0x3f}},
+  {{0xff,0xff,0x2f,0x5f}}, {{0xff,0xaf,0x0f,0x9f}}, {{0x8f,0x08,0x39,0xfa}}, {{0x2f,0x65,0xe1,0xf0}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 22
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x7f,0x5f,0xff,0xff}}, {{0x0f,0x9f,0xff,0xfb}},
+  {{0x4f,0xff,0xff,0xf2}}, {{0xcf,0xff,0xfa,0xf0}}, {{0xff,0xff,0xf3,0xf5}}, {{0x1f,0x3d,0xb0,0xf2}},
+  {{0x6f,0x29,0x10,0xe1}}, {{0xff,0xd6,0x00,0x8c}}, {{0xff,0xf4,0x43,0x5f}}, {{0xff,0xf3,0x64,0x3f}},
+  {{0xff,0xf5,0x54,0x4f}}, {{0xff,0xe7,0x10,0x7e}}, {{0x9f,0x4e,0x00,0xd3}}, {{0x0f,0x2f,0xab,0xf2}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 23
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x46,0x44,0x64}}, {{0x7f,0x78,0x27,0x37}},
+  {{0xff,0xef,0x1f,0x8f}}, {{0xff,0xaf,0x0f,0xdf}}, {{0xff,0x5f,0x3f,0xff}}, {{0xef,0x1f,0x7f,0xff}},
+  {{0xaf,0x0f,0xcf,0xff}}, {{0x5f,0x2f,0xff,0xff}}, {{0x1f,0x6f,0xff,0xff}}, {{0x0f,0xaf,0xff,0xfc}},
+  {{0x0f,0xef,0xff,0xf8}}, {{0x3f,0xff,0xff,0xf5}}, {{0x7f,0xff,0xff,0xf1}}, {{0xbf,0xff,0xfc,0xf0}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 24
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x6f,0xee,0xf7}}, {{0x5f,0x1e,0x22,0xf1}},
+  {{0xff,0xd8,0x00,0x9d}}, {{0xff,0xf6,0x12,0x7f}}, {{0xff,0xf6,0x01,0x7f}}, {{0xff,0x8a,0x00,0xb9}},
+  {{0x4f,0x0f,0x55,0xf0}}, {{0x1f,0x0f,0x77,0xf0}}, {{0xff,0x6b,0x00,0xb6}}, {{0xff,0xf5,0x22,0x5f}},
+  {{0xff,0xf4,0x44,0x3f}}, {{0xff,0xf6,0x21,0x6e}}, {{0x8f,0x4c,0x00,0xc4}}, {{0x0f,0x2f,0xaa,0xf2}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 25
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x6f,0xdd,0xf6}}, {{0x4f,0x0f,0x22,0xe1}},
+  {{0xff,0xb9,0x00,0x9c}}, {{0xff,0xf5,0x34,0x5f}}, {{0xff,0xf4,0x45,0x3f}}, {{0xff,0xf4,0x45,0x4f}},
+  {{0xff,0xe6,0x01,0x5f}}, {{0xbf,0x4c,0x00,0x75}}, {{0x0f,0x0f,0x06,0xb0}}, {{0xbf,0x6f,0x1f,0xfd}},
+  {{0xef,0x1f,0x7f,0xff}}, {{0x7f,0x0f,0xdf,0xff}}, {{0x0f,0x7f,0xff,0xfd}}, {{0x2f,0xff,0xff,0xf3}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 26
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xdf,0xf8,0xf0,0xf0}}, {{0xdf,0xf8,0xf0,0xf0}}, {{0xdf,0xf8,0xf0,0xf0}},
+  {{0xff,0xfe,0xfd,0xfd}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xef,0xfb,0xf5,0xf5}},
+  {{0xdf,0xf8,0xf0,0xf0}}, {{0xdf,0xf8,0xf0,0xf0}}, {{0xef,0xfc,0xf7,0xf7}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 27
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xdf,0xf8,0xf0,0xf0}}, {{0xdf,0xf8,0xf0,0xf0}}, {{0xdf,0xf8,0xf0,0xf0}},
+  {{0xff,0xfe,0xfd,0xfd}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xef,0xfb,0xf6,0xf6}}, {{0xdf,0xf8,0xf0,0xf0}}, {{0xdf,0xf8,0xf0,0xf0}}, {{0xdf,0xfe,0xf8,0xf0}},
+  {{0xff,0xff,0xf6,0xf1}}, {{0xff,0xf9,0xf0,0xf8}}, {{0xff,0xfc,0xfa,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 28
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xcf,0xaf}}, {{0xff,0x8f,0x0f,0x2f}}, {{0x4f,0x0f,0x5f,0xed}}, {{0x1f,0xaf,0xf9,0xf1}},
+  {{0xde,0xf5,0xf0,0xf4}}, {{0xfc,0xf0,0xf2,0xfe}}, {{0xcf,0xf7,0xf0,0xf2}}, {{0x0f,0x8f,0xfb,0xf2}},
+  {{0x5f,0x0f,0x4f,0xde}}, {{0xff,0x9f,0x0f,0x1f}}, {{0xff,0xff,0xdf,0xaf}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x0f, } },
+// glyph 29
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0x3a,0x33,0x33,0x33}}, {{0xad,0xaa,0xaa,0xaa}}, {{0xff,0xff,0xff,0xff}}, {{0x8c,0x88,0x88,0x88}},
+  {{0x5a,0x55,0x55,0x55}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xda, 0xcf, 0xfa, 0xff, 0xff, 0x0f, } },
+// glyph 30
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xfa,0xfd,0xff}}, {{0xfe,0xf1,0xf1,0xf9}}, {{0x5f,0xed,0xf3,0xf0}}, {{0x0f,0x2f,0xcf,0xf7}},
+  {{0xbf,0x2f,0x0f,0x7f}}, {{0xff,0xef,0x2f,0x0f}}, {{0xdf,0x3f,0x0f,0x6f}}, {{0x1f,0x1f,0xaf,0xf9}},
+  {{0x5f,0xee,0xf4,0xf0}}, {{0xfe,0xf1,0xf1,0xf9}}, {{0xff,0xfa,0xfd,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 31
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x5f,0x6d,0xb7,0xf5}}, {{0x4f,0x20,0x01,0x94}},
+  {{0xff,0xf9,0x4f,0x2f}}, {{0xff,0xff,0x8f,0x0f}}, {{0xff,0xff,0x7f,0x0f}}, {{0xff,0xef,0x1f,0x5f}},
+  {{0xef,0x2f,0x1f,0xdf}}, {{0x4f,0x1f,0xcf,0xff}}, {{0x0f,0x9f,0xff,0xfc}}, {{0x3f,0xdf,0xff,0xfb}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xcf,0xff,0xfb}}, {{0x0f,0x9f,0xff,0xf6}}, {{0x0f,0x9f,0xff,0xf6}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 32
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x5f,0x7f,0xdd,0xf7}}, {{0xaf,0x7d,0x11,0xc7}},
+  {{0xbf,0xc5,0x87,0x3e}}, {{0x2d,0x00,0x9d,0x32}}, {{0xfa,0x34,0x9a,0x74}}, {{0xf7,0x47,0x97,0x97}},
+  {{0xf6,0x49,0x96,0xa9}}, {{0xf6,0x4a,0x96,0x89}}, {{0xf6,0x49,0x97,0x78}}, {{0xf8,0x47,0x99,0x36}},
+  {{0x4b,0x04,0x4d,0x11}}, {{0x9f,0x92,0x7b,0xbc}}, {{0xff,0xfb,0xd1,0xba}}, {{0x1f,0x1f,0x2c,0x64}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xbf, 0x68, 0x65, 0xa7, 0xfe, 0xff, 0xff, 0x0f, } },
+// glyph 33
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0xaf,0xff,0xfa}}, {{0x0f,0x6f,0xff,0xf5}},
+  {{0x1f,0x2f,0xff,0xf2}}, {{0x7f,0x0f,0xee,0xf0}}, {{0xcf,0x0f,0xbb,0xf0}}, {{0xff,0x1f,0x87,0xf2}},
+  {{0xff,0x4f,0x44,0xf5}}, {{0xff,0x7f,0x11,0xf8}}, {{0x0f,0x0d,0x00,0xd0}}, {{0xaf,0x9a,0x00,0x99}},
+  {{0xff,0xf6,0x12,0x6f}}, {{0xff,0xf3,0x44,0x3f}}, {{0xff,0xf0,0x77,0x0f}}, {{0xfc,0xf0,0xaa,0x0f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x0f, } },
+// glyph 34
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x78,0xd4,0xf4}}, {{0x5f,0x15,0x21,0xf6}},
+  {{0xff,0xc5,0x04,0xbf}}, {{0xff,0xf5,0x04,0x9f}}, {{0xff,0xf5,0x04,0x9f}}, {{0xef,0x85,0x04,0xcf}},
+  {{0x0f,0x05,0x30,0xf0}}, {{0xaf,0x65,0x03,0x9a}}, {{0xff,0xf5,0x44,0x3f}}, {{0xff,0xf5,0x74,0x1f}},
+  {{0xff,0xf5,0x74,0x1f}}, {{0xff,0xf5,0x44,0x3f}}, {{0xaf,0x65,0x02,0x9a}}, {{0x0f,0x25,0x80,0xf0}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 35
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x5f,0xcf,0xf8}}, {{0x4f,0x1f,0x15,0xc0}},
+  {{0xff,0xeb,0x20,0x4a}}, {{0xff,0xf5,0x83,0x0f}}, {{0xff,0xf2,0xc7,0x1f}}, {{0xff,0xf0,0xf9,0xff}},
+  {{0xfe,0xf0,0xfa,0xff}}, {{0xfe,0xf0,0xfa,0xff}}, {{0xff,0xf0,0xf9,0xdf}}, {{0xff,0xf1,0xb8,0x0f}},
+  {{0xff,0xf4,0x94,0x0f}}, {{0xff,0xf8,0x40,0x3c}}, {{0x8f,0x5e,0x02,0x91}}, {{0x0f,0x2f,0x8d,0xf4}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xef, 0xfc, 0xff, 0xcf, 0xfe, 0xff, 0xff, 0x0f, } },
+// glyph 36
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x5f,0x98,0xf4,0xf4}}, {{0x3f,0x05,0x61,0xf6}},
+  {{0xff,0x75,0x03,0xcf}}, {{0xff,0xe5,0x03,0x7f}}, {{0xff,0xf5,0x43,0x4f}}, {{0xff,0xf5,0x63,0x2f}},
+  {{0xff,0xf5,0x73,0x1f}}, {{0xff,0xf5,0x73,0x1f}}, {{0xff,0xf5,0x63,0x2f}}, {{0xff,0xf5,0x43,0x3f}},
+  {{0xff,0xf5,0x13,0x6f}}, {{0xff,0xa5,0x03,0xaf}}, {{0x8f,0x15,0x32,0xfa}}, {{0x1f,0x55,0xe0,0xf0}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 37
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x48,0x44,0x64}}, {{0x5f,0x55,0x51,0x75}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0x0f,0x05,0x00,0xa0}}, {{0xaf,0xa5,0xa3,0xea}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0x9f,0x95,0x92,0xa9}}, {{0x0f,0x05,0x00,0x30}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 38
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x48,0x44,0x64}}, {{0x5f,0x55,0x51,0x75}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0x0f,0x05,0x30,0xf0}}, {{0xaf,0xa5,0xb3,0xfa}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 39
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x6f,0xce,0xf7}}, {{0x4f,0x1f,0x15,0xd0}},
+  {{0xff,0xdb,0x10,0x5a}}, {{0xff,0xf6,0x62,0x1f}}, {{0xff,0xf3,0xe6,0xdf}}, {{0xff,0xf1,0xf8,0xff}},
+  {{0xbf,0x90,0x99,0x9f}}, {{0x6f,0x10,0x09,0x1f}}, {{0xff,0xf0,0x88,0x1f}}, {{0xff,0xf2,0x87,0x1f}},
+  {{0xff,0xf4,0x84,0x1f}}, {{0xff,0xf8,0x70,0x1d}}, {{0x8f,0x5e,0x01,0x12}}, {{0x0f,0x2f,0x3c,0x13}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 40
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xf8,0x77,0x8f}}, {{0xff,0xf5,0x44,0x5f}},
+  {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}},
+  {{0x0f,0x05,0x00,0x50}}, {{0xaf,0xa5,0x33,0x5a}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}},
+  {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 41
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x4f,0xbb,0xf4}}, {{0x0f,0x4f,0xbb,0xf4}},
+  {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}},
+  {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}},
+  {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0x8f,0xdd,0xf8}}, {{0x0f,0x0f,0x99,0xf0}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 42
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0x7f,0x8f}}, {{0xff,0xff,0x4f,0x5f}},
+  {{0xff,0xff,0x4f,0x5f}}, {{0xff,0xff,0x4f,0x5f}}, {{0xff,0xff,0x4f,0x5f}}, {{0xff,0xff,0x4f,0x5f}},
+  {{0xff,0xff,0x4f,0x5f}}, {{0xff,0xff,0x4f,0x5f}}, {{0xff,0xff,0x4f,0x5f}}, {{0xff,0xff,0x4f,0x5f}},
+  {{0xff,0xff,0x3f,0x6f}}, {{0xff,0xdf,0x0f,0x8f}}, {{0x7f,0x14,0x15,0xe7}}, {{0x1f,0x48,0xc2,0xf1}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 43
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xf8,0x77,0x5f}}, {{0xff,0xa5,0x04,0x9f}},
+  {{0xef,0x25,0x44,0xff}}, {{0x6f,0x15,0xd4,0xff}}, {{0x0f,0x95,0xf4,0xfb}}, {{0x4f,0xf5,0xf3,0xf2}},
+  {{0x7f,0xf5,0xf0,0xf0}}, {{0x0f,0xe5,0xf0,0xf3}}, {{0x1f,0x65,0xf3,0xfe}}, {{0x7f,0x05,0xd4,0xff}},
+  {{0xef,0x05,0x64,0xff}}, {{0xff,0x75,0x04,0xdf}}, {{0xff,0xe5,0x04,0x5f}}, {{0xff,0xf5,0x64,0x0f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x0f, } },
+// glyph 44
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xf8,0xf7,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xaf,0xa5,0xa2,0xca}}, {{0x0f,0x05,0x00,0x50}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 45
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xd8,0x44,0x9d}}, {{0xff,0x95,0x00,0x6a}},
+  {{0xff,0x65,0x00,0x67}}, {{0xff,0x45,0x00,0x64}}, {{0xff,0x15,0x00,0x61}}, {{0xcf,0x05,0x22,0x60}},
+  {{0x6f,0x25,0x34,0x61}}, {{0x1f,0x45,0x34,0x64}}, {{0x0f,0x75,0x34,0x67}}, {{0x0f,0xa5,0x34,0x6a}},
+  {{0xaf,0xe5,0x34,0x6e}}, {{0xff,0xf5,0x34,0x6f}}, {{0xff,0xf5,0x34,0x6f}}, {{0xff,0xf5,0x34,0x6f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 46
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xf8,0x64,0x8b}}, {{0xff,0xf5,0x30,0x55}},
+  {{0xff,0xf5,0x30,0x51}}, {{0xcf,0xf5,0x31,0x50}}, {{0x8f,0xf5,0x33,0x52}}, {{0x4f,0xf5,0x33,0x56}},
+  {{0x0f,0xe5,0x33,0x5a}}, {{0x0f,0xb5,0x33,0x5e}}, {{0x3f,0x75,0x33,0x5f}}, {{0x7f,0x35,0x33,0x5f}},
+  {{0xbf,0x05,0x13,0x5f}}, {{0xff,0x15,0x03,0x5f}}, {{0xff,0x45,0x03,0x5f}}, {{0xff,0x85,0x03,0x5f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 47
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x6f,0xcc,0xf6}}, {{0x4f,0x1b,0x00,0xc1}},
+  {{0xff,0xd4,0x01,0x4d}}, {{0xfe,0xf0,0x67,0x0f}}, {{0xfc,0xf0,0xaa,0x0f}}, {{0xfb,0xf0,0xcc,0x0f}},
+  {{0xfa,0xf0,0xdd,0x0f}}, {{0xfa,0xf0,0xdd,0x0f}}, {{0xfa,0xf0,0xdd,0x0f}}, {{0xfb,0xf0,0xbb,0x0f}},
+  {{0xfd,0xf0,0x88,0x0f}}, {{0xff,0xf2,0x33,0x2f}}, {{0x8f,0x49,0x00,0x94}}, {{0x0f,0x1f,0x88,0xf1}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xef, 0xac, 0xaa, 0xba, 0xfd, 0xff, 0xff, 0x0f, } },
+// glyph 48
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x68,0xc4,0xf4}}, {{0x4f,0x15,0x01,0xb5}},
+  {{0xff,0xe5,0x23,0x4f}}, {{0xff,0xf5,0x63,0x1f}}, {{0xff,0xf5,0x53,0x2f}}, {{0xef,0xb5,0x03,0x6f}},
+  {{0x0f,0x05,0x30,0xd0}}, {{0xaf,0xc5,0xf2,0xfa}}, {{0xff,0xf5,0xf3,0xff}}, {{0xff,0xf5,0xf3,0xff}},
+  {{0xff,0xf5,0xf3,0xff}}, {{0xff,0xf5,0xf3,0xff}}, {{0xff,0xf5,0xf3,0xff}}, {{0xff,0xf5,0xf3,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 49
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x6f,0xdd,0xf6}}, {{0x4f,0x0f,0x22,0xf0}},
+  {{0xff,0xa9,0x00,0xaa}}, {{0xff,0xf5,0x11,0x6f}}, {{0xff,0xf3,0x44,0x3f}}, {{0xff,0xf2,0x66,0x2f}},
+  {{0xff,0xf1,0x77,0x1f}}, {{0xff,0xf1,0x77,0x1f}}, {{0xff,0xf1,0x67,0x1f}}, {{0x6f,0xc2,0x56,0x3e}},
+  {{0x0f,0xa5,0x23,0x5e}}, {{0x0f,0x68,0x00,0x9d}}, {{0x0f,0x0e,0x21,0xe3}}, {{0x0f,0x1f,0xcc,0xf3}},
+  {{0x8f,0x0f,0xcf,0xff}}, {{0xef,0x2f,0x0f,0x1f}}, {{0xff,0xef,0x9f,0x7f}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x09, } },
+// glyph 50
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x68,0xc4,0xf4}}, {{0x4f,0x15,0x01,0xb5}},
+  {{0xff,0xe5,0x23,0x4f}}, {{0xff,0xf5,0x63,0x1f}}, {{0xff,0xf5,0x53,0x2f}}, {{0xef,0xb5,0x03,0x6f}},
+  {{0x0f,0x05,0x20,0xd0}}, {{0x4f,0x25,0xf2,0xfa}}, {{0xaf,0x05,0xc3,0xff}}, {{0xef,0x05,0x73,0xff}},
+  {{0xff,0x55,0x13,0xff}}, {{0xff,0xa5,0x03,0xbf}}, {{0xff,0xe5,0x03,0x6f}}, {{0xff,0xf5,0x53,0x1f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 51
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x6f,0xde,0xf7}}, {{0x5f,0x2c,0x11,0xb2}},
+  {{0xff,0xf4,0x33,0x2f}}, {{0xff,0xf2,0xa6,0x2f}}, {{0xff,0xf4,0xf3,0xff}}, {{0xef,0xfb,0xf0,0xf5}},
+  {{0x2f,0xbf,0xf9,0xf0}}, {{0x4f,0x0f,0x5f,0xfd}}, {{0xff,0x9f,0x0f,0x7f}}, {{0xff,0xff,0x7f,0x1f}},
+  {{0xfe,0xf1,0xba,0x0f}}, {{0xff,0xf2,0x84,0x0f}}, {{0x8f,0x7b,0x00,0x63}}, {{0x1f,0x2f,0x7b,0xf3}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x0f, } },
+// glyph 52
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x44,0x44,0x44}}, {{0x0f,0x45,0x55,0x53}},
+  {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}},
+  {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}},
+  {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}}, {{0x0f,0xdf,0xff,0xfb}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 53
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xf8,0x66,0x8f}}, {{0xff,0xf5,0x33,0x5f}},
+  {{0xff,0xf5,0x33,0x5f}}, {{0xff,0xf5,0x33,0x5f}}, {{0xff,0xf5,0x33,0x5f}}, {{0xff,0xf5,0x33,0x5f}},
+  {{0xff,0xf5,0x33,0x5f}}, {{0xff,0xf5,0x33,0x5f}}, {{0xff,0xf5,0x33,0x5f}}, {{0xff,0xf5,0x33,0x5f}},
+  {{0xff,0xf6,0x22,0x5f}}, {{0xff,0xe8,0x00,0x8e}}, {{0x8f,0x4d,0x00,0xd3}}, {{0x1f,0x3f,0xbb,0xf3}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 54
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xf5,0x88,0x5f}}, {{0xff,0xf3,0x33,0x3f}},
+  {{0xff,0xf6,0x00,0x6f}}, {{0xff,0xd9,0x00,0x9d}}, {{0xff,0xac,0x00,0xca}}, {{0xff,0x8f,0x00,0xe7}},
+  {{0xff,0x5f,0x23,0xf5}}, {{0xff,0x2f,0x56,0xf2}}, {{0xef,0x0f,0x89,0xf0}}, {{0x9f,0x0f,0xbc,0xf0}},
+  {{0x4f,0x0f,0xee,0xf0}}, {{0x0f,0x2f,0xff,0xf2}}, {{0x0f,0x4f,0xff,0xf5}}, {{0x0f,0x7f,0xff,0xf8}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 55
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4e,0xa4,0xbb,0x4b}}, {{0x0e,0x70,0x88,0x08}},
+  {{0x0f,0x60,0x88,0x07}}, {{0x0f,0x51,0x77,0x16}}, {{0x1f,0x42,0x66,0x25}}, {{0x3f,0x34,0x66,0x43}},
+  {{0x5f,0x25,0x55,0x52}}, {{0x8f,0x06,0x55,0x61}}, {{0xaf,0x07,0x34,0x70}}, {{0xcf,0x08,0x22,0x80}},
+  {{0xef,0x09,0x00,0x90}}, {{0xff,0x1b,0x00,0xb1}}, {{0xff,0x3c,0x00,0xc2}}, {{0xff,0x4d,0x00,0xd3}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 56
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xfd,0xf4,0xaa,0x4f}}, {{0xff,0xf3,0x22,0x3f}},
+  {{0xff,0xa9,0x00,0x9a}}, {{0xff,0x4f,0x11,0xf4}}, {{0x9f,0x0f,0x77,0xf0}}, {{0x0f,0x0f,0xee,0xf0}},
+  {{0x0f,0x6f,0xff,0xf6}}, {{0x0f,0x7f,0xff,0xf7}}, {{0x0f,0x1f,0xee,0xf1}}, {{0x6f,0x0f,0x98,0xf0}},
+  {{0xff,0x2f,0x22,0xf2}}, {{0xff,0x9a,0x00,0xa9}}, {{0xff,0xe3,0x11,0x3e}}, {{0xfc,0xf0,0x77,0x0f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x0f, } },
+// glyph 57
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xf5,0x67,0x5f}}, {{0xff,0xe6,0x00,0x6e}},
+  {{0xff,0x9b,0x00,0xba}}, {{0xff,0x5f,0x11,0xf5}}, {{0xef,0x1f,0x66,0xf1}}, {{0x7f,0x0f,0xbb,0xf0}},
+  {{0x0f,0x1f,0xff,0xf2}}, {{0x0f,0x6f,0xff,0xf6}}, {{0x0f,0xaf,0xff,0xfb}}, {{0x0f,0xbf,0xff,0xfb}},
+  {{0x0f,0xbf,0xff,0xfb}}, {{0x0f,0xbf,0xff,0xfb}}, {{0x0f,0xbf,0xff,0xfb}}, {{0x0f,0xbf,0xff,0xfb}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 58
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x4f,0x48,0x44,0x84}}, {{0x5f,0x58,0x05,0x55}},
+  {{0xff,0xaf,0x0f,0xaf}}, {{0xff,0x4f,0x2f,0xff}}, {{0xdf,0x0f,0x8f,0xff}}, {{0x6f,0x0f,0xef,0xff}},
+  {{0x1f,0x6f,0xff,0xfe}}, {{0x0f,0xcf,0xff,0xf8}}, {{0x4f,0xff,0xff,0xf2}}, {{0xaf,0xff,0xfa,0xf0}},
+  {{0xff,0xff,0xf4,0xf2}}, {{0xff,0xfc,0xf0,0xf8}}, {{0x9f,0x96,0x90,0xb8}}, {{0x0f,0x05,0x00,0x50}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 59
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0x4f,0x4f,0x45,0x64}}, {{0x6f,0x6f,0x61,0x84}}, {{0xff,0xff,0xf1,0xf8}},
+  {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}},
+  {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}},
+  {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}}, {{0xff,0xff,0xf1,0xf8}},
+  {{0x6f,0x6f,0x61,0xa3}}, {{0x5f,0x5f,0x55,0x95}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 60
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0x4f,0x4a,0xc4,0xf4}}, {{0x7f,0x0c,0xa7,0xf7}}, {{0xef,0x0f,0xaf,0xff}},
+  {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}},
+  {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}},
+  {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}}, {{0xef,0x0f,0xaf,0xff}},
+  {{0x5f,0x0b,0xa5,0xf5}}, {{0x5f,0x5a,0xc5,0xf5}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 61
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0x2f,0xbf,0xff,0xfb}}, {{0x2f,0x0f,0x88,0xf0}}, {{0xff,0x95,0x00,0x59}},
+  {{0xff,0xf3,0xcc,0x2f}}, {{0xff,0xfe,0xff,0xef}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 62
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x22,0x22,0x22,0x22}}, {{0x77,0x77,0x77,0x77}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x07, } },
+// glyph 63
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xfd,0xfd}}, {{0x8f,0xff,0xf9,0xf0}}, {{0x1f,0xef,0xff,0xf3}},
+  {{0x1f,0x8f,0xff,0xfc}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 64
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xaf,0xfe,0xfb}}, {{0x1f,0x0d,0x22,0xe0}}, {{0xff,0xc5,0x11,0x7c}},
+  {{0xff,0xf6,0x49,0x4f}}, {{0x8f,0x5f,0x1f,0x4d}}, {{0x0f,0x4e,0x25,0x40}}, {{0xef,0xf6,0x40,0x47}},
+  {{0xff,0xf1,0x46,0x4f}}, {{0xff,0xf1,0x38,0x4f}}, {{0x8f,0x24,0x02,0x49}}, {{0x2f,0x6d,0x34,0x41}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 65
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xfc,0xfb,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0x9f,0xb5,0xf4,0xfb}}, {{0x0f,0x05,0x40,0xf0}}, {{0xef,0x85,0x02,0x7c}},
+  {{0xff,0xf5,0x54,0x2f}}, {{0xff,0xf5,0x84,0x0f}}, {{0xff,0xf5,0x94,0x0f}}, {{0xff,0xf5,0x84,0x0f}},
+  {{0xff,0xf5,0x74,0x1f}}, {{0xff,0xf5,0x24,0x5f}}, {{0x9f,0x35,0x01,0xc8}}, {{0x0f,0x35,0xb1,0xf1}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 66
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xaf,0xff,0xfb}}, {{0x0f,0x0f,0x35,0xe0}}, {{0xef,0xb9,0x00,0x68}},
+  {{0xff,0xf3,0x63,0x2f}}, {{0xff,0xf0,0xd7,0xbf}}, {{0xfe,0xf0,0xf9,0xff}}, {{0xfe,0xf0,0xf8,0xff}},
+  {{0xff,0xf1,0xa6,0x6f}}, {{0xff,0xf4,0x42,0x3e}}, {{0x9f,0x5b,0x00,0xa3}}, {{0x0f,0x2f,0x9a,0xf3}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 67
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xbf,0xcf}}, {{0xff,0xff,0x4f,0x5f}}, {{0xff,0xff,0x4f,0x5f}},
+  {{0xff,0xff,0x4f,0x5f}}, {{0x9f,0xbf,0x4e,0x5a}}, {{0x0f,0x0e,0x02,0x50}}, {{0xef,0xb7,0x20,0x5a}},
+  {{0xff,0xf2,0x45,0x5f}}, {{0xff,0xf1,0x48,0x5f}}, {{0xff,0xf0,0x49,0x5f}}, {{0xff,0xf0,0x49,0x5f}},
+  {{0xff,0xf2,0x47,0x5f}}, {{0xff,0xf5,0x43,0x5f}}, {{0x9f,0x6b,0x00,0x55}}, {{0x0f,0x2f,0x19,0x52}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 68
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xaf,0xff,0xfa}}, {{0x0f,0x0e,0x33,0xe0}}, {{0xff,0xb6,0x00,0x7b}},
+  {{0xff,0xf2,0x55,0x2f}}, {{0xff,0xf0,0x77,0x0f}}, {{0x1f,0x10,0x11,0x01}}, {{0x9f,0x90,0x94,0x99}},
+  {{0xff,0xf2,0xf6,0xff}}, {{0xff,0xf6,0xc1,0xce}}, {{0x9f,0x7d,0x01,0x62}}, {{0x0f,0x2f,0x7c,0xf3}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 69
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xcf,0xaf,0xaf,0xcf}}, {{0x0f,0x0f,0x0f,0x57}}, {{0x6f,0xff,0xff,0xf3}},
+  {{0x7f,0xff,0xff,0xf3}}, {{0x4f,0x9b,0x99,0xb2}}, {{0x1f,0x26,0x22,0x60}}, {{0x7f,0xff,0xff,0xf3}},
+  {{0x7f,0xff,0xff,0xf3}}, {{0x7f,0xff,0xff,0xf3}}, {{0x7f,0xff,0xff,0xf3}}, {{0x7f,0xff,0xff,0xf3}},
+  {{0x7f,0xff,0xff,0xf3}}, {{0x7f,0xff,0xff,0xf3}}, {{0x7f,0xff,0xff,0xf3}}, {{0x7f,0xff,0xff,0xf3}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 70
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xcf,0xbe,0xba}}, {{0x0f,0x0e,0x02,0x50}}, {{0xef,0xa6,0x10,0x5a}},
+  {{0xff,0xf2,0x45,0x5f}}, {{0xff,0xf0,0x48,0x5f}}, {{0xff,0xf0,0x49,0x5f}}, {{0xff,0xf0,0x49,0x5f}},
+  {{0xff,0xf1,0x47,0x5f}}, {{0xff,0xe4,0x22,0x5e}}, {{0x4f,0x1c,0x00,0x51}}, {{0x5f,0x7f,0x2c,0x66}},
+  {{0xff,0xae,0x0c,0x9f}}, {{0x0f,0x0c,0x30,0xf0}}, {{0x8f,0xae,0xfa,0xf8}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 71
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xfc,0xfb,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xaf,0x95,0xb4,0xff}}, {{0x0f,0x05,0x02,0xa2}}, {{0xdf,0xe5,0x20,0x66}},
+  {{0xff,0xf5,0x43,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}},
+  {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 72
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xaf,0xef,0xff,0xfe}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}},
+  {{0xdf,0xff,0xff,0xff}}, {{0x9f,0xdf,0xff,0xfe}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}},
+  {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}},
+  {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 73
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xaf,0xef,0xff,0xfe}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}},
+  {{0xdf,0xff,0xff,0xff}}, {{0x9f,0xdf,0xff,0xfe}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}},
+  {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}},
+  {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}}, {{0x0f,0xbf,0xff,0xfc}},
+  {{0x0f,0xbf,0xff,0xfb}}, {{0x1c,0xe0,0xf1,0xf0}}, {{0xde,0xf9,0xf8,0xf8}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 74
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xfc,0xfb,0xff}}, {{0xff,0xf5,0xf3,0xff}}, {{0xff,0xf5,0xf3,0xff}},
+  {{0xff,0xf5,0xf3,0xff}}, {{0xff,0xf5,0xa3,0x9f}}, {{0xff,0xa5,0x03,0x8f}}, {{0xcf,0x05,0x63,0xff}},
+  {{0x2f,0x45,0xf3,0xfd}}, {{0x0f,0xc5,0xf2,0xf3}}, {{0x1f,0x55,0xf0,0xf1}}, {{0x7f,0x05,0xd0,0xfc}},
+  {{0xef,0x05,0x53,0xff}}, {{0xff,0x65,0x03,0xcf}}, {{0xff,0xd5,0x03,0x5f}}, {{0xff,0xf5,0x53,0x0f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x0f, } },
+// glyph 75
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xaf,0xef,0xff,0xfe}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}},
+  {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}},
+  {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}},
+  {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0xcf,0xff,0xfc}}, {{0x0f,0x8f,0xbf,0xcc}}, {{0x4f,0x0f,0x0f,0x5f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 76
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xdf,0xc9,0x9b,0xd9}}, {{0x2f,0x00,0x00,0x20}}, {{0x0f,0xa0,0x98,0x0a}},
+  {{0x0f,0xc0,0xaa,0x0c}}, {{0x0f,0xc0,0xaa,0x0c}}, {{0x0f,0xc0,0xaa,0x0c}}, {{0x0f,0xc0,0xaa,0x0c}},
+  {{0x0f,0xc0,0xaa,0x0c}}, {{0x0f,0xc0,0xaa,0x0c}}, {{0x0f,0xc0,0xaa,0x0c}}, {{0x0f,0xc0,0xaa,0x0c}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 77
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xaf,0x9b,0xca,0xfe}}, {{0x0f,0x05,0x02,0xc1}}, {{0xef,0xe5,0x20,0x67}},
+  {{0xff,0xf5,0x54,0x5f}}, {{0xff,0xf5,0x54,0x5f}}, {{0xff,0xf5,0x54,0x5f}}, {{0xff,0xf5,0x54,0x5f}},
+  {{0xff,0xf5,0x54,0x5f}}, {{0xff,0xf5,0x54,0x5f}}, {{0xff,0xf5,0x54,0x5f}}, {{0xff,0xf5,0x54,0x5f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 78
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xaf,0xff,0xfa}}, {{0x0f,0x0e,0x33,0xe0}}, {{0xef,0x98,0x00,0x89}},
+  {{0xff,0xf2,0x54,0x1f}}, {{0xff,0xf0,0x98,0x0f}}, {{0xfe,0xf0,0xa9,0x0f}}, {{0xff,0xf0,0xa9,0x0f}},
+  {{0xff,0xf1,0x87,0x0f}}, {{0xff,0xf4,0x32,0x3f}}, {{0x9f,0x4b,0x00,0xa4}}, {{0x0f,0x2f,0x89,0xf2}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 79
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0x9b,0xea,0xfd}}, {{0x0f,0x05,0x21,0xd0}}, {{0xef,0xb5,0x11,0x6a}},
+  {{0xff,0xf5,0x64,0x2f}}, {{0xff,0xf5,0x94,0x0f}}, {{0xff,0xf5,0xa4,0x0f}}, {{0xff,0xf5,0xa4,0x0f}},
+  {{0xff,0xf5,0x94,0x1f}}, {{0xff,0xf5,0x54,0x4f}}, {{0x9f,0x65,0x00,0x95}}, {{0x0f,0x15,0x81,0xf3}},
+  {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xf5,0xf4,0xff}}, {{0xff,0xfa,0xf9,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 80
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xbf,0xbe,0xba}}, {{0x0f,0x0d,0x02,0x50}}, {{0xff,0xd5,0x21,0x5c}},
+  {{0xff,0xf1,0x57,0x5f}}, {{0xff,0xf0,0x59,0x5f}}, {{0xff,0xf0,0x59,0x5f}}, {{0xff,0xf0,0x59,0x5f}},
+  {{0xff,0xf1,0x58,0x5f}}, {{0xff,0xf3,0x54,0x5f}}, {{0xaf,0x79,0x10,0x56}}, {{0x0f,0x2f,0x28,0x52}},
+  {{0xff,0xff,0x5f,0x5f}}, {{0xff,0xff,0x5f,0x5f}}, {{0xff,0xff,0xaf,0xaf}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 81
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xdf,0xa9,0xac}}, {{0x5f,0x0f,0x00,0x38}}, {{0x1f,0xaf,0xd0,0xe1}},
+  {{0xdf,0xff,0xf0,0xf1}}, {{0xff,0xff,0xf0,0xf7}}, {{0xff,0xff,0xf0,0xf8}}, {{0xff,0xff,0xf0,0xf8}},
+  {{0xff,0xff,0xf0,0xf8}}, {{0xff,0xff,0xf0,0xf8}}, {{0xff,0xff,0xf0,0xf8}}, {{0xff,0xff,0xf0,0xf8}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 82
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0xbf,0xfe,0xfb}}, {{0x2f,0x0c,0x42,0xf0}}, {{0xff,0xc4,0x04,0x8e}},
+  {{0xff,0xf2,0x67,0x6f}}, {{0xdf,0xf7,0xf0,0xf7}}, {{0x0f,0x3f,0xb9,0xf2}}, {{0xbf,0x5f,0x0f,0x9f}},
+  {{0xfe,0xfb,0x6e,0x2f}}, {{0xfe,0xf0,0x88,0x1f}}, {{0x9f,0x75,0x10,0x67}}, {{0x0f,0x2e,0x77,0xe2}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 83
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0x9f,0xff,0xff,0xf7}}, {{0x6f,0xff,0xff,0xf3}},
+  {{0x6f,0xff,0xff,0xf3}}, {{0x4f,0x99,0x99,0xb2}}, {{0x1e,0x22,0x22,0x60}}, {{0x6f,0xff,0xff,0xf3}},
+  {{0x6f,0xff,0xff,0xf3}}, {{0x6f,0xff,0xff,0xf3}}, {{0x6f,0xff,0xff,0xf3}}, {{0x6f,0xff,0xff,0xf3}},
+  {{0x6f,0xff,0xff,0xf3}}, {{0x6f,0xff,0xff,0xf3}}, {{0x3f,0xbf,0xbf,0xc5}}, {{0x2f,0x0f,0x0f,0x5c}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 84
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xfb,0xba,0xbf}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}},
+  {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf5,0x44,0x5f}},
+  {{0xff,0xf5,0x44,0x5f}}, {{0xff,0xf6,0x33,0x5f}}, {{0x9f,0x39,0x00,0x58}}, {{0x1f,0x5f,0x36,0x51}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 85
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xfd,0xf9,0xee,0x9f}}, {{0xfd,0xf0,0x98,0x0f}}, {{0xff,0xf3,0x54,0x3f}},
+  {{0xff,0xf7,0x11,0x7f}}, {{0xff,0xbc,0x00,0xbb}}, {{0xff,0x7f,0x11,0xf7}}, {{0xff,0x3f,0x55,0xf3}},
+  {{0xdf,0x0f,0xaa,0xf0}}, {{0x5f,0x0f,0xee,0xf0}}, {{0x0f,0x3f,0xff,0xf3}}, {{0x0f,0x8f,0xff,0xf8}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 86
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9b,0xc9,0xef,0x9c}}, {{0x07,0x70,0xcf,0x07}}, {{0x09,0x50,0xce,0x05}},
+  {{0x2c,0x30,0xbc,0x04}}, {{0x6e,0x10,0xab,0x02}}, {{0x9f,0x01,0x89,0x10}}, {{0xdf,0x03,0x56,0x30}},
+  {{0xff,0x15,0x22,0x50}}, {{0xff,0x37,0x00,0x62}}, {{0xff,0x59,0x00,0x84}}, {{0xff,0x6b,0x00,0xa5}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xcf, 0xa8, 0xec, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 87
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xfe,0xf9,0xcc,0x9f}}, {{0xff,0xe3,0x22,0x2e}}, {{0xff,0x7b,0x00,0xb8}},
+  {{0xbf,0x0f,0x55,0xf0}}, {{0x0f,0x0f,0xdd,0xf0}}, {{0x0f,0x6f,0xff,0xf6}}, {{0x0f,0x3f,0xff,0xf3}},
+  {{0x4f,0x0f,0x99,0xf0}}, {{0xff,0x3e,0x11,0xe3}}, {{0xff,0xb6,0x00,0x7b}}, {{0xfc,0xf0,0x55,0x0f}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x0f, } },
+// glyph 88
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xf9,0xbb,0x9f}}, {{0xff,0xf4,0x23,0x4f}}, {{0xff,0xc9,0x00,0x9d}},
+  {{0xff,0x6d,0x00,0xe9}}, {{0xff,0x2f,0x43,0xf5}}, {{0xbf,0x0f,0x98,0xf1}}, {{0x3f,0x0f,0xed,0xf0}},
+  {{0x0f,0x4f,0xff,0xf2}}, {{0x0f,0x9f,0xff,0xf7}}, {{0x0f,0xef,0xff,0xf7}}, {{0x4f,0xff,0xff,0xf2}},
+  {{0x9f,0xff,0xfc,0xf0}}, {{0xef,0xff,0xf7,0xf0}}, {{0xff,0xff,0xf9,0xf8}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 89
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  {{0xff,0xff,0xff,0xff}}, {{0x9f,0x9b,0x99,0xb9}}, {{0x1f,0x16,0x01,0x51}}, {{0xff,0xaf,0x0f,0xbf}},
+  {{0xef,0x1f,0x5f,0xff}}, {{0x7f,0x0f,0xdf,0xff}}, {{0x0f,0x7f,0xff,0xfd}}, {{0x2f,0xef,0xff,0xf4}},
+  {{0xaf,0xff,0xfa,0xf0}}, {{0xff,0xfe,0xf2,0xf4}}, {{0xaf,0xa8,0xa0,0xc8}}, {{0x0f,0x05,0x00,0x50}},
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 90
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xef,0x8f,0x5f}}, {{0xff,0x3f,0x2f,0x9f}}, {{0xef,0x0f,0xaf,0xff}},
+  {{0xdf,0x0f,0xbf,0xff}}, {{0xdf,0x0f,0xbf,0xff}}, {{0xdf,0x0f,0xbf,0xff}}, {{0xcf,0x0f,0xcf,0xff}},
+  {{0x6f,0x3f,0xff,0xfe}}, {{0x3f,0xef,0xff,0xf2}}, {{0x6f,0x3f,0xff,0xff}}, {{0xcf,0x0f,0xcf,0xff}},
+  {{0xdf,0x0f,0xbf,0xff}}, {{0xdf,0x0f,0xbf,0xff}}, {{0xdf,0x0f,0xbf,0xff}}, {{0xdf,0x0f,0xaf,0xff}},
+  {{0xff,0x2f,0x4f,0xcf}}, {{0xff,0xdf,0x5f,0x2f}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x0f, } },
+// glyph 91
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0x2f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}},
+  {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}},
+  {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}},
+  {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}}, {{0x0f,0xcf,0xff,0xfd}},
+  {{0x0f,0xcf,0xff,0xfd}}, {{0x3f,0xcf,0xff,0xfd}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
+// glyph 92
+{ {
+  {{0xff,0xff,0xff,0xff}}, {{0xff,0xf4,0xf7,0xfe}}, {{0xff,0xfb,0xf3,0xf2}}, {{0xdf,0xff,0xfb,0xf0}},
+  {{0xcf,0xff,0xfc,0xf0}}, {{0xcf,0xff,0xfc,0xf0}}, {{0xcf,0xff,0xfc,0xf0}}, {{0xcf,0xff,0xfc,0xf0}},
+  {{0x7f,0xff,0xff,0xf2}}, {{0x4f,0x3f,0xff,0xfd}}, {{0x3f,0xbf,0xff,0xf7}}, {{0xbf,0xff,0xfd,0xf0}},
+  {{0xcf,0xff,0xfc,0xf0}}, {{0xcf,0xff,0xfc,0xf0}}, {{0xcf,0xff,0xfc,0xf0}}, {{0xcf,0xff,0xfb,0xf0}},
+  {{0xff,0xfc,0xf4,0xf1}}, {{0xff,0xf2,0xf5,0xfc}}, {{0xff,0xff,0xff,0xff}},
+  }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, } },
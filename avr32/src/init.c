@@ -23,6 +23,7 @@
 // aleph
 //#include "conf_aleph.h"
 #include "debug.h"
+#include "bfin.h"
 #include "conf_board.h"
 #include "conf_tc_irq.h"
 #include "filesystem.h"
@@ -238,6 +239,14 @@ void init_local_pdca(void) {
 
 // intialize resources for bf533 communication: SPI, GPIO
 void init_bfin_resources(void) {
+    pdca_channel_options_t pdcaTxOptions = {
+        .addr = NULL,
+        .size = 0,
+        .r_addr = NULL,
+        .r_size = 0,
+        .pid = BFIN_TX_PDCA_PID,
+        .transfer_size = PDCA_TRANSFER_SIZE_BYTE
+    };
     static const gpio_map_t BFIN_SPI_GPIO_MAP = {
         { BFIN_SPI_SCK_PIN, BFIN_SPI_SCK_FUNCTION },
         { BFIN_SPI_MISO_PIN, BFIN_SPI_MISO_FUNCTION },
@@ -277,6 +286,10 @@ void init_bfin_resources(void) {
 
     // intialize the chip register
     spi_setupChipReg(BFIN_SPI, &spiOptions, FPBA_HZ);
+
+    // DMA channel for queued frames;
+    // addresses and sizes are loaded per transfer (see bfin_tx_kick)
+    pdca_init_channel(BFIN_TX_PDCA_CHANNEL, &pdcaTxOptions);
     // we would do an internal pulldown on HWAIT here,
     // but this avr32 part family doesn't have it.
     // so there is an external pulldown instead.
@@ -39,6 +39,9 @@ volatile u8 refresh = 0;
 // irq for pdca (sdcard)
 __attribute__((__interrupt__)) static void irq_pdca(void);
 
+// irq for pdca (bfin frames)
+__attribute__((__interrupt__)) static void irq_pdca_bfin(void);
+
 // irq for app timer
 __attribute__((__interrupt__)) static void irq_tc(void);
 
@@ -84,6 +87,10 @@ __attribute__((__interrupt__)) static void irq_pdca(void) {
     fsEndTransfer = true;
 }
 
+__attribute__((__interrupt__)) static void irq_pdca_bfin(void) {
+    bfin_tx_dma_done();
+}
+
 // timer irq
 __attribute__((__interrupt__)) static void irq_tc(void) {
     tcTicks++;
@@ -284,6 +291,9 @@ void register_interrupts(void) {
 
     // register IRQ for PDCA transfer
     INTC_register_interrupt(&irq_pdca, AVR32_PDCA_IRQ_0, SYS_IRQ_PRIORITY);
+    INTC_register_interrupt(&irq_pdca_bfin,
+                            AVR32_PDCA_IRQ_0 + BFIN_TX_PDCA_CHANNEL,
+                            SYS_IRQ_PRIORITY);
 
     // register TC interrupt
     INTC_register_interrupt(&irq_tc, APP_TC_IRQ, APP_TC_IRQ_PRIORITY);
@@ -37,6 +37,7 @@
 #include "app.h"
 #include "bfin.h"
 #include "conf_tc_irq.h"
+#include "control.h"
 #include "debug.h"
 #include "encoders.h"
 #include "events.h"
@@ -341,6 +342,8 @@ void check_startup(void) {
 void check_events(void) {
     static event_t e;
     if (event_next(&e)) { (app_event_handlers)[e.type](e.data); }
+    // send param changes from this tick as one batch
+    ctl_param_flush();
 }
 
 // !!!!!!!!!!!!!
@@ -15,6 +15,7 @@ bfin_lib_src = control.c \
 	init.c \
 	isr.c \
 	main.c \
+	mdma.c \
 	spi.c \
 	util.c
 
@@ -56,4 +57,21 @@ $(bfin_lib_objdir)%.o : # $(bfin_lib_srcdir)%.c
 bfin_lib_clean:
 	rm $(bfin_lib_objdir)*.o
 
-.PHONY: bfin_lib_target bfin_lib_clean
+# host plugin ("make plugin"): the module's sim sources as one shared object,
+# for utils/bfin_sim/module_host.c (one copy per instance).
+# modules set sim_sourcefiles and sim_inc, and may add
+# plugin_extra_sourcefiles or append to plugin_flags.
+plugin_sourcefiles = $(filter-out ../../utils/bfin_sim/main.c, $(sim_sourcefiles)) \
+	$(plugin_extra_sourcefiles)
+
+plugin_outfile = $(module_name).so
+
+# -Bsymbolic keeps in/out/SDRAM_ADDRESS bound to this copy
+plugin_flags = -lm -fcommon -fPIC -shared -Wl,-Bsymbolic -D ARCH_LINUX=1
+
+plugin:
+	touch $(plugin_outfile)
+	rm ./$(plugin_outfile)
+	gcc $(plugin_sourcefiles) $(plugin_flags) $(sim_inc) -o $(plugin_outfile) -O2 -g
+
+.PHONY: bfin_lib_target bfin_lib_clean plugin
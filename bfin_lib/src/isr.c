@@ -26,7 +26,9 @@ void sport0_rx_isr() {
   READY_LO;
 
   if(!processAudio) { 
-    READY_HI;
+    // keep applying param changes while audio is off
+    ctl_next_frame();
+    if(ctl_param_ready()) { READY_HI; }
     /// if this interrupt came from DMA1, clear it and continue(W1C)
     if(*pDMA1_IRQ_STATUS & 1) { *pDMA1_IRQ_STATUS = 0x0001; }
     return;
@@ -46,11 +48,14 @@ void sport0_rx_isr() {
   iTxBuf[INTERNAL_DAC_L1] = out[2] >> 8;
   iTxBuf[INTERNAL_DAC_R1] = out[3] >> 8;
 
+  // apply some pending param changes
+  ctl_next_frame();
+
   // module-defined frame processing function
   module_process_frame();
 
   // inform the world we're ready to receive param changes
-  READY_HI;
+  if(ctl_param_ready()) { READY_HI; }
   
   /// if this interrupt came from DMA1, clear it and continue(W1C)
   if(*pDMA1_IRQ_STATUS & 1) { *pDMA1_IRQ_STATUS = 0x0001; }
@@ -68,5 +73,6 @@ void sport1_tx_isr() {
 void spi_rx_isr() {
   READY_LO;
   *pSPI_TDBR = spi_process(*pSPI_RDBR);
-  READY_HI;
+  // hold off the avr32 while the param queue is full
+  if(ctl_param_ready()) { READY_HI; }
 }
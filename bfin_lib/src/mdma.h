@@ -0,0 +1,19 @@
+/* mdma.h
+ * aleph-blackfin audio core
+ *
+ * memory-to-memory DMA, on stream 0.
+ * one copy at a time; starting a copy waits for the last one.
+ */
+
+#ifndef _ALEPH_BFIN_MDMA_H_
+#define _ALEPH_BFIN_MDMA_H_
+
+#include "types.h"
+
+// start copying bytes (a multiple of 2, 2-byte aligned) and return;
+// 32-bit transfers are used when everything is 4-byte aligned
+extern void mdma_copy(void* dst, const void* src, u32 bytes);
+// wait for the last copy to complete
+extern void mdma_wait(void);
+
+#endif // header guard
@@ -21,6 +21,10 @@
 #define SDRAM_ADDRESS 0x00000000
 #define SDRAM_SIZE    0x07ffffff
 
+// declare the module's real SDRAM footprint (its external data struct),
+// at file scope in the module source:  MODULE_SDRAM(linesData);
+#define MODULE_SDRAM(type) \
+  typedef char module_sdram_fits[(sizeof(type) <= SDRAM_SIZE) ? 1 : -1]
 
 #else
 void *SDRAM_ADDRESS;
@@ -34,6 +38,14 @@ fract32 out[OUT_PORTS];
 void module_init(void);
 void module_process_frame(void);
 
+// on linux the footprint is what a host allocates per instance.
+// modules that don't declare one get all of SDRAM_SIZE.
+extern const u32 moduleSdramBytes __attribute__((weak));
+#define MODULE_SDRAM(type) const u32 moduleSdramBytes = sizeof(type)
+
+static inline u32 module_sdram_bytes(void) {
+  return &moduleSdramBytes != 0 ? moduleSdramBytes : SDRAM_SIZE;
+}
 
 #endif
 
@@ -17,6 +17,7 @@ bfin_lib_src = audio.c \
 	dma.c \
 	isr.c \
 	main.c \
+	mdma.c \
 	serial.c \
 	spi.c
 
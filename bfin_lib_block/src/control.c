@@ -4,11 +4,37 @@
 #include "gpio.h"
 #include "module.h"
 
+/*
+  param changes from the SPI ISR are queued here,
+  and applied from the audio ISR, up to a fixed count per block.
+
+  the SPI ISR is the only writer and the audio ISR the only reader.
+  each index is stored by one side only, so there is no shared counter.
+  the audio ISR has higher priority and can preempt the SPI ISR,
+  so the producer masks interrupts where it touches a pending entry.
+ */
+
+#ifdef ARCH_BFIN
+// mask interrupts, saving IMASK in m / restore IMASK from m
+#define CONTROL_IRQ_SAVE(m)    asm volatile ("cli %0; csync;" : "=d"(m))
+#define CONTROL_IRQ_RESTORE(m) asm volatile ("sti %0; csync;" : : "d"(m))
+#else
+#define CONTROL_IRQ_SAVE(m)    (m) = 0
+#define CONTROL_IRQ_RESTORE(m) (void)(m)
+#endif
+
 // size of control change FIFO...
 // FIXME: should this be module-defined?
 // how to choose a good value?
 #define CONTROL_Q_SIZE 64
 
+// max param changes applied per audio block.
+// anything left over waits for the next block.
+#define CONTROL_CHANGES_PER_BLOCK 8
+
+// param indices are single bytes on the wire
+#define CONTROL_NUM_IDX 256
+
 // globally visible cycle count result
 // volatile u64 controlCycleCount;
 // temp
@@ -20,46 +46,84 @@ typedef struct {
 } change_t;
 
 static change_t q[CONTROL_Q_SIZE];
-static u16 qIdxWr = 0;
-static u16 qIdxRd = 0;
-static u16 qCount = 0;
+// write count, stored only by the producer
+static volatile u32 qIdxWr = 0;
+// read count, stored by the consumer
+// (and by the producer, masked, on overflow)
+static volatile u32 qIdxRd = 0;
+// queue position of each pending param (+1; 0 == not pending)
+static volatile u8 qPos[CONTROL_NUM_IDX];
+
+// apply the change at the read position
+static void control_apply_next(void) {
+  const u32 pos = qIdxRd & (CONTROL_Q_SIZE - 1);
+  const u32 idx = q[pos].idx;
+  // clear the flag first, so the value can't be updated after it's read
+  qPos[idx] = 0;
+  module_set_param(idx, q[pos].val);
+  qIdxRd = qIdxRd + 1;
+}
 
 void control_add(u32 idx, ParamValue val) {
+  u32 pos;
+  u32 imask;
   // shouldn't happen..
   //  if(!isModuleInit) { return; }
-  if(qCount >= CONTROL_Q_SIZE) {
-    // queue is full! indicate with LED3
-    LED3_LO; 
-  } else {  
-    q[qIdxWr].idx = idx;
-    q[qIdxWr].val = val;
-    qIdxWr = (qIdxWr + 1) & (CONTROL_Q_SIZE - 1);
-    qCount++;
+  if(idx >= CONTROL_NUM_IDX) { return; }
+
+  // the audio ISR may take this entry between the check and the store
+  CONTROL_IRQ_SAVE(imask);
+  if(qPos[idx] > 0) {
+    // already pending; only the latest value matters
+    q[qPos[idx] - 1].val = val;
+    CONTROL_IRQ_RESTORE(imask);
+    return;
+  }
+  if((qIdxWr - qIdxRd) >= CONTROL_Q_SIZE) {
+    // the ready pin holds off the avr32 while the queue is full,
+    // so this only happens if the sender ignored it.
+    // make room by applying the oldest change, which keeps the order.
+    // indicate with LED3
+    LED3_LO;
+    control_apply_next();
   }
-   
+  CONTROL_IRQ_RESTORE(imask);
+
+  // add a new change; the reader can't see it until the write count moves
+  pos = qIdxWr & (CONTROL_Q_SIZE - 1);
+  q[pos].idx = idx;
+  q[pos].val = val;
+  qPos[idx] = pos + 1;
+  qIdxWr = qIdxWr + 1;
 }
 
 void control_process(void) {
-  u16 i;
-  ParamValue val;
-  u32 idx;
+  u16 n = CONTROL_CHANGES_PER_BLOCK;
 
   //  START_CYCLE_COUNT(startCycleCount);
  
-  for(i=0; i<qCount; i++) {
-    idx = q[qIdxRd].idx;
-    val = q[qIdxRd].val;
-    module_set_param(idx, val);
-    qIdxRd = (qIdxRd + 1) & (CONTROL_Q_SIZE - 1);
+  while((qIdxWr != qIdxRd) && (n > 0)) {
+    control_apply_next();
+    n--;
   }
-  qCount = 0;
 
   //  STOP_CYCLE_COUNT(controlCycleCount, startCycleCount);
 }
 
 
 void control_reset(void) {
-  qIdxWr = 0;
+  u16 i;
+  for(i=0; i<CONTROL_NUM_IDX; i++) {
+    qPos[i] = 0;
+  }
   qIdxRd = 0;
-  qCount = 0;
+  qIdxWr = 0;
+}
+
+u16 control_num_pending(void) {
+  return (u16)(qIdxWr - qIdxRd);
+}
+
+u8 control_ready(void) {
+  return (qIdxWr - qIdxRd) < CONTROL_Q_SIZE;
 }
@@ -14,15 +14,23 @@
 //! keep track of cycles spent processing each param change block
 // extern volatile u64 controlCycleCount;
 
-//! add a parameter change to the queue
+//! add a parameter change to the queue.
+//! a param that is already queued just gets its value replaced.
 //! should be called with interrupts disabled (e.g. from an ISR)
 extern void control_add(u32 idx, ParamValue val);
 
-//! process pending param changes.
+//! process pending param changes, up to a fixed count per block.
 //! should be called with interrupts disabled (e.g. from an ISR)
 extern void control_process(void);
 
 //! reset the control change queue
 extern void control_reset(void);
 
+//! count of pending param changes
+extern u16 control_num_pending(void);
+
+//! non-zero if a new param change can be queued
+//! (raise the ready pin only when this is true)
+extern u8 control_ready(void);
+
 #endif
@@ -3,6 +3,7 @@
 #include "ccblkfn.h"
 
 #include "audio.h"
+#include "control.h"
 #include "dma.h"
 #include "gpio.h"
 #include "isr.h"
@@ -29,7 +30,7 @@ void sport0_rx_isr(void) {
   *pDMA1_IRQ_STATUS = 0x0001;
   ssync();
   
-  READY_HI;
+  if(control_ready()) { READY_HI; }
 }
 
 
@@ -54,7 +55,7 @@ void sport0_tx_isr(void) {
   *pDMA2_IRQ_STATUS = 0x0001;
   ssync();
 
-  READY_HI;
+  if(control_ready()) { READY_HI; }
 }
 
 
@@ -69,7 +70,7 @@ void spi_isr(void) {
   tx = spi_handle_byte(rx);
   *pSPI_TDBR = tx;
   
-  READY_HI; 
+  if(control_ready()) { READY_HI; }
 }
 
 
@@ -0,0 +1,50 @@
+/* mdma.c
+ * aleph-blackfin audio core
+ *
+ * memory-to-memory DMA, on stream 0.
+ * completion is polled; the MDMA interrupt stays masked.
+ */
+
+#include <blackfin.h>
+#include <cdefBF533.h>
+#include "ccblkfn.h"
+
+#include "mdma.h"
+
+// a copy has been started and not waited for
+static volatile u8 busy = 0;
+
+void mdma_copy(void* dst, const void* src, u32 bytes) {
+  u16 wdsize = WDSIZE_32;
+  u8 shift = 2;
+  mdma_wait();
+  // 32-bit words, linear; 16-bit words if anything is only 2-byte aligned
+  if(((u32)dst | (u32)src | bytes) & 3) {
+    wdsize = WDSIZE_16;
+    shift = 1;
+  }
+  *pMDMA_S0_START_ADDR = (void*)src;
+  *pMDMA_S0_X_COUNT = bytes >> shift;
+  *pMDMA_S0_X_MODIFY = 1 << shift;
+  *pMDMA_D0_START_ADDR = dst;
+  *pMDMA_D0_X_COUNT = bytes >> shift;
+  *pMDMA_D0_X_MODIFY = 1 << shift;
+  // source first, then destination starts the transfer.
+  // DI_EN is needed for DMA_DONE to be reported.
+  *pMDMA_S0_CONFIG = wdsize | DMAEN;
+  *pMDMA_D0_CONFIG = WNR | wdsize | DI_EN | DMAEN;
+  ssync();
+  busy = 1;
+}
+
+void mdma_wait(void) {
+  if(busy) {
+    while((*pMDMA_D0_IRQ_STATUS & DMA_DONE) == 0) { ;; }
+    // write-1-to-clear
+    *pMDMA_D0_IRQ_STATUS = DMA_DONE | DMA_ERR;
+    *pMDMA_S0_CONFIG = 0;
+    *pMDMA_D0_CONFIG = 0;
+    ssync();
+    busy = 0;
+  }
+}
@@ -16,6 +16,11 @@
 #define SDRAM_ADDRESS 0x00000000
 #define SDRAM_SIZE    0x07ffffff
 
+//! declare the module's real SDRAM footprint (its external data struct),
+//! at file scope in the module source:  MODULE_SDRAM(linesData);
+#define MODULE_SDRAM(type) \
+  typedef char module_sdram_fits[(sizeof(type) <= SDRAM_SIZE) ? 1 : -1]
+
 //! global module data type
 typedef struct _moduleData {
   char name[MODULE_NAME_LEN];
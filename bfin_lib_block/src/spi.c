@@ -1,4 +1,5 @@
 // aleph/common
+#include "param_batch.h"
 #include "param_common.h"
 #include "protocol.h"
 
@@ -18,6 +19,10 @@ static eSpiByte byte = eCom;
 static u8 com;
 // current param index
 static u8 idx;
+// batched param change decoder
+static ParamBatchDecoder batch;
+// value from batch decoder
+static ParamValue batchVal;
 
 // temp value
 static ParamValueSwap pval;
@@ -41,6 +46,10 @@ u8 spi_handle_byte(u8 rx) {
     case MSG_SET_PARAM_COM:
       byte = eSetParamIdx;
       break;
+    case MSG_SET_PARAM_BATCH_COM:
+      param_batch_decode_start(&batch);
+      byte = batch.byte;
+      break;
     case MSG_GET_PARAM_COM:
       byte = eGetParamIdx;
       break;
@@ -122,6 +131,20 @@ u8 spi_handle_byte(u8 rx) {
     break;
 
 
+    //---- set param batch
+  case eSetParamBatchCount :
+  case eSetParamBatchIdx :
+  case eSetParamBatchData0 :
+  case eSetParamBatchData1 :
+  case eSetParamBatchData2 :
+  case eSetParamBatchData3 :
+    if(param_batch_decode(&batch, rx, &idx, &batchVal)) {
+      spi_set_param(idx, batchVal);
+    }
+    byte = batch.byte;
+    return 0; // don't care
+    break;
+
     //---- get param
   case eGetParamIdx :
     idx = rx; // set index
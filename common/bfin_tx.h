@@ -0,0 +1,164 @@
+/*
+   bfin_tx.h
+
+   common
+   aleph
+
+   ring of outgoing protocol frames for the avr32 -> bfin link.
+
+   the main loop pushes complete frames (e.g. a param batch message)
+   and never waits on the bus. a transport (DMA on the avr32,
+   a simulated bus on the host) takes contiguous chunks of the oldest
+   unsent frame and reports what it has sent; the main loop later
+   reaps finished frames, freeing their space and running their
+   completion callbacks in its own context.
+
+   ownership:
+     producer (main loop) : byteHead, frameHead, byteTail, frameTail
+     transport (may be an ISR) : frameSent, sentBytes
+
+   a push that does not fit returns non-zero and leaves the ring as is;
+   the caller keeps the data and tries again later (backpressure).
+
+   everything here is static inline and hardware-independent.
+
+ */
+
+#ifndef _ALEPH_COMMON_BFIN_TX_H_
+#define _ALEPH_COMMON_BFIN_TX_H_
+
+#include "types.h"
+
+// ring size in bytes (power of two, divides 0x10000)
+#define BFIN_TX_RING_BYTES 2048
+// max frames in flight (power of two)
+#define BFIN_TX_RING_FRAMES 16
+
+#define BFIN_TX_BYTE_MASK (BFIN_TX_RING_BYTES - 1)
+#define BFIN_TX_FRAME_MASK (BFIN_TX_RING_FRAMES - 1)
+
+// completion callback, run from bfin_tx_reap()
+typedef void (*bfin_tx_done_fn)(u32 arg);
+
+typedef struct _BfinTxFrame {
+  // position of first byte (free-running)
+  u16 start;
+  // byte count
+  u16 len;
+  // called once the frame is on the wire (may be NULL)
+  bfin_tx_done_fn done;
+  u32 arg;
+} BfinTxFrame;
+
+typedef struct _BfinTxRing {
+  u8 data[BFIN_TX_RING_BYTES];
+  BfinTxFrame frame[BFIN_TX_RING_FRAMES];
+  // free-running byte counters
+  u16 byteHead;
+  u16 byteTail;
+  // free-running frame counters: pushed, sent, reaped
+  volatile u16 frameHead;
+  volatile u16 frameSent;
+  u16 frameTail;
+  // bytes of the frame at frameSent already sent
+  volatile u16 sentBytes;
+  // pushes refused for lack of space
+  u32 full;
+} BfinTxRing;
+
+static inline void bfin_tx_init(BfinTxRing* r) {
+  r->byteHead = r->byteTail = 0;
+  r->frameHead = r->frameSent = r->frameTail = 0;
+  r->sentBytes = 0;
+  r->full = 0;
+}
+
+//---------------------------
+//--- producer
+
+// copy a frame into the ring.
+// returns 0 on success, 1 if there is no room.
+static inline u8 bfin_tx_push(BfinTxRing* r, const u8* src, u16 len,
+			      bfin_tx_done_fn done, u32 arg) {
+  BfinTxFrame* f;
+  u16 pos;
+  u16 i;
+  if(len == 0) { return 0; }
+  if((u16)(r->frameHead - r->frameTail) >= BFIN_TX_RING_FRAMES
+     || (u16)(BFIN_TX_RING_BYTES - (u16)(r->byteHead - r->byteTail)) < len) {
+    ++(r->full);
+    return 1;
+  }
+  pos = r->byteHead;
+  for(i=0; i<len; ++i) {
+    r->data[(u16)(pos + i) & BFIN_TX_BYTE_MASK] = src[i];
+  }
+  r->byteHead = pos + len;
+  f = &(r->frame[r->frameHead & BFIN_TX_FRAME_MASK]);
+  f->start = pos;
+  f->len = len;
+  f->done = done;
+  f->arg = arg;
+  // publish last
+  r->frameHead = r->frameHead + 1;
+  return 0;
+}
+
+// retire frames the transport has finished with,
+// running their callbacks. returns count of frames retired.
+static inline u16 bfin_tx_reap(BfinTxRing* r) {
+  BfinTxFrame* f;
+  u16 n = 0;
+  while(r->frameTail != r->frameSent) {
+    f = &(r->frame[r->frameTail & BFIN_TX_FRAME_MASK]);
+    r->byteTail = r->byteTail + f->len;
+    r->frameTail = r->frameTail + 1;
+    ++n;
+    if(f->done) { (*(f->done))(f->arg); }
+  }
+  return n;
+}
+
+// frames pushed but not yet sent
+static inline u16 bfin_tx_pending(BfinTxRing* r) {
+  return (u16)(r->frameHead - r->frameSent);
+}
+
+// nothing pushed that has not been sent and reaped
+static inline u8 bfin_tx_idle(BfinTxRing* r) {
+  return r->frameTail == r->frameHead;
+}
+
+//---------------------------
+//--- transport
+
+// get the next contiguous run of bytes to send.
+// returns its length, 0 if there is nothing to send.
+// *first is set if this run starts a frame.
+static inline u16 bfin_tx_chunk(BfinTxRing* r, const u8** data, u8* first) {
+  BfinTxFrame* f;
+  u16 off, rem, run;
+  if(r->frameSent == r->frameHead) { return 0; }
+  f = &(r->frame[r->frameSent & BFIN_TX_FRAME_MASK]);
+  off = (u16)(f->start + r->sentBytes) & BFIN_TX_BYTE_MASK;
+  rem = f->len - r->sentBytes;
+  run = BFIN_TX_RING_BYTES - off;
+  *data = &(r->data[off]);
+  *first = (r->sentBytes == 0);
+  return rem < run ? rem : run;
+}
+
+// report n bytes of the current chunk sent.
+// returns 1 if that completed the frame.
+static inline u8 bfin_tx_advance(BfinTxRing* r, u16 n) {
+  BfinTxFrame* f = &(r->frame[r->frameSent & BFIN_TX_FRAME_MASK]);
+  r->sentBytes = r->sentBytes + n;
+  if(r->sentBytes >= f->len) {
+    r->sentBytes = 0;
+    r->frameSent = r->frameSent + 1;
+    return 1;
+  }
+  return 0;
+}
+
+#endif // header guard
@@ -1,29 +1,45 @@
-/* fract32.h
-<<<<<<< HEAD
+/* fract32_emu.h
  *
-=======
- * 
->>>>>>> upstream/master
- * float-conversion and arithmetic functions for fract32 on linux.
- * these should allow compatibility with blackfin bf5xx intrinsics.
+ * fract32 / fract16 / fract2x16 arithmetic for linux builds,
+ * matching the bf5xx intrinsics bit for bit.
  *
+ * everything here is static inline, branch-free where it matters,
+ * and works on plain integers, so loops over sample buffers
+ * can be unrolled and auto-vectorized by gcc / clang.
+ *
+ * semantics are those of the blackfin instructions the bfin-elf-gcc
+ * builtins expand to:
+ *  - add / sub / negate / abs / shifts saturate.
+ *  - 16x16 multiplies are fractional (<< 1); -1 * -1 saturates.
+ *  - mult_fr1x32x32 is the builtin's sum of 16x16 partial products,
+ *    which comes to floor(x*y / 2^31), saturated; except that when both
+ *    high halves are 0x8000 the hi*hi term saturates and the result
+ *    is one lsb lower. the NS variant wraps instead.
+ *  - shift counts keep only their low 6 (fract32) or 5 (fract16) bits,
+ *    sign-extended; the _clip variants clamp the count instead.
+ *  - rounding is biased (round half up), the default RND_MOD.
+ *
+ * float <-> fract conversions are out of line, in fract32_emu.c.
  */
 
+#ifndef _ALEPH_COMMON_FRACT32_EMU_H_
+#define _ALEPH_COMMON_FRACT32_EMU_H_
+
 #include <limits.h>
-#include <stdio.h>
 #include <stdint.h>
 
 #include "types.h"
 
-#if 0
-typedef int32_t fract32;
-typedef int32_t fract16;
-typedef float f32;
-typedef double f64;
-typedef int32_t s32; 
-typedef int64_t s64; 
+#ifndef ARCH_LINUX
+typedef int32_t fract2x16;
 #endif
 
+// 40-bit accumulator, held sign-extended in 64 bits
+typedef int64_t fract40;
+
+#define FR40_MAX ((fract40)0x7fffffffffLL)
+#define FR40_MIN (-FR40_MAX - 1)
+
 //----------------------------
 //----- float <-> fract conversions
 
@@ -33,39 +49,336 @@ extern f32 fr32_to_float(fract32 x);
 // convert float to fract32
 extern fract32 float_to_fr32(f32 x);
 
+//----------------------------
+//----- saturation helpers
+
+static inline fract32 sat_fr32_s64(int64_t x) {
+  return (fract32)(x > INT32_MAX ? INT32_MAX : (x < INT32_MIN ? INT32_MIN : x));
+}
+
+static inline fract16 sat_fr16_s32(int32_t x) {
+  return (fract16)(x > INT16_MAX ? INT16_MAX : (x < INT16_MIN ? INT16_MIN : x));
+}
+
+static inline fract40 sat_fr40_s64(int64_t x) {
+  return x > FR40_MAX ? FR40_MAX : (x < FR40_MIN ? FR40_MIN : x);
+}
+
+// sign-extend the low n bits of a shift count
+static inline int fr_shift_count(int y, int n) {
+  const int m = 1 << (n - 1);
+  return ((y & ((m << 1) - 1)) ^ m) - m;
+}
+
+static inline int fr_clip_count(int y, int lo, int hi) {
+  return y < lo ? lo : (y > hi ? hi : y);
+}
+
+//-------------------------
+//----- fract32 arithmetic
+
+// the 32-bit ops stay in 32-bit lanes (overflow from sign bits),
+// since 64-bit compares keep sse2 from vectorizing.
+
+// value a positive / negative overflow of x saturates to
+static inline fract32 sat_fr32_of(fract32 x) {
+  return (x >> 31) ^ INT32_MAX;
+}
+
+static inline fract32 add_fr1x32(fract32 _x, fract32 _y) {
+  const fract32 r = (fract32)((uint32_t)_x + (uint32_t)_y);
+  return ((_x ^ r) & (_y ^ r)) < 0 ? sat_fr32_of(_x) : r;
+}
+
+static inline fract32 sub_fr1x32(fract32 _x, fract32 _y) {
+  const fract32 r = (fract32)((uint32_t)_x - (uint32_t)_y);
+  return ((_x ^ _y) & (_x ^ r)) < 0 ? sat_fr32_of(_x) : r;
+}
+
+// |x*y >> 31| only reaches 2^31 for -1 * -1,
+// where the high-halves correction brings it back in range.
+static inline fract32 mult_fr1x32x32(fract32 _x, fract32 _y) {
+  const int64_t hh = ((uint32_t)_x >> 16 == 0x8000) & ((uint32_t)_y >> 16 == 0x8000);
+  return (fract32)((((int64_t)_x * _y) >> 31) - hh);
+}
+
+static inline fract32 mult_fr1x32x32NS(fract32 _x, fract32 _y) {
+  return (fract32)(uint32_t)(((int64_t)_x * _y) >> 31);
+}
+
+// 16x16 -> 1.31
+static inline fract32 mult_fr1x32(fract16 _x, fract16 _y) {
+  const int32_t p = (int32_t)_x * _y;
+  return (fract32)(((uint32_t)p << 1) - (uint32_t)(p == 0x40000000));
+}
+
+static inline fract32 negate_fr1x32(fract32 _x) {
+  return (fract32)(0u - (uint32_t)_x - (uint32_t)(_x == INT32_MIN));
+}
+
+static inline fract32 abs_fr1x32(fract32 _x) {
+  return _x < 0 ? negate_fr1x32(_x) : _x;
+}
+
+static inline fract32 min_fr1x32(fract32 _x, fract32 _y) {
+  return _x < _y ? _x : _y;
+}
+
+static inline fract32 max_fr1x32(fract32 _x, fract32 _y) {
+  return _x > _y ? _x : _y;
+}
+
+// shift left by a count in [-32, 31]; negative shifts right
+static inline fract32 ashift_fr1x32(fract32 _x, int s) {
+  const fract32 l = (fract32)((uint32_t)_x << (s & 31));
+  if(s < 0) {
+    return _x >> (s < -31 ? 31 : -s);
+  }
+  return (l >> s) != _x ? sat_fr32_of(_x) : l;
+}
+
+static inline fract32 shl_fr1x32(fract32 _x, int _y) {
+  return ashift_fr1x32(_x, fr_shift_count(_y, 6));
+}
+
+static inline fract32 shl_fr1x32_clip(fract32 _x, int _y) {
+  return ashift_fr1x32(_x, fr_clip_count(_y, -32, 31));
+}
+
+static inline fract32 shr_fr1x32(fract32 _x, int _y) {
+  return ashift_fr1x32(_x, fr_shift_count(-_y, 6));
+}
+
+static inline fract32 shr_fr1x32_clip(fract32 _x, int _y) {
+  return ashift_fr1x32(_x, fr_clip_count(-_y, -32, 31));
+}
+
+// redundant sign bits: left shifts to bring x into
+// [0x40000000, 0x7fffffff] or [0x80000000, 0xc0000000].
+// 0 and -1 give 31, as SIGNBITS does.
+static inline int norm_fr1x32(fract32 _x) {
+  uint32_t v = (uint32_t)(_x ^ (_x >> 31));
+  return __builtin_clz((v << 1) | 1);
+}
+
+//-------------------------
+//----- fract16 arithmetic
+
+static inline fract16 add_fr1x16(fract16 _x, fract16 _y) {
+  return sat_fr16_s32((int32_t)_x + _y);
+}
+
+static inline fract16 sub_fr1x16(fract16 _x, fract16 _y) {
+  return sat_fr16_s32((int32_t)_x - _y);
+}
+
+// truncating
+static inline fract16 mult_fr1x16(fract16 _x, fract16 _y) {
+  return sat_fr16_s32(((int32_t)_x * _y) >> 15);
+}
+
+// rounding
+static inline fract16 multr_fr1x16(fract16 _x, fract16 _y) {
+  return sat_fr16_s32(((int32_t)_x * _y + 0x4000) >> 15);
+}
+
+static inline fract16 abs_fr1x16(fract16 _x) {
+  return sat_fr16_s32(_x < 0 ? -(int32_t)_x : (int32_t)_x);
+}
+
+static inline fract16 abs_fr16(fract16 _x) {
+  return abs_fr1x16(_x);
+}
+
+static inline fract16 negate_fr1x16(fract16 _x) {
+  return sat_fr16_s32(-(int32_t)_x);
+}
+
+static inline fract16 min_fr1x16(fract16 _x, fract16 _y) {
+  return _x < _y ? _x : _y;
+}
+
+static inline fract16 max_fr1x16(fract16 _x, fract16 _y) {
+  return _x > _y ? _x : _y;
+}
+
+static inline fract16 min_fr16(fract16 _x, fract16 _y) {
+  return min_fr1x16(_x, _y);
+}
+
+static inline fract16 max_fr16(fract16 _x, fract16 _y) {
+  return max_fr1x16(_x, _y);
+}
+
+// shift left by a count in [-16, 15]; negative shifts right
+static inline fract16 ashift_fr1x16(fract16 _x, int s) {
+  return s >= 0 ? sat_fr16_s32((int32_t)((uint32_t)(int32_t)_x << s))
+    : (fract16)((int32_t)_x >> -s);
+}
+
+// logical shift by a count in [-16, 15]; negative shifts left
+static inline fract16 lshift_fr1x16(fract16 _x, int s) {
+  return (fract16)(s >= 0 ? (uint16_t)_x >> s : (uint16_t)((uint32_t)(uint16_t)_x << -s));
+}
+
+static inline fract16 shl_fr1x16(fract16 _x, int _y) {
+  return ashift_fr1x16(_x, fr_shift_count(_y, 5));
+}
+
+static inline fract16 shl_fr1x16_clip(fract16 _x, int _y) {
+  return ashift_fr1x16(_x, fr_clip_count(_y, -16, 15));
+}
+
+static inline fract16 shr_fr1x16(fract16 _x, int _y) {
+  return ashift_fr1x16(_x, fr_shift_count(-_y, 5));
+}
+
+static inline fract16 shr_fr1x16_clip(fract16 _x, int _y) {
+  return ashift_fr1x16(_x, fr_clip_count(-_y, -16, 15));
+}
+
+static inline fract16 shrl_fr1x16(fract16 _x, int _y) {
+  return lshift_fr1x16(_x, fr_shift_count(_y, 5));
+}
+
+static inline fract16 shrl_fr1x16_clip(fract16 _x, int _y) {
+  return lshift_fr1x16(_x, fr_clip_count(_y, -16, 15));
+}
+
+// as norm_fr1x32, for 16 bits. 0 and -1 give 15.
+static inline int norm_fr1x16(fract16 _x) {
+  uint32_t v = (uint16_t)(_x ^ (_x >> 15));
+  return __builtin_clz((v << 17) | 0x10000);
+}
+
 //-------------------------
-//----- arithmetic
+//----- fract32 <-> fract16
+
+// saturate to 16 bits
+static inline fract16 sat_fr1x32(fract32 _x) {
+  return sat_fr16_s32(_x);
+}
 
-// 32-bit add
-extern fract32 add_fr1x32(fract32 _x, fract32 _y);
+// high half, rounded
+static inline fract16 round_fr1x32(fract32 _x) {
+  return sat_fr16_s32((fract32)(((int64_t)_x + 0x8000) >> 16));
+}
 
-// 32-bit sub
-extern fract32 sub_fr1x32(fract32 _x, fract32 _y);
+// high half, truncated
+static inline fract16 trunc_fr1x32(fract32 _x) {
+  return (fract16)(_x >> 16);
+}
+
+//-------------------------
+//----- fract2x16
 
-// 32-bit mult with 40-bit buffer
-extern fract32 mult_fr1x32x32(fract32 _x, fract32 _y);
+static inline fract2x16 compose_fr2x16(fract16 _h, fract16 _l) {
+  return (fract2x16)(((uint32_t)(uint16_t)_h << 16) | (uint16_t)_l);
+}
 
-// div
+static inline fract16 high_of_fr2x16(fract2x16 _x) {
+  return (fract16)(_x >> 16);
+}
+
+static inline fract16 low_of_fr2x16(fract2x16 _x) {
+  return (fract16)_x;
+}
+
+// apply a fract16 op to both halves
+#define FR2X16_OP2(op, x, y) \
+  compose_fr2x16(op(high_of_fr2x16(x), high_of_fr2x16(y)),	\
+		 op(low_of_fr2x16(x), low_of_fr2x16(y)))
+#define FR2X16_SHIFT(op, x, s) \
+  compose_fr2x16(op(high_of_fr2x16(x), s), op(low_of_fr2x16(x), s))
+
+static inline fract2x16 add_fr2x16(fract2x16 _x, fract2x16 _y) {
+  return FR2X16_OP2(add_fr1x16, _x, _y);
+}
+
+static inline fract2x16 sub_fr2x16(fract2x16 _x, fract2x16 _y) {
+  return FR2X16_OP2(sub_fr1x16, _x, _y);
+}
+
+static inline fract2x16 mult_fr2x16(fract2x16 _x, fract2x16 _y) {
+  return FR2X16_OP2(mult_fr1x16, _x, _y);
+}
+
+static inline fract2x16 multr_fr2x16(fract2x16 _x, fract2x16 _y) {
+  return FR2X16_OP2(multr_fr1x16, _x, _y);
+}
+
+static inline fract2x16 min_fr2x16(fract2x16 _x, fract2x16 _y) {
+  return FR2X16_OP2(min_fr1x16, _x, _y);
+}
+
+static inline fract2x16 max_fr2x16(fract2x16 _x, fract2x16 _y) {
+  return FR2X16_OP2(max_fr1x16, _x, _y);
+}
+
+static inline fract2x16 negate_fr2x16(fract2x16 _x) {
+  return compose_fr2x16(negate_fr1x16(high_of_fr2x16(_x)),
+			negate_fr1x16(low_of_fr2x16(_x)));
+}
+
+static inline fract2x16 abs_fr2x16(fract2x16 _x) {
+  return compose_fr2x16(abs_fr1x16(high_of_fr2x16(_x)),
+			abs_fr1x16(low_of_fr2x16(_x)));
+}
+
+static inline fract2x16 shl_fr2x16(fract2x16 _x, int _y) {
+  return FR2X16_SHIFT(shl_fr1x16, _x, _y);
+}
+
+static inline fract2x16 shl_fr2x16_clip(fract2x16 _x, int _y) {
+  return FR2X16_SHIFT(shl_fr1x16_clip, _x, _y);
+}
+
+static inline fract2x16 shr_fr2x16(fract2x16 _x, int _y) {
+  return FR2X16_SHIFT(shr_fr1x16, _x, _y);
+}
+
+static inline fract2x16 shr_fr2x16_clip(fract2x16 _x, int _y) {
+  return FR2X16_SHIFT(shr_fr1x16_clip, _x, _y);
+}
+
+static inline fract2x16 shrl_fr2x16(fract2x16 _x, int _y) {
+  return FR2X16_SHIFT(shrl_fr1x16, _x, _y);
+}
+
+static inline fract2x16 shrl_fr2x16_clip(fract2x16 _x, int _y) {
+  return FR2X16_SHIFT(shrl_fr1x16_clip, _x, _y);
+}
+
+//-------------------------
+//----- 40-bit accumulator (A0 / A1)
 
-// abs
-extern fract32 abs_fr1x32(fract32 _x);
+// a0 = x * y
+static inline fract40 mult_fr1x40(fract16 _x, fract16 _y) {
+  return (fract40)mult_fr1x32(_x, _y);
+}
 
-// negation
-extern fract32 negate_fr1x32(fract32 _x);
+// a0 += x * y
+static inline fract40 mac_fr1x40(fract40 _a, fract16 _x, fract16 _y) {
+  return sat_fr40_s64(_a + mult_fr1x32(_x, _y));
+}
 
-// minimum
-extern fract32 min_fr1x32(fract32 _x, fract32 _y);
+// a0 -= x * y
+static inline fract40 msu_fr1x40(fract40 _a, fract16 _x, fract16 _y) {
+  return sat_fr40_s64(_a - mult_fr1x32(_x, _y));
+}
 
-// maximum
-extern fract32 max_fr1x32(fract32 _x, fract32 _y);
+static inline fract40 add_fr1x40(fract40 _a, fract40 _b) {
+  return sat_fr40_s64(_a + _b);
+}
 
-// left shift (with sign extension)
-extern fract32 shl_fr1x32(fract32 _x, int _y);
-extern fract32 shl_fr1x32_clip(fract32 _x, int _y);
+// r0 = a0
+static inline fract32 fr40_to_fr32(fract40 _a) {
+  return sat_fr32_s64(_a);
+}
 
-// right shift (with sign extension)
-extern fract32 shr_fr1x32(fract32 _x, int _y);
-extern fract32 shr_fr1x32_clip(fract32 _x, int _y);
+// r0.h = a0 (rounded)
+static inline fract16 fr40_to_fr16(fract40 _a) {
+  return sat_fr16_s32(sat_fr32_s64((_a + 0x8000) >> 16));
+}
 
-// normalize ( to [0x40000000, 0x7fffffff] or [0x80000000, 0xc0000000] )
-extern int norm_fr1x32(fract32 _x);
+#endif // header guard
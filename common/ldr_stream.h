@@ -0,0 +1,81 @@
+/*
+   ldr_stream.h
+
+   common
+   aleph
+
+   chunked pipeline for booting the blackfin from a file,
+   without holding the whole .ldr image in RAM.
+
+   the image is read in sector-sized chunks into one of two buffers.
+   each chunk is handed to a sink, which may keep sending it
+   while the source fills the other buffer;
+   the sink is flushed before its buffer is reused.
+
+   peak memory is LDR_STREAM_BUFS * LDR_STREAM_CHUNK bytes,
+   and when the sink can drain while the source is busy,
+   total time approaches max(read, transfer) rather than their sum.
+
+   everything here is static inline and hardware-independent,
+   so the same pipeline runs on the avr32 (SD -> boot SPI)
+   and on the host (image file -> recording sink).
+
+ */
+
+#ifndef _ALEPH_COMMON_LDR_STREAM_H_
+#define _ALEPH_COMMON_LDR_STREAM_H_
+
+#include "types.h"
+
+// bytes per chunk (one FAT sector)
+#define LDR_STREAM_CHUNK 512
+// ping-pong
+#define LDR_STREAM_BUFS 2
+
+// read up to len bytes into dst.
+// return the number of bytes read, 0 at end of data.
+typedef u32 (*ldr_read_fn)(void* src, u8* dst, u32 len);
+
+typedef struct _LdrSink {
+  // called once before the first chunk, with the total size if known
+  void (*begin)(struct _LdrSink* sink, u32 size);
+  // hand over a chunk. the data stays valid until the next flush,
+  // so the sink may return before all of it has been sent.
+  void (*write)(struct _LdrSink* sink, const u8* data, u32 len);
+  // block until everything handed over has been sent
+  void (*flush)(struct _LdrSink* sink);
+  // called once after the last chunk has been flushed
+  void (*end)(struct _LdrSink* sink);
+  // sink-specific state
+  void* ctx;
+} LdrSink;
+
+// pipeline buffers, supplied by the caller
+typedef struct _LdrStreamBufs {
+  u8 buf[LDR_STREAM_BUFS][LDR_STREAM_CHUNK];
+} LdrStreamBufs;
+
+// run the pipeline from src to sink.
+// size is passed through to the sink's begin().
+// returns total bytes sent.
+static inline u32 ldr_stream(ldr_read_fn read, void* src, LdrSink* sink,
+			     LdrStreamBufs* bufs, u32 size) {
+  u32 total = 0;
+  u32 n;
+  u8 cur = 0;
+
+  n = read(src, bufs->buf[cur], LDR_STREAM_CHUNK);
+  sink->begin(sink, size);
+  while(n > 0) {
+    sink->write(sink, bufs->buf[cur], n);
+    total += n;
+    cur ^= 1;
+    // fill the other buffer while the sink drains this one
+    n = read(src, bufs->buf[cur], LDR_STREAM_CHUNK);
+    sink->flush(sink);
+  }
+  sink->end(sink);
+  return total;
+}
+
+#endif // header guard
@@ -0,0 +1,120 @@
+/*
+   param_batch.h
+
+   common
+   aleph
+
+   encoder / decoder for the batched parameter-change SPI message.
+
+   wire format (MSG_SET_PARAM_BATCH_COM):
+
+     [com] [count] ( [idx] [val3] [val2] [val1] [val0] ) x count
+
+   values go out most significant byte first,
+   same as the single MSG_SET_PARAM_COM message from the (BE) avr32.
+
+   everything here is static inline and hardware-independent,
+   so the same code runs on avr32, blackfin and the host simulators.
+
+ */
+
+#ifndef _ALEPH_COMMON_PARAM_BATCH_H_
+#define _ALEPH_COMMON_PARAM_BATCH_H_
+
+#include "param_common.h"
+#include "protocol.h"
+#include "types.h"
+
+// max (idx, value) pairs in one message (count is a single byte)
+#define PARAM_BATCH_MAX 255
+// bytes per (idx, value) pair
+#define PARAM_BATCH_PAIR_BYTES 5
+// command + count
+#define PARAM_BATCH_HEAD_BYTES 2
+// bytes on the wire for a batch of n params
+#define PARAM_BATCH_BYTES(n) (PARAM_BATCH_HEAD_BYTES + (n) * PARAM_BATCH_PAIR_BYTES)
+
+// decoder state
+typedef struct _ParamBatchDecoder {
+  // current node in the SPI state machine
+  eSpiByte byte;
+  // pairs remaining in this message
+  u8 count;
+  // index of the pair being received
+  u8 idx;
+  // value of the pair being received
+  u32 val;
+} ParamBatchDecoder;
+
+//---------------------------
+//--- encoder
+
+// write a complete batch message to dst.
+// count must be <= PARAM_BATCH_MAX.
+// returns number of bytes written.
+static inline u32 param_batch_encode(u8* dst, const u8* idx,
+				     const ParamValue* val, u8 count) {
+  u8* p = dst;
+  u32 v;
+  u8 i;
+  *p++ = MSG_SET_PARAM_BATCH_COM;
+  *p++ = count;
+  for(i=0; i<count; ++i) {
+    v = (u32)(val[i]);
+    *p++ = idx[i];
+    *p++ = (u8)(v >> 24);
+    *p++ = (u8)(v >> 16);
+    *p++ = (u8)(v >> 8);
+    *p++ = (u8)v;
+  }
+  return (u32)(p - dst);
+}
+
+//---------------------------
+//--- decoder
+
+// call after receiving MSG_SET_PARAM_BATCH_COM
+static inline void param_batch_decode_start(ParamBatchDecoder* dec) {
+  dec->byte = eSetParamBatchCount;
+  dec->count = 0;
+}
+
+// process one byte following the command byte.
+// returns 1 and fills idx / val when a param change is complete.
+// when the message is finished, dec->byte returns to eCom.
+static inline u8 param_batch_decode(ParamBatchDecoder* dec, u8 rx,
+				    u8* idx, ParamValue* val) {
+  switch(dec->byte) {
+  case eSetParamBatchCount :
+    dec->count = rx;
+    dec->byte = (rx > 0) ? eSetParamBatchIdx : eCom;
+    return 0;
+  case eSetParamBatchIdx :
+    dec->idx = rx;
+    dec->byte = eSetParamBatchData0;
+    return 0;
+  case eSetParamBatchData0 :
+    dec->val = (u32)rx << 24;
+    dec->byte = eSetParamBatchData1;
+    return 0;
+  case eSetParamBatchData1 :
+    dec->val |= (u32)rx << 16;
+    dec->byte = eSetParamBatchData2;
+    return 0;
+  case eSetParamBatchData2 :
+    dec->val |= (u32)rx << 8;
+    dec->byte = eSetParamBatchData3;
+    return 0;
+  case eSetParamBatchData3 :
+    dec->val |= (u32)rx;
+    *idx = dec->idx;
+    *val = (ParamValue)(dec->val);
+    dec->byte = (--(dec->count) > 0) ? eSetParamBatchIdx : eCom;
+    return 1;
+  default:
+    dec->byte = eCom;
+    return 0;
+  }
+}
+
+#endif // header guard
@@ -31,6 +31,10 @@
 #define MSG_GET_AUDIO_CPU_COM           9
 // get param change CPU use (0 - 0x7fffffff)
 #define MSG_GET_CONTROL_CPU_COM         10
+// set many params in one burst:
+// count byte, then (idx, 4 value bytes) for each param
+// (see param_batch.h)
+#define MSG_SET_PARAM_BATCH_COM         11
 
 // enumerate state-machine nodes for sending and receiving SPI.
 
@@ -107,6 +111,14 @@ typedef enum {
   eGetControlCpuData0,
   eGetControlCpuData1,
   eGetControlCpuData2,
+
+  //---- set param batch
+  eSetParamBatchCount,
+  eSetParamBatchIdx,
+  eSetParamBatchData0,
+  eSetParamBatchData1,
+  eSetParamBatchData2,
+  eSetParamBatchData3,
   
   eNumSpiBytes
 } eSpiByte;
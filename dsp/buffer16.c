@@ -30,7 +30,7 @@
 //---- extern
 
 //---- non-interpolated
-void buffer16_init(audioBuffer16 *buf, fract16 *data, u32 frames) {
+void buffer16_init(audioBuffer16 *buf, volatile fract16 *data, u32 frames) {
   //u32 i;
   buf->data = data;
   buf->frames = frames;
@@ -114,10 +114,7 @@ void buffer16_tapN_sync(buffer16TapN* tap, buffer16TapN* target, u32 samps) {
 
 // set tap position directly (wraps to loop)
 void buffer16_tapN_set_pos(buffer16TapN* tap, u32 samps) {
-  while(samps > tap->loop) {
-    samps -= tap->loop;
-  }
-  tap->idx = samps;
+  tap->idx = samps % tap->loop;
 }
 
 // copy all params
@@ -38,7 +38,7 @@ typedef struct _buffer16Tap {
 // initialize a (mono) audio buffer16 at pre-allocated memory.
 // provide 2nd pointer for data,
 // so it can be placed in an arbitrarily separate memory region.
-extern void buffer16_init(audioBuffer16* buf, fract16* data, u32 frames);
+extern void buffer16_init(audioBuffer16* buf, volatile fract16* data, u32 frames);
 
 // intialize tap
 extern void buffer16_tap_init(buffer16Tap* tap, audioBuffer16* buf);
@@ -0,0 +1,179 @@
+/* buffer_stage.c
+ * aleph
+ */
+
+#include <string.h>
+
+#include "buffer_stage.h"
+
+//-----------------------
+//---- memcpy copier
+
+static void memcpy_copy(void* dst, const void* src, u32 bytes) {
+  memcpy(dst, src, bytes);
+}
+
+static void memcpy_wait(void) {
+  ;;
+}
+
+bufferStageCopier bufferStageMemcpy = { &memcpy_copy, &memcpy_wait, 0, 0 };
+
+//-----------------------
+//---- static functions
+
+static inline void stage_copy(bufferStage* st, void* dst, const volatile void* src, u32 frames) {
+  st->copier->copy(dst, (const void*)src, frames * sizeof(delaySample));
+  st->copier->bursts++;
+  st->copier->words += frames;
+}
+
+static inline void stage_wait(bufferStage* st) {
+  st->copier->wait();
+}
+
+// frames in a window starting at idx, within the loop.
+// a tap can sit past a loop that was just shortened, until its next step;
+// it gets a single frame, so the window stays inside the buffer.
+static inline u32 win_len(u32 idx, u32 loop) {
+  u32 n = idx < loop ? loop - idx : 1;
+  return n < BUFFER_STAGE_FRAMES ? n : BUFFER_STAGE_FRAMES;
+}
+
+static inline u8 overlaps(u32 a, u32 aLen, u32 b, u32 bLen) {
+  return (a < b + bLen) && (b < a + aLen);
+}
+
+static void win_init(bufferStageWin* w) {
+  w->data = w->mem[0];
+  w->next = w->mem[1];
+  w->start = 0;
+  w->len = 0;
+  w->lo = 0;
+  w->hi = 0;
+  w->nextStart = 0;
+  w->nextLen = 0;
+}
+
+//-----------------------
+//---- external functions
+
+void buffer_stage_init(bufferStage* st, delayBuffer* buf) {
+  u8 i;
+  st->buf = buf;
+  st->copier = &bufferStageMemcpy;
+  for(i=0; i<BUFFER_STAGE_READS; i++) {
+    win_init(&(st->rd[i]));
+  }
+  win_init(&(st->wr));
+  st->direct = 0;
+}
+
+void buffer_stage_set_copier(bufferStage* st, bufferStageCopier* copier) {
+  buffer_stage_sync(st);
+  st->copier = copier;
+}
+
+void buffer_stage_sync(bufferStage* st) {
+  bufferStageWin* w = &(st->wr);
+  u8 i;
+  stage_wait(st);
+  if(w->hi > w->lo) {
+    stage_copy(st, (void*)(st->buf->data + w->start + w->lo), w->data + w->lo, w->hi - w->lo);
+    stage_wait(st);
+  }
+  w->len = 0;
+  w->lo = 0;
+  w->hi = 0;
+  for(i=0; i<BUFFER_STAGE_READS; i++) {
+    st->rd[i].len = 0;
+    st->rd[i].nextLen = 0;
+  }
+}
+
+fract32 buffer_stage_read_miss(bufferStage* st, u8 port, delayTapN* tap) {
+  bufferStageWin* w = &(st->rd[port]);
+  const bufferStageWin* wr = &(st->wr);
+  const u32 idx = tap->idx;
+  u32 len = win_len(idx, tap->loop);
+  u32 k;
+  delaySample* tmp;
+
+  if(overlaps(idx, len, wr->start, wr->len)) {
+    // being written; read through the write window
+    w->len = 0;
+    st->direct++;
+    k = idx - wr->start;
+    if((k - wr->lo) < (wr->hi - wr->lo)) {
+      return delay_sample_load(wr->data[k]);
+    }
+    // anything copying back must land first
+    stage_wait(st);
+    return delay_sample_load(st->buf->data[idx]);
+  }
+
+  if(idx - w->nextStart < w->nextLen) {
+    // fetched ahead
+    tmp = w->data;
+    w->data = w->next;
+    w->next = tmp;
+    w->start = w->nextStart;
+    w->len = w->nextLen;
+  } else {
+    w->start = idx;
+    w->len = len;
+    stage_copy(st, w->data, st->buf->data + idx, len);
+  }
+  stage_wait(st);
+
+  // fetch the window after this one
+  w->nextStart = w->start + w->len;
+  if(w->nextStart >= tap->loop) { w->nextStart = 0; }
+  len = win_len(w->nextStart, tap->loop);
+  if(overlaps(w->nextStart, len, wr->start, wr->len)) {
+    w->nextLen = 0;
+  } else {
+    w->nextLen = len;
+    stage_copy(st, w->next, st->buf->data + w->nextStart, len);
+  }
+  return delay_sample_load(w->data[idx - w->start]);
+}
+
+delaySample* buffer_stage_write_miss(bufferStage* st, delayTapN* tap, u8 keep) {
+  bufferStageWin* w = &(st->wr);
+  const u32 idx = tap->idx;
+  const u32 len = win_len(idx, tap->loop);
+  bufferStageWin* r;
+  delaySample* tmp;
+  u8 i;
+
+  // the other window may still be copying back
+  stage_wait(st);
+  if(w->hi > w->lo) {
+    stage_copy(st, (void*)(st->buf->data + w->start + w->lo), w->data + w->lo, w->hi - w->lo);
+  }
+  tmp = w->data;
+  w->data = w->next;
+  w->next = tmp;
+  w->start = idx;
+  w->len = len;
+
+  // read windows must not see this part of the buffer any more
+  for(i=0; i<BUFFER_STAGE_READS; i++) {
+    r = &(st->rd[i]);
+    if(overlaps(r->start, r->len, idx, len)) { r->len = 0; }
+    if(overlaps(r->nextStart, r->nextLen, idx, len)) { r->nextLen = 0; }
+  }
+
+  w->lo = 0;
+  if(keep) {
+    // old contents are needed; the copy-back above lands first
+    stage_copy(st, w->data, st->buf->data + idx, len);
+    stage_wait(st);
+    w->hi = len;
+  } else {
+    // the caller writes the first frame
+    w->hi = 1;
+  }
+  return w->data;
+}
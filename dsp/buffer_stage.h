@@ -0,0 +1,141 @@
+/* buffer_stage.h
+ * aleph
+ *
+ * L1 staging for non-interpolated taps in an SDRAM audio buffer.
+ *
+ * each tap works on a window of up to BUFFER_STAGE_FRAMES frames,
+ * held in internal memory. read windows are filled from SDRAM in one
+ * burst, and the window after the current one is fetched ahead while
+ * the tap plays through it. the write window is copied back in one
+ * burst when the write tap leaves it, while the tap goes on in a
+ * second window.
+ *
+ * copies go through a copier, which may return before the data has
+ * moved (MDMA on the blackfin); a memcpy copier is provided for hosts.
+ * copies are assumed to complete in the order they are started.
+ *
+ * a read window never overlaps the write window: reading a part of
+ * the buffer that is being written falls back to a direct read,
+ * through the write window where it holds newer data.
+ * so staged taps return exactly what unstaged taps would.
+ *
+ * windows hold frames as stored (see delay_buffer.h);
+ * taps read and write fract32.
+ */
+
+#ifndef _ALEPH_AUDIO_BUFFER_STAGE_H_
+#define _ALEPH_AUDIO_BUFFER_STAGE_H_
+
+#include "delay_buffer.h"
+#include "fract_math.h"
+#include "types.h"
+
+// frames per window
+#define BUFFER_STAGE_FRAMES 32
+// read taps per stage
+#define BUFFER_STAGE_READS 2
+
+//--- copier
+// copy backend.
+typedef struct _bufferStageCopier {
+  // start a copy; may return before it completes
+  void (*copy)(void* dst, const void* src, u32 bytes);
+  // wait for every started copy to complete
+  void (*wait)(void);
+  // bursts and words moved, for checking
+  u32 bursts;
+  u32 words;
+} bufferStageCopier;
+
+// memcpy, for hosts
+extern bufferStageCopier bufferStageMemcpy;
+
+//--- window
+typedef struct _bufferStageWin {
+  // current data; a window of buffer frames [start, start + len)
+  delaySample* data;
+  u32 start;
+  u32 len;
+  // write window: valid frames [lo, hi), relative to start
+  u32 lo;
+  u32 hi;
+  // fetched-ahead (read) or copying-back (write) data
+  delaySample* next;
+  u32 nextStart;
+  u32 nextLen;
+  // storage
+  delaySample mem[2][BUFFER_STAGE_FRAMES];
+} bufferStageWin;
+
+//--- stage
+typedef struct _bufferStage {
+  delayBuffer* buf;
+  bufferStageCopier* copier;
+  bufferStageWin rd[BUFFER_STAGE_READS];
+  bufferStageWin wr;
+  // reads that went straight to SDRAM
+  u32 direct;
+} bufferStage;
+
+// initialize on a buffer, with the memcpy copier
+extern void buffer_stage_init(bufferStage* st, delayBuffer* buf);
+// use another copier
+extern void buffer_stage_set_copier(bufferStage* st, bufferStageCopier* copier);
+// copy back the write window and drop every window,
+// e.g. before touching the buffer data directly
+extern void buffer_stage_sync(bufferStage* st);
+
+// window misses
+extern fract32 buffer_stage_read_miss(bufferStage* st, u8 port, delayTapN* tap);
+extern delaySample* buffer_stage_write_miss(bufferStage* st, delayTapN* tap, u8 keep);
+
+//-----------------------
+//---- inline taps
+
+// non-interpolated read, for read tap number port
+static inline fract32 buffer_stage_read(bufferStage* st, u8 port, delayTapN* tap) {
+  bufferStageWin* w = &(st->rd[port]);
+  u32 k = tap->idx - w->start;
+  if(k < w->len) {
+    return delay_sample_load(w->data[k]);
+  }
+  return buffer_stage_read_miss(st, port, tap);
+}
+
+// non-interpolated write (erases old contents)
+static inline void buffer_stage_write(bufferStage* st, delayTapN* tap, fract32 val) {
+  bufferStageWin* w = &(st->wr);
+  u32 k = tap->idx - w->start;
+  // anywhere in the valid run, or just past its end
+  if(k < w->len && (k - w->lo) <= (w->hi - w->lo)) {
+    w->data[k] = delay_sample_store(val);
+    w->hi += (k == w->hi);
+  } else {
+    *(buffer_stage_write_miss(st, tap, 0)) = delay_sample_store(val);
+  }
+}
+
+// slot holding the current contents at the write tap
+static inline delaySample* buffer_stage_old(bufferStage* st, delayTapN* tap) {
+  bufferStageWin* w = &(st->wr);
+  u32 k = tap->idx - w->start;
+  if((k - w->lo) < (w->hi - w->lo)) {
+    return &(w->data[k]);
+  }
+  return buffer_stage_write_miss(st, tap, 1);
+}
+
+// non-interpolated mix (old + new, arbitrary)
+static inline void buffer_stage_mix(bufferStage* st, delayTapN* tap,
+				    fract32 val, fract32 preLevel) {
+  delaySample* p = buffer_stage_old(st, tap);
+  *p = delay_sample_store(add_fr1x32(mult_fr1x32x32(delay_sample_load(*p), preLevel), val));
+}
+
+// non-interpolated add (new + old (unchanged)
+static inline void buffer_stage_add(bufferStage* st, delayTapN* tap, fract32 val) {
+  delaySample* p = buffer_stage_old(st, tap);
+  *p = delay_sample_store(add_fr1x32(delay_sample_load(*p), val));
+}
+
+#endif // h guard
@@ -112,6 +112,43 @@ extern fract16 delayFadeN_next(delayFadeN* dl, fract16 in) {
   return readVal;
 }
 
+// process a block.
+// fade, pre-level and run flags are copied to locals first:
+// buffer writes could otherwise alias them and force a reload every frame.
+extern void delayFadeN_process_block(delayFadeN* dl, const fract16* in, fract16* out, u16 frames) {
+  const fract16 fadeRd = dl->fadeRd;
+  const fract16 pre = dl->preLevel;
+  const u8 write = dl->write;
+  const u8 runRd = dl->runRd;
+  const u8 runWr = dl->runWr;
+  fract16 readVal;
+  u16 i;
+
+  for(i=0; i<frames; ++i) {
+    // read before write, same as _next()
+    readVal = pan_lin_mix16( buffer16_tapN_read( &(dl->tapRd[0]) ) ,
+			     buffer16_tapN_read( &(dl->tapRd[1]) ) ,
+			     fadeRd );
+    if(write) {
+      if(pre == 0) {
+	buffer16_tapN_write(&(dl->tapWr[0]), in[i]);
+      } else if(pre < 0) {
+	buffer16_tapN_add(&(dl->tapWr[0]), in[i]);
+      } else {
+	buffer16_tapN_mix(&(dl->tapWr[0]), in[i], pre);
+      }
+    }
+    if(runRd) {
+      buffer16_tapN_next( &(dl->tapRd[0]) );
+      buffer16_tapN_next( &(dl->tapRd[1]) );
+    }
+    if(runWr) {
+      buffer16_tapN_next( &(dl->tapWr[0]) );
+    }
+    out[i] = readVal;
+  }
+}
+
 // set loop endpoint in seconds
 extern void delayFadeN_set_loop_sec(delayFadeN* dl, fix16 sec, u8 id) {
   u32 samps = sec_to_frames_trunc(sec);
@@ -47,6 +47,9 @@ typedef struct _delayFadeN {
 extern void delayFadeN_init(delayFadeN* dl, volatile fract16* bufData, u32 frames);
 // get next value given input
 extern fract16 delayFadeN_next(delayFadeN* dl, fract16 in);
+// process a block (in and out may be the same buffer).
+// fade, pre-level and flags are held constant for the block.
+extern void delayFadeN_process_block(delayFadeN* dl, const fract16* in, fract16* out, u16 frames);
 // set loop endpoint in seconds / samples
 extern void delayFadeN_set_loop_sec(delayFadeN* dl, fix16 sec , u8 id );
 extern void delayFadeN_set_loop_samp(delayFadeN* dl, u32 samp , u8 id );
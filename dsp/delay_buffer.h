@@ -0,0 +1,146 @@
+/* delay_buffer.h
+ * aleph
+ *
+ * sample storage for delay lines.
+ *
+ * delay lines keep fract32 frames (buffer). built with BUFFER_16,
+ * they keep fract16 frames instead (buffer16): twice the time fits in
+ * the same memory, and SDRAM traffic is halved.
+ * processing stays in fract32; frames are converted as they are
+ * stored (rounded) and loaded.
+ *
+ * with BUFFER_16, buffer data must be 4-byte aligned,
+ * so that adjacent frames can be loaded as one 2x16 word.
+ */
+
+#ifndef _ALEPH_AUDIO_DELAY_BUFFER_H_
+#define _ALEPH_AUDIO_DELAY_BUFFER_H_
+
+#include "fract_math.h"
+#include "types.h"
+
+#ifdef BUFFER_16
+
+#include "buffer16.h"
+
+typedef fract16 delaySample;
+typedef audioBuffer16 delayBuffer;
+typedef buffer16TapN delayTapN;
+
+#define delay_buffer_init buffer16_init
+#define delay_tapN_init buffer16_tapN_init
+#define delay_tapN_next buffer16_tapN_next
+#define delay_tapN_write buffer16_tapN_write
+#define delay_tapN_sync buffer16_tapN_sync
+#define delay_tapN_set_pos buffer16_tapN_set_pos
+#define delay_tapN_set_inc buffer16_tapN_set_inc
+#define delay_tapN_set_div buffer16_tapN_set_div
+#define delay_tapN_copy buffer16_tapN_copy
+
+static inline delaySample delay_sample_store(fract32 x) {
+  // round, saturating
+  return trunc_fr1x32(add_fr1x32(x, 0x8000));
+}
+
+static inline fract32 delay_sample_load(delaySample x) {
+  return (fract32)x << 16;
+}
+
+// two frames from idx (even), in one 2x16 load;
+// the first frame is in the low half
+static inline void delay_buffer_load_pair(const volatile delaySample* data, u32 idx,
+					  fract32* x) {
+  const u32 w = *((const volatile u32*)(data + idx));
+  x[0] = (fract32)(w << 16);
+  x[1] = (fract32)(w & 0xffff0000);
+}
+
+// frames [idx, idx + 2), wrapping at loop
+static inline void delay_buffer_read2(const delayBuffer* buf, u32 idx, u32 loop,
+				      fract32* x) {
+  const volatile delaySample* data = buf->data;
+  if((idx & 1) == 0 && idx + 2 <= loop) {
+    delay_buffer_load_pair(data, idx, x);
+  } else {
+    x[0] = delay_sample_load(data[idx]);
+    if(++idx >= loop) { idx = 0; }
+    x[1] = delay_sample_load(data[idx]);
+  }
+}
+
+// frames [idx, idx + 4), wrapping at loop
+static inline void delay_buffer_read4(const delayBuffer* buf, u32 idx, u32 loop,
+				      fract32* x) {
+  const volatile delaySample* data = buf->data;
+  u8 i;
+  if(idx + 4 <= loop) {
+    if(idx & 1) {
+      x[0] = delay_sample_load(data[idx]);
+      delay_buffer_load_pair(data, idx + 1, x + 1);
+      x[3] = delay_sample_load(data[idx + 3]);
+    } else {
+      delay_buffer_load_pair(data, idx, x);
+      delay_buffer_load_pair(data, idx + 2, x + 2);
+    }
+  } else {
+    for(i=0; i<4; i++) {
+      x[i] = delay_sample_load(data[idx]);
+      if(++idx >= loop) { idx = 0; }
+    }
+  }
+}
+
+#else // fract32
+
+#include "buffer.h"
+
+typedef fract32 delaySample;
+typedef audioBuffer delayBuffer;
+typedef bufferTapN delayTapN;
+
+#define delay_buffer_init buffer_init
+#define delay_tapN_init buffer_tapN_init
+#define delay_tapN_next buffer_tapN_next
+#define delay_tapN_write buffer_tapN_write
+#define delay_tapN_sync buffer_tapN_sync
+#define delay_tapN_set_pos buffer_tapN_set_pos
+#define delay_tapN_set_inc buffer_tapN_set_inc
+#define delay_tapN_set_div buffer_tapN_set_div
+#define delay_tapN_copy buffer_tapN_copy
+
+static inline delaySample delay_sample_store(fract32 x) {
+  return x;
+}
+
+static inline fract32 delay_sample_load(delaySample x) {
+  return x;
+}
+
+// frames [idx, idx + 2), wrapping at loop
+static inline void delay_buffer_read2(const delayBuffer* buf, u32 idx, u32 loop,
+				      fract32* x) {
+  fract32* data = (fract32*)buf->data;
+  fract32* p = data + idx;
+  x[0] = *p;
+  p = (fract32*)__builtin_bfin_circptr(p, sizeof(fract32), data,
+				       sizeof(fract32) * loop);
+  x[1] = *p;
+}
+
+// frames [idx, idx + 4), wrapping at loop
+static inline void delay_buffer_read4(const delayBuffer* buf, u32 idx, u32 loop,
+				      fract32* x) {
+  fract32* data = (fract32*)buf->data;
+  fract32* p = data + idx;
+  u8 i;
+  x[0] = *p;
+  for(i=1; i<4; i++) {
+    p = (fract32*)__builtin_bfin_circptr(p, sizeof(fract32), data,
+					 sizeof(fract32) * loop);
+    x[i] = *p;
+  }
+}
+
+#endif // BUFFER_16
+
+#endif // h guard
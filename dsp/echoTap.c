@@ -3,7 +3,7 @@
 #include "pan.h"
 
 // intialize tap
-void echoTap_init(echoTap* tap, bufferTapN* tapWr){
+void echoTap_init(echoTap* tap, delayTapN* tapWr){
   tap->tapWr = tapWr;
   tap->idx_last = tapWr->idx;
 
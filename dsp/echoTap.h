@@ -13,7 +13,7 @@
 #include "fix.h"
 #include "fix32.h"
 #include "types.h"
-#include "buffer.h"
+#include "delay_buffer.h"
 #include "pan.h"
 #include "ricks_tricks.h"
 // ---- echoTap
@@ -23,7 +23,7 @@
 // echoWrap is where tap starts to wrap back
 // echoReset is where echo tap wraps back to
 typedef struct _echoTap {
-  bufferTapN* tapWr; // pointer to write head
+  delayTapN* tapWr; // pointer to write head
   s32 time; // delay time in subsamples (1/256 sample)
   s32 idx_last;// last position read from (for antialiasing)
 
@@ -60,36 +60,22 @@ void echoTap_next(echoTap* tap);
 // fixed grain envelope shapes
 fract32 echoTap_envelope(echoTap *tap);
 // intialize tap
-extern void echoTap_init(echoTap* tap, bufferTapN* tapWr);
+extern void echoTap_init(echoTap* tap, delayTapN* tapWr);
 
 // interpolated cubic read
 static inline fract32 echoTap_read_interp_cubic(echoTap* echoTap, s32 time) {
     u32 samp0_index = (echoTap->tapWr->idx
 		       + echoTap->tapWr->loop - 3 - (time >> 8));
     samp0_index = samp0_index % echoTap->tapWr->loop;
-    fract32 *samp0 = (fract32*)echoTap->tapWr->buf->data + samp0_index;
-
-    u32 buffSize = sizeof (fract32) * (u32) echoTap->tapWr->loop;
-    fract32 *buffer = (fract32*)echoTap->tapWr->buf->data;
-    fract32 *samp1 = (fract32*)__builtin_bfin_circptr (samp0,
-    						       sizeof (fract32),
-    						       buffer,
-    						       buffSize);
-    fract32 *samp2 = (fract32*)__builtin_bfin_circptr (samp1,
-    						       sizeof (fract32),
-    						       buffer,
-    						       buffSize);
-    fract32 *samp3 = (fract32*)__builtin_bfin_circptr (samp2,
-    						       sizeof (fract32),
-    						       buffer,
-    						       buffSize);
+    fract32 samp[4];
+    delay_buffer_read4(echoTap->tapWr->buf, samp0_index, echoTap->tapWr->loop, samp);
 
     fract32 inter_sample = shl_fr1x32((time & 0xFF), 23);
 
     fract32 pre_fader;
     //Pick an interpolation method! - linear or cubic?
-    /* pre_fader = pan_lin_mix(*samp2, *samp1, inter_sample); */
-    pre_fader = interp_bspline_fract32(inter_sample, *samp3, *samp2, *samp1, *samp0);
+    /* pre_fader = pan_lin_mix(samp[2], samp[1], inter_sample); */
+    pre_fader = interp_bspline_fract32(inter_sample, samp[3], samp[2], samp[1], samp[0]);
     return pre_fader;
 }
 
@@ -98,19 +84,13 @@ static inline fract32 echoTap_read_interp_linear(echoTap* echoTap, s32 time) {
     u32 samp1_index = (echoTap->tapWr->idx
 		       + echoTap->tapWr->loop - 1 - (time >> 8));
     samp1_index = samp1_index % echoTap->tapWr->loop;
-    fract32 *samp1 = (fract32*)echoTap->tapWr->buf->data + samp1_index;
-
-    u32 buffSize = sizeof (fract32) * (u32) echoTap->tapWr->loop;
-    fract32 *buffer = (fract32*)echoTap->tapWr->buf->data;
-    fract32 *samp2 = (fract32*)__builtin_bfin_circptr (samp1,
-    						       sizeof (fract32),
-    						       buffer,
-    						       buffSize);
+    fract32 samp[2];
+    delay_buffer_read2(echoTap->tapWr->buf, samp1_index, echoTap->tapWr->loop, samp);
 
     fract32 inter_sample = shl_fr1x32((time & 0xFF), 23);
 
     fract32 pre_fader;
-    pre_fader = pan_lin_mix(*samp2, *samp1, inter_sample);
+    pre_fader = pan_lin_mix(samp[1], samp[0], inter_sample);
     return pre_fader;
 }
 
@@ -40,6 +40,25 @@ fract32 env_adsr_next(env_adsr *env) {
 }
 
 
+void env_adsr_process_block(env_adsr *env, fract32 *dst, u16 frames) {
+  u16 i = 0;
+  // attack can end partway through the block
+  while(i < frames && env->envState == adsrAttack) {
+    dst[i++] = env_adsr_next(env);
+  }
+  if(env->envState == adsrDecay) {
+    for(; i < frames; i++) {
+      normalised_logSlew(&(env->envOut), env->sustainLevel, env->decayTime);
+      dst[i] = env->envOut;
+    }
+  } else {
+    for(; i < frames; i++) {
+      normalised_logSlew(&(env->envOut), 0, env->releaseTime);
+      dst[i] = env->envOut;
+    }
+  }
+}
+
 
 void env_adsr_16_init(env_adsr_16 *env) {
   env->envState=adsrRelease;
@@ -76,3 +95,21 @@ fract16 env_adsr_16_next(env_adsr_16 *env) {
   }
   return env->envOut;
 }
+
+void env_adsr_16_process_block(env_adsr_16 *env, fract16 *dst, u16 frames) {
+  u16 i = 0;
+  while(i < frames && env->envState == adsrAttack) {
+    dst[i++] = env_adsr_16_next(env);
+  }
+  if(env->envState == adsrDecay) {
+    for(; i < frames; i++) {
+      normalised_logSlew_16(&(env->envOut), env->sustainLevel, env->decayTime);
+      dst[i] = env->envOut;
+    }
+  } else {
+    for(; i < frames; i++) {
+      normalised_logSlew_16(&(env->envOut), 0, env->releaseTime);
+      dst[i] = env->envOut;
+    }
+  }
+}
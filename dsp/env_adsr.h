@@ -26,6 +26,8 @@ void env_adsr_release (env_adsr *env);
 
 fract32 env_adsr_next(env_adsr *env);
 
+void env_adsr_process_block(env_adsr *env, fract32 *dst, u16 frames);
+
 typedef struct env_adsr_16 {
   char envState;
   fract16 envOut;
@@ -44,4 +46,6 @@ void env_adsr_16_release (env_adsr_16 *env);
 
 fract16 env_adsr_16_next(env_adsr_16 *env);
 
+void env_adsr_16_process_block(env_adsr_16 *env, fract16 *dst, u16 frames);
+
 #endif
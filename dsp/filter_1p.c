@@ -81,6 +81,33 @@ fract32 filter_1p_lo_norm_next(filter_1p_lo* f) {
 }
 
 
+// fill a block with successive filtered values
+void filter_1p_lo_process_block(filter_1p_lo* f, fract32* dst, u16 frames) {
+  fract32 x = f->x;
+  fract32 y = f->y;
+  fract32 c = f->c;
+  u16 i;
+  for(i=0; i<frames; ++i) {
+    y = add_fr1x32(x, mult_fr1x32x32(c, sub_fr1x32(y, x)));
+    dst[i] = y;
+  }
+  f->y = y;
+}
+
+// advance by a number of frames, return the last value
+fract32 filter_1p_lo_next_block(filter_1p_lo* f, u16 frames) {
+  fract32 x = f->x;
+  fract32 y = f->y;
+  fract32 c = f->c;
+  // nothing to do when settled
+  if(x == y) { return y; }
+  while(frames > 0) {
+    y = add_fr1x32(x, mult_fr1x32x32(c, sub_fr1x32(y, x)));
+    --frames;
+  }
+  f->y = y;
+  return y;
+}
 
 // compare target/value
 extern u8 filter_1p_sync(filter_1p_lo* f) {
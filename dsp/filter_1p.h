@@ -38,6 +38,13 @@ extern fract32 filter_1p_lo_norm_next(filter_1p_lo* f);
 // compare target/value
 extern u8 filter_1p_sync(filter_1p_lo* f);
 
+//---- block processing
+// fill a block with successive filtered values
+extern void filter_1p_lo_process_block(filter_1p_lo* f, fract32* dst, u16 frames);
+// advance by a number of frames, return the last value
+// (for parameters that are applied once per block)
+extern fract32 filter_1p_lo_next_block(filter_1p_lo* f, u16 frames);
+
 ///---- highpass
 // not using this anywhere right now.
 /*
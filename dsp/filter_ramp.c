@@ -36,5 +36,27 @@ fract32 filter_ramp_next(filter_ramp* f) {
   return f->y;
 }
 
+// fill a block with successive values
+void filter_ramp_process_block(filter_ramp* f, fract32* dst, u16 frames) {
+  u16 i = 0;
+  fract32 y = f->y;
+  if(!(f->sync)) {
+    for(; i<frames; ++i) {
+      y = add_fr1x32(y, f->inc);
+      if(y >= FR32_MAX) {
+	f->sync = 1;
+	y = FR32_MAX;
+	break;
+      }
+      dst[i] = y;
+    }
+    f->y = y;
+  }
+  // ramp is finished
+  for(; i<frames; ++i) {
+    dst[i] = FR32_MAX;
+  }
+}
+
 
 
@@ -26,6 +26,8 @@ void filter_ramp_set_inc(filter_ramp* f, fract32 inc);
 extern void filter_ramp_start(filter_ramp* f);
 // get next filtered value
 extern fract32 filter_ramp_next(filter_ramp* f);
+// fill a block with successive values
+extern void filter_ramp_process_block(filter_ramp* f, fract32* dst, u16 frames);
 
 
 
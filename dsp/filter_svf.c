@@ -27,7 +27,7 @@
 //=====================================================
 //===== static functions
 
-static void filter_svf_calc_frame( filter_svf* f, fract32 in) {
+static inline void filter_svf_calc_frame( filter_svf* f, fract32 in) {
   f->low = add_fr1x32(f->low, 
 		      mult_fr1x32x32(f->freq, f->band));
 
@@ -214,6 +214,64 @@ extern fract32 filter_svf_softclip_asym_notch_next( filter_svf* f, fract32 in) {
   return add_fr1x32(f->low, f->high);
 }
 
+//-----------------------------
+//---- block processing
+// the filter state is copied to a local for the duration of the block,
+// so it can stay in registers instead of being reloaded every frame.
+
+extern void filter_svf_process_block( filter_svf* f, fract32* buf, u16 frames ) {
+  filter_svf s = *f;
+  fract32 out;
+  u16 i;
+  for(i=0; i<frames; ++i) {
+    filter_svf_calc_frame(&s, buf[i]);
+    out = shr_fr1x32(filter_svf_mix_outputs(&s), 1);
+    filter_svf_calc_frame(&s, buf[i]);
+    buf[i] = add_fr1x32(out, shr_fr1x32(filter_svf_mix_outputs(&s), 1));
+  }
+  *f = s;
+}
+
+extern void filter_svf_lpf_process_block( filter_svf* f, fract32* buf, u16 frames ) {
+  filter_svf s = *f;
+  u16 i;
+  for(i=0; i<frames; ++i) {
+    filter_svf_calc_frame(&s, buf[i]);
+    buf[i] = s.low;
+  }
+  *f = s;
+}
+
+extern void filter_svf_hpf_process_block( filter_svf* f, fract32* buf, u16 frames ) {
+  filter_svf s = *f;
+  u16 i;
+  for(i=0; i<frames; ++i) {
+    filter_svf_calc_frame(&s, buf[i]);
+    buf[i] = s.high;
+  }
+  *f = s;
+}
+
+extern void filter_svf_bpf_process_block( filter_svf* f, fract32* buf, u16 frames ) {
+  filter_svf s = *f;
+  u16 i;
+  for(i=0; i<frames; ++i) {
+    filter_svf_calc_frame(&s, buf[i]);
+    buf[i] = s.band;
+  }
+  *f = s;
+}
+
+extern void filter_svf_notch_process_block( filter_svf* f, fract32* buf, u16 frames ) {
+  filter_svf s = *f;
+  u16 i;
+  for(i=0; i<frames; ++i) {
+    filter_svf_calc_frame(&s, buf[i]);
+    buf[i] = add_fr1x32(s.low, s.high);
+  }
+  *f = s;
+}
+
 const svf_func_t svf_funcs[3][4] =
   {
     {filter_svf_hpf_next, filter_svf_bpf_next, filter_svf_lpf_next, filter_svf_notch_next},
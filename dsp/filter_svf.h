@@ -75,4 +75,13 @@ extern fract32 filter_svf_softclip_asym_notch_next( filter_svf* f, fract32 in);
 
 const extern svf_func_t svf_funcs[3][4];
 
+//---- block processing
+// process a block in place.
+// coefficients and mixes are held constant for the whole block.
+extern void filter_svf_process_block( filter_svf* f, fract32* buf, u16 frames );
+extern void filter_svf_lpf_process_block( filter_svf* f, fract32* buf, u16 frames );
+extern void filter_svf_hpf_process_block( filter_svf* f, fract32* buf, u16 frames );
+extern void filter_svf_bpf_process_block( filter_svf* f, fract32* buf, u16 frames );
+extern void filter_svf_notch_process_block( filter_svf* f, fract32* buf, u16 frames );
+
 #endif // h guard
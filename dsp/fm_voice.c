@@ -140,3 +140,261 @@ void fm_voice_next (fm_voice *v) {
     }
   }
 }
+
+//-----------------------
+//---- polyphonic pool
+
+void fm_poly_init (fm_poly *p, u8 nVoices, u8 nOps, u8 nModPoints) {
+  int i, v;
+  p->nVoices = nVoices > FM_VOICES_MAX ? FM_VOICES_MAX : nVoices;
+  p->nOps = nOps;
+  p->nModPoints = nModPoints;
+  p->stealMode = fmStealOldest;
+  p->noteTune = FIX16_ONE;
+  p->portamento = SLEW_100MS;
+  p->noteCount = 0;
+
+  for(i=0; i < FM_OPS_MAX; i++) {
+    p->opTune[i] = FIX16_ONE;
+    p->opMod1Source[i] = i;
+    p->opMod1Gain[i] = 0;
+    p->opMod2Source[i] = (i - 1) % nOps;
+    p->opMod2Gain[i] = 0;
+    p->opSlew[i] = SLEW_100MS;
+    p->opAttack[i] = SLEW_10MS;
+    p->opDecay[i] = SLEW_100MS;
+    p->opSustain[i] = FR32_MAX >> 2;
+    p->opRelease[i] = SLEW_1S;
+    p->bandLimit[i] = 1;
+    p->freqSaturate[i] = 1;
+    p->opMix[i] = 0;
+    for(v=0; v < FM_VOICES_MAX; v++) {
+      p->opPhase[i][v] = 0;
+      p->opFreqs[i][v] = 0;
+      p->envState[i][v] = adsrRelease;
+      p->envOut[i][v] = 0;
+      p->opModLast[i][v] = 0;
+      p->opOutputsInternal[i][v] = 0;
+      p->opOutputs[i][v] = 0;
+    }
+  }
+  for(i=0; i < FM_MOD_POINTS_MAX; i++) {
+    p->opModPointsExternal[i] = 0;
+  }
+  for(v=0; v < FM_VOICES_MAX; v++) {
+    p->noteHz[v] = 440 << 16;
+    p->noteBaseFreq[v] = 0;
+    p->noteVelocity[v] = 0;
+    p->noteHeld[v] = 0;
+    p->noteAge[v] = 0;
+  }
+}
+
+// loudest op envelope of a voice
+static fract32 fm_poly_level (fm_poly *p, u8 v) {
+  fract32 level = 0;
+  int i;
+  for(i=0; i < p->nOps; i++) {
+    level = max_fr1x32(level, p->envOut[i][v]);
+  }
+  return mult_fr1x32x32(level, p->noteVelocity[v]);
+}
+
+u8 fm_poly_alloc (fm_poly *p) {
+  u8 v, best = 0;
+  u8 bestHeld = 1;
+  fract32 level, bestLevel = FR32_MAX;
+  u32 age, bestAge = 0;
+  for(v=0; v < p->nVoices; v++) {
+    level = fm_poly_level(p, v);
+    age = p->noteCount - p->noteAge[v];
+    if(!p->noteHeld[v]) {
+      // released: take the quietest
+      if(bestHeld || level < bestLevel) {
+	best = v;
+	bestLevel = level;
+	bestHeld = 0;
+      }
+    } else if(bestHeld) {
+      if(p->stealMode == fmStealQuietest) {
+	if(level < bestLevel) {
+	  best = v;
+	  bestLevel = level;
+	}
+      } else if(age >= bestAge) {
+	best = v;
+	bestAge = age;
+      }
+    }
+  }
+  return best;
+}
+
+void fm_poly_press (fm_poly *p, u8 voice, fix16 hz, fract32 velocity) {
+  int i;
+  if(voice >= p->nVoices) { return; }
+  p->noteHz[voice] = hz;
+  p->noteVelocity[voice] = velocity;
+  p->noteHeld[voice] = 1;
+  p->noteAge[voice] = ++(p->noteCount);
+  for(i=0; i < p->nOps; i++) {
+    p->envState[i][voice] = adsrAttack;
+  }
+}
+
+void fm_poly_release (fm_poly *p, u8 voice) {
+  int i;
+  if(voice >= p->nVoices) { return; }
+  p->noteHeld[voice] = 0;
+  for(i=0; i < p->nOps; i++) {
+    p->envState[i][voice] = adsrRelease;
+  }
+}
+
+u8 fm_poly_release_hz (fm_poly *p, fix16 hz) {
+  u8 v, found = p->nVoices, newest = p->nVoices;
+  for(v=0; v < p->nVoices; v++) {
+    if(!p->noteHeld[v]) { continue; }
+    if(newest == p->nVoices
+       || (p->noteAge[v] - p->noteAge[newest]) < 0x80000000) {
+      newest = v;
+    }
+    if(p->noteHz[v] == hz) {
+      if(found == p->nVoices
+	 || (p->noteAge[v] - p->noteAge[found]) < 0x80000000) {
+	found = v;
+      }
+    }
+  }
+  // hz moved since the press (glide, legato): release the newest note
+  if(found == p->nVoices) { found = newest; }
+  fm_poly_release(p, found);
+  return found;
+}
+
+void fm_poly_next (fm_poly *p) {
+  int i, j, v;
+  const int nV = p->nVoices;
+  fract16 envNext[FM_OPS_MAX][FM_VOICES_MAX];
+  fract16 nextOpOutputs[FM_OPS_MAX][FM_VOICES_MAX];
+  // mod points, broadcast across voices
+  fract16 modPoints[FM_MOD_POINTS_MAX][FM_VOICES_MAX];
+  fract16 silence[FM_VOICES_MAX];
+  // row of each mod source: ops, then mod points, then silence
+  const fract16* modRows[FM_OPS_MAX + FM_MOD_POINTS_MAX];
+  fract32 opFreqTarget, target, speed;
+
+  for(v=0; v < nV; v++) {
+    normalised_logSlew(&(p->noteBaseFreq[v]),
+		       fix16_mul_fract(p->noteHz[v], p->noteTune),
+		       p->portamento);
+  }
+
+  // envelopes and op frequencies
+  for(i=0; i < p->nOps; i++) {
+    u8* state = p->envState[i];
+    fract32* env = p->envOut[i];
+    fract32* freq = p->opFreqs[i];
+    for(v=0; v < nV; v++) {
+      switch(state[v]) {
+      case adsrAttack :
+	target = FR32_MAX;
+	speed = p->opAttack[i];
+	break;
+      case adsrDecay :
+	target = p->opSustain[i];
+	speed = p->opDecay[i];
+	break;
+      default :
+	target = 0;
+	speed = p->opRelease[i];
+	break;
+      }
+      normalised_logSlew(&(env[v]), target, speed);
+      if(state[v] == adsrAttack && env[v] > FR32_MAX - FR32_MAX / 10) {
+	state[v] = adsrDecay;
+      }
+      envNext[i][v] = trunc_fr1x32(env[v]);
+    }
+    for(v=0; v < nV; v++) {
+      opFreqTarget = shr_fr1x32(fix16_mul_fract(p->noteBaseFreq[v], p->opTune[i]),
+				FM_OVERSAMPLE_BITS);
+      normalised_logSlew(&(freq[v]), opFreqTarget, p->opSlew[i]);
+    }
+  }
+
+  for(v=0; v < nV; v++) {
+    silence[v] = 0;
+  }
+  for(i=0; i < FM_OPS_MAX + FM_MOD_POINTS_MAX; i++) {
+    modRows[i] = silence;
+  }
+  for(i=0; i < p->nOps; i++) {
+    modRows[i] = p->opOutputsInternal[i];
+  }
+  for(i=0; i < p->nModPoints; i++) {
+    fract16 point = trunc_fr1x32(p->opModPointsExternal[i]);
+    for(v=0; v < nV; v++) {
+      modPoints[i][v] = point;
+    }
+    modRows[p->nOps + i] = modPoints[i];
+  }
+
+  for(i=0; i < p->nOps; i++) {
+    for(v=0; v < nV; v++) {
+      p->opOutputs[i][v] = 0;
+    }
+  }
+
+  for(j=0; j < FM_OVERSAMPLE; j++) {
+    for(i=0; i < p->nOps; i++) {
+      const fract16* mod1 = modRows[p->opMod1Source[i] & (FM_OPS_MAX + FM_MOD_POINTS_MAX - 1)];
+      const fract16* mod2 = modRows[p->opMod2Source[i] & (FM_OPS_MAX + FM_MOD_POINTS_MAX - 1)];
+      const fract16 gain1 = p->opMod1Gain[i];
+      const fract16 gain2 = p->opMod2Gain[i];
+      const u8 bandLimit = p->bandLimit[i];
+      const u8 freqSaturate = p->freqSaturate[i];
+      fract16* modLast = p->opModLast[i];
+      s32* phase = p->opPhase[i];
+      const fract32* freq = p->opFreqs[i];
+      const fract16* env = envNext[i];
+      fract16* next = nextOpOutputs[i];
+      for(v=0; v < nV; v++) {
+	fract16 opMod = multr_fr1x16(mod1[v], gain1);
+	opMod = add_fr1x16(opMod, multr_fr1x16(mod2[v], gain2));
+	opMod = shr_fr1x32(opMod, 2);
+	if(bandLimit) {
+	  //bandlimit modulation signal with 20kHz iir
+	  opMod = mult_fr1x16(opMod, FR16_MAX - FM_SMOOTH);
+	  opMod = add_fr1x16(opMod, multr_fr1x16(modLast[v], FM_SMOOTH));
+	  modLast[v] = opMod;
+	}
+	phase[v] += freq[v];
+	fract32 opPhase = phase[v];
+	if(freqSaturate) {
+	  opPhase += shl_fr1x32(opMod, 20);
+	} else {
+	  opPhase += (opMod << 20);
+	}
+	next[v] = multr_fr1x16(env[v], sine_polyblep(opPhase));
+      }
+    }
+    for(i=0; i < p->nOps; i++) {
+      for(v=0; v < nV; v++) {
+	p->opOutputsInternal[i][v] = nextOpOutputs[i][v];
+	p->opOutputs[i][v] = add_fr1x16(shr_fr1x16(nextOpOutputs[i][v],
+						   FM_OVERSAMPLE_BITS),
+					p->opOutputs[i][v]);
+      }
+    }
+  }
+
+  for(i=0; i < p->nOps; i++) {
+    fract32 mix = 0;
+    for(v=0; v < nV; v++) {
+      mix = add_fr1x32(mix, mult_fr1x32x32(shl_fr1x32(p->opOutputs[i][v], 16),
+					   p->noteVelocity[v]));
+    }
+    p->opMix[i] = mix;
+  }
+}
@@ -38,4 +38,79 @@ void fm_voice_press (fm_voice *v);
 void fm_voice_release (fm_voice *v);
 void fm_voice_next (fm_voice *v);
 
+//-----------------------
+//---- polyphonic pool
+
+// voices share one patch (everything but pitch, velocity and state).
+// per-voice state is stored [op][voice], so each step of fm_poly_next
+// is one tight loop over all voices for a given op,
+// with the op's routing and flags looked up once.
+
+#ifndef FM_VOICES_MAX
+#define FM_VOICES_MAX 8
+#endif
+
+// which held voice a note-on takes when none are free
+enum fmStealModes {
+  fmStealOldest,
+  fmStealQuietest,
+};
+
+typedef struct fm_poly {
+  u8 nVoices, nOps, nModPoints;
+  u8 stealMode;
+
+  // patch
+  fix16 noteTune;
+  fract32 portamento;
+  fract32 opTune[FM_OPS_MAX];
+  u8 opMod1Source[FM_OPS_MAX];
+  fract16 opMod1Gain[FM_OPS_MAX];
+  u8 opMod2Source[FM_OPS_MAX];
+  fract16 opMod2Gain[FM_OPS_MAX];
+  fract32 opSlew[FM_OPS_MAX];
+  fract32 opAttack[FM_OPS_MAX];
+  fract32 opDecay[FM_OPS_MAX];
+  fract32 opSustain[FM_OPS_MAX];
+  fract32 opRelease[FM_OPS_MAX];
+  u8 bandLimit[FM_OPS_MAX];
+  u8 freqSaturate[FM_OPS_MAX];
+  fract32 opModPointsExternal[FM_MOD_POINTS_MAX];
+
+  // voices
+  fix16 noteHz[FM_VOICES_MAX];
+  fract32 noteBaseFreq[FM_VOICES_MAX];
+  fract32 noteVelocity[FM_VOICES_MAX];
+  u8 noteHeld[FM_VOICES_MAX];
+  // note-on stamp, for stealing the oldest
+  u32 noteAge[FM_VOICES_MAX];
+  u32 noteCount;
+
+  // voice state, [op][voice]
+  s32 opPhase[FM_OPS_MAX][FM_VOICES_MAX];
+  fract32 opFreqs[FM_OPS_MAX][FM_VOICES_MAX];
+  u8 envState[FM_OPS_MAX][FM_VOICES_MAX];
+  fract32 envOut[FM_OPS_MAX][FM_VOICES_MAX];
+  fract16 opModLast[FM_OPS_MAX][FM_VOICES_MAX];
+  fract16 opOutputsInternal[FM_OPS_MAX][FM_VOICES_MAX];
+  fract16 opOutputs[FM_OPS_MAX][FM_VOICES_MAX];
+
+  // each op summed over voices, scaled by velocity
+  fract32 opMix[FM_OPS_MAX];
+} fm_poly;
+
+void fm_poly_init (fm_poly *p, u8 nVoices, u8 nOps, u8 nModPoints);
+// pick a voice for a new note: a released voice if there is one
+// (the quietest), otherwise a held one by the steal mode
+u8 fm_poly_alloc (fm_poly *p);
+// start a note on a given voice
+void fm_poly_press (fm_poly *p, u8 voice, fix16 hz, fract32 velocity);
+// release a given voice
+void fm_poly_release (fm_poly *p, u8 voice);
+// release the newest held voice playing hz,
+// or the newest held voice if none plays hz.
+// returns the voice, or nVoices if none was held.
+u8 fm_poly_release_hz (fm_poly *p, fix16 hz);
+void fm_poly_next (fm_poly *p);
+
 #endif
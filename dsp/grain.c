@@ -14,9 +14,9 @@
 #include <stdlib.h>
 
 // initialize with pointer to audio buffer
-void grain_init(grain* dl, fract32* data, u32 frames) {
-  buffer_init(&(dl->buffer), data, frames);
-  buffer_tapN_init(&(dl->tapWr), &(dl->buffer));
+void grain_init(grain* dl, volatile delaySample* data, u32 frames) {
+  delay_buffer_init(&(dl->buffer), data, frames);
+  delay_tapN_init(&(dl->tapWr), &(dl->buffer));
   dl->tapWr.inc = 1;
 
   echoTap_init(&(dl->echoTap), &(dl->tapWr));
@@ -66,7 +66,7 @@ fract32 grain_next(grain* dl, fract32 in, fract32 FM_signal) {
 			     sub_fr1x32((fract32) dl->echoMaxTarget,
 					(fract32) dl->echoMinTarget)),
 	      SLEW_100MS);
-  buffer_tapN_next( &(dl->tapWr) );
+  delay_tapN_next( &(dl->tapWr) );
   echoTap_next( &(dl->echoTap) );
 
   //DEBUG forcing nominal scrubLength to 50ms
@@ -115,7 +115,7 @@ fract32 grain_next(grain* dl, fract32 in, fract32 FM_signal) {
 
   scrubTap_next( &(dl->scrubTap) );
 
-  buffer_tapN_write(&(dl->tapWr), in);
+  delay_tapN_write(&(dl->tapWr), delay_sample_store(in));
 
   //DEBUG uncomment this line to listen to the detected tone from pitch Tracker
   /* return pitchTrackOsc(&(dl->pitchDetector)) >> 3; */
@@ -10,7 +10,7 @@ delay line object interface/
 #ifndef _ALEPH_LINES_DELAYLINE_H_
 #define _ALEPH_LINES_DELAYLINE_H_
 
-#include "buffer.h"
+#include "delay_buffer.h"
 #include "types.h"
 #include "echoTap.h"
 #include "scrubTap.h"
@@ -18,10 +18,10 @@ delay line object interface/
 // delay line data structure
 typedef struct _grain {
   //-- audio buffer class
-  audioBuffer buffer;
+  delayBuffer buffer;
   echoTap echoTap;
   scrubTap scrubTap;
-  bufferTapN tapWr;
+  delayTapN tapWr;
   pitchDetector pitchDetector;
   trackingEnvelopeLog env;
   fract32 echoTapOutput;
@@ -53,7 +53,7 @@ typedef struct _grain {
 
 
 // initialize with pointer to audio buffer data
-extern void grain_init(grain* dl, fract32* bufData, u32 frames);
+extern void grain_init(grain* dl, volatile delaySample* bufData, u32 frames);
 
 // get next value given input
 extern fract32 grain_next(grain* dl, fract32 in, fract32 FM_signal);
@@ -0,0 +1,173 @@
+/* grain_cloud.c
+ * aleph
+ */
+
+#include "fix.h"
+#include "module.h"
+#include "grain_cloud.h"
+
+// hann window, then a half of zeros for voices that are done.
+// shared by every voice of every cloud; see utils/tabletool/grain_window.
+static const fract16 window[GRAIN_CLOUD_WIN_SIZE << 1] = {
+#include "grain_window_inc.c"
+};
+
+//-----------------------
+//---- static functions
+
+// per-grain gain for the current overlap:
+// halve it for every 4x of grains sounding at once, about 1/sqrt(overlap)
+static void calc_level(grainCloud* c) {
+  u32 overlap = c->period ? c->length / c->period : 0;
+  u8 bits = 0;
+  while(overlap) {
+    bits++;
+    overlap >>= 1;
+  }
+  c->level = FR16_MAX >> (bits >> 1);
+}
+
+// drop finished voices, moving the last live one into each gap
+static void cull(grainCloud* c) {
+  u8 i = 0;
+  u8 last;
+  while(i < c->num) {
+    if(c->phase[i] & 0x80000000) {
+      last = --(c->num);
+      c->pos[i] = c->pos[last];
+      c->rate[i] = c->rate[last];
+      c->phase[i] = c->phase[last];
+      c->inc[i] = c->inc[last];
+      c->amp[i] = c->amp[last];
+    } else {
+      i++;
+    }
+  }
+}
+
+static void spawn(grainCloud* c) {
+  const u32 frames = c->mask + 1;
+  // read head moves this far from the write head over the grain
+  const s32 drift = ((c->pitch - GRAIN_CLOUD_RATE_1) * (s32)c->length) >> GRAIN_CLOUD_FRAC;
+  s32 lo, hi, d;
+  u8 v;
+
+  // time to the next grain
+  c->wait = (s32)c->period
+    + mult_fr1x32x32((fract32)c->period,
+		     mult_fr1x32x32(c->jitter, lcprng_next(&(c->rand))));
+  if(c->wait < 1) { c->wait = 1; }
+
+  if(c->num == GRAIN_CLOUD_VOICES) { return; }
+
+  // start position; the read head must stay behind the write head
+  // and inside the buffer for the whole grain
+  d = (s32)c->delay
+    + mult_fr1x32x32((fract32)c->spread, (fract32)((u32)lcprng_next(&(c->rand)) >> 1));
+  lo = 2 + (drift > 0 ? drift : 0);
+  hi = (s32)frames - 2 + (drift < 0 ? drift : 0);
+  if(d < lo) { d = lo; }
+  if(d > hi) { d = hi; }
+
+  v = c->num++;
+  c->pos[v] = ((c->wr - (u32)d) & c->mask) << GRAIN_CLOUD_FRAC;
+  c->rate[v] = c->pitch;
+  c->phase[v] = 0;
+  c->inc[v] = 0x80000000 / c->length;
+  c->amp[v] = c->level;
+}
+
+//-----------------------
+//---- external functions
+
+void grain_cloud_init(grainCloud* c, fract32* data, u32 frames) {
+  u32 i;
+  c->data = data;
+  c->mask = frames - 1;
+  c->wr = 0;
+  for(i=0; i<frames; i++) {
+    data[i] = 0;
+  }
+  c->num = 0;
+  c->period = 0;
+  c->jitter = 0;
+  c->wait = 0;
+  c->tick = GRAIN_CLOUD_TICK;
+  lcprng_reset(&(c->rand), 0xdeadbeef);
+  c->length = 4800;
+  c->pitch = GRAIN_CLOUD_RATE_1;
+  c->delay = 4800;
+  c->spread = 0;
+  calc_level(c);
+}
+
+fract32 grain_cloud_next(grainCloud* c, fract32 in) {
+  const fract32* data = c->data;
+  const u32 mask = c->mask;
+  const u8 num = c->num;
+  u32* pos = c->pos;
+  const s32* rate = c->rate;
+  u32* phase = c->phase;
+  const u32* inc = c->inc;
+  const fract16* amp = c->amp;
+  fract32 out = 0;
+  u8 i;
+
+  for(i=0; i<num; i++) {
+    const u32 p = pos[i];
+    const u32 idx = (p >> GRAIN_CLOUD_FRAC) & mask;
+    const fract32 a = data[idx];
+    const fract32 b = data[(idx + 1) & mask];
+    // interpolation weight from the fractional position
+    const fract32 mulB = (fract32)((p & (GRAIN_CLOUD_RATE_1 - 1))
+				   << (31 - GRAIN_CLOUD_FRAC));
+    const fract32 x = add_fr1x32(a, mult_fr1x32x32(sub_fr1x32(b, a), mulB));
+    const fract16 w = mult_fr1x16(window[phase[i] >> (31 - GRAIN_CLOUD_WIN_BITS)],
+				  amp[i]);
+    out = add_fr1x32(out, mult_fr1x32x32(x, (fract32)w << 16));
+    pos[i] = p + (u32)rate[i];
+    phase[i] += inc[i];
+  }
+
+  c->data[c->wr] = in;
+  c->wr = (c->wr + 1) & mask;
+
+  if(--(c->tick) == 0) {
+    c->tick = GRAIN_CLOUD_TICK;
+    cull(c);
+  }
+  if(c->period && --(c->wait) <= 0) {
+    spawn(c);
+  }
+  return out;
+}
+
+void grain_cloud_set_density(grainCloud* c, s32 hz) {
+  // 16.16 grains per second to frames between grains
+  c->period = hz > 0 ? (u32)(((u64)SAMPLERATE << 16) / (u32)hz) : 0;
+  if(c->period == 0 && hz > 0) { c->period = 1; }
+  calc_level(c);
+}
+
+void grain_cloud_set_jitter(grainCloud* c, fract32 jitter) {
+  c->jitter = jitter;
+}
+
+void grain_cloud_set_length(grainCloud* c, u32 frames) {
+  if(frames < GRAIN_CLOUD_LENGTH_MIN) { frames = GRAIN_CLOUD_LENGTH_MIN; }
+  if(frames > ((c->mask + 1) >> 1)) { frames = (c->mask + 1) >> 1; }
+  c->length = frames;
+  calc_level(c);
+}
+
+void grain_cloud_set_pitch(grainCloud* c, s32 rate) {
+  c->pitch = rate;
+}
+
+void grain_cloud_set_delay(grainCloud* c, u32 frames) {
+  c->delay = frames;
+}
+
+void grain_cloud_set_spread(grainCloud* c, u32 frames) {
+  c->spread = frames;
+}
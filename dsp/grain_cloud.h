@@ -0,0 +1,93 @@
+/* grain_cloud.h
+ * aleph
+ *
+ * a cloud of lightweight grains.
+ *
+ * the cloud records its input into a buffer (in SDRAM) and plays it
+ * back through a pool of grain voices. a voice is only a read
+ * position, a rate, a window phase and an amplitude; all voices share
+ * one window table. new grains are spawned by a scheduler with a mean
+ * density and random jitter in timing and start position.
+ *
+ * voices are kept packed at the front of the pool, so the per-frame
+ * loop runs straight over the live ones. a voice that has finished
+ * its window reads zeros from the second half of the window table
+ * until the next cull, which happens every GRAIN_CLOUD_TICK frames.
+ */
+
+#ifndef _ALEPH_AUDIO_GRAIN_CLOUD_H_
+#define _ALEPH_AUDIO_GRAIN_CLOUD_H_
+
+#include "fract_math.h"
+#include "noise.h"
+#include "types.h"
+
+// voices in the pool
+#define GRAIN_CLOUD_VOICES 32
+// fractional bits in read position and rate
+#define GRAIN_CLOUD_FRAC 12
+// rate of 1 sample/sample
+#define GRAIN_CLOUD_RATE_1 (1 << GRAIN_CLOUD_FRAC)
+// log2 of points in the window
+#define GRAIN_CLOUD_WIN_BITS 10
+#define GRAIN_CLOUD_WIN_SIZE (1 << GRAIN_CLOUD_WIN_BITS)
+// frames between culls of finished voices
+#define GRAIN_CLOUD_TICK 32
+// shortest grain in frames; must be longer than a tick
+#define GRAIN_CLOUD_LENGTH_MIN 256
+
+typedef struct _grainCloud {
+  //-- buffer
+  // frames must be a power of 2, and no more than 2^(32 - GRAIN_CLOUD_FRAC)
+  fract32* data;
+  u32 mask;
+  // write index
+  u32 wr;
+  //-- voices, packed at the front
+  u8 num;
+  // read position, with GRAIN_CLOUD_FRAC fractional bits
+  u32 pos[GRAIN_CLOUD_VOICES];
+  // read rate, with GRAIN_CLOUD_FRAC fractional bits
+  s32 rate[GRAIN_CLOUD_VOICES];
+  // window phase and increment; the window is the first half of 2^32
+  u32 phase[GRAIN_CLOUD_VOICES];
+  u32 inc[GRAIN_CLOUD_VOICES];
+  fract16 amp[GRAIN_CLOUD_VOICES];
+  //-- scheduler
+  // mean frames between grains, 0 for none
+  u32 period;
+  // fraction of the period to randomize
+  fract32 jitter;
+  // frames until the next grain
+  s32 wait;
+  // frames until the next cull
+  u8 tick;
+  lcprng rand;
+  //-- settings for new grains
+  u32 length;
+  s32 pitch;
+  // frames behind the write head, and random extra
+  u32 delay;
+  u32 spread;
+  fract16 level;
+} grainCloud;
+
+// initialize with a buffer of frames (power of 2)
+extern void grain_cloud_init(grainCloud* c, fract32* data, u32 frames);
+// write one input frame, compute one output frame
+extern fract32 grain_cloud_next(grainCloud* c, fract32 in);
+
+// grains per second (16.16)
+extern void grain_cloud_set_density(grainCloud* c, s32 hz);
+// timing jitter, [0, 1]
+extern void grain_cloud_set_jitter(grainCloud* c, fract32 jitter);
+// grain length in frames
+extern void grain_cloud_set_length(grainCloud* c, u32 frames);
+// playback rate with GRAIN_CLOUD_FRAC fractional bits; may be negative
+extern void grain_cloud_set_pitch(grainCloud* c, s32 rate);
+// start position in frames behind the write head
+extern void grain_cloud_set_delay(grainCloud* c, u32 frames);
+// random extra delay in frames
+extern void grain_cloud_set_spread(grainCloud* c, u32 frames);
+
+#endif // h guard
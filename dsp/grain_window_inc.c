@@ -0,0 +1,68 @@
+// generated by utils/tabletool/grain_window
+#if GRAIN_CLOUD_WIN_BITS != 10
+#error "window data doesn't match grain_cloud.h"
+#endif
+  0, 0, 1, 2, 4, 7, 11, 15, 19, 24, 30, 37, 44, 52, 60, 69,
+  78, 89, 99, 111, 123, 135, 149, 162, 177, 192, 208, 224, 241, 258, 276, 295,
+  314, 334, 355, 376, 398, 420, 443, 466, 490, 515, 541, 566, 593, 620, 648, 676,
+  705, 734, 765, 795, 826, 858, 891, 924, 957, 991, 1026, 1061, 1097, 1134, 1171, 1208,
+  1247, 1285, 1325, 1365, 1405, 1446, 1488, 1530, 1572, 1616, 1660, 1704, 1749, 1794, 1840, 1887,
+  1934, 1982, 2030, 2079, 2128, 2178, 2228, 2279, 2330, 2382, 2435, 2488, 2541, 2595, 2650, 2705,
+  2761, 2817, 2873, 2930, 2988, 3046, 3105, 3164, 3224, 3284, 3344, 3406, 3467, 3529, 3592, 3655,
+  3718, 3782, 3847, 3912, 3977, 4043, 4110, 4176, 4244, 4311, 4380, 4448, 4517, 4587, 4657, 4727,
+  4798, 4869, 4941, 5013, 5086, 5159, 5232, 5306, 5381, 5455, 5530, 5606, 5682, 5758, 5835, 5912,
+  5989, 6067, 6146, 6224, 6303, 6383, 6463, 6543, 6623, 6704, 6786, 6867, 6949, 7032, 7114, 7197,
+  7281, 7365, 7449, 7533, 7618, 7703, 7788, 7874, 7960, 8047, 8133, 8220, 8308, 8395, 8483, 8571,
+  8660, 8749, 8838, 8927, 9017, 9107, 9197, 9287, 9378, 9469, 9560, 9652, 9744, 9836, 9928, 10021,
+  10113, 10206, 10300, 10393, 10487, 10581, 10675, 10769, 10864, 10958, 11053, 11148, 11244, 11339, 11435, 11531,
+  11627, 11723, 11820, 11917, 12013, 12110, 12207, 12305, 12402, 12500, 12597, 12695, 12793, 12892, 12990, 13088,
+  13187, 13285, 13384, 13483, 13582, 13681, 13780, 13880, 13979, 14079, 14178, 14278, 14377, 14477, 14577, 14677,
+  14777, 14877, 14977, 15078, 15178, 15278, 15378, 15479, 15579, 15680, 15780, 15880, 15981, 16081, 16182, 16282,
+  16383, 16484, 16584, 16685, 16785, 16886, 16986, 17086, 17187, 17287, 17388, 17488, 17588, 17688, 17789, 17889,
+  17989, 18089, 18189, 18289, 18389, 18488, 18588, 18687, 18787, 18886, 18986, 19085, 19184, 19283, 19382, 19481,
+  19579, 19678, 19776, 19874, 19973, 20071, 20169, 20266, 20364, 20461, 20559, 20656, 20753, 20849, 20946, 21043,
+  21139, 21235, 21331, 21427, 21522, 21618, 21713, 21808, 21902, 21997, 22091, 22185, 22279, 22373, 22466, 22560,
+  22653, 22745, 22838, 22930, 23022, 23114, 23206, 23297, 23388, 23479, 23569, 23659, 23749, 23839, 23928, 24017,
+  24106, 24195, 24283, 24371, 24458, 24546, 24633, 24719, 24806, 24892, 24978, 25063, 25148, 25233, 25317, 25401,
+  25485, 25569, 25652, 25734, 25817, 25899, 25980, 26062, 26143, 26223, 26303, 26383, 26463, 26542, 26620, 26699,
+  26777, 26854, 26931, 27008, 27084, 27160, 27236, 27311, 27385, 27460, 27534, 27607, 27680, 27753, 27825, 27897,
+  27968, 28039, 28109, 28179, 28249, 28318, 28386, 28455, 28522, 28590, 28656, 28723, 28789, 28854, 28919, 28984,
+  29048, 29111, 29174, 29237, 29299, 29360, 29422, 29482, 29542, 29602, 29661, 29720, 29778, 29836, 29893, 29949,
+  30005, 30061, 30116, 30171, 30225, 30278, 30331, 30384, 30436, 30487, 30538, 30588, 30638, 30687, 30736, 30784,
+  30832, 30879, 30926, 30972, 31017, 31062, 31106, 31150, 31194, 31236, 31278, 31320, 31361, 31401, 31441, 31481,
+  31519, 31558, 31595, 31632, 31669, 31705, 31740, 31775, 31809, 31842, 31875, 31908, 31940, 31971, 32001, 32032,
+  32061, 32090, 32118, 32146, 32173, 32200, 32225, 32251, 32276, 32300, 32323, 32346, 32368, 32390, 32411, 32432,
+  32452, 32471, 32490, 32508, 32525, 32542, 32558, 32574, 32589, 32604, 32617, 32631, 32643, 32655, 32667, 32677,
+  32688, 32697, 32706, 32714, 32722, 32729, 32736, 32742, 32747, 32751, 32755, 32759, 32762, 32764, 32765, 32766,
+  32767, 32766, 32765, 32764, 32762, 32759, 32755, 32751, 32747, 32742, 32736, 32729, 32722, 32714, 32706, 32697,
+  32688, 32677, 32667, 32655, 32643, 32631, 32617, 32604, 32589, 32574, 32558, 32542, 32525, 32508, 32490, 32471,
+  32452, 32432, 32411, 32390, 32368, 32346, 32323, 32300, 32276, 32251, 32225, 32200, 32173, 32146, 32118, 32090,
+  32061, 32032, 32001, 31971, 31940, 31908, 31875, 31842, 31809, 31775, 31740, 31705, 31669, 31632, 31595, 31558,
+  31519, 31481, 31441, 31401, 31361, 31320, 31278, 31236, 31194, 31150, 31106, 31062, 31017, 30972, 30926, 30879,
+  30832, 30784, 30736, 30687, 30638, 30588, 30538, 30487, 30436, 30384, 30331, 30278, 30225, 30171, 30116, 30061,
+  30005, 29949, 29893, 29836, 29778, 29720, 29661, 29602, 29542, 29482, 29422, 29360, 29299, 29237, 29174, 29111,
+  29048, 28984, 28919, 28854, 28789, 28723, 28656, 28590, 28522, 28455, 28386, 28318, 28249, 28179, 28109, 28039,
+  27968, 27897, 27825, 27753, 27680, 27607, 27534, 27460, 27385, 27311, 27236, 27160, 27084, 27008, 26931, 26854,
+  26777, 26699, 26620, 26542, 26463, 26383, 26303, 26223, 26143, 26062, 25980, 25899, 25817, 25734, 25652, 25569,
+  25485, 25401, 25317, 25233, 25148, 25063, 24978, 24892, 24806, 24719, 24633, 24546, 24458, 24371, 24283, 24195,
+  24106, 24017, 23928, 23839, 23749, 23659, 23569, 23479, 23388, 23297, 23206, 23114, 23022, 22930, 22838, 22745,
+  22653, 22560, 22466, 22373, 22279, 22185, 22091, 21997, 21902, 21808, 21713, 21618, 21522, 21427, 21331, 21235,
+  21139, 21043, 20946, 20849, 20753, 20656, 20559, 20461, 20364, 20266, 20169, 20071, 19973, 19874, 19776, 19678,
+  19579, 19481, 19382, 19283, 19184, 19085, 18986, 18886, 18787, 18687, 18588, 18488, 18389, 18289, 18189, 18089,
+  17989, 17889, 17789, 17688, 17588, 17488, 17388, 17287, 17187, 17086, 16986, 16886, 16785, 16685, 16584, 16484,
+  16383, 16282, 16182, 16081, 15981, 15880, 15780, 15680, 15579, 15479, 15378, 15278, 15178, 15078, 14977, 14877,
+  14777, 14677, 14577, 14477, 14377, 14278, 14178, 14079, 13979, 13880, 13780, 13681, 13582, 13483, 13384, 13285,
+  13187, 13088, 12990, 12892, 12793, 12695, 12597, 12500, 12402, 12305, 12207, 12110, 12013, 11917, 11820, 11723,
+  11627, 11531, 11435, 11339, 11244, 11148, 11053, 10958, 10864, 10769, 10675, 10581, 10487, 10393, 10300, 10206,
+  10113, 10021, 9928, 9836, 9744, 9652, 9560, 9469, 9378, 9287, 9197, 9107, 9017, 8927, 8838, 8749,
+  8660, 8571, 8483, 8395, 8308, 8220, 8133, 8047, 7960, 7874, 7788, 7703, 7618, 7533, 7449, 7365,
+  7281, 7197, 7114, 7032, 6949, 6867, 6786, 6704, 6623, 6543, 6463, 6383, 6303, 6224, 6146, 6067,
+  5989, 5912, 5835, 5758, 5682, 5606, 5530, 5455, 5381, 5306, 5232, 5159, 5086, 5013, 4941, 4869,
+  4798, 4727, 4657, 4587, 4517, 4448, 4380, 4311, 4244, 4176, 4110, 4043, 3977, 3912, 3847, 3782,
+  3718, 3655, 3592, 3529, 3467, 3406, 3344, 3284, 3224, 3164, 3105, 3046, 2988, 2930, 2873, 2817,
+  2761, 2705, 2650, 2595, 2541, 2488, 2435, 2382, 2330, 2279, 2228, 2178, 2128, 2079, 2030, 1982,
+  1934, 1887, 1840, 1794, 1749, 1704, 1660, 1616, 1572, 1530, 1488, 1446, 1405, 1365, 1325, 1285,
+  1247, 1208, 1171, 1134, 1097, 1061, 1026, 991, 957, 924, 891, 858, 826, 795, 765, 734,
+  705, 676, 648, 620, 593, 566, 541, 515, 490, 466, 443, 420, 398, 376, 355, 334,
+  314, 295, 276, 258, 241, 224, 208, 192, 177, 162, 149, 135, 123, 111, 99, 89,
+  78, 69, 60, 52, 44, 37, 30, 24, 19, 15, 11, 7, 4, 2, 1, 0,
@@ -221,3 +221,17 @@ fract32 osc_next(osc* osc) {
   // lookup 
   return osc_lookup(osc);
 }
+
+// compute a block of values
+void osc_process_block(osc* osc, fract32* dst, u16 frames) {
+  u16 i;
+  for(i=0; i<frames; ++i) {
+    osc->inc = filter_1p_lo_next( &(osc->lpInc) );
+    osc->shape = filter_1p_lo_next( &(osc->lpShape) );
+    osc->pmAmt = filter_1p_lo_next( &(osc->lpPm) );
+    osc->shapeMod = osc->shape;
+    osc_calc_pm(osc);
+    osc_advance(osc);
+    dst[i] = osc_lookup(osc);
+  }
+}
@@ -104,4 +104,8 @@ extern void osc_set_bl(osc* osc, fract32 bl);
 // compute next value
 extern fract32 osc_next( osc* osc);
 
+// compute a block of values.
+// modulation inputs are held constant for the block.
+extern void osc_process_block( osc* osc, fract32* dst, u16 frames);
+
 #endif
@@ -0,0 +1,53 @@
+/* osc_mip.c
+ * aleph
+ */
+
+#include "osc_mip.h"
+
+//-----------------------
+//---- external functions
+
+void osc_mip_bank_init(oscMipBank* b, const fract16* tab, u8 numShapes, u8 num) {
+  u8 i;
+  b->tab = tab;
+  b->numShapes = numShapes;
+  b->num = num > OSC_MIP_BANK_MAX ? OSC_MIP_BANK_MAX : num;
+  for(i=0; i<OSC_MIP_BANK_MAX; i++) {
+    b->inc[i] = 0;
+    b->pm[i] = 0;
+    b->shape[i] = 0;
+    b->phase[i] = 0;
+  }
+}
+
+void osc_mip_bank_next(oscMipBank* b, fract32* out) {
+  u8 i;
+  for(i=0; i<b->num; i++) {
+    out[i] = osc_mip_read_shape(b->tab, b->numShapes, b->shape[i],
+				osc_mip_level(b->inc[i]),
+				(fract32)((u32)b->phase[i] + (u32)b->pm[i]));
+    // phase wraps; unsigned add, as signed overflow is undefined
+    b->phase[i] = (fract32)((u32)b->phase[i] + (u32)b->inc[i]);
+  }
+}
+
+void osc_mip_bank_process_block(oscMipBank* b, fract32* const* dst, u16 frames) {
+  u8 i;
+  u16 j;
+  for(i=0; i<b->num; i++) {
+    const fract32 inc = b->inc[i];
+    const fract32 pm = b->pm[i];
+    const u8 level = osc_mip_level(inc);
+    const u8 numShapes = b->numShapes;
+    const fract16 shape = b->shape[i];
+    const fract16* tab = b->tab;
+    fract32 phase = b->phase[i];
+    fract32* out = dst[i];
+    for(j=0; j<frames; j++) {
+      out[j] = osc_mip_read_shape(tab, numShapes, shape, level,
+				  (fract32)((u32)phase + (u32)pm));
+      phase = (fract32)((u32)phase + (u32)inc);
+    }
+    b->phase[i] = phase;
+  }
+}
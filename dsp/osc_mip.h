@@ -0,0 +1,108 @@
+/* osc_mip.h
+ * aleph
+ *
+ * mip-mapped wavetable oscillators.
+ *
+ * each waveshape is stored as a stack of band-limited tables,
+ * one per octave of fundamental, generated offline by
+ * utils/tabletool/wavtab_mip. level 0 is used below
+ * (samplerate >> OSC_MIP_LEVELS) hz; each level above it covers
+ * one more octave, with half the harmonics in half the points,
+ * so nothing it holds can fold over nyquist within its octave.
+ * the level is picked from the phase increment.
+ *
+ * a bank runs a number of oscillators together:
+ * the owner sets increment, phase offset and shape per
+ * oscillator, and one call computes all of them.
+ */
+
+#ifndef _ALEPH_AUDIO_OSC_MIP_H_
+#define _ALEPH_AUDIO_OSC_MIP_H_
+
+#include "fract_math.h"
+#include "types.h"
+
+// log2 of points in level 0
+#define OSC_MIP_BITS 10
+#define OSC_MIP_SIZE (1 << OSC_MIP_BITS)
+// number of levels.
+// level 0 tops out at (sr >> OSC_MIP_LEVELS) hz, the last at nyquist.
+#define OSC_MIP_LEVELS 6
+// harmonics in level 0
+#define OSC_MIP_HARM (1 << (OSC_MIP_LEVELS - 1))
+// points per shape, all levels
+#define OSC_MIP_SHAPE_SIZE ((OSC_MIP_SIZE << 1) - (OSC_MIP_SIZE >> (OSC_MIP_LEVELS - 1)))
+// start of level l within a shape
+#define OSC_MIP_OFFSET(l) ((OSC_MIP_SIZE << 1) - ((OSC_MIP_SIZE << 1) >> (l)))
+
+// max oscillators per bank
+#define OSC_MIP_BANK_MAX 8
+
+typedef struct _oscMipBank {
+  // table data: numShapes stacks of OSC_MIP_SHAPE_SIZE points
+  const fract16* tab;
+  u8 numShapes;
+  // oscillators in the bank
+  u8 num;
+  //-- per oscillator, set by the owner
+  // phase increment (a full cycle is 2^32)
+  fract32 inc[OSC_MIP_BANK_MAX];
+  // phase offset, added to the phase for lookup
+  fract32 pm[OSC_MIP_BANK_MAX];
+  // position across the shapes, [0, 1)
+  fract16 shape[OSC_MIP_BANK_MAX];
+  //-- per oscillator, state
+  fract32 phase[OSC_MIP_BANK_MAX];
+} oscMipBank;
+
+// initialize a bank of num oscillators on table data
+extern void osc_mip_bank_init(oscMipBank* b, const fract16* tab,
+			      u8 numShapes, u8 num);
+// compute one frame of every oscillator
+extern void osc_mip_bank_next(oscMipBank* b, fract32* out);
+// compute a block of every oscillator into planar buffers.
+// increment, offset and shape are held for the block.
+extern void osc_mip_bank_process_block(oscMipBank* b, fract32* const* dst,
+				       u16 frames);
+
+//-----------------------
+//---- inline helpers, for oscillators that keep their own phase
+
+// table level for a phase increment
+static inline u8 osc_mip_level(fract32 inc) {
+  int l = (OSC_MIP_LEVELS - 1) - norm_fr1x32(inc);
+  return l < 0 ? 0 : (u8)l;
+}
+
+// interpolated lookup in one level of one shape
+static inline fract32 osc_mip_read(const fract16* shapeTab, u8 level, fract32 phase) {
+  const fract16* tab = shapeTab + OSC_MIP_OFFSET(level);
+  u32 bits = OSC_MIP_BITS - level;
+  u32 idxA = (u32)phase >> (32 - bits);
+  u32 idxB = (idxA + 1) & ((1 << bits) - 1);
+  fract16 mulB = (fract16)(((u32)phase << bits) >> 17);
+  fract16 mulA = sub_fr1x16(0x7fff, mulB);
+  return add_fr1x32(mult_fr1x32(tab[idxA], mulA),
+		    mult_fr1x32(tab[idxB], mulB));
+}
+
+// lookup with interpolation across shapes
+static inline fract32 osc_mip_read_shape(const fract16* tab, u8 numShapes,
+					 fract16 shape, u8 level, fract32 phase) {
+  // shape position in 15-bit fixed point
+  u32 pos = (u32)shape * (numShapes - 1);
+  u32 shapeA = pos >> 15;
+  fract16 mulB = (fract16)(pos & 0x7fff);
+  fract16 mulA = sub_fr1x16(0x7fff, mulB);
+  const fract16* tabA = tab + shapeA * OSC_MIP_SHAPE_SIZE;
+  if(mulB == 0) {
+    return mult_fr1x32(trunc_fr1x32(osc_mip_read(tabA, level, phase)), mulA);
+  }
+  return add_fr1x32(mult_fr1x32(trunc_fr1x32(osc_mip_read(tabA, level, phase)),
+				mulA),
+		    mult_fr1x32(trunc_fr1x32(osc_mip_read(tabA + OSC_MIP_SHAPE_SIZE,
+							  level, phase)),
+				mulB));
+}
+
+#endif // h guard
@@ -201,6 +201,8 @@ fract32 osc_square (fract32 phase) {
     return FR32_MIN;
 }
 
+#ifdef PITCH_DETECTOR_ZERO_CROSSING
+
 void pitchDetector_init (pitchDetector *p) {
   p->currentPeriod = 48 << PITCH_DETECTOR_RADIX_TOTAL;
   p->period = 48 << PITCH_DETECTOR_RADIX_TOTAL;
@@ -214,6 +216,38 @@ void pitchDetector_init (pitchDetector *p) {
   lpf_init(&(p->adaptiveFilter));
 }
 
+#else
+
+void pitchDetector_init (pitchDetector *p) {
+  int i;
+  p->currentPeriod = 48 << PITCH_DETECTOR_RADIX_TOTAL;
+  p->confidence = 0;
+  p->phase = 0;
+  p->pitchOffset = FR32_MAX >> 2;
+  /* p->pitchOffset = FR32_MAX / 2; */
+  p->decSum = 0;
+  p->decCount = 0;
+  for(i=0; i < PITCH_DETECTOR_RING; i++) {
+    p->ring[i] = 0;
+  }
+  for(i=0; i <= PITCH_DETECTOR_TAU_MAX; i++) {
+    p->cmnd[i] = 0x8000;
+  }
+  p->wr = 0;
+  p->base = 0;
+  // nothing to analyse until the first hop
+  p->tau = PITCH_DETECTOR_TAU_MAX + 1;
+  p->term = 0;
+  p->acc = 0;
+  p->cum = 0;
+  p->best = 0;
+  p->minTau = PITCH_DETECTOR_TAU_MIN;
+  p->found = 0;
+  p->settled = 0;
+}
+
+#endif // PITCH_DETECTOR_ZERO_CROSSING
+
 fract32 pitchTrackOsc (pitchDetector *p) {
   //Debug uncomment the line below to force 1k tone
   /* p->currentPeriod = (48 << (PITCH_DETECTOR_RADIX_INTERNAL)); */
@@ -224,6 +258,8 @@ fract32 pitchTrackOsc (pitchDetector *p) {
   return osc(p->phase);
 }
 
+#ifdef PITCH_DETECTOR_ZERO_CROSSING
+
 //This guy returns the current measured wave period (in subsamples)
 fract32 pitchTrack (pitchDetector *p, fract32 in) {
   fract32 centreFreq = FR32_MAX / p->currentPeriod;
@@ -250,6 +286,156 @@ fract32 pitchTrack (pitchDetector *p, fract32 in) {
   return (shl_fr1x32(p->currentPeriod, PITCH_DETECTOR_RADIX_EXTERNAL - PITCH_DETECTOR_RADIX_INTERNAL));
 }
 
+fract32 pitchTrackConfidence (pitchDetector *p) {
+  return FR32_MAX;
+}
+
+#else
+
+// d(tau) * tau / sum(d(1..tau)), 1.15, clipped below 2
+static inline u16 pitch_cmnd (u32 d, u32 tau, u64 cum) {
+  u64 num = (u64)d * tau;
+  u32 hi;
+  int s;
+  if (cum == 0)
+    return 0x8000;
+  if (num >= (cum << 1))
+    return 0xffff;
+  // scale to 16 bits for a 32-bit divide
+  hi = (u32)(cum >> 16);
+  if (hi) {
+    s = 31 - norm_fr1x32((fract32)hi);
+    cum >>= s;
+    num >>= s;
+  }
+  return (u16)(((u32)num << 15) / (u32)cum);
+}
+
+// squared differences, 2^20 max per term
+static inline u32 pitch_sum (const fract16* x, const fract16* y, int n) {
+  u32 acc = 0;
+  int i;
+  for (i = 0; i < n; i++) {
+    s32 diff = (s32)x[i] - (s32)y[i];
+    u32 ad = (u32)(diff < 0 ? -diff : diff);
+    acc += (ad * ad) >> 12;
+  }
+  return acc;
+}
+
+// sum a slice of the current lag; complete it and search when done
+static inline void pitch_slice (pitchDetector *p) {
+  // the window starts on a hop and slices are aligned, so only
+  // the lagged side can wrap
+  u16 a = (p->base + p->term) & PITCH_DETECTOR_RING_1;
+  u16 b = (a + p->tau) & PITCH_DETECTOR_RING_1;
+  int n = PITCH_DETECTOR_RING - b;
+  u32 acc = p->acc;
+  u32 d;
+  u16 v;
+  if (n >= PITCH_DETECTOR_SLICE) {
+    acc += pitch_sum(p->ring + a, p->ring + b, PITCH_DETECTOR_SLICE);
+  } else {
+    acc += pitch_sum(p->ring + a, p->ring + b, n);
+    acc += pitch_sum(p->ring + a + n, p->ring, PITCH_DETECTOR_SLICE - n);
+  }
+  p->term += PITCH_DETECTOR_SLICE;
+  if (p->term < PITCH_DETECTOR_WINDOW) {
+    p->acc = acc;
+    return;
+  }
+  // lag complete
+  d = acc;
+  p->acc = 0;
+  p->term = 0;
+  p->cum += d;
+  v = pitch_cmnd(d, p->tau, p->cum);
+  p->cmnd[p->tau] = v;
+  if (p->tau >= PITCH_DETECTOR_TAU_MIN) {
+    if (!p->found) {
+      // first dip under the threshold, else the global minimum
+      if (v < PITCH_DETECTOR_THRESHOLD) {
+	p->found = 1;
+	p->best = p->tau;
+      } else if (v < p->cmnd[p->minTau]) {
+	p->minTau = p->tau;
+      }
+    } else if (!p->settled) {
+      // follow the dip down to its bottom
+      if (v < p->cmnd[p->best])
+	p->best = p->tau;
+      else
+	p->settled = 1;
+    }
+  }
+  p->tau++;
+}
+
+// publish the last analysis
+static inline void pitch_result (pitchDetector *p) {
+  u16 t = p->found ? p->best : p->minTau;
+  s32 a, b, c, den;
+  s32 off = 0;
+  b = p->cmnd[t];
+  // a perfect lock (b == 0) would be 1.0, which doesn't fit in fract32
+  if (b >= 0x8000)
+    p->confidence = 0;
+  else if (b <= 0)
+    p->confidence = FR32_MAX;
+  else
+    p->confidence = (0x8000 - b) << 16;
+  if (!p->found)
+    return;
+  // parabolic interpolation of the minimum, in 1/256 lags
+  if (t > 1 && t < PITCH_DETECTOR_TAU_MAX) {
+    a = p->cmnd[t - 1];
+    c = p->cmnd[t + 1];
+    den = a + c - (b << 1);
+    if (den > 0) {
+      off = ((a - c) << 7) / den;
+      off = max_fr1x32(-128, min_fr1x32(128, off));
+    }
+  }
+  // decimated lags -> input subsamples at radix internal
+  p->currentPeriod = ((((s32)t << 8) + off) << PITCH_DETECTOR_DECIMATE_BITS)
+    >> (8 - PITCH_DETECTOR_RADIX_INTERNAL);
+}
+
+//This guy returns the current measured wave period (in subsamples)
+fract32 pitchTrack (pitchDetector *p, fract32 in) {
+  // decimate
+  p->decSum += shr_fr1x32(in, PITCH_DETECTOR_DECIMATE_BITS);
+  if (++(p->decCount) == (1 << PITCH_DETECTOR_DECIMATE_BITS)) {
+    p->ring[p->wr] = trunc_fr1x32(p->decSum);
+    p->wr = (p->wr + 1) & PITCH_DETECTOR_RING_1;
+    p->decSum = 0;
+    p->decCount = 0;
+    // start an analysis each hop, on the latest window
+    if ((p->wr & (PITCH_DETECTOR_TAU_MAX - 1)) == 0
+	&& p->tau > PITCH_DETECTOR_TAU_MAX) {
+      pitch_result(p);
+      p->base = (p->wr - PITCH_DETECTOR_WINDOW - PITCH_DETECTOR_TAU_MAX)
+	& PITCH_DETECTOR_RING_1;
+      p->tau = 1;
+      p->term = 0;
+      p->acc = 0;
+      p->cum = 0;
+      p->minTau = PITCH_DETECTOR_TAU_MIN;
+      p->found = 0;
+      p->settled = 0;
+    }
+  }
+  if (p->tau <= PITCH_DETECTOR_TAU_MAX)
+    pitch_slice(p);
+  return (shl_fr1x32(p->currentPeriod, PITCH_DETECTOR_RADIX_EXTERNAL - PITCH_DETECTOR_RADIX_INTERNAL));
+}
+
+fract32 pitchTrackConfidence (pitchDetector *p) {
+  return p->confidence;
+}
+
+#endif // PITCH_DETECTOR_ZERO_CROSSING
+
 // 4-point, 3rd-order B-spline (x-form) from http://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
 float interp_bspline_float (float x, float _y, float y, float y_, float y__) {
   float ym1py1 = _y+y_;
@@ -151,6 +151,11 @@ fract32 osc_square (fract32 phase);
 #define PITCH_DETECTOR_RADIX_EXTERNAL 8
 #define PITCH_DETECTOR_RADIX_TOTAL (PITCH_DETECTOR_RADIX_INTERNAL + PITCH_DETECTOR_RADIX_EXTERNAL)
 
+// define PITCH_DETECTOR_ZERO_CROSSING (e.g. CFLAGS += -D ...)
+// to build the previous zero-crossing tracker instead of YIN,
+// for comparing renders of the same module.
+#ifdef PITCH_DETECTOR_ZERO_CROSSING
+
 typedef struct {
   fract32 currentPeriod;
   fract32 lastIn;
@@ -163,9 +168,68 @@ typedef struct {
   fract32 pitchOffset;
 } pitchDetector;
 
+#else
+
+// YIN on a 4x decimated ring buffer (12k at 48k).
+// the difference function over one window is summed in slices,
+// a fixed number of terms per input frame, so each analysis
+// takes exactly one hop and no frame does more than a slice
+// (plus one divide when a lag completes).
+#define PITCH_DETECTOR_DECIMATE_BITS 2
+// decimated samples per lag sum
+#define PITCH_DETECTOR_WINDOW 256
+// lag range, decimated samples (4k - 47hz).
+// the max lag is also the hop: one lag completes every
+// (1 << DECIMATE_BITS) frames.
+#define PITCH_DETECTOR_TAU_MIN 3
+#define PITCH_DETECTOR_TAU_MAX 256
+// terms summed per input frame
+#define PITCH_DETECTOR_SLICE (PITCH_DETECTOR_WINDOW >> PITCH_DETECTOR_DECIMATE_BITS)
+// holds a window, the lag range and a hop of new input
+#define PITCH_DETECTOR_RING 1024
+#define PITCH_DETECTOR_RING_1 (PITCH_DETECTOR_RING - 1)
+// normalized difference threshold (0.15), 1.15
+#define PITCH_DETECTOR_THRESHOLD 0x1333
+
+typedef struct {
+  // detected period, subsamples at radix internal
+  fract32 currentPeriod;
+  // 1 - normalized difference at the detected lag
+  fract32 confidence;
+  fract32 phase;
+  fract32 pitchOffset;
+  // decimator
+  fract32 decSum;
+  u8 decCount;
+  // decimated input
+  fract16 ring[PITCH_DETECTOR_RING];
+  u16 wr;
+  //-- analysis in progress
+  // ring index of the window
+  u16 base;
+  // lag being summed, and next term of it
+  u16 tau;
+  u16 term;
+  u32 acc;
+  // running sum of the difference function
+  u64 cum;
+  // cumulative mean normalized difference, 1.15
+  u16 cmnd[PITCH_DETECTOR_TAU_MAX + 1];
+  // search state
+  u16 best;
+  u16 minTau;
+  u8 found;
+  u8 settled;
+} pitchDetector;
+
+#endif // PITCH_DETECTOR_ZERO_CROSSING
+
 void pitchDetector_init (pitchDetector *p);
 fract32 pitchTrack (pitchDetector *p, fract32 preIn);
 fract32 pitchTrackOsc (pitchDetector *p);
+// confidence of the current period [0, 1)
+// (always FR32_MAX for the zero-crossing tracker)
+fract32 pitchTrackConfidence (pitchDetector *p);
 fract32 s32_halfWave_env (fract32 pos) ;
 float interp_bspline_float (float x, float _y, float y, float y_, float y__);
 
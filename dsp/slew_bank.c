@@ -0,0 +1,106 @@
+/* slew_bank.c
+ * aleph
+ */
+
+#include "slew_bank.h"
+
+#ifdef ARCH_BFIN
+#include "fract_math.h"
+#else
+#include "fract32_emu.h"
+#endif
+
+//-----------------------
+//---- static functions
+
+// remove the slew at position pos in the active list
+static inline void slew_bank_stop(slewBank* b, u8 pos) {
+  u8 idx = b->active[pos];
+  b->y[idx] = b->x[idx];
+  *(b->dst[idx]) = b->x[idx];
+  b->isActive[idx] = 0;
+  b->active[pos] = b->active[--(b->numActive)];
+}
+
+//-----------------------
+//---- external functions
+
+void slew_bank_init(slewBank* b) {
+  b->num = 0;
+  b->numActive = 0;
+}
+
+u8 slew_bank_add(slewBank* b, fract32* dst, fract32 c) {
+  u8 idx = b->num;
+  if(idx == SLEW_BANK_MAX) {
+    return SLEW_BANK_NONE;
+  }
+  ++(b->num);
+  b->x[idx] = *dst;
+  b->y[idx] = *dst;
+  b->c[idx] = c;
+  b->dst[idx] = dst;
+  b->isActive[idx] = 0;
+  return idx;
+}
+
+void slew_bank_set_slew(slewBank* b, u8 idx, fract32 c) {
+  if(idx >= b->num) { return; }
+  b->c[idx] = c;
+}
+
+void slew_bank_in(slewBank* b, u8 idx, fract32 val) {
+  if(idx >= b->num) { return; }
+  b->x[idx] = val;
+  if(!b->isActive[idx]) {
+    b->isActive[idx] = 1;
+    b->active[b->numActive++] = idx;
+  }
+}
+
+void slew_bank_next(slewBank* b) {
+  u8 pos = 0;
+  u8 idx;
+  fract32 y;
+  while(pos < b->numActive) {
+    idx = b->active[pos];
+    y = add_fr1x32(b->x[idx],
+		   mult_fr1x32x32(b->c[idx],
+				  sub_fr1x32(b->y[idx], b->x[idx])));
+    if(y == b->y[idx]) {
+      // settled; the last entry moves here, so don't advance
+      slew_bank_stop(b, pos);
+    } else {
+      b->y[idx] = y;
+      *(b->dst[idx]) = y;
+      ++pos;
+    }
+  }
+}
+
+void slew_bank_next_block(slewBank* b, u16 frames) {
+  u8 pos = 0;
+  u8 idx;
+  u16 i;
+  fract32 x, y, c, last;
+  if(frames == 0) { return; }
+  while(pos < b->numActive) {
+    idx = b->active[pos];
+    x = b->x[idx];
+    y = b->y[idx];
+    c = b->c[idx];
+    last = y;
+    for(i=0; i<frames; ++i) {
+      last = y;
+      y = add_fr1x32(x, mult_fr1x32x32(c, sub_fr1x32(y, x)));
+      if(y == last) { break; }
+    }
+    if(y == last) {
+      slew_bank_stop(b, pos);
+    } else {
+      b->y[idx] = y;
+      *(b->dst[idx]) = y;
+      ++pos;
+    }
+  }
+}
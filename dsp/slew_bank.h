@@ -0,0 +1,64 @@
+/* slew_bank.h
+ * aleph
+ *
+ * one-pole smoothing for all of a module's parameters.
+ *
+ * targets, values and coefficients are kept in parallel arrays,
+ * with a list of the slews still moving; only those are stepped.
+ * each step is filter_1p_lo_next(). a slew stops when a step
+ * no longer changes its value (converged, or stuck at rounding
+ * distance), and its value is snapped to the target.
+ *
+ * the smoothed value is written to a variable of the module's,
+ * registered along with the slew at init.
+ */
+
+#ifndef _ALEPH_AUDIO_SLEW_BANK_H_
+#define _ALEPH_AUDIO_SLEW_BANK_H_
+
+#include "types.h"
+
+// max slews per bank
+#define SLEW_BANK_MAX 48
+// index returned when the bank is full
+#define SLEW_BANK_NONE 0xff
+
+typedef struct _slewBank {
+  // registered slews
+  u8 num;
+  // slews still moving
+  u8 numActive;
+  u8 active[SLEW_BANK_MAX];
+  u8 isActive[SLEW_BANK_MAX];
+  // target values
+  fract32 x[SLEW_BANK_MAX];
+  // current values
+  fract32 y[SLEW_BANK_MAX];
+  // integration coefficients (0 is immediate)
+  fract32 c[SLEW_BANK_MAX];
+  // module variables that follow the values
+  fract32* dst[SLEW_BANK_MAX];
+} slewBank;
+
+// initialize (no slews)
+extern void slew_bank_init(slewBank* b);
+// register a slew writing to *dst, starting (and settled) at *dst.
+// returns its index in the bank, or SLEW_BANK_NONE if the bank is full.
+// set and input calls with SLEW_BANK_NONE are ignored.
+extern u8 slew_bank_add(slewBank* b, fract32* dst, fract32 c);
+// set integration coefficient
+extern void slew_bank_set_slew(slewBank* b, u8 idx, fract32 c);
+// set target value
+extern void slew_bank_in(slewBank* b, u8 idx, fract32 val);
+// step all moving slews by one frame
+extern void slew_bank_next(slewBank* b);
+// step all moving slews by a number of frames
+// (for parameters applied once per control block)
+extern void slew_bank_next_block(slewBank* b, u16 frames);
+
+// count of slews still moving
+static inline u8 slew_bank_num_active(slewBank* b) {
+  return b->numActive;
+}
+
+#endif
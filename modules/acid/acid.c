@@ -39,6 +39,8 @@ typedef struct _drumsData {
   ParamData mParamData[ACID_NPARAMS];
 } drumsynData;
 
+MODULE_SDRAM(drumsynData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData * gModuleData; // module data
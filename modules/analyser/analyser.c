@@ -35,6 +35,8 @@ typedef struct _analyserData {
   ParamData mParamData[eParamNumParams];
 } analyserData;
 
+MODULE_SDRAM(analyserData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData;
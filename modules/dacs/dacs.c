@@ -33,6 +33,8 @@ typedef struct _dacsData {
   ParamData mParamData[eParamNumParams];
 } dacsData;
 
+MODULE_SDRAM(dacsData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData;
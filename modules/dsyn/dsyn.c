@@ -17,19 +17,9 @@
 //#include "noise.h"
 #include "noise_dsyn.h"
 
-// bfin
-#ifdef ARCH_BFIN
 #include "bfin_core.h"
 #include "fract_math.h"
 #include <fract2float_conv.h>
-#else
-// linux
-#warning "LINUX"
-#include <stdio.h>
-#include "fract32_emu.h"
-#warning "linux"
-#include "audio.h"
-#endif
 
 #include "module.h"
 #include "module_custom.h"
@@ -47,18 +37,14 @@ typedef struct _drumsData {
   ParamData mParamData[eParamNumParams];
 } drumsynData;
 
+MODULE_SDRAM(drumsynData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData * gModuleData; // module data
 
 //-----------------------
 //------ static variables
-#if ARCH_LINUX
-static FILE* dbgFile;
-u8 dbgFlag = 0;
-u32 dbgCount = 0;
-#endif
-
 drumsynVoice* voices[DRUMSYN_NVOICES];
 
 // pointer to local module data, initialize at top of SDRAM
@@ -169,15 +155,9 @@ static void calc_frame(void) {
 void module_init(void) {
   u8 i;
   // init module/param descriptor
-#ifdef ARCH_BFIN 
   // intialize local data at start of SDRAM
   data = (drumsynData * )SDRAM_ADDRESS;
   // initialize moduleData superclass for core routines
-#else
-  data = (drumsynData*)malloc(sizeof(drumsData));
-  /// debugging output file
-  dbgFile = fopen( "drums_dbg.txt", "w");
-#endif
   gModuleData = &(data->super);
   strcpy(gModuleData->name, "dsyn");
 
@@ -196,9 +176,6 @@ void module_init(void) {
 
 void module_deinit(void) {
   drumsyn_voice_deinit(voices[0]);
-#if ARCH_LINUX 
-  fclose(dbgFile);
-#endif
 }
 
 
@@ -209,7 +186,6 @@ extern u32 module_get_num_params(void) {
 }
 
 // frame callback
-#ifdef ARCH_BFIN 
 void module_process_frame(void) {
   // sum input pairs to output pairs
   fract32 sum01 = add_fr1x32(in[0], in[1]);
@@ -227,29 +203,3 @@ void module_process_frame(void) {
   out[2] = sum23;
   out[3] = sum23;
 }
-
-#else //  non-bfin
-void module_process_frame(const f32* in, f32* out) {
-  u32 frame;
-  u8 chan;
-  for(frame=0; frame<BLOCKSIZE; frame++) {
-    calc_frame(); 
-    for(chan=0; chan<NUMCHANNELS; chan++) { // stereo interleaved
-      // FIXME: could use fract for output directly (portaudio setting?)
-      *out = fr32_to_float(frameVal);
-      if(dbgFlag) {  
-	/* fprintf(dbgFile, "%d \t %f \t %f \t %f \r\n",  */
-	/* 	dbgCount,  */
-	/* 	*out */
-	/* 	//		fr32_to_float(osc2), */
-	/* 	//		fr32_to_float((fract32)modIdxOffset << 3) */
-	/* 	//		fr32_to_float((fract32)modIdxOffset << 16) */
-	/* 	//		fr32_to_float((fract32)modIdxOffset) */
-	/* 	); */
-	dbgCount++;
-      }
-      out++;
-    }
-  }
-}
-#endif
@@ -1,7 +1,16 @@
 /* fmsynth.c
    aleph-bfin
 
-   (Monophonic) FM Synth.
+   Polyphonic FM Synth.
+
+   FM_VOICES voices (module_custom.h) share one patch.
+   noteVoice 1..FM_VOICES addresses that voice directly, as the
+   monophonic synth did: note params apply to it at once.
+   the default is 1, so scenes made for the mono synth play as before.
+   with noteVoice at 0, noteTrigger allocates voices:
+   on starts noteHz / noteVelocity on a free voice (or steals one,
+   per voiceSteal), off releases the voice playing noteHz
+   (or the newest held voice, if noteHz has changed since).
 */
 
 // std
@@ -32,6 +41,7 @@
 #include "module.h"
 
 /// custom
+#include "module_custom.h"
 #include "params.h"
 #define PAN_DEFAULT PAN_MAX/2
 #define FADER_DEFAULT PARAM_AMP_12
@@ -42,6 +52,8 @@ typedef struct _fmsynthData {
   ParamData mParamData[eParamNumParams];
 } fmsynthData;
 
+MODULE_SDRAM(fmsynthData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData;
@@ -57,8 +69,12 @@ static fract32 cvVal[4];
 static filter_1p_lo cvSlew[4];
 static u8 cvChan = 0;
 
-fm_voice voice;
+fm_poly poly;
+// note params, for the next note-on
+fix16 noteHz;
 fract32 noteVelocity;
+// 0: allocate, else the voice addressed (from 1)
+u8 noteVoice;
 fract32 opVols[4];
 fract32 opPans[4];
 
@@ -89,6 +105,7 @@ static inline void param_setup(u32 id, ParamValue v) {
 #define FM_VOICE_NOPS 4
 
 void module_init(void) {
+  int i;
   // init module/param descriptor
   pDacsData = (fmsynthData*)SDRAM_ADDRESS;
 
@@ -103,7 +120,7 @@ void module_init(void) {
   filter_1p_lo_init( &(cvSlew[2]), 0 );
   filter_1p_lo_init( &(cvSlew[3]), 0 );
 
-  fm_voice_init(&voice, FM_VOICE_NOPS, 4);
+  fm_poly_init(&poly, FM_VOICES, FM_VOICE_NOPS, 4);
 
   param_setup( eParam_cvSlew0, PARAM_CV_SLEW_DEFAULT );
   param_setup( eParam_cvSlew1, PARAM_CV_SLEW_DEFAULT );
@@ -132,6 +149,8 @@ void module_init(void) {
   param_setup( eParam_notePortamento, SLEW_10MS);
   param_setup( eParam_noteTrigger, 0);
   param_setup( eParam_noteVelocity, PARAM_AMP_0 >> 2);
+  param_setup( eParam_noteVoice, 1);
+  param_setup( eParam_voiceSteal, fmStealOldest);
 
   param_setup(eParam_op1Mod1Source, 0);
   param_setup(eParam_op1Mod1Gain,0);
@@ -185,6 +204,10 @@ void module_init(void) {
   param_setup(eParam_op4BandLimit, 1 << 16);
   param_setup(eParam_op4FreqSat, 1 << 16);
 
+  // idle voices sit at the default note, so the first notes glide from it
+  for(i=0; i < FM_VOICES; i++) {
+    poly.noteHz[i] = noteHz;
+  }
 }
 
 // de-init
@@ -206,16 +229,12 @@ void module_process_frame(void) {
   int i;
   for(i=0; i < 4; i++) {
     out[i] = 0;
-    voice.opModPointsExternal[i] = in[i];
+    poly.opModPointsExternal[i] = in[i];
   }
-  fm_voice_next(&voice);
-  fract32 opOut;
+  fm_poly_next(&poly);
   for(i=0; i<FM_VOICE_NOPS; i++) {
-    opOut = shl_fr1x32(voice.opOutputs[i], 16);
-    mix_panned_mono (opOut, &(out[0]), &(out[1]), opPans[i], opVols[i]);
+    mix_panned_mono (poly.opMix[i], &(out[0]), &(out[1]), opPans[i], opVols[i]);
   }
-  out[0] = mult_fr1x32x32(out[0], noteVelocity);
-  out[1] = mult_fr1x32x32(out[1], noteVelocity);
   out[2] = out[0];
   out[3] = out[1];
 }
@@ -275,172 +294,188 @@ void module_set_param(u32 idx, ParamValue v) {
     opPans[3] = v;
     break;
   case eParam_noteHz :
-    voice.noteHz = v;
+    noteHz = v;
+    if(noteVoice) {
+      poly.noteHz[noteVoice - 1] = v;
+    }
     break;
   case eParam_noteTune :
-    voice.noteTune = v;
+    poly.noteTune = v;
     break;
   case eParam_notePortamento :
-    voice.portamento = v;
+    poly.portamento = v;
     break;
   case eParam_noteTrigger :
     if (v > 0) {
-      fm_voice_press(&voice);
+      fm_poly_press(&poly, noteVoice ? noteVoice - 1 : fm_poly_alloc(&poly),
+		    noteHz, noteVelocity);
+    }
+    else if (noteVoice) {
+      fm_poly_release(&poly, noteVoice - 1);
     }
     else {
-      fm_voice_release(&voice);
+      fm_poly_release_hz(&poly, noteHz);
     }
     break;
   case eParam_noteVelocity :
     noteVelocity = v;
+    if(noteVoice) {
+      poly.noteVelocity[noteVoice - 1] = v;
+    }
+    break;
+  case eParam_noteVoice :
+    noteVoice = v < 0 ? 0 : v > FM_VOICES ? FM_VOICES : v;
+    break;
+  case eParam_voiceSteal :
+    poly.stealMode = v ? fmStealQuietest : fmStealOldest;
     break;
 
   case eParam_op1Mod1Source :
-    voice.opMod1Source[0] = v;
+    poly.opMod1Source[0] = v;
     break;
   case eParam_op1Mod1Gain :
-    voice.opMod1Gain[0] = trunc_fr1x32(v);
+    poly.opMod1Gain[0] = trunc_fr1x32(v);
     break;
   case eParam_op1Mod2Source :
-    voice.opMod2Source[0] = v;
+    poly.opMod2Source[0] = v;
     break;
   case eParam_op1Mod2Gain :
-    voice.opMod2Gain[0] = trunc_fr1x32(v);
+    poly.opMod2Gain[0] = trunc_fr1x32(v);
     break;
   case eParam_op1Tune :
-    voice.opTune[0] = v;
+    poly.opTune[0] = v;
     break;
   case eParam_op1Attack :
-    voice.opEnv[0].attackTime = v;
+    poly.opAttack[0] = v;
     break;
   case eParam_op1Decay :
-    voice.opEnv[0].decayTime = v;
+    poly.opDecay[0] = v;
     break;
   case eParam_op1Sustain :
-    voice.opEnv[0].sustainLevel = v;
+    poly.opSustain[0] = v;
    break;
   case eParam_op1Release :
-    voice.opEnv[0].releaseTime = v;
+    poly.opRelease[0] = v;
     break;
   case eParam_op1BandLimit :
-    voice.bandLimit[0] = trunc_fr1x32(v);
+    poly.bandLimit[0] = trunc_fr1x32(v);
     break;
   case eParam_op1FreqSat :
-    voice.freqSaturate[0] = trunc_fr1x32(v);
+    poly.freqSaturate[0] = trunc_fr1x32(v);
     break;
   case eParam_op1FreqSlew :
-    voice.opSlew[0] = v;
+    poly.opSlew[0] = v;
     break;
 
   case eParam_op2Mod1Source :
-    voice.opMod1Source[1] = v;
+    poly.opMod1Source[1] = v;
     break;
   case eParam_op2Mod1Gain :
-    voice.opMod1Gain[1] = trunc_fr1x32(v);
+    poly.opMod1Gain[1] = trunc_fr1x32(v);
     break;
   case eParam_op2Mod2Source :
-    voice.opMod2Source[1] = v;
+    poly.opMod2Source[1] = v;
     break;
   case eParam_op2Mod2Gain :
-    voice.opMod2Gain[1] = trunc_fr1x32(v);
+    poly.opMod2Gain[1] = trunc_fr1x32(v);
     break;
   case eParam_op2Tune :
-    voice.opTune[1] = v;
+    poly.opTune[1] = v;
     break;
   case eParam_op2Attack :
-    voice.opEnv[1].attackTime = v;
+    poly.opAttack[1] = v;
     break;
   case eParam_op2Decay :
-    voice.opEnv[1].decayTime = v;
+    poly.opDecay[1] = v;
     break;
   case eParam_op2Sustain :
-    voice.opEnv[1].sustainLevel = v;
+    poly.opSustain[1] = v;
    break;
   case eParam_op2Release :
-    voice.opEnv[1].releaseTime = v;
+    poly.opRelease[1] = v;
     break;
   case eParam_op2BandLimit :
-    voice.bandLimit[1] = trunc_fr1x32(v);
+    poly.bandLimit[1] = trunc_fr1x32(v);
     break;
   case eParam_op2FreqSat :
-    voice.freqSaturate[1] = trunc_fr1x32(v);
+    poly.freqSaturate[1] = trunc_fr1x32(v);
     break;
   case eParam_op2FreqSlew :
-    voice.opSlew[1] = v;
+    poly.opSlew[1] = v;
     break;
 
   case eParam_op3Mod1Source :
-    voice.opMod1Source[2] = v;
+    poly.opMod1Source[2] = v;
     break;
   case eParam_op3Mod1Gain :
-    voice.opMod1Gain[2] = trunc_fr1x32(v);
+    poly.opMod1Gain[2] = trunc_fr1x32(v);
     break;
   case eParam_op3Mod2Source :
-    voice.opMod2Source[2] = v;
+    poly.opMod2Source[2] = v;
     break;
   case eParam_op3Mod2Gain :
-    voice.opMod2Gain[2] = trunc_fr1x32(v);
+    poly.opMod2Gain[2] = trunc_fr1x32(v);
     break;
   case eParam_op3Tune :
-    voice.opTune[2] = v;
+    poly.opTune[2] = v;
     break;
   case eParam_op3Attack :
-    voice.opEnv[2].attackTime = v;
+    poly.opAttack[2] = v;
     break;
   case eParam_op3Decay :
-    voice.opEnv[2].decayTime = v;
+    poly.opDecay[2] = v;
     break;
   case eParam_op3Sustain :
-    voice.opEnv[2].sustainLevel = v;
+    poly.opSustain[2] = v;
    break;
   case eParam_op3Release :
-    voice.opEnv[2].releaseTime = v;
+    poly.opRelease[2] = v;
     break;
   case eParam_op3BandLimit :
-    voice.bandLimit[2] = trunc_fr1x32(v);
+    poly.bandLimit[2] = trunc_fr1x32(v);
     break;
   case eParam_op3FreqSat :
-    voice.freqSaturate[2] = trunc_fr1x32(v);
+    poly.freqSaturate[2] = trunc_fr1x32(v);
     break;
   case eParam_op3FreqSlew :
-    voice.opSlew[2] = v;
+    poly.opSlew[2] = v;
     break;
 
   case eParam_op4Mod1Source :
-    voice.opMod1Source[3] = v;
+    poly.opMod1Source[3] = v;
     break;
   case eParam_op4Mod1Gain :
-    voice.opMod1Gain[3] = trunc_fr1x32(v);
+    poly.opMod1Gain[3] = trunc_fr1x32(v);
     break;
   case eParam_op4Mod2Source :
-    voice.opMod2Source[3] = v;
+    poly.opMod2Source[3] = v;
     break;
   case eParam_op4Mod2Gain :
-    voice.opMod2Gain[3] = trunc_fr1x32(v);
+    poly.opMod2Gain[3] = trunc_fr1x32(v);
     break;
   case eParam_op4Tune :
-    voice.opTune[3] = v;
+    poly.opTune[3] = v;
     break;
   case eParam_op4Attack :
-    voice.opEnv[3].attackTime = v;
+    poly.opAttack[3] = v;
     break;
   case eParam_op4Decay :
-    voice.opEnv[3].decayTime = v;
+    poly.opDecay[3] = v;
     break;
   case eParam_op4Sustain :
-    voice.opEnv[3].sustainLevel = v;
+    poly.opSustain[3] = v;
    break;
   case eParam_op4Release :
-    voice.opEnv[3].releaseTime = v;
+    poly.opRelease[3] = v;
     break;
   case eParam_op4BandLimit :
-    voice.bandLimit[3] = trunc_fr1x32(v);
+    poly.bandLimit[3] = trunc_fr1x32(v);
     break;
   case eParam_op4FreqSat :
-    voice.freqSaturate[3] = trunc_fr1x32(v);
+    poly.freqSaturate[3] = trunc_fr1x32(v);
     break;
   case eParam_op4FreqSlew :
-    voice.opSlew[3] = v;
+    poly.opSlew[3] = v;
     break;
 
   default:
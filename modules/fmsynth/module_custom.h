@@ -17,4 +17,10 @@
 
 #define NUM_PARAMS eParamNumParams
 
+// polyphony. cost is linear in voices, all of them processed every
+// frame: on the host (fmsynth_render -b) each voice costs what the
+// monophonic synth did. bfin_lib doesn't report audio CPU yet
+// (MSG_GET_AUDIO_CPU_COM), so this is conservative until measured.
+#define FM_VOICES 4
+
 #endif
@@ -1,6 +1,7 @@
 #include <string.h>
 
 #include "module.h"
+#include "module_custom.h"
 #include "params.h"
 
 void param_desc_aux (ParamDesc* desc,int param_idx,
@@ -160,6 +161,12 @@ extern void fill_param_desc(ParamDesc* desc) {
 		 eParamTypeFix, 0x00000000, 0x00010000,
 		 32);
 
+  param_desc_aux(desc, eParam_noteVoice, "noteVoice",
+		 eParamTypeLabel, 0, FM_VOICES, 1);
+  // 0: steal the oldest note, 1: the quietest
+  param_desc_aux(desc, eParam_voiceSteal, "voiceSteal",
+		 eParamTypeLabel, 0, 1, 1);
+
 }
 
 // EOF
@@ -115,6 +115,9 @@ enum params {
   eParam_op4BandLimit,
   eParam_op4FreqSat,
 
+  eParam_noteVoice,
+  eParam_voiceSteal,
+
   eParamNumParams
 
 };
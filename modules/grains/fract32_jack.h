@@ -1 +1,3 @@
+#include "fract32_emu.h"
+
 fract32 clip_to_fr32(long x);
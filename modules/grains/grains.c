@@ -26,8 +26,10 @@
 
 // audio
 #include "filter_1p.h"
+#include "slew_bank.h"
 #include "module.h"
 #include "grain.h"
+#include "grain_cloud.h"
 #include "ricks_tricks.h"
 
 /// custom
@@ -36,12 +38,19 @@
 
 // total SDRAM is 64M
 // each line 16 bit address
+// (17 bits with fract16 frames (BUFFER_16), in the same memory)
+#ifdef BUFFER_16
+#define LINES_BUF_FRAMES 0x20000
+#else
 #define LINES_BUF_FRAMES 0x10000
+#endif
 //#define LINES_BUF_FRAMES 0xFFFFFF
 // try...
 //#define LINES_BUF_FRAMES 0x600000
 //#define LINES_BUF_FRAMES 0x1000000
 //#define LINES_BUF_FRAMES 0xbb8000 // 256 seconds @ 48k
+// grain cloud buffer, 5.4s
+#define CLOUD_BUF_FRAMES 0x40000
 #define PARAM_SECONDS_MAX 0x003c0000
 #define AUX_DEFAULT PARAM_AMP_0
 #define PAN_DEFAULT PAN_MAX/2
@@ -50,19 +59,19 @@
 
 //ADC mix params
 ParamValue faderI[4];
-ParamValue faderITarget[4];
+u8 faderISlew[4];
 
 ParamValue panI[4];
-ParamValue panITarget[4];
+u8 panISlew[4];
 
 ParamValue aux1I[4];
-ParamValue aux1ITarget[4];
+u8 aux1ISlew[4];
 
 ParamValue aux2I[4];
-ParamValue aux2ITarget[4];
+u8 aux2ISlew[4];
 
 ParamValue effectI[4];
-ParamValue effectITarget[4];
+u8 effectISlew[4];
 
 #define NGRAINS 2
 grain grains[NGRAINS];
@@ -73,19 +82,19 @@ ParamValue sourceMixer4;
 ParamValue sourceG[NGRAINS];
 
 ParamValue faderG[NGRAINS];
-ParamValue faderGTarget[NGRAINS];
+u8 faderGSlew[NGRAINS];
 
 ParamValue panG[NGRAINS];
-ParamValue panGTarget[NGRAINS];
+u8 panGSlew[NGRAINS];
 
 ParamValue aux1G[NGRAINS];
-ParamValue aux1GTarget[NGRAINS];
+u8 aux1GSlew[NGRAINS];
 
 ParamValue aux2G[NGRAINS];
-ParamValue aux2GTarget[NGRAINS];
+u8 aux2GSlew[NGRAINS];
 
 ParamValue effectG[NGRAINS];
-ParamValue effectGTarget[NGRAINS];
+u8 effectGSlew[NGRAINS];
 
 ParamValue FM_sourceG[NGRAINS];
 ParamValue FM_faderG[NGRAINS];
@@ -99,6 +108,25 @@ fract32 grain_lpf_freq[NGRAINS];
 
 ParamValue phaseG[NGRAINS];
 
+grainCloud cloud;
+//Cloud mix params
+ParamValue sourceC;
+
+ParamValue faderC;
+u8 faderCSlew;
+
+ParamValue panC;
+u8 panCSlew;
+
+ParamValue aux1C;
+u8 aux1CSlew;
+
+ParamValue aux2C;
+u8 aux2CSlew;
+
+ParamValue effectC;
+u8 effectCSlew;
+
 phasor LFO;
 fract32 LFO_bus;
 fract32 LFO_shape;
@@ -107,19 +135,38 @@ fract32 noiseBurstEnv;
 fract32 noiseBurstDecay;
 lcprng noiseBurstSource;
 
-fract32 CV_gen1Target;
-fract32 CV_gen2Target;
 fract32 CV_gen1;
 fract32 CV_gen2;
+u8 CV_gen1Slew;
+u8 CV_gen2Slew;
+
+// param integrators (the *Slew indices above)
+slewBank paramSlews;
+// inputs, grains and the rest, as registered in module_init()
+#define NUM_PARAM_SLEWS (4 * 5 + NGRAINS * 5 + 7)
+#if NUM_PARAM_SLEWS > SLEW_BANK_MAX
+#error "param slews don't fit in one slew bank"
+#endif
+// integration coefficients, as simple_slew(x, y, SLEW_100MS);
+// 0 follows the param immediately
+/* #define FADER_SLEW (FR32_MAX - SLEW_100MS) */
+#define FADER_SLEW 0
+#define GRAIN_SLEW (FR32_MAX - SLEW_100MS)
+/* #define GRAIN_SLEW 0 */
+#define CV_GEN_SLEW (FR32_MAX - SLEW_100MS)
 
 // data structure of external memory
 typedef struct _grainsData {
   ModuleData super;
   //ParamDesc mParamDesc[eParamNumParams];
   ParamData mParamData[eParamNumParams];
-  volatile fract32 audioBuffer[NGRAINS][LINES_BUF_FRAMES];
+  // aligned for 2x16 loads
+  volatile delaySample audioBuffer[NGRAINS][LINES_BUF_FRAMES] __attribute__((aligned(4)));
+  volatile fract32 cloudBuffer[CLOUD_BUF_FRAMES];
 } grainsData;
 
+MODULE_SDRAM(grainsData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData;
@@ -145,11 +192,39 @@ void module_init(void) {
   pGrainsData = (grainsData*)SDRAM_ADDRESS;
 
   gModuleData = &(pGrainsData->super);
+#ifdef BUFFER_16
+  strcpy(gModuleData->name, "grains16");
+#else
   strcpy(gModuleData->name, "grains");
+#endif
 
   gModuleData->paramData = (ParamData*)pGrainsData->mParamData;
   gModuleData->numParams = eParamNumParams;
 
+  int i;
+  slew_bank_init(&paramSlews);
+  for (i=0;i<4;i++) {
+    faderISlew[i] = slew_bank_add(&paramSlews, &(faderI[i]), FADER_SLEW);
+    panISlew[i] = slew_bank_add(&paramSlews, &(panI[i]), FADER_SLEW);
+    aux1ISlew[i] = slew_bank_add(&paramSlews, &(aux1I[i]), FADER_SLEW);
+    aux2ISlew[i] = slew_bank_add(&paramSlews, &(aux2I[i]), FADER_SLEW);
+    effectISlew[i] = slew_bank_add(&paramSlews, &(effectI[i]), FADER_SLEW);
+  }
+  for (i=0;i<NGRAINS;i++) {
+    faderGSlew[i] = slew_bank_add(&paramSlews, &(faderG[i]), GRAIN_SLEW);
+    panGSlew[i] = slew_bank_add(&paramSlews, &(panG[i]), GRAIN_SLEW);
+    aux1GSlew[i] = slew_bank_add(&paramSlews, &(aux1G[i]), GRAIN_SLEW);
+    aux2GSlew[i] = slew_bank_add(&paramSlews, &(aux2G[i]), GRAIN_SLEW);
+    effectGSlew[i] = slew_bank_add(&paramSlews, &(effectG[i]), GRAIN_SLEW);
+  }
+  faderCSlew = slew_bank_add(&paramSlews, &faderC, GRAIN_SLEW);
+  panCSlew = slew_bank_add(&paramSlews, &panC, GRAIN_SLEW);
+  aux1CSlew = slew_bank_add(&paramSlews, &aux1C, GRAIN_SLEW);
+  aux2CSlew = slew_bank_add(&paramSlews, &aux2C, GRAIN_SLEW);
+  effectCSlew = slew_bank_add(&paramSlews, &effectC, GRAIN_SLEW);
+  CV_gen1Slew = slew_bank_add(&paramSlews, &CV_gen1, CV_GEN_SLEW);
+  CV_gen2Slew = slew_bank_add(&paramSlews, &CV_gen2, CV_GEN_SLEW);
+
   param_setup( 	eParam_fader_i1,	FADER_DEFAULT );
   param_setup( 	eParam_pan_i1,		PAN_DEFAULT );
   param_setup( 	eParam_aux1_i1,		AUX_DEFAULT );
@@ -178,7 +253,6 @@ void module_init(void) {
 
   //initialise effect bus feedback DC block filter
   hpf_init(&effect_hpf);
-  int i;
   //initialise grains
   for (i=0;i<NGRAINS; i++) {
     grain_init(&(grains[i]), pGrainsData->audioBuffer[i], LINES_BUF_FRAMES);
@@ -274,6 +348,22 @@ void module_init(void) {
 
   param_setup (eParam_CV_gen1, 0);
   param_setup (eParam_CV_gen2, 0);
+
+  grain_cloud_init(&cloud, (fract32*)pGrainsData->cloudBuffer, CLOUD_BUF_FRAMES);
+  param_setup( 	eParam_source_c,	0);
+  param_setup( 	eParam_fader_c,		0 );
+  param_setup( 	eParam_pan_c,		PAN_DEFAULT );
+  param_setup( 	eParam_aux1_c,		0 );
+  param_setup( 	eParam_aux2_c,		0 );
+  param_setup( 	eParam_effect_c,	0 );
+
+  //grain cloud params
+  param_setup (eParam_density_c, 20 << 16);
+  param_setup (eParam_jitter_c, PAN_DEFAULT);
+  param_setup (eParam_size_c, 100 << 16);
+  param_setup (eParam_pitch_c, 1 << 16);
+  param_setup (eParam_position_c, 100 << 16);
+  param_setup (eParam_spread_c, 200 << 16);
 }
 
 // de-init
@@ -287,10 +377,6 @@ u32 module_get_num_params(void) {
 
 
 
-/* #define fader_slew(x, y) simple_slew(x, y, SLEW_100MS) */
-#define fader_slew(x, y) x = y;
-#define grain_slew(x, y) simple_slew(x, y, SLEW_100MS)
-/* #define grain_slew(x, y) x = y; */
 
 
 #define simple_busmix(x, y, fact) x = add_fr1x32(x, mult_fr1x32x32(y, fact))
@@ -324,21 +410,10 @@ void module_process_frame(void) {
 
   u8 i;
   //IIR slew
+  slew_bank_next(&paramSlews);
   for (i=0;i<4;i++) {
-    fader_slew(faderI[i], faderITarget[i]);
-    fader_slew(aux1I[i], aux1ITarget[i]);
-    fader_slew(aux2I[i], aux2ITarget[i]);
-    fader_slew(panI[i], panITarget[i]);
-    fader_slew(effectI[i],effectITarget[i]);
     patchMatrix[i+1] = in[i];
   }
-  for (i=0;i<NGRAINS;i++) {
-    grain_slew(faderG[i], faderGTarget[i]);
-    grain_slew(aux1G[i], aux1GTarget[i]);
-    grain_slew(aux2G[i], aux2GTarget[i]);
-    grain_slew(panG[i], panGTarget[i]);
-    grain_slew(effectG[i],effectGTarget[i]);
-  }
   
   //define delay input & output
   out[0] = 0;
@@ -397,6 +472,14 @@ void module_process_frame(void) {
 		   grainOut,
 		   effectG[i]);
   }
+
+  grainOut = grain_cloud_next(&cloud, selectGrainInput(sourceC));
+  patchMatrix[9+NGRAINS+NGRAINS+NGRAINS] = grainOut;
+  mix_panned_mono (grainOut, &(out[0]), &(out[1]), panC, faderC);
+  mix_aux_mono (grainOut, &(out[2]), &(out[3]), aux1C, aux2C);
+  simple_busmix (effectBusFeedback,
+		 grainOut,
+		 effectC);
   patchMatrix[0] = effectBus;
 
   fract32 phase_next = phasor_next(&LFO);
@@ -411,8 +494,6 @@ void module_process_frame(void) {
     abs_fr1x32(mult_fr1x32x32(noiseBurstEnv,
 			      lcprng_next (&noiseBurstSource)));
 
-  simple_slew(CV_gen1, CV_gen1Target, SLEW_100MS);
-  simple_slew(CV_gen2, CV_gen2Target, SLEW_100MS);
   patchMatrix[7+NGRAINS+NGRAINS+NGRAINS] = CV_gen1;
   patchMatrix[8+NGRAINS+NGRAINS+NGRAINS] = CV_gen2;
   process_cv();
@@ -425,73 +506,73 @@ void module_set_param(u32 idx, ParamValue v) {
   switch(idx) {
     // ADC mix params
   case eParam_fader_i1 :
-    faderITarget[0] = v;
+    slew_bank_in(&paramSlews, faderISlew[0], v);
     break;
   case eParam_pan_i1 :
-    panITarget[0] = v;
+    slew_bank_in(&paramSlews, panISlew[0], v);
     break;
   case eParam_aux1_i1 :
-    aux1ITarget[0] = v;
+    slew_bank_in(&paramSlews, aux1ISlew[0], v);
     break;
   case eParam_aux2_i1 :
-    aux2ITarget[0] = v;
+    slew_bank_in(&paramSlews, aux2ISlew[0], v);
     break;
   case eParam_effect_i1 :
-    effectITarget[0] = v;
+    slew_bank_in(&paramSlews, effectISlew[0], v);
     break;
 
   case eParam_fader_i2 :
-    faderITarget[1] = v;
+    slew_bank_in(&paramSlews, faderISlew[1], v);
     break;
   case eParam_pan_i2 :
-    panITarget[1] = v;
+    slew_bank_in(&paramSlews, panISlew[1], v);
     break;
   case eParam_aux1_i2 :
-    aux1ITarget[1] = v;
+    slew_bank_in(&paramSlews, aux1ISlew[1], v);
     break;
   case eParam_aux2_i2 :
-    aux2ITarget[1] = v;
+    slew_bank_in(&paramSlews, aux2ISlew[1], v);
     break;
   case eParam_effect_i2 :
-    effectITarget[1] = v;
+    slew_bank_in(&paramSlews, effectISlew[1], v);
     break;
 
   case eParam_source_i3 :
     sourceMixer3 = v;
     break;
   case eParam_fader_i3 :
-    faderITarget[2] = v;
+    slew_bank_in(&paramSlews, faderISlew[2], v);
     break;
   case eParam_pan_i3 :
-    panITarget[2] = v;
+    slew_bank_in(&paramSlews, panISlew[2], v);
     break;
   case eParam_aux1_i3 :
-    aux1ITarget[2] = v;
+    slew_bank_in(&paramSlews, aux1ISlew[2], v);
     break;
   case eParam_aux2_i3 :
-    aux2ITarget[2] = v;
+    slew_bank_in(&paramSlews, aux2ISlew[2], v);
     break;
   case eParam_effect_i3 :
-    effectITarget[2] = v;
+    slew_bank_in(&paramSlews, effectISlew[2], v);
     break;
 
   case eParam_source_i4 :
     sourceMixer4 = v;
     break;
   case eParam_fader_i4 :
-    faderITarget[3] = v;
+    slew_bank_in(&paramSlews, faderISlew[3], v);
     break;
   case eParam_pan_i4 :
-    panITarget[3] = v;
+    slew_bank_in(&paramSlews, panISlew[3], v);
     break;
   case eParam_aux1_i4 :
-    aux1ITarget[3] = v;
+    slew_bank_in(&paramSlews, aux1ISlew[3], v);
     break;
   case eParam_aux2_i4 :
-    aux2ITarget[3] = v;
+    slew_bank_in(&paramSlews, aux2ISlew[3], v);
     break;
   case eParam_effect_i4 :
-    effectITarget[3] = v;
+    slew_bank_in(&paramSlews, effectISlew[3], v);
     break;
 
   //grain mix params
@@ -499,19 +580,19 @@ void module_set_param(u32 idx, ParamValue v) {
     sourceG[0] = v;
     break;
   case eParam_fader_g1 :
-    faderGTarget[0] = v;
+    slew_bank_in(&paramSlews, faderGSlew[0], v);
     break;
   case eParam_pan_g1 :
-    panGTarget[0] = v;
+    slew_bank_in(&paramSlews, panGSlew[0], v);
     break;
   case eParam_aux1_g1 :
-    aux1GTarget[0] = v;
+    slew_bank_in(&paramSlews, aux1GSlew[0], v);
     break;
   case eParam_aux2_g1 :
-    aux2GTarget[0] = v;
+    slew_bank_in(&paramSlews, aux2GSlew[0], v);
     break;
   case eParam_effect_g1 :
-    effectGTarget[0] = v;
+    slew_bank_in(&paramSlews, effectGSlew[0], v);
     break;
   case eParam_phase_g1 :
     if (v == 0)
@@ -598,19 +679,19 @@ void module_set_param(u32 idx, ParamValue v) {
     sourceG[1] = v;
     break;
   case eParam_fader_g2 :
-    faderGTarget[1] = v;
+    slew_bank_in(&paramSlews, faderGSlew[1], v);
     break;
   case eParam_pan_g2 :
-    panGTarget[1] = v;
+    slew_bank_in(&paramSlews, panGSlew[1], v);
     break;
   case eParam_aux1_g2 :
-    aux1GTarget[1] = v;
+    slew_bank_in(&paramSlews, aux1GSlew[1], v);
     break;
   case eParam_aux2_g2 :
-    aux2GTarget[1] = v;
+    slew_bank_in(&paramSlews, aux2GSlew[1], v);
     break;
   case eParam_effect_g2 :
-    effectGTarget[1] = v;
+    slew_bank_in(&paramSlews, effectGSlew[1], v);
     break;
   case eParam_phase_g2 :
     if (v == 0)
@@ -720,10 +801,50 @@ void module_set_param(u32 idx, ParamValue v) {
     break;
 
   case eParam_CV_gen1 :
-    CV_gen1Target = v ;
+    slew_bank_in(&paramSlews, CV_gen1Slew, v);
     break;
   case eParam_CV_gen2 :
-    CV_gen2Target = v ;
+    slew_bank_in(&paramSlews, CV_gen2Slew, v);
+    break;
+
+  //grain cloud mix params
+  case eParam_source_c :
+    sourceC = v;
+    break;
+  case eParam_fader_c :
+    slew_bank_in(&paramSlews, faderCSlew, v);
+    break;
+  case eParam_pan_c :
+    slew_bank_in(&paramSlews, panCSlew, v);
+    break;
+  case eParam_aux1_c :
+    slew_bank_in(&paramSlews, aux1CSlew, v);
+    break;
+  case eParam_aux2_c :
+    slew_bank_in(&paramSlews, aux2CSlew, v);
+    break;
+  case eParam_effect_c :
+    slew_bank_in(&paramSlews, effectCSlew, v);
+    break;
+
+  //grain cloud params
+  case eParam_density_c :
+    grain_cloud_set_density(&cloud, v);
+    break;
+  case eParam_jitter_c :
+    grain_cloud_set_jitter(&cloud, v);
+    break;
+  case eParam_size_c :
+    grain_cloud_set_length(&cloud, (v >> 16) * (SAMPLERATE / 1000));
+    break;
+  case eParam_pitch_c :
+    grain_cloud_set_pitch(&cloud, v >> (16 - GRAIN_CLOUD_FRAC));
+    break;
+  case eParam_position_c :
+    grain_cloud_set_delay(&cloud, (v >> 16) * (SAMPLERATE / 1000));
+    break;
+  case eParam_spread_c :
+    grain_cloud_set_spread(&cloud, (v >> 16) * (SAMPLERATE / 1000));
     break;
 
   default:
@@ -0,0 +1,143 @@
+# build rules shared by grains and grains16.
+#
+# the including Makefile sets module_name and grains_dir (the grains sources).
+# grains16 also sets BUFFER_16 = 1: fract16 grain buffers, for twice the time.
+# its objects are built in its own directory, since they differ from
+# the fract32 build.
+
+audio = ../../dsp
+bfin = ../../bfin_lib/src
+
+include $(grains_dir)/version.mk
+version = $(maj).$(min).$(rev)
+ldr_name = $(module_name)-$(version).ldr
+
+ifdef BUFFER_16
+module_defs = -D BUFFER_16=1
+buffer_name = buffer16
+audio_obj =
+vpath %.c $(grains_dir) $(audio)
+else
+module_defs =
+buffer_name = buffer
+audio_obj = $(audio)/
+endif
+
+module_obj = grains.o \
+	$(audio_obj)$(buffer_name).o \
+	$(audio_obj)ricks_tricks.o \
+	$(audio_obj)echoTap.o \
+	$(audio_obj)scrubTap.o \
+	$(audio_obj)conversion.o \
+	$(audio_obj)grain.o \
+	$(audio_obj)grain_cloud.o \
+	$(audio_obj)filter_1p.o \
+	$(audio_obj)slew_bank.o \
+	$(audio_obj)filter_ramp.o \
+	$(audio_obj)filter_svf.o \
+	$(audio_obj)noise.o \
+	$(audio_obj)pan.o \
+	$(audio_obj)table.o \
+	$(bfin)/libfixmath/fix32.o \
+	$(bfin)/libfixmath/fix16.o \
+	$(bfin)/libfixmath/fix16_sqrt.o
+
+
+all: $(module_name).ldr
+
+include ../../bfin_lib/bfin_lib.mk
+
+# module_custom.h and params.h
+INC += -I$(grains_dir)
+
+CFLAGS += -D ARCH_BFIN=1 $(module_defs)
+# CFLAGS += --verbose
+
+desc_src = \
+	$(bfin_lib_srcdir)desc.c \
+	$(bfin_lib_srcdir)pickle.c \
+	$(grains_dir)/params.c
+
+desc:
+	gcc $(desc_src) \
+	$(INC) \
+	$(module_defs) \
+	-D NAME=\"$(module_name)\" \
+	-o $(module_name)_desc_build
+
+$(module_obj): %.o : %.c
+	$(CC) $(CFLAGS) -c -o $@ $< $(LDFLAGS)
+
+$(module_name): bfin_lib_target $(module_obj)
+	$(CC) $(LDFLAGS) -T $(grains_dir)/grains.lds \
+	$(patsubst %.o, $(bfin_lib_objdir)%.o, $(bfin_lib_obj)) \
+	$(module_obj) \
+	-o $(module_name) \
+	-lm -lbfdsp -lbffastfp
+
+clean: bfin_lib_clean
+	rm $(module_obj)
+	rm $(module_name).ldr
+	rm $(module_name)
+	rm $(module_name).dsc
+	rm $(module_name)_desc_build
+
+deploy: $(module_name).ldr
+	make desc
+	./$(module_name)_desc_build
+	cp $(module_name).ldr $(module_name)-$(maj).$(min).$(rev).ldr
+
+.PHONY: clean
+	deploy
+
+sim_sourcefiles = ../../utils/bfin_sim/main.c \
+	$(grains_dir)/grains.c \
+	$(audio)/$(buffer_name).c \
+	$(audio)/ricks_tricks.c \
+	$(audio)/echoTap.c \
+	$(audio)/scrubTap.c \
+	$(audio)/grain.c \
+	$(audio)/grain_cloud.c \
+	$(audio)/filter_1p.c \
+	$(audio)/slew_bank.c \
+	$(audio)/filter_ramp.c \
+	$(audio)/noise.c \
+	$(audio)/pan.c \
+	../../utils/bfin_sim/fract2float_conv.c \
+	../../utils/bfin_sim/module_block.c \
+	../../utils/bfin_sim/src/control.c \
+	../../utils/bfin_sim/src/cv.c \
+	../../utils/bfin_sim/fract_math.c \
+	$(grains_dir)/params.c
+
+sim_inc = -I ../../dsp \
+	-I ../../utils/bfin_sim/src \
+	-I ../../utils/bfin_sim/ \
+	-I ../../utils/bfin_sim/src/libfixmath \
+	-I $(grains_dir) \
+	-I ../../common\
+
+sim_outfile = $(module_name)_jack
+
+sim_flags = -ljack -llo -D ARCH_LINUX=1 $(module_defs)
+
+sim:
+	touch $(sim_outfile)
+	rm ./$(sim_outfile)
+	gcc $(sim_sourcefiles) $(sim_flags) $(sim_inc) -o $(sim_outfile) -g
+
+render_sourcefiles = $(filter-out ../../utils/bfin_sim/main.c, $(sim_sourcefiles)) \
+	../../utils/bfin_sim/bfin_render.c
+
+render_outfile = $(module_name)_render
+
+# tentative in/out definitions in bfin_sim/module.h need -fcommon
+render_flags = -lm -fcommon -D ARCH_LINUX=1 -D BFIN_RENDER=1 $(module_defs) \
+	-D NAME=\"$(module_name)\"
+
+render:
+	touch $(render_outfile)
+	rm ./$(render_outfile)
+	gcc $(render_sourcefiles) $(render_flags) $(sim_inc) -o $(render_outfile) -O2 -g
+
+plugin_flags += $(module_defs)
@@ -12,7 +12,7 @@ void param_desc_aux (ParamDesc* desc,int param_idx,
   desc[param_idx].max = max;
   desc[param_idx].radix = radix;
 }
-#define GRAINS_PATCHPOINTS 15
+#define GRAINS_PATCHPOINTS 16
 #define param_desc_patch(param_idx, desc_string) param_desc_aux (desc, param_idx, desc_string, eParamTypeLabel, 0, GRAINS_PATCHPOINTS-1, 1)
 #define param_desc_fader(param_idx, desc_string)  param_desc_aux (desc, param_idx, desc_string, FADER_TYPE, FADER_MIN, FADER_MAX, FADER_RADIX)
 #define param_desc_pan(param_idx, desc_string)  param_desc_aux (desc, param_idx, desc_string, PAN_TYPE, PAN_MIN, PAN_MAX, PAN_RADIX)
@@ -207,6 +207,32 @@ extern void fill_param_desc(ParamDesc* desc) {
 		  eParamTypeFix, -1 << 31, FR32_MAX,
 		  16);
 
+  //Grain Cloud Mixer Params
+  param_desc_patch(eParam_source_c, "source_c");
+  param_desc_fader (eParam_fader_c, "fader_c");
+  param_desc_pan (eParam_pan_c, "pan_c");
+  param_desc_fader (eParam_aux1_c, "aux1_c");
+  param_desc_fader (eParam_aux2_c, "aux2_c");
+  param_desc_fader (eParam_effect_c, "effect_c");
+
+  //Grain Cloud Params
+  param_desc_aux (desc, eParam_density_c, "density_c",
+		  eParamTypeFix, 0, 1000 << 16,
+		  16);
+  param_desc_pan(eParam_jitter_c, "jitter_c");
+  param_desc_aux (desc, eParam_size_c, "size_c",
+		  eParamTypeFix, 6 << 16, 1000 << 16,
+		  16);
+  param_desc_aux (desc, eParam_pitch_c, "pitch_c",
+		  SPEED_TYPE, -(4 << 16), 4 << 16,
+		  SPEED_RADIX);
+  param_desc_aux (desc, eParam_position_c, "position_c",
+		  eParamTypeFix, 0, 4000 << 16,
+		  16);
+  param_desc_aux (desc, eParam_spread_c, "spread_c",
+		  eParamTypeFix, 0, 4000 << 16,
+		  16);
+
 }
 
 // EOF
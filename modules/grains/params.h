@@ -184,6 +184,22 @@ enum params {
 
   eParam_CV_gen1,
   eParam_CV_gen2,
+
+  //grain cloud mix params
+  eParam_source_c,
+  eParam_fader_c,
+  eParam_pan_c,
+  eParam_aux1_c,
+  eParam_aux2_c,
+  eParam_effect_c,
+
+  //grain cloud params
+  eParam_density_c,
+  eParam_jitter_c,
+  eParam_size_c,
+  eParam_pitch_c,
+  eParam_position_c,
+  eParam_spread_c,
   
   eParamNumParams
 };
@@ -14,13 +14,14 @@
 #include "pan.h"
 
 // initialize with pointer to audio buffer
-extern void delayFadeN_init(delayFadeN* dl, volatile fract32* data, u32 frames) {
-  buffer_init(&(dl->buffer), data, frames);
+extern void delayFadeN_init(delayFadeN* dl, volatile delaySample* data, u32 frames) {
+  delay_buffer_init(&(dl->buffer), data, frames);
+  buffer_stage_init(&(dl->stage), &(dl->buffer));
   
-  buffer_tapN_init(&(dl->tapRd[0]), &(dl->buffer));
-  buffer_tapN_init(&(dl->tapRd[1]), &(dl->buffer));
+  delay_tapN_init(&(dl->tapRd[0]), &(dl->buffer));
+  delay_tapN_init(&(dl->tapRd[1]), &(dl->buffer));
 
-  buffer_tapN_init(&(dl->tapWr), &(dl->buffer));
+  delay_tapN_init(&(dl->tapWr), &(dl->buffer));
 
   dl->tapWr.idx = 0;
   dl->tapRd[0].idx = 0;
@@ -54,42 +55,83 @@ extern fract32 delayFadeN_next(delayFadeN* dl, fract32 in) {
   /* 			      dl->fadeRd); */
 
   /// linear read-head crossfade
-  readVal = pan_lin_mix( buffer_tapN_read( &(dl->tapRd[0]) ) ,
-			 buffer_tapN_read( &(dl->tapRd[1]) ) ,
+  readVal = pan_lin_mix( buffer_stage_read( &(dl->stage), 0, &(dl->tapRd[0]) ) ,
+			 buffer_stage_read( &(dl->stage), 1, &(dl->tapRd[1]) ) ,
 			 dl->fadeRd);
 
   if(dl->preLevel == 0) {
     if(dl->write) {
       // write and replace
-      buffer_tapN_write(&(dl->tapWr), in);
+      buffer_stage_write(&(dl->stage), &(dl->tapWr), in);
     }
   } else if(dl->preLevel < 0) { // consider <0 to be == 1
     if(dl->write) {
       // overdub
-      buffer_tapN_add(&(dl->tapWr), in);
+      buffer_stage_add(&(dl->stage), &(dl->tapWr), in);
     }
   } else { // prelevel is non-zero, non-full
     if(dl->write) {
       // write mix
-      buffer_tapN_mix(&(dl->tapWr), in, dl->preLevel);
+      buffer_stage_mix(&(dl->stage), &(dl->tapWr), in, dl->preLevel);
     }
   }
 
   // advance the read phasors
   if(dl->runRd) {
-    buffer_tapN_next( &(dl->tapRd[0]) );
-    buffer_tapN_next( &(dl->tapRd[1]) );
+    delay_tapN_next( &(dl->tapRd[0]) );
+    delay_tapN_next( &(dl->tapRd[1]) );
   }
   // advance the write phasors
   if(dl->runWr) {
-    buffer_tapN_next( &(dl->tapWr) );
+    delay_tapN_next( &(dl->tapWr) );
   }
   return readVal;
 }
 
+// process a block, given per-frame read crossfade values.
+// pre-level and run flags are copied to locals first:
+// buffer writes could otherwise alias them and force a reload every frame.
+extern void delayFadeN_process_block(delayFadeN* dl, const fract32* in, fract32* out,
+				     const fract32* fadeRd, u16 frames) {
+  const fract32 pre = dl->preLevel;
+  const u8 write = dl->write;
+  const u8 runRd = dl->runRd;
+  const u8 runWr = dl->runWr;
+  fract32 readVal;
+  u16 i;
+
+  for(i=0; i<frames; ++i) {
+    // read before write, same as _next()
+    readVal = pan_lin_mix( buffer_stage_read( &(dl->stage), 0, &(dl->tapRd[0]) ) ,
+			   buffer_stage_read( &(dl->stage), 1, &(dl->tapRd[1]) ) ,
+			   fadeRd[i]);
+    if(write) {
+      if(pre == 0) {
+	buffer_stage_write(&(dl->stage), &(dl->tapWr), in[i]);
+      } else if(pre < 0) {
+	buffer_stage_add(&(dl->stage), &(dl->tapWr), in[i]);
+      } else {
+	buffer_stage_mix(&(dl->stage), &(dl->tapWr), in[i], pre);
+      }
+    }
+    if(runRd) {
+      delay_tapN_next( &(dl->tapRd[0]) );
+      delay_tapN_next( &(dl->tapRd[1]) );
+    }
+    if(runWr) {
+      delay_tapN_next( &(dl->tapWr) );
+    }
+    out[i] = readVal;
+  }
+  dl->fadeRd = fadeRd[frames - 1];
+}
+
 // set loop endpoint in seconds
 extern void delayFadeN_set_loop_ms(delayFadeN* dl, fract32 ms) {
   u32 samps = ms * 48;
+  if(samps > dl->buffer.frames) {
+    samps = dl->buffer.frames;
+  }
   dl->tapRd[0].loop = samps;
   dl->tapRd[1].loop = samps;
   dl->tapWr.loop = samps;
@@ -97,12 +139,12 @@ extern void delayFadeN_set_loop_ms(delayFadeN* dl, fract32 ms) {
 
 extern void delayFadeN_set_delay_ms(delayFadeN* dl, fract32 ms, u8 id) {
   u32 samp = ms * 48;
-  buffer_tapN_sync(&(dl->tapRd[id]), &(dl->tapWr), samp);
+  delay_tapN_sync(&(dl->tapRd[id]), &(dl->tapWr), samp);
 }
 
 // set delayFadeN in samples
 extern void delayFadeN_set_delay_samp(delayFadeN* dl, u32 samp, u8 id) {
-  buffer_tapN_sync(&(dl->tapRd[id]), &(dl->tapWr), samp);
+  delay_tapN_sync(&(dl->tapRd[id]), &(dl->tapWr), samp);
 }
 
 // set erase level
@@ -117,12 +159,12 @@ extern void delayFadeN_set_write(delayFadeN* dl, u8 write) {
 
 extern void delayFadeN_set_pos_read_ms(delayFadeN* dl, fract32 ms, u8 id) {
   u32 samp = ms * 48;
-  buffer_tapN_set_pos(&(dl->tapRd[id]), samp);
+  delay_tapN_set_pos(&(dl->tapRd[id]), samp);
 }
 
 extern void delayFadeN_set_pos_write_ms(delayFadeN* dl, fract32 ms) {
   u32 samp = 48 * ms;
-  buffer_tapN_set_pos(&(dl->tapWr), samp);
+  delay_tapN_set_pos(&(dl->tapWr), samp);
 }
 
 // set read run flag 
@@ -138,13 +180,13 @@ extern void delayFadeN_set_run_write(delayFadeN* dl, u8 val) {
 // set read-head rate multiplier
 void delayFadeN_set_mul(delayFadeN* dl, u32 val) {
   // different terms, dumb...
-  buffer_tapN_set_inc( &(dl->tapRd[0]), val );
-  buffer_tapN_set_inc( &(dl->tapRd[1]), val );
+  delay_tapN_set_inc( &(dl->tapRd[0]), val );
+  delay_tapN_set_inc( &(dl->tapRd[1]), val );
 
 }
 
 // set read-head rate divider
 void delayFadeN_set_div(delayFadeN* dl, u32 val) {
-  buffer_tapN_set_div( &(dl->tapRd[0]), val );
-  buffer_tapN_set_div( &(dl->tapRd[1]), val );
+  delay_tapN_set_div( &(dl->tapRd[0]), val );
+  delay_tapN_set_div( &(dl->tapRd[1]), val );
 }
@@ -8,7 +8,8 @@ delay line object interface
 #ifndef _ALEPH_LINES_DELAYLINE_H_
 #define _ALEPH_LINES_DELAYLINE_H_
 
-#include "buffer.h"
+#include "buffer_stage.h"
+#include "delay_buffer.h"
 #include "fade.h"
 #include "types.h"
 
@@ -16,10 +17,12 @@ delay line object interface
 // double-tapped delay line
 typedef struct _delayFadeN {
   //-- audio buffer class
-  audioBuffer buffer;
+  delayBuffer buffer;
   //-- read and write taps (non-interpolated)
-  bufferTapN tapRd[2];
-  bufferTapN tapWr;
+  delayTapN tapRd[2];
+  delayTapN tapWr;
+  // L1 windows for the taps (read taps are ports 0 and 1)
+  bufferStage stage;
   // level of existing data to mix with new data
   // negative == 1
   fract32 preLevel;
@@ -37,9 +40,13 @@ typedef struct _delayFadeN {
 } delayFadeN;
 
 // initialize with pointer to audio buffer data
-extern void delayFadeN_init(delayFadeN* dl, volatile fract32* bufData, u32 frames);
+extern void delayFadeN_init(delayFadeN* dl, volatile delaySample* bufData, u32 frames);
 // get next value given input
 extern fract32 delayFadeN_next(delayFadeN* dl, fract32 in);
+// process a block, given per-frame read crossfade values
+// (in and out may be the same buffer)
+extern void delayFadeN_process_block(delayFadeN* dl, const fract32* in, fract32* out,
+				     const fract32* fadeRd, u16 frames);
 // set loop endpoint in seconds / samples
 extern void delayFadeN_set_loop_ms(delayFadeN* dl, fract32 ms);
 // set delayFadeN time in seconds / samples
@@ -25,9 +25,13 @@
 #include "buffer.h"
 #include "filter_svf.h"
 #include "filter_1p.h"
+#include "slew_bank.h"
 #include "filter_ramp.h"
 
 #include "delayFadeN.h"
+#ifdef ARCH_BFIN
+#include "mdma.h"
+#endif
 #include "module.h"
 ////test
 #include "noise.h"
@@ -36,6 +40,11 @@
 
 #define TEST 0
 
+#ifdef ARCH_BFIN
+// delay taps are staged in L1 by memory DMA
+static bufferStageCopier mdmaCopier = { &mdma_copy, &mdma_wait, 0, 0 };
+#endif
+
 //-----------------------
 //------ static variables
 
@@ -45,7 +54,12 @@
 // time idx is 48 samples (1ms)
 // time param is 16 bit
 // max time multipler is 4.0
+// fract16 frames (BUFFER_16) fit twice as many.
+#ifdef BUFFER_16
+#define LINES_BUF_FRAMES 0xBFFE80
+#else
 #define LINES_BUF_FRAMES 0x5FFF40
+#endif
 
 #define NLINES 2
 
@@ -55,9 +69,12 @@ typedef struct _linesData {
   ModuleData super;
   //  ParamDesc mParamDesc[eParamNumParams];
   ParamData mParamData[eParamNumParams];
-  volatile fract32 audioBuffer[NLINES][LINES_BUF_FRAMES];
+  // aligned for 2x16 loads
+  volatile delaySample audioBuffer[NLINES][LINES_BUF_FRAMES] __attribute__((aligned(4)));
 } linesData;
 
+MODULE_SDRAM(linesData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData; 
@@ -91,8 +108,6 @@ fract16 mix_del_dac[2][4] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
 // svf balance
 fract32 mix_fwet[NLINES] = { 0, 0 };
 fract32 mix_fdry[NLINES] = { 0, 0 };
-filter_1p_lo drySlew[2];
-filter_1p_lo wetSlew[2];
 
 // -- mixed inputs
 // delay 
@@ -104,8 +119,18 @@ fract32 out_del[NLINES] = { 0, 0 };
 fract32 out_svf[NLINES] = { 0, 0 };
 
 //-- parameter integrators
-filter_1p_lo svfCutSlew[2];
-filter_1p_lo svfRqSlew[2];
+slewBank paramSlews;
+// smoothed svf params
+fract32 svfCut[NLINES];
+fract32 svfRq[NLINES];
+// indices in paramSlews
+u8 svfCutSlew[NLINES];
+u8 svfRqSlew[NLINES];
+u8 drySlew[NLINES];
+u8 wetSlew[NLINES];
+#if NLINES * 4 > SLEW_BANK_MAX
+#error "param slews don't fit in one slew bank"
+#endif
 
 //--- crossfade stuff
 /// which tap we are fading towards...
@@ -206,19 +231,31 @@ void module_init(void) {
   pLinesData = (linesData*)SDRAM_ADDRESS;
   
   gModuleData = &(pLinesData->super);
+#ifdef BUFFER_16
+  strcpy(gModuleData->name, "lines16");
+#else
   strcpy(gModuleData->name, "lines");
+#endif
 
   gModuleData->paramData = (ParamData*)pLinesData->mParamData;
   gModuleData->numParams = eParamNumParams;
 
+  slew_bank_init(&paramSlews);
   for(i=0; i<NLINES; i++) {
     delayFadeN_init(&(lines[i]), pLinesData->audioBuffer[i], LINES_BUF_FRAMES);
+#ifdef ARCH_BFIN
+    buffer_stage_set_copier(&(lines[i].stage), &mdmaCopier);
+#endif
     filter_svf_init(&(svf[i]));
 
-    filter_1p_lo_init(&(svfCutSlew[i]), 0x3fffffff);
-    filter_1p_lo_init(&(svfRqSlew[i]), 0x3fffffff);
-    filter_1p_lo_init(&(wetSlew[i]), 0x3fffffff);
-    filter_1p_lo_init(&(drySlew[i]), 0x3fffffff);
+    svfCut[i] = 0x3fffffff;
+    svfRq[i] = 0x3fffffff;
+    mix_fwet[i] = 0x3fffffff;
+    mix_fdry[i] = 0x3fffffff;
+    svfCutSlew[i] = slew_bank_add(&paramSlews, &(svfCut[i]), 0);
+    svfRqSlew[i] = slew_bank_add(&paramSlews, &(svfRq[i]), 0);
+    wetSlew[i] = slew_bank_add(&paramSlews, &(mix_fwet[i]), 0);
+    drySlew[i] = slew_bank_add(&paramSlews, &(mix_fdry[i]), 0);
 
     filter_ramp_init(&(lpFadeRd[i]));
     filter_ramp_init(&(lpFadeWr[i]));
@@ -229,7 +266,7 @@ void module_init(void) {
     /* } */
 
     // need to zero everything to avoid horrible noise at boot...
-    memset((void*)pLinesData->audioBuffer[i], 0, LINES_BUF_FRAMES * sizeof(fract32));
+    memset((void*)pLinesData->audioBuffer[i], 0, LINES_BUF_FRAMES * sizeof(delaySample));
     // however, it is causing crashes or hangs here, for some damn reason.
 
     // at least zero the end of the buffer
@@ -384,6 +421,9 @@ void module_process_frame(void) {
   // mix inputs to delay lines
   mix_del_inputs();
 
+  // param integrators
+  slew_bank_next(&paramSlews);
+
   /// TEST
 
   for(i=0; i<NLINES; i++) {
@@ -397,28 +437,13 @@ void module_process_frame(void) {
     // process delay line
     tmpDel = delayFadeN_next( &(lines[i]), in_del[i]);	    
     // process filters
-    // check integrators for filter params
-
-    /* if( !filter_1p_sync(&(svfCutSlew[i])) ) { */
-      filter_svf_set_coeff( &(svf[i]), filter_1p_lo_next(&(svfCutSlew[i])) );
-    /* } */
-    /* if( !filter_1p_sync(&(svfRqSlew[i])) ) { */
-      filter_svf_set_rq( &(svf[i]), filter_1p_lo_next(&(svfRqSlew[i])) );
-    /* } */
+    filter_svf_set_coeff( &(svf[i]), svfCut[i] );
+    filter_svf_set_rq( &(svf[i]), svfRq[i] );
 
     tmpSvf = filter_svf_next( &(svf[i]), tmpDel);  
 
     // mix
-    /* if( !filter_1p_sync(&(drySlew[i])) ) { */
-    mix_fdry[i] = filter_1p_lo_next(&(drySlew[i]));
-    /* } */
-
     tmpDel = mult_fr1x32x32( tmpDel, mix_fdry[i] );
-
-
-    /* if( !filter_1p_sync(&(wetSlew[i])) ) { */
-      mix_fwet[i] = filter_1p_lo_next(&(wetSlew[i]));
-    /* } */
     tmpDel = add_fr1x32(tmpDel,
 			mult_fr1x32x32(tmpSvf, mix_fwet[i]));
 
@@ -10,8 +10,8 @@ static u8 start_fade_rd(u8 id) {
     oldTarget = fadeTargetRd[id];
     newTarget = !oldTarget;
     // copy all tap parameters to target
-    buffer_tapN_copy( &(lines[id].tapRd[oldTarget]),
-		      &(lines[id].tapRd[newTarget]) );
+    delay_tapN_copy( &(lines[id].tapRd[oldTarget]),
+		     &(lines[id].tapRd[newTarget]) );
     fadeTargetRd[id] = newTarget;
     // start the fade
     filter_ramp_start(&(lpFadeRd[id]));
@@ -120,23 +120,23 @@ void module_set_param(u32 idx, ParamValue v) {
     // filter params
   case eParam_freq0 :
     //    filter_svf_set_coeff(&(svf[0]), v );
-    svfCutSlew[0].x = v;
+    slew_bank_in(&paramSlews, svfCutSlew[0], v);
     break;
   case eParam_freq1 :
     //    filter_svf_set_coeff(&(svf[1]), v );
-    svfCutSlew[1].x = v;
+    slew_bank_in(&paramSlews, svfCutSlew[1], v);
     break;
   case eParam_rq0 :
     //    filter_svf_set_rq(&(svf[0]), v);
     // incoming param value is 16.16
     // target is 2.30xs
     //    filter_svf_set_rq(&(svf[0]), v << 14);
-    svfRqSlew[0].x = v << 14;
+    slew_bank_in(&paramSlews, svfRqSlew[0], v << 14);
     break;
   case eParam_rq1 :
     //    filter_svf_set_rq(&(svf[1]), v);
     //    filter_svf_set_rq(&(svf[1]), v << 14);
-    svfRqSlew[1].x = v << 14;
+    slew_bank_in(&paramSlews, svfRqSlew[1], v << 14);
     break;
   case eParam_low0 :
     filter_svf_set_low(&(svf[0]), v);
@@ -166,22 +166,22 @@ void module_set_param(u32 idx, ParamValue v) {
     // filter balance
   case eParam_fwet0 :
     /* mix_fwet[0] = v; */
-    wetSlew[0].x = v;
+    slew_bank_in(&paramSlews, wetSlew[0], v);
     break;
 
   case eParam_fwet1 :
     /* mix_fwet[1] = v; */
-    wetSlew[1].x = v;
+    slew_bank_in(&paramSlews, wetSlew[1], v);
     break;
 
   case eParam_fdry0 :
     /* mix_fdry[0] = v; */
-    drySlew[0].x = v;
+    slew_bank_in(&paramSlews, drySlew[0], v);
     break;
 
   case eParam_fdry1 :
     /* mix_fdry[1] = v; */
-    drySlew[1].x = v;
+    slew_bank_in(&paramSlews, drySlew[1], v);
     break;
 
     /// mix points
@@ -298,17 +298,17 @@ void module_set_param(u32 idx, ParamValue v) {
 
     // param integrators
   case eParamCut0Slew :
-    svfCutSlew[0].c =  v;
+    slew_bank_set_slew(&paramSlews, svfCutSlew[0], v);
     break;
   case eParamCut1Slew :
-    svfCutSlew[1].c =  v;
+    slew_bank_set_slew(&paramSlews, svfCutSlew[1], v);
     break;
 
   case eParamRq0Slew :
-    svfRqSlew[0].c =  v;
+    slew_bank_set_slew(&paramSlews, svfRqSlew[0], v);
     break;
   case eParamRq1Slew :
-    svfRqSlew[1].c =  v;
+    slew_bank_set_slew(&paramSlews, svfRqSlew[1], v);
     break;
 
     // -- cv output
@@ -341,16 +341,16 @@ void module_set_param(u32 idx, ParamValue v) {
     break;
 
   case eParamDry0Slew :
-    drySlew[0].c = v;
+    slew_bank_set_slew(&paramSlews, drySlew[0], v);
     break;
   case eParamWet0Slew :
-    wetSlew[0].c = v;
+    slew_bank_set_slew(&paramSlews, wetSlew[0], v);
     break;
   case eParamDry1Slew :
-    drySlew[1].c = v;
+    slew_bank_set_slew(&paramSlews, drySlew[1], v);
     break;
   case eParamWet1Slew :
-    wetSlew[1].c = v;
+    slew_bank_set_slew(&paramSlews, wetSlew[1], v);
     break;
 
     // fade times
@@ -574,8 +574,14 @@ void fill_param_desc(ParamDesc* desc) {
   strcpy(desc[eParamTimescale].label, "timescale");
   desc[eParamTimescale].type = eParamTypeFix;
   desc[eParamTimescale].min = 0;
+#ifdef BUFFER_16
+  // twice the buffer, so twice the scale
+  desc[eParamTimescale].max = 0x00080000;
+  desc[eParamTimescale].radix = 5;
+#else
   desc[eParamTimescale].max = 0x00040000;
   desc[eParamTimescale].radix = 4;
+#endif
 
 }
 
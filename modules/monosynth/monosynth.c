@@ -40,6 +40,8 @@ typedef struct _monosynthData {
   ParamData mParamData[eParamNumParams];
 } monosynthData;
 
+MODULE_SDRAM(monosynthData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData;
@@ -36,6 +36,8 @@ typedef struct _tapeData {
   volatile fract16 audioBuffer[0x10000];
 } tapeData;
 
+MODULE_SDRAM(tapeData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData;
@@ -57,6 +57,8 @@ typedef struct _linesData {
   volatile fract16 audioBuffer[NLINES][LINES_BUF_FRAMES];
 } linesData;
 
+MODULE_SDRAM(linesData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData; 
@@ -40,6 +40,8 @@ typedef struct _voderData {
   ParamData mParamData[eParamNumParams];
 } voderData;
 
+MODULE_SDRAM(voderData);
+
 //-------------------------
 //----- extern vars (initialized here)
 ModuleData* gModuleData;
@@ -7,8 +7,8 @@
 #include "interpolate.h"
 #include "table.h"
 
+#include "osc_mip.h"
 #include "osc_waves.h"
-#include "osc_polyblep.h"
 #include "slew.h"
 
 //----------------
@@ -67,106 +67,18 @@ static inline void osc_calc_inc( osc* osc) {
   osc->incSlew.x = freq_to_phase( fix16_mul_fract(osc->ratio, osc->hz) ); 
 }
 
-// calculate phase
-static inline void osc_calc_pm(osc* osc) {
-  // non-saturated add, allow overflow, zap sign
-  osc->phaseMod = osc->phase + mult_fr1x32(trunc_fr1x32(osc->pmIn), osc->pmSlew.y);
-}
-
-// lookup 
-static inline fract32 osc_lookup(osc* osc) {
-  // index of wavetables and interpolation weights for shape
-  u32 waveIdxA = osc->shapeMod >> (WAVE_SHAPE_IDX_SHIFT);
-  u32 waveIdxB = waveIdxA + 1; // no bounds check !
-  fract16 waveMulB = (osc->shapeMod & (WAVE_SHAPE_MASK)) << (WAVE_SHAPE_MUL_SHIFT);
-  fract16 waveMulA = sub_fr1x16(0x7fff, waveMulB); 
-
-  fract32 pMod_unsigned = ((u32)osc->phaseMod) >> 1;
-  
-  //  signal index and interpolation weights for both wavetables
-  u32 signalIdxA = pMod_unsigned >> WAVE_IDX_SHIFT; 
-  u32 signalIdxB = (signalIdxA + 1) & WAVE_TAB_SIZE_1; // need the check here
-  fract16 signalMulB = (fract16)((pMod_unsigned & (WAVE_IDX_MASK)) >> (WAVE_IDX_MUL_SHIFT));
-  fract16 signalMulA = sub_fr1x16(0x7fff, signalMulB); 
-  
-
-  return add_fr1x32(
-		    // table A
-		    mult_fr1x32(
-				trunc_fr1x32(
-					     add_fr1x32(
-							// signal A, scaled
-							mult_fr1x32( 
-								    trunc_fr1x32( (*(osc->tab))[waveIdxA][signalIdxA] ),
-								    signalMulA 
-								     ),
-							// signal B, scaled
-							mult_fr1x32( 
-								    trunc_fr1x32( (*(osc->tab))[waveIdxA][signalIdxB] ),
-								    signalMulB
-								     )
-							)
-					     ),
-				waveMulA
-				),
-		    // table B
-		    mult_fr1x32(
-				trunc_fr1x32(
-					     add_fr1x32(
-							// signal A, scaled
-							mult_fr1x32( 
-								    trunc_fr1x32( (*(osc->tab))[waveIdxB][signalIdxA] ),
-								    signalMulA 
-								     ),
-							// signal B, scaled
-							mult_fr1x32( 
-								    trunc_fr1x32( (*(osc->tab))[waveIdxB][signalIdxB] ),
-								    signalMulB
-								     )
-							)
-					     ),
-				waveMulB
-				)
-		    );
-
-  
-  /* return add_fr1x32(  */
-  /* 		    mult_fr1x32x32(table_lookup_idx_mask( (fract32*)(*(osc->tab))[idxA],  */
-  /* 						     WAVE_TAB_SIZE_1,  */
-  /* 						     osc->idxMod */
-  /* 						     ), mulInv ), */
-  /* 		    mult_fr1x32x32(table_lookup_idx_mask( (fract32*)(*(osc->tab))[idxB], */
-  /* 						     WAVE_TAB_SIZE_1, */
-  /* 						     osc->idxMod  */
-  /* 						     ), mul  */
-  /* 				   ) ); */
-}
-
-// alternative method no lookup tables
-static inline fract32 osc_polyblep(osc* osc) {
-  //  signal index and interpolation weights for both waveshapes
-  fract16 mulB = osc->shapeMod;
-  fract16 mulA = sub_fr1x16(FR16_MAX, mulB);
-  fract16 sigA, sigB;
-  sigA = sine_polyblep(osc->phaseMod);
-  sigB = saw_polyblep(osc->phaseMod, osc->incSlew.y);
-  return add_fr1x32(mult_fr1x32(sigA, mulA),
-		    mult_fr1x32(sigB, mulB));
-}
-
-// advance phase
-static inline void osc_advance(osc* osc) {
-  // phase is normalized fract32 in [-1, 1)
-  // use non-saturating add, allow overflow
-  osc->phase = osc->phase + osc->incSlew.y;
+// calculate phase offset
+static inline fract32 osc_calc_pm(osc* osc) {
+  return mult_fr1x32(trunc_fr1x32(osc->pmIn), osc->pmSlew.y);
 }
 
 //----------------
 //--- extern funcs
 
-// initialize given table data and samplerate
-void osc_init(osc* osc, wavtab_t tab, u32 sr) {
-  osc->tab = tab;
+// initialize as oscillator idx of a wavetable bank
+void osc_init(osc* osc, oscMipBank* bank, u8 idx) {
+  osc->bank = bank;
+  osc->idx = idx;
 
   //  ips = fix16_from_float( (f32)WAVE_TAB_SIZE / (f32)sr );
 
@@ -181,7 +93,7 @@ void osc_init(osc* osc, wavtab_t tab, u32 sr) {
   slew_init(osc->pmSlew, 0, 0, 0 );
   slew_init(osc->wmSlew, 0, 0, 0 );
 
-  osc->phase = 0;
+  bank->phase[idx] = 0;
   osc->ratio = FIX16_ONE;
   osc->hz = FIX16_ONE;
 
@@ -230,8 +142,8 @@ void osc_wm_in(osc* osc, fract32 val) {
 /*   osc->bandLim = bl; */
 /* } */
 
-// get next frame value
-fract32 osc_next(osc* osc) {
+// update smoothers and modulation for the next frame
+void osc_calc(osc* osc) {
 
   /// update param smoothers
   slew16_calc ( osc->pmSlew );
@@ -240,24 +152,40 @@ fract32 osc_next(osc* osc) {
   osc->shapeSlew.y = osc->shapeSlew.x;
   slew32_calc ( osc->incSlew);
 
-  /* osc->inc = osc->incSlew.y; */
-  /* osc->shape = osc->shapeSlew.y; */
-
   /// FIXME:
   // shape mod doesn't sound awesome right now anyways
   // add mix points, then think about it
 
-  // calculate waveshape modulation + bandlimiting
+  // calculate waveshape modulation
   osc_calc_wm(osc);
-  //  osc->shapeMod = osc->shape << 16;
 
-  // calculate phase modulation
-  osc_calc_pm(osc);
+  osc->bank->inc[osc->idx] = osc->incSlew.y;
+  osc->bank->pm[osc->idx] = osc_calc_pm(osc);
+  osc->bank->shape[osc->idx] = osc->shapeMod;
+}
 
-  // advance phase
-  osc_advance(osc);
-  
-  // lookup 
-  return osc_lookup(osc);
+// compute a block of values, given per-frame modulation inputs
+void osc_process_block(osc* osc, fract32* dst,
+		       const fract32* pm, const fract32* wm, u16 frames) {
+  oscMipBank* b = osc->bank;
+  fract32 phase = b->phase[osc->idx];
+  u16 i;
+  // shape isn't smoothed (see osc_calc())
+  osc->shapeSlew.y = osc->shapeSlew.x;
+  for(i=0; i<frames; ++i) {
+    slew16_calc ( osc->pmSlew );
+    slew16_calc ( osc->wmSlew );
+    slew32_calc ( osc->incSlew);
+    osc->pmIn = pm[i];
+    osc->wmIn = wm[i];
+    osc_calc_wm(osc);
+    dst[i] = osc_mip_read_shape(b->tab, b->numShapes, osc->shapeMod,
+				osc_mip_level(osc->incSlew.y),
+				(fract32)((u32)phase + (u32)osc_calc_pm(osc)));
+    // phase wraps; unsigned add, as signed overflow is undefined
+    phase = (fract32)((u32)phase + (u32)osc->incSlew.y);
+  }
+  b->phase[osc->idx] = phase;
 }
+
 u8 svf_mode[2] = {0, 0};
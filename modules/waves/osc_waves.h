@@ -3,6 +3,8 @@
    aleph
 
    a simple wavetable oscillator with phase and shape modulation.
+   tables and phase live in an oscMipBank (dsp/osc_mip.h),
+   which picks band-limited tables for the pitch.
  */
 
 #ifndef _ALEPH_DSP_OSC_H_
@@ -10,55 +12,26 @@
 
 //#include "filter_1p.h"
 #include "fix.h"
+#include "osc_mip.h"
 #include "slew.h"
 
 //---- expected parameters for wavetable data
 // how many wavetables
 #define WAVE_SHAPE_NUM 5
-#define WAVE_SHAPE_BITS 3
-
-// size of each table
-#define WAVE_TAB_SIZE 	1024
-#define WAVE_TAB_BITS 	10
-#define WAVE_TAB_SIZE_1 ((WAVE_TAB_SIZE) - 1)
-//#define WAVE_TAB_MAX16 	((WAVE_TAB_SIZE) * FIX16_ONE - 1)
-
-// rshift from shape variable (fract16) to get table index
-#define WAVE_SHAPE_IDX_SHIFT 16 - (WAVE_SHAPE_BITS)
-// mask to get interpolation multiplier
-#define WAVE_SHAPE_MASK (1 << (WAVE_SHAPE_IDX_SHIFT)) - 1
-// lshift after mask to get fract16 multiplier 
-#define WAVE_SHAPE_MUL_SHIFT 2
-// oscillator phase is normalized fract32 in [0, 1)
-// rshift to get table index (e.g., top 10 bits)
-#define WAVE_IDX_SHIFT 21
-// mask to get interpolation multiplier 
-#define WAVE_IDX_MASK (1 << (WAVE_IDX_SHIFT)) - 1
-// rshift multiplier to fract16 
-#define WAVE_IDX_MUL_SHIFT (WAVE_IDX_SHIFT) - 15
 
 // normalized IPS for unipolar 1.31 phase, assuming 48k sampling rate
 #define WAVE_IPS_NORM 0xae3c
 
-
-// wavetable type: pointer to 2d array
-typedef const fract32 (*wavtab_t) [WAVE_SHAPE_NUM][WAVE_TAB_SIZE];
-
 // class structure
 typedef struct _osc {
-  // wavetable data (pointer to table of tables)
-  wavtab_t tab;
+  // the bank holding this oscillator's phase, and its place there
+  oscMipBank* bank;
+  u8 idx;
   // frequency in hz
   fix16 hz;
   // tuning ratio
   fix16 ratio;
 
-  // base phase, normalized fract32 in [-1, 1)
-  fract32 phase;
-  // modulated phase
-  fract32 phaseMod;
-
-  // fixed-point index increment
   // modulated waveshape
   fract16 shapeMod;
 
@@ -80,8 +53,8 @@ typedef struct _osc {
   //  fix16 invPhase;
 } osc;
 
-// initialize given table data and samplerate
-extern void osc_init(osc* osc, wavtab_t tab, u32 sr);
+// initialize as oscillator idx of a wavetable bank
+extern void osc_init(osc* osc, oscMipBank* bank, u8 idx);
 
 // set waveshape (table)
 extern void osc_set_shape(osc* osc, fract16 shape);
@@ -103,7 +76,11 @@ extern void osc_wm_in(osc* osc, fract32 wm);
 // set bandlimiting coefficient
 // extern void osc_set_bl(osc* osc, fract32 bl);
 
-// compute next value
-extern fract32 osc_next( osc* osc);
+// update smoothers and modulation and set up the bank for the next frame.
+// the bank computes the output for all its oscillators at once.
+extern void osc_calc( osc* osc);
+// compute a block of values, given per-frame modulation inputs
+extern void osc_process_block( osc* osc, fract32* dst,
+			       const fract32* pm, const fract32* wm, u16 frames);
 extern u8 svf_mode[2];
 #endif
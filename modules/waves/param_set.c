@@ -12,28 +12,6 @@ static inline fract16 param_fract_to_slew16( ParamValue v) {
   return trunc_fr1x32(v) & 0x7ffe;
 }
 
-// set adc_dac patch point
-static inline void param_set_adc_patch(int i, int o, ParamValue v) {
-  if(v > 0) { 
-    patch_adc_dac[i][o] = &(out[o]);
-  } else {
-    patch_adc_dac[i][o] = &trash;
-  }
-}
-
-static inline void param_set_osc_patch(int i, int o, ParamValue v) {
-  if(v > 0) { 
-    patch_osc_dac[i][o] = &(out[o]);
-  } else {
-    patch_osc_dac[i][o] = &trash;
-  }
-}
-
-  // set delay time in samples
-static inline void param_set_pm_del(int i, ParamValue v) { 
-  voice[i].modDelRdIdx = (voice[i].modDelWrIdx - (v>>6)) & WAVES_PM_DEL_SAMPS_1;
-} 
-
 void module_set_param(u32 idx, ParamValue v) {
   switch(idx) {
 
@@ -50,6 +50,8 @@ typedef struct _wavesData {
   //  fract32 modDelBuf[WAVES_NVOICES][WAVES_PM_DEL_SAMPS];
 } wavesData;
 
+MODULE_SDRAM(wavesData);
+
 
 // single "voice" structure
 typedef struct _waveVoice { 
@@ -111,10 +113,15 @@ static wavesData * data;
 
 /// FIXME: wavetables are statically linked constants for now.
 /// would like to have them in SDRAM and allow arbitrary asynchronous load.
-static const fract32 wavtab[WAVE_SHAPE_NUM][WAVE_TAB_SIZE] = { 
-#include "wavtab_data_inc.c" 
+// band-limited per octave; see wavtab_mip.txt
+static const fract16 wavtab[WAVE_SHAPE_NUM][OSC_MIP_SHAPE_SIZE] = {
+#include "wavtab_mip_inc.c"
 };
 
+// oscillator phases and table lookup, for both voices
+static oscMipBank oscBank;
+static fract32 oscVal[WAVES_NVOICES];
+
 // additional busses
 static fract32 voiceOut[WAVES_NVOICES] = { 0, 0, };
 
@@ -182,9 +189,14 @@ static void calc_frame(void) {
   wavesVoice* v = voice;
   fract32* vout = voiceOut;
 
+  // oscillator class includes hz and mod integrators
+  for(i=0; i<WAVES_NVOICES; i++) {
+    osc_calc( &(voice[i].osc) );
+  }
+  osc_mip_bank_next( &oscBank, oscVal );
+
   for(i=0; i<WAVES_NVOICES; i++) {
-    // oscillator class includes hz and mod integrators
-    v->oscOut = shr_fr1x32( osc_next( &(v->osc) ), 2);
+    v->oscOut = shr_fr1x32( oscVal[i], 2);
 
     // set filter params
     slew32_calc(v->cutSlew);
@@ -274,9 +286,10 @@ void module_init(void) {
   gModuleData->paramData = data->mParamData;
   gModuleData->numParams = eParamNumParams;
 
+  osc_mip_bank_init( &oscBank, wavtab[0], WAVE_SHAPE_NUM, WAVES_NVOICES );
   for(i=0; i<WAVES_NVOICES; i++) {
     fract32 tmp = FRACT32_MAX >> 2;
-    osc_init( &(voice[i].osc), &wavtab, SAMPLERATE );
+    osc_init( &(voice[i].osc), &oscBank, i );
     filter_svf_init( &(voice[i].svf) );
     voice[i].amp = tmp;
 
@@ -454,5 +467,29 @@ static long int ledCount = 0;
   }
 }
 
+//----- patch helpers for param_set.c
+
+// set adc_dac patch point
+static inline void param_set_adc_patch(int i, int o, ParamValue v) {
+  if(v > 0) { 
+    patch_adc_dac[i][o] = &(out[o]);
+  } else {
+    patch_adc_dac[i][o] = &trash;
+  }
+}
+
+static inline void param_set_osc_patch(int i, int o, ParamValue v) {
+  if(v > 0) { 
+    patch_osc_dac[i][o] = &(out[o]);
+  } else {
+    patch_osc_dac[i][o] = &trash;
+  }
+}
+
+  // set delay time in samples
+static inline void param_set_pm_del(int i, ParamValue v) { 
+  voice[i].modDelRdIdx = (voice[i].modDelWrIdx - (v>>6)) & WAVES_PM_DEL_SAMPS_1;
+} 
+
 // lazy inclusion... sorry
 #include "param_set.c"
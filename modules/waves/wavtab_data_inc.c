@@ -1,19 +0,0 @@
-
- // 0: sine : 
- { 
-0x00000000, 0x00C90F87, 0x01921D1F, 0x025B26D7, 0x03242ABF, 0x03ED26E7, 0x04B6195F, 0x057F0037, 0x0647D97F, 0x0710A347, 0x07D95B9F, 0x08A2009F, 0x096A904F, 0x0A3308BF, 0x0AFB67FF, 0x0BC3AC2F, 0x0C8BD35F, 0x0D53DB8F, 0x0E1BC2DF, 0x0EE3875F, 0x0FAB272F, 0x1072A03F, 0x1139F0BF, 0x120116DF, 0x12C8105F, 0x138EDBBF, 0x145576BF, 0x151BDF7F, 0x15E2143F, 0x16A812FF, 0x176DD9DF, 0x183366DF, 0x18F8B83F, 0x19BDCBFF, 0x1A82A01F, 0x1B4732DF, 0x1C0B825F, 0x1CCF8CBF, 0x1D934FDF, 0x1E56CA1F, 0x1F19F97F, 0x1FDCDC1F, 0x209F6FFF, 0x2161B37F, 0x2223A4BF, 0x22E541BF, 0x23A6887F, 0x2467773F, 0x25280C3F, 0x25E845BF, 0x26A8217F, 0x27679DFF, 0x2826B93F, 0x28E5713F, 0x29A3C47F, 0x2A61B0FF, 0x2B1F34FF, 0x2BDC4E7F, 0x2C98FBBF, 0x2D553AFF, 0x2E110A7F, 0x2ECC67FF, 0x2F87527F, 0x3041C77F, 0x30FBC53F, 0x31B54A3F, 0x326E54BF, 0x3326E2BF, 0x33DEF27F, 0x3496823F, 0x354D903F, 0x36041ABF, 0x36BA1FFF, 0x376F9E3F, 0x382493BF, 0x38D8FE7F, 0x398CDD3F, 0x3A402DBF, 0x3AF2EEBF, 0x3BA51E3F, 0x3C56BA7F, 0x3D07C1BF, 0x3DB832BF, 0x3E680B3F, 0x3F1749BF, 0x3FC5EC7F, 0x4073F1FF, 0x4121587F, 0x41CE1E7F, 0x427A41FF, 0x4325C0FF, 0x43D09AFF, 0x447ACD7F, 0x4524567F, 0x45CD357F, 0x467567FF, 0x471CECFF, 0x47C3C1FF, 0x4869E67F, 0x490F57FF, 0x49B414FF, 0x4A581C7F, 0x4AFB6C7F, 0x4B9E037F, 0x4C3FDFFF, 0x4CE0FFFF, 0x4D8162FF, 0x4E2105FF, 0x4EBFE87F, 0x4F5E08FF, 0x4FFB657F, 0x5097FC7F, 0x5133CC7F, 0x51CED47F, 0x5269127F, 0x530284FF, 0x539B2AFF, 0x5433027F, 0x54CA0A7F, 0x556040FF, 0x55F5A4FF, 0x568A347F, 0x571DEEFF, 0x57B0D27F, 0x5842DD7F, 0x58D40E7F, 0x5964647F, 0x59F3DDFF, 0x5A82797F, 0x5B1035FF, 0x5B9D117F, 0x5C290AFF, 0x5CB420FF, 0x5D3E51FF, 0x5DC79D7F, 0x5E50017F, 0x5ED77C7F, 0x5F5E0D7F, 0x5FE3B37F, 0x60686CFF, 0x60EC37FF, 0x616F147F, 0x61F0FFFF, 0x6271FA7F, 0x62F2017F, 0x637114FF, 0x63EF327F, 0x646C597F, 0x64E888FF, 0x6563BF7F, 0x65DDFBFF, 0x66573C7F, 0x66CF80FF, 0x6746C7FF, 0x67BD0F7F, 0x6832577F, 0x68A69E7F, 0x6919E2FF, 0x698C247F, 0x69FD617F, 0x6A6D987F, 0x6ADCC97F, 0x6B4AF27F, 0x6BB812FF, 0x6C24297F, 0x6C8F34FF, 0x6CF934FF, 0x6D6227FF, 0x6DCA0CFF, 0x6E30E37F, 0x6E96A97F, 0x6EFB5EFF, 0x6F5F027F, 0x6FC1937F, 0x7023107F, 0x708378FF, 0x70E2CBFF, 0x714107FF, 0x719E2CFF, 0x71FA397F, 0x72552C7F, 0x72AF057F, 0x7307C3FF, 0x735F65FF, 0x73B5EBFF, 0x740B53FF, 0x745F9DFF, 0x74B2C87F, 0x7504D37F, 0x7555BD7F, 0x75A585FF, 0x75F42BFF, 0x7641AEFF, 0x768E0E7F, 0x76D9497F, 0x77235EFF, 0x776C4EFF, 0x77B417FF, 0x77FAB97F, 0x784032FF, 0x788483FF, 0x78C7AB7F, 0x7909A8FF, 0x794A7BFF, 0x798A237F, 0x79C89F7F, 0x7A05EE7F, 0x7A4210FF, 0x7A7D057F, 0x7AB6CB7F, 0x7AEF62FF, 0x7B26CB7F, 0x7B5D037F, 0x7B920B7F, 0x7BC5E27F, 0x7BF887FF, 0x7C29FBFF, 0x7C5A3D7F, 0x7C894BFF, 0x7CB726FF, 0x7CE3CE7F, 0x7D0F41FF, 0x7D3980FF, 0x7D628AFF, 0x7D8A5EFF, 0x7DB0FDFF, 0x7DD6667F, 0x7DFA987F, 0x7E1D93FF, 0x7E3F57FF, 0x7E5FE47F, 0x7E7F397F, 0x7E9D55FF, 0x7EBA39FF, 0x7ED5E5FF, 0x7EF0587F, 0x7F0991FF, 0x7F21917F, 0x7F3857FF, 0x7F4DE47F, 0x7F62367F, 0x7F754E7F, 0x7F872BFF, 0x7F97CE7F, 0x7FA7367F, 0x7FB5637F, 0x7FC2557F, 0x7FCE0BFF, 0x7FD8877F, 0x7FE1C77F, 0x7FE9CB7F, 0x7FF0947F, 0x7FF6217F, 0x7FFA72FF, 0x7FFD887F, 0x7FFF61FF, 0x7FFFFFFF, 0x7FFF61FF, 0x7FFD887F, 0x7FFA72FF, 0x7FF6217F, 0x7FF0947F, 0x7FE9CB7F, 0x7FE1C77F, 0x7FD8877F, 0x7FCE0BFF, 0x7FC2557F, 0x7FB5637F, 0x7FA7367F, 0x7F97CE7F, 0x7F872BFF, 0x7F754E7F, 0x7F62367F, 0x7F4DE47F, 0x7F3857FF, 0x7F21917F, 0x7F0991FF, 0x7EF0587F, 0x7ED5E5FF, 0x7EBA39FF, 0x7E9D55FF, 0x7E7F397F, 0x7E5FE47F, 0x7E3F57FF, 0x7E1D93FF, 0x7DFA987F, 0x7DD6667F, 0x7DB0FDFF, 0x7D8A5EFF, 0x7D628AFF, 0x7D3980FF, 0x7D0F41FF, 0x7CE3CE7F, 0x7CB726FF, 0x7C894BFF, 0x7C5A3D7F, 0x7C29FBFF, 0x7BF887FF, 0x7BC5E27F, 0x7B920B7F, 0x7B5D037F, 0x7B26CB7F, 0x7AEF62FF, 0x7AB6CB7F, 0x7A7D057F, 0x7A4210FF, 0x7A05EE7F, 0x79C89F7F, 0x798A237F, 0x794A7BFF, 0x7909A8FF, 0x78C7AB7F, 0x788483FF, 0x784032FF, 0x77FAB97F, 0x77B417FF, 0x776C4EFF, 0x77235EFF, 0x76D9497F, 0x768E0E7F, 0x7641AEFF, 0x75F42BFF, 0x75A585FF, 0x7555BD7F, 0x7504D37F, 0x74B2C87F, 0x745F9DFF, 0x740B53FF, 0x73B5EBFF, 0x735F65FF, 0x7307C3FF, 0x72AF057F, 0x72552C7F, 0x71FA397F, 0x719E2CFF, 0x714107FF, 0x70E2CBFF, 0x708378FF, 0x7023107F, 0x6FC1937F, 0x6F5F027F, 0x6EFB5EFF, 0x6E96A97F, 0x6E30E37F, 0x6DCA0CFF, 0x6D6227FF, 0x6CF934FF, 0x6C8F34FF, 0x6C24297F, 0x6BB812FF, 0x6B4AF27F, 0x6ADCC97F, 0x6A6D987F, 0x69FD617F, 0x698C247F, 0x6919E2FF, 0x68A69E7F, 0x6832577F, 0x67BD0F7F, 0x6746C7FF, 0x66CF80FF, 0x66573C7F, 0x65DDFBFF, 0x6563BF7F, 0x64E888FF, 0x646C597F, 0x63EF327F, 0x637114FF, 0x62F2017F, 0x6271FA7F, 0x61F0FFFF, 0x616F147F, 0x60EC37FF, 0x60686CFF, 0x5FE3B37F, 0x5F5E0D7F, 0x5ED77C7F, 0x5E50017F, 0x5DC79D7F, 0x5D3E51FF, 0x5CB420FF, 0x5C290AFF, 0x5B9D117F, 0x5B1035FF, 0x5A82797F, 0x59F3DDFF, 0x5964647F, 0x58D40E7F, 0x5842DD7F, 0x57B0D27F, 0x571DEEFF, 0x568A347F, 0x55F5A4FF, 0x556040FF, 0x54CA0A7F, 0x5433027F, 0x539B2AFF, 0x530284FF, 0x5269127F, 0x51CED47F, 0x5133CC7F, 0x5097FC7F, 0x4FFB657F, 0x4F5E08FF, 0x4EBFE87F, 0x4E2105FF, 0x4D8162FF, 0x4CE0FFFF, 0x4C3FDFFF, 0x4B9E037F, 0x4AFB6C7F, 0x4A581C7F, 0x49B414FF, 0x490F57FF, 0x4869E67F, 0x47C3C1FF, 0x471CECFF, 0x467567FF, 0x45CD357F, 0x4524567F, 0x447ACD7F, 0x43D09AFF, 0x4325C0FF, 0x427A41FF, 0x41CE1E7F, 0x4121587F, 0x4073F1FF, 0x3FC5EC7F, 0x3F1749BF, 0x3E680B3F, 0x3DB832BF, 0x3D07C1BF, 0x3C56BA7F, 0x3BA51E3F, 0x3AF2EEBF, 0x3A402DBF, 0x398CDD3F, 0x38D8FE7F, 0x382493BF, 0x376F9E3F, 0x36BA1FFF, 0x36041ABF, 0x354D903F, 0x3496823F, 0x33DEF27F, 0x3326E2BF, 0x326E54BF, 0x31B54A3F, 0x30FBC53F, 0x3041C77F, 0x2F87527F, 0x2ECC67FF, 0x2E110A7F, 0x2D553AFF, 0x2C98FBBF, 0x2BDC4E7F, 0x2B1F34FF, 0x2A61B0FF, 0x29A3C47F, 0x28E5713F, 0x2826B93F, 0x27679DFF, 0x26A8217F, 0x25E845BF, 0x25280C3F, 0x2467773F, 0x23A6887F, 0x22E541BF, 0x2223A4BF, 0x2161B37F, 0x209F6FFF, 0x1FDCDC1F, 0x1F19F97F, 0x1E56CA1F, 0x1D934FDF, 0x1CCF8CBF, 0x1C0B825F, 0x1B4732DF, 0x1A82A01F, 0x19BDCBFF, 0x18F8B83F, 0x183366DF, 0x176DD9DF, 0x16A812FF, 0x15E2143F, 0x151BDF7F, 0x145576BF, 0x138EDBBF, 0x12C8105F, 0x120116DF, 0x1139F0BF, 0x1072A03F, 0x0FAB272F, 0x0EE3875F, 0x0E1BC2DF, 0x0D53DB8F, 0x0C8BD35F, 0x0BC3AC2F, 0x0AFB67FF, 0x0A3308BF, 0x096A904F, 0x08A2009F, 0x07D95B9F, 0x0710A347, 0x0647D97F, 0x057F0037, 0x04B6195F, 0x03ED26E7, 0x03242ABF, 0x025B26D7, 0x01921D1F, 0x00C90F87, 0xFFFFFFFF, 0xFF36F078, 0xFE6DE2E0, 0xFDA4D928, 0xFCDBD540, 0xFC12D918, 0xFB49E6A0, 0xFA80FFC8, 0xF9B82680, 0xF8EF5CB8, 0xF826A460, 0xF75DFF60, 0xF6956FB0, 0xF5CCF740, 0xF5049800, 0xF43C53D0, 0xF3742CA0, 0xF2AC2470, 0xF1E43D20, 0xF11C78A0, 0xF054D8D0, 0xEF8D5FC0, 0xEEC60F40, 0xEDFEE920, 0xED37EFA0, 0xEC712440, 0xEBAA8940, 0xEAE42080, 0xEA1DEBC0, 0xE957ED00, 0xE8922620, 0xE7CC9920, 0xE70747C0, 0xE6423400, 0xE57D5FE0, 0xE4B8CD20, 0xE3F47DA0, 0xE3307340, 0xE26CB020, 0xE1A935E0, 0xE0E60680, 0xE02323E0, 0xDF609000, 0xDE9E4C80, 0xDDDC5B40, 0xDD1ABE40, 0xDC597780, 0xDB9888C0, 0xDAD7F3C0, 0xDA17BA40, 0xD957DE80, 0xD8986200, 0xD7D946C0, 0xD71A8EC0, 0xD65C3B80, 0xD59E4F00, 0xD4E0CB00, 0xD423B180, 0xD3670440, 0xD2AAC500, 0xD1EEF580, 0xD1339800, 0xD078AD80, 0xCFBE3880, 0xCF043AC0, 0xCE4AB5C0, 0xCD91AB40, 0xCCD91D40, 0xCC210D80, 0xCB697DC0, 0xCAB26FC0, 0xC9FBE540, 0xC945E000, 0xC89061C0, 0xC7DB6C40, 0xC7270180, 0xC67322C0, 0xC5BFD240, 0xC50D1140, 0xC45AE1C0, 0xC3A94580, 0xC2F83E40, 0xC247CD40, 0xC197F4C0, 0xC0E8B640, 0xC03A1380, 0xBF8C0E00, 0xBEDEA780, 0xBE31E180, 0xBD85BE00, 0xBCDA3F00, 0xBC2F6500, 0xBB853280, 0xBADBA980, 0xBA32CA80, 0xB98A9800, 0xB8E31300, 0xB83C3E00, 0xB7961980, 0xB6F0A800, 0xB64BEB00, 0xB5A7E380, 0xB5049380, 0xB461FC80, 0xB3C02000, 0xB31F0000, 0xB27E9D00, 0xB1DEFA00, 0xB1401780, 0xB0A1F700, 0xB0049A80, 0xAF680380, 0xAECC3380, 0xAE312B80, 0xAD96ED80, 0xACFD7B00, 0xAC64D500, 0xABCCFD80, 0xAB35F580, 0xAA9FBF00, 0xAA0A5B00, 0xA975CB80, 0xA8E21100, 0xA84F2D80, 0xA7BD2280, 0xA72BF180, 0xA69B9B80, 0xA60C2200, 0xA57D8680, 0xA4EFCA00, 0xA462EE80, 0xA3D6F500, 0xA34BDF00, 0xA2C1AE00, 0xA2386280, 0xA1AFFE80, 0xA1288380, 0xA0A1F280, 0xA01C4C80, 0x9F979300, 0x9F13C800, 0x9E90EB80, 0x9E0F0000, 0x9D8E0580, 0x9D0DFE80, 0x9C8EEB00, 0x9C10CD80, 0x9B93A680, 0x9B177700, 0x9A9C4080, 0x9A220400, 0x99A8C380, 0x99307F00, 0x98B93800, 0x9842F080, 0x97CDA880, 0x97596180, 0x96E61D00, 0x9673DB80, 0x96029E80, 0x95926780, 0x95233680, 0x94B50D80, 0x9447ED00, 0x93DBD680, 0x9370CB00, 0x9306CB00, 0x929DD800, 0x9235F300, 0x91CF1C80, 0x91695680, 0x9104A100, 0x90A0FD80, 0x903E6C80, 0x8FDCEF80, 0x8F7C8700, 0x8F1D3400, 0x8EBEF800, 0x8E61D300, 0x8E05C680, 0x8DAAD380, 0x8D50FA80, 0x8CF83C00, 0x8CA09A00, 0x8C4A1400, 0x8BF4AC00, 0x8BA06200, 0x8B4D3780, 0x8AFB2C80, 0x8AAA4280, 0x8A5A7A00, 0x8A0BD400, 0x89BE5100, 0x8971F180, 0x8926B680, 0x88DCA100, 0x8893B100, 0x884BE800, 0x88054680, 0x87BFCD00, 0x877B7C00, 0x87385480, 0x86F65700, 0x86B58400, 0x8675DC80, 0x86376080, 0x85FA1180, 0x85BDEF00, 0x8582FA80, 0x85493480, 0x85109D00, 0x84D93480, 0x84A2FC80, 0x846DF480, 0x843A1D80, 0x84077800, 0x83D60400, 0x83A5C280, 0x8376B400, 0x8348D900, 0x831C3180, 0x82F0BE00, 0x82C67F00, 0x829D7500, 0x8275A100, 0x824F0200, 0x82299980, 0x82056780, 0x81E26C00, 0x81C0A800, 0x81A01B80, 0x8180C680, 0x8162AA00, 0x8145C600, 0x812A1A00, 0x810FA780, 0x80F66E00, 0x80DE6E80, 0x80C7A800, 0x80B21B80, 0x809DC980, 0x808AB180, 0x8078D400, 0x80683180, 0x8058C980, 0x804A9C80, 0x803DAA80, 0x8031F400, 0x80277880, 0x801E3880, 0x80163480, 0x800F6B80, 0x8009DE80, 0x80058D00, 0x80027780, 0x80009E00, 0x80000001, 0x80009E00, 0x80027780, 0x80058D00, 0x8009DE80, 0x800F6B80, 0x80163480, 0x801E3880, 0x80277880, 0x8031F400, 0x803DAA80, 0x804A9C80, 0x8058C980, 0x80683180, 0x8078D400, 0x808AB180, 0x809DC980, 0x80B21B80, 0x80C7A800, 0x80DE6E80, 0x80F66E00, 0x810FA780, 0x812A1A00, 0x8145C600, 0x8162AA00, 0x8180C680, 0x81A01B80, 0x81C0A800, 0x81E26C00, 0x82056780, 0x82299980, 0x824F0200, 0x8275A100, 0x829D7500, 0x82C67F00, 0x82F0BE00, 0x831C3180, 0x8348D900, 0x8376B400, 0x83A5C280, 0x83D60400, 0x84077800, 0x843A1D80, 0x846DF480, 0x84A2FC80, 0x84D93480, 0x85109D00, 0x85493480, 0x8582FA80, 0x85BDEF00, 0x85FA1180, 0x86376080, 0x8675DC80, 0x86B58400, 0x86F65700, 0x87385480, 0x877B7C00, 0x87BFCD00, 0x88054680, 0x884BE800, 0x8893B100, 0x88DCA100, 0x8926B680, 0x8971F180, 0x89BE5100, 0x8A0BD400, 0x8A5A7A00, 0x8AAA4280, 0x8AFB2C80, 0x8B4D3780, 0x8BA06200, 0x8BF4AC00, 0x8C4A1400, 0x8CA09A00, 0x8CF83C00, 0x8D50FA80, 0x8DAAD380, 0x8E05C680, 0x8E61D300, 0x8EBEF800, 0x8F1D3400, 0x8F7C8700, 0x8FDCEF80, 0x903E6C80, 0x90A0FD80, 0x9104A100, 0x91695680, 0x91CF1C80, 0x9235F300, 0x929DD800, 0x9306CB00, 0x9370CB00, 0x93DBD680, 0x9447ED00, 0x94B50D80, 0x95233680, 0x95926780, 0x96029E80, 0x9673DB80, 0x96E61D00, 0x97596180, 0x97CDA880, 0x9842F080, 0x98B93800, 0x99307F00, 0x99A8C380, 0x9A220400, 0x9A9C4080, 0x9B177700, 0x9B93A680, 0x9C10CD80, 0x9C8EEB00, 0x9D0DFE80, 0x9D8E0580, 0x9E0F0000, 0x9E90EB80, 0x9F13C800, 0x9F979300, 0xA01C4C80, 0xA0A1F280, 0xA1288380, 0xA1AFFE80, 0xA2386280, 0xA2C1AE00, 0xA34BDF00, 0xA3D6F500, 0xA462EE80, 0xA4EFCA00, 0xA57D8680, 0xA60C2200, 0xA69B9B80, 0xA72BF180, 0xA7BD2280, 0xA84F2D80, 0xA8E21100, 0xA975CB80, 0xAA0A5B00, 0xAA9FBF00, 0xAB35F580, 0xABCCFD80, 0xAC64D500, 0xACFD7B00, 0xAD96ED80, 0xAE312B80, 0xAECC3380, 0xAF680380, 0xB0049A80, 0xB0A1F700, 0xB1401780, 0xB1DEFA00, 0xB27E9D00, 0xB31F0000, 0xB3C02000, 0xB461FC80, 0xB5049380, 0xB5A7E380, 0xB64BEB00, 0xB6F0A800, 0xB7961980, 0xB83C3E00, 0xB8E31300, 0xB98A9800, 0xBA32CA80, 0xBADBA980, 0xBB853280, 0xBC2F6500, 0xBCDA3F00, 0xBD85BE00, 0xBE31E180, 0xBEDEA780, 0xBF8C0E00, 0xC03A1380, 0xC0E8B640, 0xC197F4C0, 0xC247CD40, 0xC2F83E40, 0xC3A94580, 0xC45AE1C0, 0xC50D1140, 0xC5BFD240, 0xC67322C0, 0xC7270180, 0xC7DB6C40, 0xC89061C0, 0xC945E000, 0xC9FBE540, 0xCAB26FC0, 0xCB697DC0, 0xCC210D80, 0xCCD91D40, 0xCD91AB40, 0xCE4AB5C0, 0xCF043AC0, 0xCFBE3880, 0xD078AD80, 0xD1339800, 0xD1EEF580, 0xD2AAC500, 0xD3670440, 0xD423B180, 0xD4E0CB00, 0xD59E4F00, 0xD65C3B80, 0xD71A8EC0, 0xD7D946C0, 0xD8986200, 0xD957DE80, 0xDA17BA40, 0xDAD7F3C0, 0xDB9888C0, 0xDC597780, 0xDD1ABE40, 0xDDDC5B40, 0xDE9E4C80, 0xDF609000, 0xE02323E0, 0xE0E60680, 0xE1A935E0, 0xE26CB020, 0xE3307340, 0xE3F47DA0, 0xE4B8CD20, 0xE57D5FE0, 0xE6423400, 0xE70747C0, 0xE7CC9920, 0xE8922620, 0xE957ED00, 0xEA1DEBC0, 0xEAE42080, 0xEBAA8940, 0xEC712440, 0xED37EFA0, 0xEDFEE920, 0xEEC60F40, 0xEF8D5FC0, 0xF054D8D0, 0xF11C78A0, 0xF1E43D20, 0xF2AC2470, 0xF3742CA0, 0xF43C53D0, 0xF5049800, 0xF5CCF740, 0xF6956FB0, 0xF75DFF60, 0xF826A460, 0xF8EF5CB8, 0xF9B82680, 0xFA80FFC8, 0xFB49E6A0, 0xFC12D918, 0xFCDBD540, 0xFDA4D928, 0xFE6DE2E0, 0xFF36F078,  } , 
-
- // 1: odd : 
- { 
-0x00000000, 0x02863B57, 0x050C2E0F, 0x07918F7F, 0x0A16172F, 0x0C997CCF, 0x0F1B783F, 0x119BC19F, 0x141A117F, 0x169620BF, 0x190FA89F, 0x1B86633F, 0x1DFA0A3F, 0x206A597F, 0x22D70BFF, 0x253FDDFF, 0x27A48D3F, 0x2A04D6FF, 0x2C6079BF, 0x2EB735BF, 0x3108CAFF, 0x3354FBBF, 0x359B89BF, 0x37DC397F, 0x3A16CEBF, 0x3C4B10FF, 0x3E78C5FF, 0x409FB6FF, 0x42BFADFF, 0x44D8757F, 0x46E9D9FF, 0x48F3A8FF, 0x4AF5B3FF, 0x4CEFC8FF, 0x4EE1BBFF, 0x50CB607F, 0x52AC8C7F, 0x5485167F, 0x5654D6FF, 0x581BA97F, 0x59D9687F, 0x5B8DF2FF, 0x5D39277F, 0x5EDAE87F, 0x607318FF, 0x62019CFF, 0x63865AFF, 0x65013C7F, 0x66722A7F, 0x67D9127F, 0x6935E1FF, 0x6A8887FF, 0x6BD0F77F, 0x6D0F22FF, 0x6E4300FF, 0x6F6C88FF, 0x708BB2FF, 0x71A07A7F, 0x72AADD7F, 0x73AAD97F, 0x74A06FFF, 0x758BA37F, 0x766C78FF, 0x7742F4FF, 0x780F20FF, 0x78D106FF, 0x7988B1FF, 0x7A362FFF, 0x7AD98FFF, 0x7B72E27F, 0x7C0239FF, 0x7C87ACFF, 0x7D034EFF, 0x7D7538FF, 0x7DDD847F, 0x7E3C4AFF, 0x7E91AAFF, 0x7EDDC07F, 0x7F20ABFF, 0x7F5A8DFF, 0x7F8B89FF, 0x7FB3C27F, 0x7FD35C7F, 0x7FEA7F7F, 0x7FF952FF, 0x7FFFFF7F, 0x7FFEAEFF, 0x7FF58E7F, 0x7FE4C87F, 0x7FCC8B7F, 0x7FAD04FF, 0x7F86667F, 0x7F58DEFF, 0x7F249F7F, 0x7EE9DBFF, 0x7EA8C5FF, 0x7E61927F, 0x7E14747F, 0x7DC1A27F, 0x7D69507F, 0x7D0BB77F, 0x7CA90C7F, 0x7C4185FF, 0x7BD55DFF, 0x7B64CAFF, 0x7AF004FF, 0x7A7746FF, 0x79FAC57F, 0x797ABD7F, 0x78F7667F, 0x7870F97F, 0x77E7AEFF, 0x775BC0FF, 0x76CD687F, 0x763CDE7F, 0x75AA59FF, 0x751614FF, 0x748045FF, 0x73E9267F, 0x7350EC7F, 0x72B7CF7F, 0x721E04FF, 0x7183C47F, 0x70E941FF, 0x704EB27F, 0x6FB448FF, 0x6F1A3A7F, 0x6E80B87F, 0x6DE7F3FF, 0x6D501FFF, 0x6CB96A7F, 0x6C2402FF, 0x6B9017FF, 0x6AFDD6FF, 0x6A6D6BFF, 0x69DF017F, 0x6952C17F, 0x68C8D4FF, 0x684164FF, 0x67BC95FF, 0x673A8E7F, 0x66BB727F, 0x663F63FF, 0x65C685FF, 0x6550F7FF, 0x64DED8FF, 0x6470457F, 0x64055A7F, 0x639E33FF, 0x633AE97F, 0x62DB93FF, 0x6280497F, 0x62291FFF, 0x61D629FF, 0x6187797F, 0x613D207F, 0x60F72DFF, 0x60B5AEFF, 0x6078B07F, 0x60403C7F, 0x600C5C7F, 0x5FDD17FF, 0x5FB275FF, 0x5F8C7BFF, 0x5F6B2AFF, 0x5F4E86FF, 0x5F368F7F, 0x5F2343FF, 0x5F14A0FF, 0x5F0AA47F, 0x5F0546FF, 0x5F04837F, 0x5F08507F, 0x5F10A5FF, 0x5F1D787F, 0x5F2EBAFF, 0x5F4461FF, 0x5F5E5D7F, 0x5F7C9E7F, 0x5F9F137F, 0x5FC5A8FF, 0x5FF04BFF, 0x601EE97F, 0x605168FF, 0x6087B67F, 0x60C1B7FF, 0x60FF547F, 0x614072FF, 0x6184F8FF, 0x61CCC8FF, 0x6217C77F, 0x6265D6FF, 0x62B6D7FF, 0x630AACFF, 0x6361367F, 0x63BA51FF, 0x6415DE7F, 0x6473BBFF, 0x64D3C6FF, 0x6535DB7F, 0x6599D87F, 0x65FF97FF, 0x6666F87F, 0x66CFD1FF, 0x673A01FF, 0x67A5637F, 0x6811CFFF, 0x687F21FF, 0x68ED347F, 0x695BDFFF, 0x69CB00FF, 0x6A3A717F, 0x6AAA09FF, 0x6B19A5FF, 0x6B891EFF, 0x6BF8507F, 0x6C67157F, 0x6CD547FF, 0x6D42C37F, 0x6DAF63FF, 0x6E1B057F, 0x6E8584FF, 0x6EEEBE7F, 0x6F568FFF, 0x6FBCD67F, 0x702171FF, 0x708440FF, 0x70E5227F, 0x7143F7FF, 0x71A0A27F, 0x71FB02FF, 0x7252FDFF, 0x72A874FF, 0x72FB4D7F, 0x734B6D7F, 0x7398B9FF, 0x73E31A7F, 0x742A767F, 0x746EB7FF, 0x74AFC8FF, 0x74ED947F, 0x752805FF, 0x755F0BFF, 0x7592937F, 0x75C28D7F, 0x75EEE9FF, 0x76179A7F, 0x763C937F, 0x765DC77F, 0x767B2C7F, 0x7694B8FF, 0x76AA657F, 0x76BC2A7F, 0x76CA027F, 0x76D3E8FF, 0x76D9DA7F, 0x76DBD5FF, 0x76D9DA7F, 0x76D3E8FF, 0x76CA027F, 0x76BC2A7F, 0x76AA657F, 0x7694B8FF, 0x767B2C7F, 0x765DC77F, 0x763C937F, 0x76179A7F, 0x75EEE9FF, 0x75C28D7F, 0x7592937F, 0x755F0BFF, 0x752805FF, 0x74ED947F, 0x74AFC8FF, 0x746EB7FF, 0x742A767F, 0x73E31A7F, 0x7398B9FF, 0x734B6D7F, 0x72FB4D7F, 0x72A874FF, 0x7252FDFF, 0x71FB02FF, 0x71A0A27F, 0x7143F7FF, 0x70E5227F, 0x708440FF, 0x702171FF, 0x6FBCD67F, 0x6F568FFF, 0x6EEEBE7F, 0x6E8584FF, 0x6E1B057F, 0x6DAF63FF, 0x6D42C37F, 0x6CD547FF, 0x6C67157F, 0x6BF8507F, 0x6B891EFF, 0x6B19A5FF, 0x6AAA09FF, 0x6A3A717F, 0x69CB00FF, 0x695BDFFF, 0x68ED347F, 0x687F21FF, 0x6811CFFF, 0x67A5637F, 0x673A01FF, 0x66CFD1FF, 0x6666F87F, 0x65FF97FF, 0x6599D87F, 0x6535DB7F, 0x64D3C6FF, 0x6473BBFF, 0x6415DE7F, 0x63BA51FF, 0x6361367F, 0x630AACFF, 0x62B6D7FF, 0x6265D6FF, 0x6217C77F, 0x61CCC8FF, 0x6184F8FF, 0x614072FF, 0x60FF547F, 0x60C1B7FF, 0x6087B67F, 0x605168FF, 0x601EE97F, 0x5FF04BFF, 0x5FC5A8FF, 0x5F9F137F, 0x5F7C9E7F, 0x5F5E5D7F, 0x5F4461FF, 0x5F2EBAFF, 0x5F1D787F, 0x5F10A5FF, 0x5F08507F, 0x5F04837F, 0x5F0546FF, 0x5F0AA47F, 0x5F14A0FF, 0x5F2343FF, 0x5F368F7F, 0x5F4E86FF, 0x5F6B2AFF, 0x5F8C7BFF, 0x5FB275FF, 0x5FDD17FF, 0x600C5C7F, 0x60403C7F, 0x6078B07F, 0x60B5AEFF, 0x60F72DFF, 0x613D207F, 0x6187797F, 0x61D629FF, 0x62291FFF, 0x6280497F, 0x62DB93FF, 0x633AE97F, 0x639E33FF, 0x64055A7F, 0x6470457F, 0x64DED8FF, 0x6550F7FF, 0x65C685FF, 0x663F63FF, 0x66BB727F, 0x673A8E7F, 0x67BC95FF, 0x684164FF, 0x68C8D4FF, 0x6952C17F, 0x69DF017F, 0x6A6D6BFF, 0x6AFDD6FF, 0x6B9017FF, 0x6C2402FF, 0x6CB96A7F, 0x6D501FFF, 0x6DE7F3FF, 0x6E80B87F, 0x6F1A3A7F, 0x6FB448FF, 0x704EB27F, 0x70E941FF, 0x7183C47F, 0x721E04FF, 0x72B7CF7F, 0x7350EC7F, 0x73E9267F, 0x748045FF, 0x751614FF, 0x75AA59FF, 0x763CDE7F, 0x76CD687F, 0x775BC0FF, 0x77E7AEFF, 0x7870F97F, 0x78F7667F, 0x797ABD7F, 0x79FAC57F, 0x7A7746FF, 0x7AF004FF, 0x7B64CAFF, 0x7BD55DFF, 0x7C4185FF, 0x7CA90C7F, 0x7D0BB77F, 0x7D69507F, 0x7DC1A27F, 0x7E14747F, 0x7E61927F, 0x7EA8C5FF, 0x7EE9DBFF, 0x7F249F7F, 0x7F58DEFF, 0x7F86667F, 0x7FAD04FF, 0x7FCC8B7F, 0x7FE4C87F, 0x7FF58E7F, 0x7FFEAEFF, 0x7FFFFF7F, 0x7FF952FF, 0x7FEA7F7F, 0x7FD35C7F, 0x7FB3C27F, 0x7F8B89FF, 0x7F5A8DFF, 0x7F20ABFF, 0x7EDDC07F, 0x7E91AAFF, 0x7E3C4AFF, 0x7DDD847F, 0x7D7538FF, 0x7D034EFF, 0x7C87ACFF, 0x7C0239FF, 0x7B72E27F, 0x7AD98FFF, 0x7A362FFF, 0x7988B1FF, 0x78D106FF, 0x780F20FF, 0x7742F4FF, 0x766C78FF, 0x758BA37F, 0x74A06FFF, 0x73AAD97F, 0x72AADD7F, 0x71A07A7F, 0x708BB2FF, 0x6F6C88FF, 0x6E4300FF, 0x6D0F22FF, 0x6BD0F77F, 0x6A8887FF, 0x6935E1FF, 0x67D9127F, 0x66722A7F, 0x65013C7F, 0x63865AFF, 0x62019CFF, 0x607318FF, 0x5EDAE87F, 0x5D39277F, 0x5B8DF2FF, 0x59D9687F, 0x581BA97F, 0x5654D6FF, 0x5485167F, 0x52AC8C7F, 0x50CB607F, 0x4EE1BBFF, 0x4CEFC8FF, 0x4AF5B3FF, 0x48F3A8FF, 0x46E9D9FF, 0x44D8757F, 0x42BFADFF, 0x409FB6FF, 0x3E78C5FF, 0x3C4B10FF, 0x3A16CEBF, 0x37DC397F, 0x359B89BF, 0x3354FBBF, 0x3108CAFF, 0x2EB735BF, 0x2C6079BF, 0x2A04D6FF, 0x27A48D3F, 0x253FDDFF, 0x22D70BFF, 0x206A597F, 0x1DFA0A3F, 0x1B86633F, 0x190FA89F, 0x169620BF, 0x141A117F, 0x119BC19F, 0x0F1B783F, 0x0C997CCF, 0x0A16172F, 0x07918F7F, 0x050C2E0F, 0x02863B57, 0xFFFFFFFF, 0xFD79C4A8, 0xFAF3D1F0, 0xF86E7080, 0xF5E9E8D0, 0xF3668330, 0xF0E487C0, 0xEE643E60, 0xEBE5EE80, 0xE969DF40, 0xE6F05760, 0xE4799CC0, 0xE205F5C0, 0xDF95A680, 0xDD28F400, 0xDAC02200, 0xD85B72C0, 0xD5FB2900, 0xD39F8640, 0xD148CA40, 0xCEF73500, 0xCCAB0440, 0xCA647640, 0xC823C680, 0xC5E93140, 0xC3B4EF00, 0xC1873A00, 0xBF604900, 0xBD405200, 0xBB278A80, 0xB9162600, 0xB70C5700, 0xB50A4C00, 0xB3103700, 0xB11E4400, 0xAF349F80, 0xAD537380, 0xAB7AE980, 0xA9AB2900, 0xA7E45680, 0xA6269780, 0xA4720D00, 0xA2C6D880, 0xA1251780, 0x9F8CE700, 0x9DFE6300, 0x9C79A500, 0x9AFEC380, 0x998DD580, 0x9826ED80, 0x96CA1E00, 0x95777800, 0x942F0880, 0x92F0DD00, 0x91BCFF00, 0x90937700, 0x8F744D00, 0x8E5F8580, 0x8D552280, 0x8C552680, 0x8B5F9000, 0x8A745C80, 0x89938700, 0x88BD0B00, 0x87F0DF00, 0x872EF900, 0x86774E00, 0x85C9D000, 0x85267000, 0x848D1D80, 0x83FDC600, 0x83785300, 0x82FCB100, 0x828AC700, 0x82227B80, 0x81C3B500, 0x816E5500, 0x81223F80, 0x80DF5400, 0x80A57200, 0x80747600, 0x804C3D80, 0x802CA380, 0x80158080, 0x8006AD00, 0x80000081, 0x80015100, 0x800A7180, 0x801B3780, 0x80337480, 0x8052FB00, 0x80799980, 0x80A72100, 0x80DB6080, 0x81162400, 0x81573A00, 0x819E6D80, 0x81EB8B80, 0x823E5D80, 0x8296AF80, 0x82F44880, 0x8356F380, 0x83BE7A00, 0x842AA200, 0x849B3500, 0x850FFB00, 0x8588B900, 0x86053A80, 0x86854280, 0x87089980, 0x878F0680, 0x88185100, 0x88A43F00, 0x89329780, 0x89C32180, 0x8A55A600, 0x8AE9EB00, 0x8B7FBA00, 0x8C16D980, 0x8CAF1380, 0x8D483080, 0x8DE1FB00, 0x8E7C3B80, 0x8F16BE00, 0x8FB14D80, 0x904BB700, 0x90E5C580, 0x917F4780, 0x92180C00, 0x92AFE000, 0x93469580, 0x93DBFD00, 0x946FE800, 0x95022900, 0x95929400, 0x9620FE80, 0x96AD3E80, 0x97372B00, 0x97BE9B00, 0x98436A00, 0x98C57180, 0x99448D80, 0x99C09C00, 0x9A397A00, 0x9AAF0800, 0x9B212700, 0x9B8FBA80, 0x9BFAA580, 0x9C61CC00, 0x9CC51680, 0x9D246C00, 0x9D7FB680, 0x9DD6E000, 0x9E29D600, 0x9E788680, 0x9EC2DF80, 0x9F08D200, 0x9F4A5100, 0x9F874F80, 0x9FBFC380, 0x9FF3A380, 0xA022E800, 0xA04D8A00, 0xA0738400, 0xA094D500, 0xA0B17900, 0xA0C97080, 0xA0DCBC00, 0xA0EB5F00, 0xA0F55B80, 0xA0FAB900, 0xA0FB7C80, 0xA0F7AF80, 0xA0EF5A00, 0xA0E28780, 0xA0D14500, 0xA0BB9E00, 0xA0A1A280, 0xA0836180, 0xA060EC80, 0xA03A5700, 0xA00FB400, 0x9FE11680, 0x9FAE9700, 0x9F784980, 0x9F3E4800, 0x9F00AB80, 0x9EBF8D00, 0x9E7B0700, 0x9E333700, 0x9DE83880, 0x9D9A2900, 0x9D492800, 0x9CF55300, 0x9C9EC980, 0x9C45AE00, 0x9BEA2180, 0x9B8C4400, 0x9B2C3900, 0x9ACA2480, 0x9A662780, 0x9A006800, 0x99990780, 0x99302E00, 0x98C5FE00, 0x985A9C80, 0x97EE3000, 0x9780DE00, 0x9712CB80, 0x96A42000, 0x9634FF00, 0x95C58E80, 0x9555F600, 0x94E65A00, 0x9476E100, 0x9407AF80, 0x9398EA80, 0x932AB800, 0x92BD3C80, 0x92509C00, 0x91E4FA80, 0x917A7B00, 0x91114180, 0x90A97000, 0x90432980, 0x8FDE8E00, 0x8F7BBF00, 0x8F1ADD80, 0x8EBC0800, 0x8E5F5D80, 0x8E04FD00, 0x8DAD0200, 0x8D578B00, 0x8D04B280, 0x8CB49280, 0x8C674600, 0x8C1CE580, 0x8BD58980, 0x8B914800, 0x8B503700, 0x8B126B80, 0x8AD7FA00, 0x8AA0F400, 0x8A6D6C80, 0x8A3D7280, 0x8A111600, 0x89E86580, 0x89C36C80, 0x89A23880, 0x8984D380, 0x896B4700, 0x89559A80, 0x8943D580, 0x8935FD80, 0x892C1700, 0x89262580, 0x89242A00, 0x89262580, 0x892C1700, 0x8935FD80, 0x8943D580, 0x89559A80, 0x896B4700, 0x8984D380, 0x89A23880, 0x89C36C80, 0x89E86580, 0x8A111600, 0x8A3D7280, 0x8A6D6C80, 0x8AA0F400, 0x8AD7FA00, 0x8B126B80, 0x8B503700, 0x8B914800, 0x8BD58980, 0x8C1CE580, 0x8C674600, 0x8CB49280, 0x8D04B280, 0x8D578B00, 0x8DAD0200, 0x8E04FD00, 0x8E5F5D80, 0x8EBC0800, 0x8F1ADD80, 0x8F7BBF00, 0x8FDE8E00, 0x90432980, 0x90A97000, 0x91114180, 0x917A7B00, 0x91E4FA80, 0x92509C00, 0x92BD3C80, 0x932AB800, 0x9398EA80, 0x9407AF80, 0x9476E100, 0x94E65A00, 0x9555F600, 0x95C58E80, 0x9634FF00, 0x96A42000, 0x9712CB80, 0x9780DE00, 0x97EE3000, 0x985A9C80, 0x98C5FE00, 0x99302E00, 0x99990780, 0x9A006800, 0x9A662780, 0x9ACA2480, 0x9B2C3900, 0x9B8C4400, 0x9BEA2180, 0x9C45AE00, 0x9C9EC980, 0x9CF55300, 0x9D492800, 0x9D9A2900, 0x9DE83880, 0x9E333700, 0x9E7B0700, 0x9EBF8D00, 0x9F00AB80, 0x9F3E4800, 0x9F784980, 0x9FAE9700, 0x9FE11680, 0xA00FB400, 0xA03A5700, 0xA060EC80, 0xA0836180, 0xA0A1A280, 0xA0BB9E00, 0xA0D14500, 0xA0E28780, 0xA0EF5A00, 0xA0F7AF80, 0xA0FB7C80, 0xA0FAB900, 0xA0F55B80, 0xA0EB5F00, 0xA0DCBC00, 0xA0C97080, 0xA0B17900, 0xA094D500, 0xA0738400, 0xA04D8A00, 0xA022E800, 0x9FF3A380, 0x9FBFC380, 0x9F874F80, 0x9F4A5100, 0x9F08D200, 0x9EC2DF80, 0x9E788680, 0x9E29D600, 0x9DD6E000, 0x9D7FB680, 0x9D246C00, 0x9CC51680, 0x9C61CC00, 0x9BFAA580, 0x9B8FBA80, 0x9B212700, 0x9AAF0800, 0x9A397A00, 0x99C09C00, 0x99448D80, 0x98C57180, 0x98436A00, 0x97BE9B00, 0x97372B00, 0x96AD3E80, 0x9620FE80, 0x95929400, 0x95022900, 0x946FE800, 0x93DBFD00, 0x93469580, 0x92AFE000, 0x92180C00, 0x917F4780, 0x90E5C580, 0x904BB700, 0x8FB14D80, 0x8F16BE00, 0x8E7C3B80, 0x8DE1FB00, 0x8D483080, 0x8CAF1380, 0x8C16D980, 0x8B7FBA00, 0x8AE9EB00, 0x8A55A600, 0x89C32180, 0x89329780, 0x88A43F00, 0x88185100, 0x878F0680, 0x87089980, 0x86854280, 0x86053A80, 0x8588B900, 0x850FFB00, 0x849B3500, 0x842AA200, 0x83BE7A00, 0x8356F380, 0x82F44880, 0x8296AF80, 0x823E5D80, 0x81EB8B80, 0x819E6D80, 0x81573A00, 0x81162400, 0x80DB6080, 0x80A72100, 0x80799980, 0x8052FB00, 0x80337480, 0x801B3780, 0x800A7180, 0x80015100, 0x80000081, 0x8006AD00, 0x80158080, 0x802CA380, 0x804C3D80, 0x80747600, 0x80A57200, 0x80DF5400, 0x81223F80, 0x816E5500, 0x81C3B500, 0x82227B80, 0x828AC700, 0x82FCB100, 0x83785300, 0x83FDC600, 0x848D1D80, 0x85267000, 0x85C9D000, 0x86774E00, 0x872EF900, 0x87F0DF00, 0x88BD0B00, 0x89938700, 0x8A745C80, 0x8B5F9000, 0x8C552680, 0x8D552280, 0x8E5F8580, 0x8F744D00, 0x90937700, 0x91BCFF00, 0x92F0DD00, 0x942F0880, 0x95777800, 0x96CA1E00, 0x9826ED80, 0x998DD580, 0x9AFEC380, 0x9C79A500, 0x9DFE6300, 0x9F8CE700, 0xA1251780, 0xA2C6D880, 0xA4720D00, 0xA6269780, 0xA7E45680, 0xA9AB2900, 0xAB7AE980, 0xAD537380, 0xAF349F80, 0xB11E4400, 0xB3103700, 0xB50A4C00, 0xB70C5700, 0xB9162600, 0xBB278A80, 0xBD405200, 0xBF604900, 0xC1873A00, 0xC3B4EF00, 0xC5E93140, 0xC823C680, 0xCA647640, 0xCCAB0440, 0xCEF73500, 0xD148CA40, 0xD39F8640, 0xD5FB2900, 0xD85B72C0, 0xDAC02200, 0xDD28F400, 0xDF95A680, 0xE205F5C0, 0xE4799CC0, 0xE6F05760, 0xE969DF40, 0xEBE5EE80, 0xEE643E60, 0xF0E487C0, 0xF3668330, 0xF5E9E8D0, 0xF86E7080, 0xFAF3D1F0, 0xFD79C4A8, } , 
-
- // 2: even : 
- { 
-0x00000000, 0x02B0E1CB, 0x056164FF, 0x08112B1F, 0x0ABFD5BF, 0x0D6D070F, 0x1018613F, 0x12C1875F, 0x15681CBF, 0x180BC57F, 0x1AAC267F, 0x1D48E5BF, 0x1FE1A9BF, 0x22761A7F, 0x2505E07F, 0x2790A63F, 0x2A16173F, 0x2C95E07F, 0x2F0FB03F, 0x318335FF, 0x33F023BF, 0x36562CBF, 0x38B5063F, 0x3B0C673F, 0x3D5C087F, 0x3FA3A57F, 0x41E2FA7F, 0x4419C6FF, 0x4647CCFF, 0x486CCF7F, 0x4A88947F, 0x4C9AE5FF, 0x4EA38C7F, 0x50A2567F, 0x529713FF, 0x548196FF, 0x5661B4FF, 0x5837457F, 0x5A02227F, 0x5BC2297F, 0x5D7739FF, 0x5F2136FF, 0x60C004FF, 0x62538BFF, 0x63DBB87F, 0x6558767F, 0x66C9B77F, 0x682F6E7F, 0x6989917F, 0x6AD8197F, 0x6C1B02FF, 0x6D524C7F, 0x6E7DF67F, 0x6F9E047F, 0x70B27F7F, 0x71BB6F7F, 0x72B8E27F, 0x73AAE47F, 0x7491897F, 0x756CE5FF, 0x763D0F7F, 0x77021EFF, 0x77BC31FF, 0x786B647F, 0x790FD87F, 0x79A9B0FF, 0x7A3911FF, 0x7ABE237F, 0x7B390FFF, 0x7BA9FFFF, 0x7C11257F, 0x7C6EAD7F, 0x7CC2C8FF, 0x7D0DABFF, 0x7D4F8BFF, 0x7D889F7F, 0x7DB91E7F, 0x7DE1427F, 0x7E0147FF, 0x7E196A7F, 0x7E29E7FF, 0x7E32FF7F, 0x7E34F17F, 0x7E2FFE7F, 0x7E24697F, 0x7E1274FF, 0x7DFA64FF, 0x7DDC7C7F, 0x7DB902FF, 0x7D903C7F, 0x7D626DFF, 0x7D2FDDFF, 0x7CF8D4FF, 0x7CBD977F, 0x7C7E6BFF, 0x7C3B99FF, 0x7BF567FF, 0x7BAC1AFF, 0x7B5FFA7F, 0x7B114AFF, 0x7AC0507F, 0x7A6D517F, 0x7A18917F, 0x79C2527F, 0x796AD87F, 0x7912637F, 0x78B9347F, 0x785F8A7F, 0x7805A4FF, 0x77ABC17F, 0x77521A7F, 0x76F8EB7F, 0x76A06BFF, 0x7648D87F, 0x75F261FF, 0x759D40FF, 0x7549A7FF, 0x74F7C7FF, 0x74A7CFFF, 0x7459F17F, 0x740E53FF, 0x73C5257F, 0x737E8DFF, 0x733AB37F, 0x72F9B9FF, 0x72BBC4FF, 0x7280F57F, 0x72496A7F, 0x72153F7F, 0x71E48DFF, 0x71B7707F, 0x718DFBFF, 0x716844FF, 0x71465C7F, 0x7128547F, 0x710E36FF, 0x70F812FF, 0x70E5EEFF, 0x70D7D4FF, 0x70CDC97F, 0x70C7CBFF, 0x70C5E1FF, 0x70C8067F, 0x70CE37FF, 0x70D870FF, 0x70E6A97F, 0x70F8D97F, 0x710EF37F, 0x7128EAFF, 0x7146B2FF, 0x716835FF, 0x718D65FF, 0x71B62AFF, 0x71E26F7F, 0x72121BFF, 0x7245167F, 0x727B457F, 0x72B488FF, 0x72F0C5FF, 0x732FD9FF, 0x7371A6FF, 0x73B6087F, 0x73FCDC7F, 0x7445FE7F, 0x7491477F, 0x74DE91FF, 0x752DB67F, 0x757E8AFF, 0x75D0E7FF, 0x7624A2FF, 0x76798FFF, 0x76CF847F, 0x772654FF, 0x777DD3FF, 0x77D5D67F, 0x782E2D7F, 0x7886AC7F, 0x78DF26FF, 0x79376D7F, 0x798F547F, 0x79E6ACFF, 0x7A3D497F, 0x7A92FDFF, 0x7AE79BFF, 0x7B3AF7FF, 0x7B8CE5FF, 0x7BDD397F, 0x7C2BC5FF, 0x7C78637F, 0x7CC2E5FF, 0x7D0B257F, 0x7D50F97F, 0x7D94397F, 0x7DD4BFFF, 0x7E12657F, 0x7E4D067F, 0x7E84807F, 0x7EB8AFFF, 0x7EE9737F, 0x7F16AA7F, 0x7F4035FF, 0x7F65FAFF, 0x7F87DB7F, 0x7FA5BD7F, 0x7FBF867F, 0x7FD51FFF, 0x7FE6737F, 0x7FF36BFF, 0x7FFBF5FF, 0x7FFFFFFF, 0x7FFF7BFF, 0x7FFA58FF, 0x7FF08AFF, 0x7FE208FF, 0x7FCEC57F, 0x7FB6BBFF, 0x7F99E67F, 0x7F783FFF, 0x7F51C5FF, 0x7F26757F, 0x7EF653FF, 0x7EC15E7F, 0x7E879DFF, 0x7E49157F, 0x7E05CCFF, 0x7DBDCDFF, 0x7D71227F, 0x7D1FD6FF, 0x7CC9FA7F, 0x7C6F9A7F, 0x7C10C8FF, 0x7BAD98FF, 0x7B461D7F, 0x7ADA6AFF, 0x7A6A99FF, 0x79F6C0FF, 0x797EF9FF, 0x79035D7F, 0x78840A7F, 0x78011BFF, 0x777AAF7F, 0x76F0E47F, 0x7663DBFF, 0x75D3B47F, 0x754091FF, 0x74AA96FF, 0x7411E57F, 0x7376A27F, 0x72D8F37F, 0x7238FDFF, 0x7196E5FF, 0x70F2D1FF, 0x704CEAFF, 0x6FA5577F, 0x6EFC3CFF, 0x6E51C57F, 0x6DA6167F, 0x6CF9597F, 0x6C4BB5FF, 0x6B9D52FF, 0x6AEE597F, 0x6A3EEEFF, 0x698F3CFF, 0x68DF68FF, 0x682F997F, 0x677FF47F, 0x66D0A0FF, 0x6621C17F, 0x65737CFF, 0x64C5F57F, 0x64194EFF, 0x636DA9FF, 0x62C328FF, 0x6219EB7F, 0x6172127F, 0x60CBB97F, 0x6027007F, 0x5F84017F, 0x5EE2D87F, 0x5E439F7F, 0x5DA66D7F, 0x5D0B5AFF, 0x5C727C7F, 0x5BDBE77F, 0x5B47AE7F, 0x5AB5E27F, 0x5A26947F, 0x5999D27F, 0x590FA87F, 0x5888227F, 0x58034A7F, 0x578128FF, 0x5701C37F, 0x56851F7F, 0x560B407F, 0x5594267F, 0x551FD2FF, 0x54AE437F, 0x543F74FF, 0x53D361FF, 0x536A037F, 0x5303517F, 0x529F40FF, 0x523DC6FF, 0x51DED67F, 0x51825F7F, 0x5128517F, 0x50D09A7F, 0x507B26FF, 0x5027E1FF, 0x4FD6B37F, 0x4F8784FF, 0x4F3A3BFF, 0x4EEEBDFF, 0x4EA4ED7F, 0x4E5CAE7F, 0x4E15E07F, 0x4DD063FF, 0x4D8C197F, 0x4D48DB7F, 0x4D06887F, 0x4CC4FCFF, 0x4C8410FF, 0x4C439FFF, 0x4C0381FF, 0x4BC38FFF, 0x4B83A0FF, 0x4B438B7F, 0x4B0325FF, 0x4AC244FF, 0x4A80BFFF, 0x4A3E69FF, 0x49FB17FF, 0x49B69DFF, 0x4970D0FF, 0x4929837F, 0x48E08A7F, 0x4895B8FF, 0x4848E3FF, 0x47F9DFFF, 0x47A8817F, 0x47549C7F, 0x46FE067F, 0x46A495FF, 0x4648207F, 0x45E87D7F, 0x4585847F, 0x451F0DFF, 0x44B4F2FF, 0x44470D7F, 0x43D5387F, 0x435F507F, 0x42E532FF, 0x4266BDFF, 0x41E3D0FF, 0x415C4DFF, 0x40D015FF, 0x403F0D7F, 0x3FA9193F, 0x3F0E20FF, 0x3E6E0B3F, 0x3DC8C3BF, 0x3D1E363F, 0x3C6E4E3F, 0x3BB8FC7F, 0x3AFE313F, 0x3A3DE07F, 0x3977FDBF, 0x38AC7FFF, 0x37DB607F, 0x370498FF, 0x362827BF, 0x354609BF, 0x345E413F, 0x3370D03F, 0x327DBC7F, 0x31850D3F, 0x3086CBFF, 0x2F83033F, 0x2E79C1BF, 0x2D6B177F, 0x2C5715BF, 0x2B3DD0FF, 0x2A1F5FBF, 0x28FBDA7F, 0x27D35BFF, 0x26A600FF, 0x2573E87F, 0x243D337F, 0x230204BF, 0x21C280FF, 0x207ED03F, 0x1F371B7F, 0x1DEB8D1F, 0x1C9C527F, 0x1B4999FF, 0x19F394BF, 0x189A74BF, 0x173E6E5F, 0x15DFB71F, 0x147E867F, 0x131B15BF, 0x11B59EFF, 0x104E5E1F, 0x0EE5902F, 0x0D7B749F, 0x0C104AFF, 0x0AA4537F, 0x0937D18F, 0x07CB0777, 0x065E39AF, 0x04F1AD57, 0x0385A7FB, 0x021A70CB, 0x00B04E41, 0xFF478839, 0xFDE067A0, 0xFC7B3440, 0xFB1837B8, 0xF9B7BAC0, 0xF85A0780, 0xF6FF6650, 0xF5A820E0, 0xF45480F0, 0xF304CED0, 0xF1B95360, 0xF0725710, 0xEF3021C0, 0xEDF2FAA0, 0xECBB2860, 0xEB88F0A0, 0xEA5C9840, 0xE93663E0, 0xE8169640, 0xE6FD7120, 0xE5EB35C0, 0xE4E023A0, 0xE3DC78A0, 0xE2E071C0, 0xE1EC4A20, 0xE1003BA0, 0xE01C7E40, 0xDF414800, 0xDE6ECDC0, 0xDDA54200, 0xDCE4D580, 0xDC2DB640, 0xDB801180, 0xDADC11C0, 0xDA41DEC0, 0xD9B19E80, 0xD92B7480, 0xD8AF8300, 0xD83DE780, 0xD7D6BF00, 0xD77A2380, 0xD7282C40, 0xD6E0EDC0, 0xD6A47A80, 0xD672E180, 0xD64C3040, 0xD6306F80, 0xD61FA780, 0xD619DCC0, 0xD61F1040, 0xD62F4200, 0xD64A6D40, 0xD6708C40, 0xD6A194C0, 0xD6DD7AC0, 0xD7242F40, 0xD775A080, 0xD7D1B980, 0xD83862C0, 0xD8A98240, 0xD924FAC0, 0xD9AAAC80, 0xDA3A75C0, 0xDAD430C0, 0xDB77B640, 0xDC24DB40, 0xDCDB7340, 0xDD9B4F40, 0xDE643C80, 0xDF360780, 0xE0107940, 0xE0F358A0, 0xE1DE6A40, 0xE2D170C0, 0xE3CC2CE0, 0xE4CE5C00, 0xE5D7BB40, 0xE6E80480, 0xE7FEF020, 0xE91C34E0, 0xEA3F87C0, 0xEB689BA0, 0xEC9722A0, 0xEDCACCA0, 0xEF034880, 0xF04043B0, 0xF1816A70, 0xF2C66800, 0xF40EE630, 0xF55A8E40, 0xF6A90850, 0xF7F9FBE0, 0xF94D0FB0, 0xFAA1E9F0, 0xFBF83050, 0xFD4F8828, 0xFEA79670, 0x00000000, 0x0158698F, 0x02B077D7, 0x0407CFAF, 0x055E160F, 0x06B2F04F, 0x0806041F, 0x0956F7AF, 0x0AA571BF, 0x0BF119CF, 0x0D3997FF, 0x0E7E958F, 0x0FBFBC4F, 0x10FCB77F, 0x1235335F, 0x1368DD5F, 0x1497645F, 0x15C0783F, 0x16E3CB1F, 0x18010FDF, 0x1917FB7F, 0x1A2844BF, 0x1B31A3FF, 0x1C33D31F, 0x1D2E8F3F, 0x1E2195BF, 0x1F0CA75F, 0x1FEF86BF, 0x20C9F87F, 0x219BC37F, 0x2264B0BF, 0x23248CBF, 0x23DB24BF, 0x248849BF, 0x252BCF3F, 0x25C58A3F, 0x2655537F, 0x26DB053F, 0x27567DBF, 0x27C79D3F, 0x282E467F, 0x288A5F7F, 0x28DBD0BF, 0x2922853F, 0x295E6B3F, 0x298F73BF, 0x29B592BF, 0x29D0BDFF, 0x29E0EFBF, 0x29E6233F, 0x29E0587F, 0x29CF907F, 0x29B3CFBF, 0x298D1E7F, 0x295B857F, 0x291F123F, 0x28D7D3BF, 0x2885DC7F, 0x282940FF, 0x27C2187F, 0x27507CFF, 0x26D48B7F, 0x264E617F, 0x25BE213F, 0x2523EE3F, 0x247FEE7F, 0x23D249BF, 0x231B2A7F, 0x225ABDFF, 0x2191323F, 0x20BEB7FF, 0x1FE381BF, 0x1EFFC45F, 0x1E13B5DF, 0x1D1F8E3F, 0x1C23875F, 0x1B1FDC5F, 0x1A14CA3F, 0x19028EDF, 0x17E969BF, 0x16C99C1F, 0x15A367BF, 0x14770F5F, 0x1344D79F, 0x120D055F, 0x10CFDE3F, 0x0F8DA8EF, 0x0E46AC9F, 0x0CFB312F, 0x0BAB7F0F, 0x0A57DF1F, 0x090099AF, 0x07A5F87F, 0x0648453F, 0x04E7C847, 0x0384CBBF, 0x021F985F, 0x00B877C6, 0xFF4FB1BE, 0xFDE58F34, 0xFC7A5804, 0xFB0E52A8, 0xF9A1C650, 0xF834F888, 0xF6C82E70, 0xF55BAC80, 0xF3EFB500, 0xF2848B60, 0xF11A6FD0, 0xEFB1A1E0, 0xEE4A6100, 0xECE4EA40, 0xEB817980, 0xEA2048E0, 0xE8C191A0, 0xE7658B40, 0xE60C6B40, 0xE4B66600, 0xE363AD80, 0xE21472E0, 0xE0C8E480, 0xDF812FC0, 0xDE3D7F00, 0xDCFDFB40, 0xDBC2CC80, 0xDA8C1780, 0xD959FF00, 0xD82CA400, 0xD7042580, 0xD5E0A040, 0xD4C22F00, 0xD3A8EA40, 0xD294E880, 0xD1863E40, 0xD07CFCC0, 0xCF793400, 0xCE7AF2C0, 0xCD824380, 0xCC8F2FC0, 0xCBA1BEC0, 0xCAB9F640, 0xC9D7D840, 0xC8FB6700, 0xC8249F80, 0xC7538000, 0xC6880240, 0xC5C21F80, 0xC501CEC0, 0xC4470380, 0xC391B1C0, 0xC2E1C9C0, 0xC2373C40, 0xC191F4C0, 0xC0F1DF00, 0xC056E6C0, 0xBFC0F280, 0xBF2FEA00, 0xBEA3B200, 0xBE1C2F00, 0xBD994200, 0xBD1ACD00, 0xBCA0AF80, 0xBC2AC780, 0xBBB8F280, 0xBB4B0D00, 0xBAE0F200, 0xBA7A7B80, 0xBA178280, 0xB9B7DF80, 0xB95B6A00, 0xB901F980, 0xB8AB6380, 0xB8577E80, 0xB8062000, 0xB7B71C00, 0xB76A4700, 0xB71F7580, 0xB6D67C80, 0xB68F2F00, 0xB6496200, 0xB604E800, 0xB5C19600, 0xB57F4000, 0xB53DBB00, 0xB4FCDA00, 0xB4BC7480, 0xB47C5F00, 0xB43C7000, 0xB3FC7E00, 0xB3BC6000, 0xB37BEF00, 0xB33B0300, 0xB2F97780, 0xB2B72480, 0xB273E680, 0xB22F9C00, 0xB1EA1F80, 0xB1A35180, 0xB15B1280, 0xB1114200, 0xB0C5C400, 0xB0787B00, 0xB0294C80, 0xAFD81E00, 0xAF84D900, 0xAF2F6580, 0xAED7AE80, 0xAE7DA080, 0xAE212980, 0xADC23900, 0xAD60BF00, 0xACFCAE80, 0xAC95FC80, 0xAC2C9E00, 0xABC08B00, 0xAB51BC80, 0xAAE02D00, 0xAA6BD980, 0xA9F4BF80, 0xA97AE080, 0xA8FE3C80, 0xA87ED700, 0xA7FCB580, 0xA777DD80, 0xA6F05780, 0xA6662D80, 0xA5D96B80, 0xA54A1D80, 0xA4B85180, 0xA4241880, 0xA38D8380, 0xA2F4A500, 0xA2599280, 0xA1BC6080, 0xA11D2780, 0xA07BFE80, 0x9FD8FF80, 0x9F344680, 0x9E8DED80, 0x9DE61480, 0x9D3CD700, 0x9C925600, 0x9BE6B100, 0x9B3A0A80, 0x9A8C8300, 0x99DE3E80, 0x992F5F00, 0x98800B80, 0x97D06680, 0x97209700, 0x9670C300, 0x95C11100, 0x9511A680, 0x9462AD00, 0x93B44A00, 0x9306A680, 0x9259E980, 0x91AE3A80, 0x9103C300, 0x905AA880, 0x8FB31500, 0x8F0D2E00, 0x8E691A00, 0x8DC70200, 0x8D270C80, 0x8C895D80, 0x8BEE1A80, 0x8B556900, 0x8ABF6E00, 0x8A2C4B80, 0x899C2400, 0x890F1B80, 0x88855080, 0x87FEE400, 0x877BF580, 0x86FCA280, 0x86810600, 0x86093F00, 0x85956600, 0x85259500, 0x84B9E280, 0x84526700, 0x83EF3700, 0x83906580, 0x83360580, 0x82E02900, 0x828EDD80, 0x82423200, 0x81FA3300, 0x81B6EA80, 0x81786200, 0x813EA180, 0x8109AC00, 0x80D98A80, 0x80AE3A00, 0x8087C000, 0x80661980, 0x80494400, 0x80313A80, 0x801DF700, 0x800F7500, 0x8005A700, 0x80008400, 0x80000001, 0x80040A00, 0x800C9400, 0x80198C80, 0x802AE000, 0x80407980, 0x805A4280, 0x80782480, 0x809A0500, 0x80BFCA00, 0x80E95580, 0x81168C80, 0x81475000, 0x817B7F80, 0x81B2F980, 0x81ED9A80, 0x822B4000, 0x826BC680, 0x82AF0680, 0x82F4DA80, 0x833D1A00, 0x83879C80, 0x83D43A00, 0x8422C680, 0x84731A00, 0x84C50800, 0x85186400, 0x856D0200, 0x85C2B680, 0x86195300, 0x8670AB80, 0x86C89280, 0x8720D900, 0x87795380, 0x87D1D280, 0x882A2980, 0x88822C00, 0x88D9AB00, 0x89307B80, 0x89867000, 0x89DB5D00, 0x8A2F1800, 0x8A817500, 0x8AD24980, 0x8B216E00, 0x8B6EB880, 0x8BBA0180, 0x8C032380, 0x8C49F780, 0x8C8E5900, 0x8CD02600, 0x8D0F3A00, 0x8D4B7700, 0x8D84BA80, 0x8DBAE980, 0x8DEDE400, 0x8E1D9080, 0x8E49D500, 0x8E729A00, 0x8E97CA00, 0x8EB94D00, 0x8ED71500, 0x8EF10C80, 0x8F072680, 0x8F195680, 0x8F278F00, 0x8F31C800, 0x8F37F980, 0x8F3A1E00, 0x8F383400, 0x8F323680, 0x8F282B00, 0x8F1A1100, 0x8F07ED00, 0x8EF1C900, 0x8ED7AB80, 0x8EB9A380, 0x8E97BB00, 0x8E720400, 0x8E488F80, 0x8E1B7200, 0x8DEAC080, 0x8DB69580, 0x8D7F0A80, 0x8D443B00, 0x8D064600, 0x8CC54C80, 0x8C817200, 0x8C3ADA80, 0x8BF1AC00, 0x8BA60E80, 0x8B583000, 0x8B083800, 0x8AB65800, 0x8A62BF00, 0x8A0D9E00, 0x89B72780, 0x895F9400, 0x89071480, 0x88ADE580, 0x88543E80, 0x87FA5B00, 0x87A07580, 0x8746CB80, 0x86ED9C80, 0x86952780, 0x863DAD80, 0x85E76E80, 0x8592AE80, 0x853FAF80, 0x84EEB500, 0x84A00580, 0x8453E500, 0x840A9800, 0x83C46600, 0x83819400, 0x83426880, 0x83072B00, 0x82D02200, 0x829D9200, 0x826FC380, 0x8246FD00, 0x82238380, 0x82059B00, 0x81ED8B00, 0x81DB9680, 0x81D00180, 0x81CB0E80, 0x81CD0080, 0x81D61800, 0x81E69580, 0x81FEB800, 0x821EBD80, 0x8246E180, 0x82776080, 0x82B07400, 0x82F25400, 0x833D3700, 0x83915280, 0x83EEDA80, 0x84560000, 0x84C6F000, 0x8541DC80, 0x85C6EE00, 0x86564F00, 0x86F02780, 0x87949B80, 0x8843CE00, 0x88FDE100, 0x89C2F080, 0x8A931A00, 0x8B6E7680, 0x8C551B80, 0x8D471D80, 0x8E449080, 0x8F4D8080, 0x9061FB80, 0x91820980, 0x92ADB380, 0x93E4FD00, 0x9527E680, 0x96766E80, 0x97D09180, 0x99364880, 0x9AA78980, 0x9C244780, 0x9DAC7400, 0x9F3FFB00, 0xA0DEC900, 0xA288C600, 0xA43DD680, 0xA5FDDD80, 0xA7C8BA80, 0xA99E4B00, 0xAB7E6900, 0xAD68EC00, 0xAF5DA980, 0xB15C7380, 0xB3651A00, 0xB5776B80, 0xB7933080, 0xB9B83300, 0xBBE63900, 0xBE1D0580, 0xC05C5A80, 0xC2A3F780, 0xC4F398C0, 0xC74AF9C0, 0xC9A9D340, 0xCC0FDC40, 0xCE7CCA00, 0xD0F04FC0, 0xD36A1F80, 0xD5E9E8C0, 0xD86F59C0, 0xDAFA1F80, 0xDD89E580, 0xE01E5640, 0xE2B71A40, 0xE553D980, 0xE7F43A80, 0xEA97E340, 0xED3E78A0, 0xEFE79EC0, 0xF292F8F0, 0xF5402A40, 0xF7EED4E0, 0xFA9E9B00, 0xFD4F1E34, } , 
-
- // 3: even + odd, order 7 : 
- { 
-0x00000000, 0x03541CB3, 0x06A79527, 0x09F9C55F, 0x0D4A09AF, 0x1097BF5F, 0x13E243BF, 0x1728F61F, 0x1A6B365F, 0x1DA865FF, 0x20DFE87F, 0x2411223F, 0x273B7A7F, 0x2A5E5AFF, 0x2D792E3F, 0x308B633F, 0x33946A3F, 0x3693B83F, 0x3988C1FF, 0x3C7303FF, 0x3F51FA7F, 0x4225277F, 0x44EC0F7F, 0x47A63A7F, 0x4A5336FF, 0x4CF294FF, 0x4F83E9FF, 0x5206CF7F, 0x547AE3FF, 0x56DFC9FF, 0x5935297F, 0x5B7AADFF, 0x5DB008FF, 0x5FD4F1FF, 0x61E922FF, 0x63EC5C7F, 0x65DE647F, 0x67BF05FF, 0x698E10FF, 0x6B4B5A7F, 0x6CF6BDFF, 0x6E901C7F, 0x701759FF, 0x718C60FF, 0x72EF247F, 0x743F977F, 0x757DB67F, 0x76A9817F, 0x77C2FD7F, 0x78CA37FF, 0x79BF3EFF, 0x7AA2267F, 0x7B730AFF, 0x7C320BFF, 0x7CDF4CFF, 0x7D7AF77F, 0x7E05397F, 0x7E7E45FF, 0x7EE6537F, 0x7F3D9DFF, 0x7F8467FF, 0x7FBAF0FF, 0x7FE184FF, 0x7FF86FFF, 0x7FFFFFFF, 0x7FF88AFF, 0x7FE269FF, 0x7FBDF47F, 0x7F8B8AFF, 0x7F4B8BFF, 0x7EFE607F, 0x7EA46B7F, 0x7E3E17FF, 0x7DCBD27F, 0x7D4E077F, 0x7CC529FF, 0x7C31A8FF, 0x7B93FC7F, 0x7AEC967F, 0x7A3BF0FF, 0x7982817F, 0x78C0C27F, 0x77F72EFF, 0x77263E7F, 0x764E6FFF, 0x75703C7F, 0x748C1F7F, 0x73A2957F, 0x72B4187F, 0x71C124FF, 0x70CA32FF, 0x6FCFBC7F, 0x6ED23B7F, 0x6DD2257F, 0x6CCFF07F, 0x6BCC117F, 0x6AC6FC7F, 0x69C1207F, 0x68BAEF7F, 0x67B4D4FF, 0x66AF3AFF, 0x65AA8C7F, 0x64A72FFF, 0x63A587FF, 0x62A5F57F, 0x61A8D6FF, 0x60AE87FF, 0x5FB7607F, 0x5EC3B57F, 0x5DD3D8FF, 0x5CE81B7F, 0x5C00C47F, 0x5B1E1DFF, 0x5A406CFF, 0x5967EE7F, 0x5894E47F, 0x57C784FF, 0x5700057F, 0x563E987F, 0x55836CFF, 0x54CEA97F, 0x542076FF, 0x5378F87F, 0x52D8497F, 0x523E857F, 0x51ABC3FF, 0x512017FF, 0x509B8FFF, 0x501E37FF, 0x4FA8147F, 0x4F392BFF, 0x4ED17CFF, 0x4E71047F, 0x4E17BAFF, 0x4DC596FF, 0x4D7A877F, 0x4D367C7F, 0x4CF9617F, 0x4CC31D7F, 0x4C9395FF, 0x4C6AAAFF, 0x4C483CFF, 0x4C2C257F, 0x4C16407F, 0x4C0662FF, 0x4BFC5FFF, 0x4BF80B7F, 0x4BF9317F, 0x4BFFA07F, 0x4C0B247F, 0x4C1B857F, 0x4C3089FF, 0x4C49F87F, 0x4C67947F, 0x4C8920FF, 0x4CAE5E7F, 0x4CD70DFF, 0x4D02EE7F, 0x4D31BD7F, 0x4D63397F, 0x4D971E7F, 0x4DCD287F, 0x4E05157F, 0x4E3E9F7F, 0x4E79837F, 0x4EB57CFF, 0x4EF247FF, 0x4F2F9FFF, 0x4F6D437F, 0x4FAAF07F, 0x4FE8627F, 0x5025597F, 0x506195FF, 0x509CD8FF, 0x50D6E3FF, 0x510F7A7F, 0x514661FF, 0x517B5FFF, 0x51AE3BFF, 0x51DEC0FF, 0x520CB87F, 0x5237F07F, 0x526038FF, 0x5285607F, 0x52A73C7F, 0x52C5A0FF, 0x52E0667F, 0x52F764FF, 0x530A7B7F, 0x5319867F, 0x532466FF, 0x532AFFFF, 0x532D38FF, 0x532AF8FF, 0x53242B7F, 0x5318BCFF, 0x53089EFF, 0x52F3C37F, 0x52DA207F, 0x52BBABFF, 0x5298627F, 0x5270407F, 0x524344FF, 0x521171FF, 0x51DACC7F, 0x519F5C7F, 0x515F29FF, 0x511A417F, 0x50D0B1FF, 0x50828B7F, 0x502FE1FF, 0x4FD8C8FF, 0x4F7D58FF, 0x4F1DAAFF, 0x4EB9D97F, 0x4E52037F, 0x4DE6477F, 0x4D76C6FF, 0x4D03A2FF, 0x4C8D01FF, 0x4C1308FF, 0x4B95DEFF, 0x4B15AD7F, 0x4A929EFF, 0x4A0CDD7F, 0x498495FF, 0x48F9F67F, 0x486D2AFF, 0x47DE64FF, 0x474DD37F, 0x46BBA5FF, 0x46280DFF, 0x45933CFF, 0x44FD637F, 0x4466B4FF, 0x43CF61FF, 0x43379BFF, 0x429F947F, 0x42077EFF, 0x416F8AFF, 0x40D7E8FF, 0x4040C9FF, 0x3FAA5D7F, 0x3F14D23F, 0x3E8056FF, 0x3DED187F, 0x3D5B42BF, 0x3CCB02BF, 0x3C3C817F, 0x3BAFE7FF, 0x3B255DBF, 0x3A9D09BF, 0x3A1710BF, 0x399397BF, 0x3912BDBF, 0x3894A57F, 0x38196CBF, 0x37A130FF, 0x372C0D7F, 0x36BA1B3F, 0x364B727F, 0x35E027FF, 0x3578513F, 0x3513FE3F, 0x34B3407F, 0x3456247F, 0x33FCB7FF, 0x33A702BF, 0x33550EBF, 0x3306E0BF, 0x32BC7CFF, 0x3275E47F, 0x3233183F, 0x31F4147F, 0x31B8D6BF, 0x3181577F, 0x314D8F7F, 0x311D743F, 0x30F0F9BF, 0x30C8123F, 0x30A2AE3F, 0x3080BCBF, 0x306229BF, 0x3046E0BF, 0x302ECB7F, 0x3019D17F, 0x3007DA7F, 0x2FF8C9FF, 0x2FEC83FF, 0x2FE2EAFF, 0x2FDBDF7F, 0x2FD741FF, 0x2FD4F03F, 0x2FD4C83F, 0x2FD6A7BF, 0x2FDA683F, 0x2FDFE67F, 0x2FE6FA7F, 0x2FEF807F, 0x2FF94FFF, 0x300440BF, 0x30102C3F, 0x301CE83F, 0x302A4D7F, 0x3038337F, 0x3046707F, 0x3054DBFF, 0x30634CFF, 0x30719AFF, 0x307F9E7F, 0x308D2E3F, 0x309A23FF, 0x30A6573F, 0x30B1A2FF, 0x30BBDFFF, 0x30C4E9BF, 0x30CC9B7F, 0x30D2D27F, 0x30D76C3F, 0x30DA457F, 0x30DB3FFF, 0x30DA3BFF, 0x30D719FF, 0x30D1BE7F, 0x30CA0C7F, 0x30BFEABF, 0x30B340BF, 0x30A3F63F, 0x3091F57F, 0x307D2A3F, 0x3065823F, 0x304AEAFF, 0x302D563F, 0x300CB4BF, 0x2FE8FB7F, 0x2FC21E3F, 0x2F98163F, 0x2F6ADABF, 0x2F3A66BF, 0x2F06B6FF, 0x2ECFC87F, 0x2E959C3F, 0x2E58333F, 0x2E178FFF, 0x2DD3B87F, 0x2D8CB2BF, 0x2D4287BF, 0x2CF53FFF, 0x2CA4E87F, 0x2C518DFF, 0x2BFB3E7F, 0x2BA20B7F, 0x2B4604FF, 0x2AE7403F, 0x2A85CFFF, 0x2A21CA7F, 0x29BB47FF, 0x2952603F, 0x28E72C7F, 0x2879C87F, 0x280A4EFF, 0x2798DEBF, 0x2725937F, 0x26B08CFF, 0x2639EAFF, 0x25C1CD7F, 0x2548563F, 0x24CDA5BF, 0x2451DF3F, 0x23D5253F, 0x235799FF, 0x22D9627F, 0x225AA0FF, 0x21DB79FF, 0x215C117F, 0x20DC8BBF, 0x205D0C7F, 0x1FDDB79F, 0x1F5EB0DF, 0x1EE01B7F, 0x1E621B1F, 0x1DE4D1FF, 0x1D68625F, 0x1CECEDFF, 0x1C7295BF, 0x1BF97A9F, 0x1B81BC3F, 0x1B0B78BF, 0x1A96CEDF, 0x1A23DB1F, 0x19B2B9BF, 0x194385FF, 0x18D6599F, 0x186B4D7F, 0x1802795F, 0x179BF31F, 0x1737D09F, 0x16D6249F, 0x1677025F, 0x161A7A7F, 0x15C09C9F, 0x1569775F, 0x151516BF, 0x14C385FF, 0x1474CE9F, 0x1428F91F, 0x13E00BDF, 0x139A0B9F, 0x1356FBBF, 0x1316DE5F, 0x12D9B35F, 0x129F799F, 0x12682DFF, 0x1233CCBF, 0x12024EFF, 0x11D3AD1F, 0x11A7DEDF, 0x117ED8FF, 0x11588F9F, 0x1134F57F, 0x1113FBFF, 0x10F5921F, 0x10D9A69F, 0x10C026FF, 0x10A8FEBF, 0x1094181F, 0x10815D9F, 0x1070B6BF, 0x10620ADF, 0x105540DF, 0x104A3D3F, 0x1040E49F, 0x10391AFF, 0x1032C29F, 0x102DBD9F, 0x1029ED9F, 0x102732FF, 0x10256E7F, 0x10247F9F, 0x1024457F, 0x10249F5F, 0x10256C1F, 0x10268A3F, 0x1027D83F, 0x1029349F, 0x102A7D5F, 0x102B919F, 0x102C4F5F, 0x102C963F, 0x102C44BF, 0x102B3A7F, 0x102957BF, 0x10267CBF, 0x10228A9F, 0x101D62DF, 0x1016E7BF, 0x100EFC3F, 0x1005845F, 0x0FFA64EF, 0x0FED832F, 0x0FDEC5EF, 0x0FCE148F, 0x0FBB57DF, 0x0FA679AF, 0x0F8F64DF, 0x0F7605AF, 0x0F5A494F, 0x0F3C1E8F, 0x0F1B752F, 0x0EF83EAF, 0x0ED26DDF, 0x0EA9F68F, 0x0E7ECE7F, 0x0E50EC8F, 0x0E20491F, 0x0DECDE4F, 0x0DB6A73F, 0x0D7DA0FF, 0x0D41CA0F, 0x0D03222F, 0x0CC1AABF, 0x0C7D66BF, 0x0C365ABF, 0x0BEC8C7F, 0x0BA0034F, 0x0B50C7FF, 0x0AFEE50F, 0x0AAA65EF, 0x0A5357BF, 0x09F9C90F, 0x099DC96F, 0x093F6A1F, 0x08DEBD3F, 0x087BD66F, 0x0816CA7F, 0x07AFAF37, 0x07469B97, 0x06DBA78F, 0x066EEC27, 0x06008367, 0x0590880F, 0x051F15CF, 0x04AC4927, 0x04383F2F, 0x03C315C3, 0x034CEB53, 0x02D5DECF, 0x025E0F9B, 0x01E59D95, 0x016CA8E3, 0x00F351F2, 0x0079B963, 0x00000000, 0xFF86469C, 0xFF0CAE0D, 0xFE93571C, 0xFE1A626A, 0xFDA1F064, 0xFD2A2130, 0xFCB314AC, 0xFC3CEA3C, 0xFBC7C0D0, 0xFB53B6D8, 0xFAE0EA30, 0xFA6F77F0, 0xF9FF7C98, 0xF99113D8, 0xF9245870, 0xF8B96468, 0xF85050C8, 0xF7E93580, 0xF7842990, 0xF72142C0, 0xF6C095E0, 0xF6623690, 0xF60636F0, 0xF5ACA840, 0xF5559A10, 0xF5011AF0, 0xF4AF3800, 0xF45FFCB0, 0xF4137380, 0xF3C9A540, 0xF3829940, 0xF33E5540, 0xF2FCDDD0, 0xF2BE35F0, 0xF2825F00, 0xF24958C0, 0xF21321B0, 0xF1DFB6E0, 0xF1AF1370, 0xF1813180, 0xF1560970, 0xF12D9220, 0xF107C150, 0xF0E48AD0, 0xF0C3E170, 0xF0A5B6B0, 0xF089FA50, 0xF0709B20, 0xF0598650, 0xF044A820, 0xF031EB70, 0xF0213A10, 0xF0127CD0, 0xF0059B10, 0xEFFA7BA0, 0xEFF103C0, 0xEFE91840, 0xEFE29D20, 0xEFDD7560, 0xEFD98340, 0xEFD6A840, 0xEFD4C580, 0xEFD3BB40, 0xEFD369C0, 0xEFD3B0A0, 0xEFD46E60, 0xEFD582A0, 0xEFD6CB60, 0xEFD827C0, 0xEFD975C0, 0xEFDA93E0, 0xEFDB60A0, 0xEFDBBA80, 0xEFDB8060, 0xEFDA9180, 0xEFD8CD00, 0xEFD61260, 0xEFD24260, 0xEFCD3D60, 0xEFC6E500, 0xEFBF1B60, 0xEFB5C2C0, 0xEFAABF20, 0xEF9DF520, 0xEF8F4940, 0xEF7EA260, 0xEF6BE7E0, 0xEF570140, 0xEF3FD900, 0xEF265960, 0xEF0A6DE0, 0xEEEC0400, 0xEECB0A80, 0xEEA77060, 0xEE812700, 0xEE582120, 0xEE2C52E0, 0xEDFDB100, 0xEDCC3340, 0xED97D200, 0xED608660, 0xED264CA0, 0xECE921A0, 0xECA90440, 0xEC65F460, 0xEC1FF420, 0xEBD706E0, 0xEB8B3160, 0xEB3C7A00, 0xEAEAE940, 0xEA9688A0, 0xEA3F6360, 0xE9E58580, 0xE988FDA0, 0xE929DB60, 0xE8C82F60, 0xE8640CE0, 0xE7FD86A0, 0xE794B280, 0xE729A660, 0xE6BC7A00, 0xE64D4640, 0xE5DC24E0, 0xE5693120, 0xE4F48740, 0xE47E43C0, 0xE4068560, 0xE38D6A40, 0xE3131200, 0xE2979DA0, 0xE21B2E00, 0xE19DE4E0, 0xE11FE480, 0xE0A14F20, 0xE0224860, 0xDFA2F380, 0xDF237440, 0xDEA3EE80, 0xDE248600, 0xDDA55F00, 0xDD269D80, 0xDCA86600, 0xDC2ADAC0, 0xDBAE20C0, 0xDB325A40, 0xDAB7A9C0, 0xDA3E3280, 0xD9C61500, 0xD94F7300, 0xD8DA6C80, 0xD8672140, 0xD7F5B100, 0xD7863780, 0xD718D380, 0xD6AD9FC0, 0xD644B800, 0xD5DE3580, 0xD57A3000, 0xD518BFC0, 0xD4B9FB00, 0xD45DF480, 0xD404C180, 0xD3AE7200, 0xD35B1780, 0xD30AC000, 0xD2BD7840, 0xD2734D40, 0xD22C4780, 0xD1E87000, 0xD1A7CCC0, 0xD16A63C0, 0xD1303780, 0xD0F94900, 0xD0C59940, 0xD0952540, 0xD067E9C0, 0xD03DE1C0, 0xD0170480, 0xCFF34B40, 0xCFD2A9C0, 0xCFB51500, 0xCF9A7DC0, 0xCF82D5C0, 0xCF6E0A80, 0xCF5C09C0, 0xCF4CBF40, 0xCF401540, 0xCF35F380, 0xCF2E4180, 0xCF28E600, 0xCF25C400, 0xCF24C000, 0xCF25BA80, 0xCF2893C0, 0xCF2D2D80, 0xCF336480, 0xCF3B1640, 0xCF442000, 0xCF4E5D00, 0xCF59A8C0, 0xCF65DC00, 0xCF72D1C0, 0xCF806180, 0xCF8E6500, 0xCF9CB300, 0xCFAB2400, 0xCFB98F80, 0xCFC7CC80, 0xCFD5B280, 0xCFE317C0, 0xCFEFD3C0, 0xCFFBBF40, 0xD006B000, 0xD0107F80, 0xD0190580, 0xD0201980, 0xD02597C0, 0xD0295840, 0xD02B37C0, 0xD02B0FC0, 0xD028BE00, 0xD0242080, 0xD01D1500, 0xD0137C00, 0xD0073600, 0xCFF82580, 0xCFE62E80, 0xCFD13480, 0xCFB91F40, 0xCF9DD640, 0xCF7F4340, 0xCF5D51C0, 0xCF37EDC0, 0xCF0F0640, 0xCEE28BC0, 0xCEB27080, 0xCE7EA880, 0xCE472940, 0xCE0BEB80, 0xCDCCE7C0, 0xCD8A1B80, 0xCD438300, 0xCCF91F40, 0xCCAAF140, 0xCC58FD40, 0xCC034800, 0xCBA9DB80, 0xCB4CBF80, 0xCAEC01C0, 0xCA87AEC0, 0xCA1FD800, 0xC9B48D80, 0xC945E4C0, 0xC8D3F280, 0xC85ECF00, 0xC7E69340, 0xC76B5A80, 0xC6ED4240, 0xC66C6840, 0xC5E8EF40, 0xC562F640, 0xC4DAA240, 0xC4501800, 0xC3C37E80, 0xC334FD40, 0xC2A4BD40, 0xC212E780, 0xC17FA900, 0xC0EB2DC0, 0xC055A280, 0xBFBF3600, 0xBF281700, 0xBE907500, 0xBDF88100, 0xBD606B80, 0xBCC86400, 0xBC309E00, 0xBB994B00, 0xBB029C80, 0xBA6CC300, 0xB9D7F200, 0xB9445A00, 0xB8B22C80, 0xB8219B00, 0xB792D500, 0xB7060980, 0xB67B6A00, 0xB5F32280, 0xB56D6100, 0xB4EA5280, 0xB46A2100, 0xB3ECF700, 0xB372FE00, 0xB2FC5D00, 0xB2893900, 0xB219B880, 0xB1ADFC80, 0xB1462680, 0xB0E25500, 0xB082A700, 0xB0273700, 0xAFD01E00, 0xAF7D7480, 0xAF2F4E00, 0xAEE5BE80, 0xAEA0D600, 0xAE60A380, 0xAE253380, 0xADEE8E00, 0xADBCBB00, 0xAD8FBF80, 0xAD679D80, 0xAD445400, 0xAD25DF80, 0xAD0C3C80, 0xACF76100, 0xACE74300, 0xACDBD480, 0xACD50700, 0xACD2C700, 0xACD50000, 0xACDB9900, 0xACE67980, 0xACF58480, 0xAD089B00, 0xAD1F9980, 0xAD3A5F00, 0xAD58C380, 0xAD7A9F80, 0xAD9FC700, 0xADC80F80, 0xADF34780, 0xAE213F00, 0xAE51C400, 0xAE84A000, 0xAEB99E00, 0xAEF08580, 0xAF291C00, 0xAF632700, 0xAF9E6A00, 0xAFDAA680, 0xB0179D80, 0xB0550F80, 0xB092BC80, 0xB0D06000, 0xB10DB800, 0xB14A8300, 0xB1867C80, 0xB1C16080, 0xB1FAEA80, 0xB232D780, 0xB268E180, 0xB29CC680, 0xB2CE4280, 0xB2FD1180, 0xB328F200, 0xB351A180, 0xB376DF00, 0xB3986B80, 0xB3B60780, 0xB3CF7600, 0xB3E47A80, 0xB3F4DB80, 0xB4005F80, 0xB406CE80, 0xB407F480, 0xB403A000, 0xB3F99D00, 0xB3E9BF80, 0xB3D3DA80, 0xB3B7C300, 0xB3955500, 0xB36C6A00, 0xB33CE280, 0xB3069E80, 0xB2C98380, 0xB2857880, 0xB23A6900, 0xB1E84500, 0xB18EFB80, 0xB12E8300, 0xB0C6D400, 0xB057EB80, 0xAFE1C800, 0xAF647000, 0xAEDFE800, 0xAE543C00, 0xADC17A80, 0xAD27B680, 0xAC870780, 0xABDF8900, 0xAB315680, 0xAA7C9300, 0xA9C16780, 0xA8FFFA80, 0xA8387B00, 0xA76B1B80, 0xA6981180, 0xA5BF9300, 0xA4E1E200, 0xA3FF3B80, 0xA317E480, 0xA22C2700, 0xA13C4A80, 0xA0489F80, 0x9F517800, 0x9E572900, 0x9D5A0A80, 0x9C5A7800, 0x9B58D000, 0x9A557380, 0x9950C500, 0x984B2B00, 0x97451080, 0x963EDF80, 0x95390380, 0x9433EE80, 0x93300F80, 0x922DDA80, 0x912DC480, 0x90304380, 0x8F35CD00, 0x8E3EDB00, 0x8D4BE780, 0x8C5D6A80, 0x8B73E080, 0x8A8FC380, 0x89B19000, 0x88D9C180, 0x8808D100, 0x873F3D80, 0x867D7E80, 0x85C40F00, 0x85136980, 0x846C0380, 0x83CE5700, 0x833AD600, 0x82B1F880, 0x82342D80, 0x81C1E800, 0x815B9480, 0x81019F80, 0x80B47400, 0x80747500, 0x80420B80, 0x801D9600, 0x80077500, 0x80000001, 0x80079000, 0x801E7B00, 0x80450F00, 0x807B9800, 0x80C26200, 0x8119AC80, 0x8181BA00, 0x81FAC680, 0x82850880, 0x8320B300, 0x83CDF400, 0x848CF500, 0x855DD980, 0x8640C100, 0x8735C800, 0x883D0280, 0x89567E80, 0x8A824980, 0x8BC06880, 0x8D10DB80, 0x8E739F00, 0x8FE8A600, 0x916FE380, 0x93094200, 0x94B4A580, 0x9671EF00, 0x9840FA00, 0x9A219B80, 0x9C13A380, 0x9E16DD00, 0xA02B0E00, 0xA24FF700, 0xA4855200, 0xA6CAD680, 0xA9203600, 0xAB851C00, 0xADF93080, 0xB07C1600, 0xB30D6B00, 0xB5ACC900, 0xB859C580, 0xBB13F080, 0xBDDAD880, 0xC0AE0580, 0xC38CFC00, 0xC6773E00, 0xC96C47C0, 0xCC6B95C0, 0xCF749CC0, 0xD286D1C0, 0xD5A1A500, 0xD8C48580, 0xDBEEDDC0, 0xDF201780, 0xE2579A00, 0xE594C9A0, 0xE8D709E0, 0xEC1DBC40, 0xEF6840A0, 0xF2B5F650, 0xF6063AA0, 0xF9586AD8, 0xFCABE34C, } , 
- // 3: even + odd, order 11 : 
- { 
-0x00000000, 0x0506253F, 0x0A0A108F, 0x0F09897F, 0x14025B5F, 0x18F2569F, 0x1DD7515F, 0x22AF2B7F, 0x2777CDFF, 0x2C2F2D3F, 0x30D34BFF, 0x3562393F, 0x39DA167F, 0x3E39157F, 0x427D78FF, 0x46A59A7F, 0x4AAFE6FF, 0x4E9AE2FF, 0x5265277F, 0x560D697F, 0x5992727F, 0x5CF32BFF, 0x602E91FF, 0x6343C2FF, 0x6631F57F, 0x68F87C7F, 0x6B96C6FF, 0x6E0C617F, 0x7058F47F, 0x727C467F, 0x747637FF, 0x7646C77F, 0x77EE0EFF, 0x796C487F, 0x7AC1C2FF, 0x7BEEEA7F, 0x7CF4477F, 0x7DD27A7F, 0x7E8A3BFF, 0x7F1C5E7F, 0x7F89C6FF, 0x7FD3757F, 0x7FFA7BFF, 0x7FFFFFFF, 0x7FE53C7F, 0x7FAB78FF, 0x7F54107F, 0x7EE06B7F, 0x7E51FE7F, 0x7DAA4C7F, 0x7CEAE07F, 0x7C154C7F, 0x7B2B2FFF, 0x7A2E2B7F, 0x791FE57F, 0x7802067F, 0x76D639FF, 0x759E297F, 0x745B7F7F, 0x730FDF7F, 0x71BCEFFF, 0x706448FF, 0x6F07807F, 0x6DA8247F, 0x6C47B5FF, 0x6AE7AFFF, 0x69897EFF, 0x682E7FFF, 0x66D806FF, 0x658754FF, 0x643D9F7F, 0x62FC057F, 0x61C3997F, 0x60955B7F, 0x5F72347F, 0x5E5B007F, 0x5D5081FF, 0x5C536D7F, 0x5B645E7F, 0x5A83DFFF, 0x59B263FF, 0x58F04B7F, 0x583DE2FF, 0x579B607F, 0x5708E97F, 0x56868AFF, 0x5614427F, 0x55B1F8FF, 0x555F84FF, 0x551CAB7F, 0x54E91F7F, 0x54C483FF, 0x54AE6C7F, 0x54A65B7F, 0x54ABC87F, 0x54BE1B7F, 0x54DCB07F, 0x5506D77F, 0x553BD7FF, 0x557AEDFF, 0x55C34E7F, 0x561425FF, 0x566C9D7F, 0x56CBD57F, 0x5730ECFF, 0x579AFD7F, 0x5809227F, 0x587A727F, 0x58EE07FF, 0x5962FB7F, 0x59D86D7F, 0x5A4D79FF, 0x5AC145FF, 0x5B32FD7F, 0x5BA1CCFF, 0x5C0CEF7F, 0x5C73A17F, 0x5CD529FF, 0x5D30DAFF, 0x5D860F7F, 0x5DD428FF, 0x5E1A9C7F, 0x5E58E57F, 0x5E8E8A7F, 0x5EBB1FFF, 0x5EDE487F, 0x5EF7B1FF, 0x5F07187F, 0x5F0C45FF, 0x5F070CFF, 0x5EF754FF, 0x5EDD0DFF, 0x5EB8357F, 0x5E88D6FF, 0x5E4F0B7F, 0x5E0AF57F, 0x5DBCC87F, 0x5D64BFFF, 0x5D0323FF, 0x5C98467F, 0x5C2483FF, 0x5BA8447F, 0x5B23F7FF, 0x5A98167F, 0x5A05207F, 0x596B9CFF, 0x58CC18FF, 0x582727FF, 0x577D617F, 0x56CF647F, 0x561DCD7F, 0x55693FFF, 0x54B25E7F, 0x53F9CDFF, 0x534032FF, 0x5286307F, 0x51CC6AFF, 0x5113817F, 0x505C10FF, 0x4FA6B3FF, 0x4EF3FF7F, 0x4E4481FF, 0x4D98C87F, 0x4CF1577F, 0x4C4EA97F, 0x4BB1377F, 0x4B196E7F, 0x4A87B4FF, 0x49FC697F, 0x4977DEFF, 0x48FA60FF, 0x4884317F, 0x481586FF, 0x47AE90FF, 0x474F70FF, 0x46F8437F, 0x46A9157F, 0x4661ED7F, 0x4622C5FF, 0x45EB907F, 0x45BC347F, 0x45948FFF, 0x4574777F, 0x455BB6FF, 0x454A117F, 0x453F40FF, 0x453AF8FF, 0x453CE3FF, 0x4544A8FF, 0x4551E3FF, 0x45642BFF, 0x457B16FF, 0x4596307F, 0x45B503FF, 0x45D7167F, 0x45FBEAFF, 0x462303FF, 0x464BDFFF, 0x4675FCFF, 0x46A0D87F, 0x46CBF17F, 0x46F6C7FF, 0x4720D9FF, 0x4749A97F, 0x4770BCFF, 0x47959CFF, 0x47B7D37F, 0x47D6F2FF, 0x47F28FFF, 0x480A43FF, 0x481DB07F, 0x482C7A7F, 0x48364FFF, 0x483AE37F, 0x4839F07F, 0x4833397F, 0x4826887F, 0x4813AFFF, 0x47FA887F, 0x47DAF5FF, 0x47B4E27F, 0x4788407F, 0x47550BFF, 0x471B487F, 0x46DB00FF, 0x4694497F, 0x46473E7F, 0x45F401FF, 0x459AC07F, 0x453BAB7F, 0x44D6FC7F, 0x446CF2FF, 0x43FDD4FF, 0x4389EDFF, 0x431191FF, 0x429514FF, 0x4214D0FF, 0x419126FF, 0x410A7A7F, 0x40812FFF, 0x3FF5B07F, 0x3F6864FF, 0x3ED9BBBF, 0x3E4A203F, 0x3DBA017F, 0x3D29CB3F, 0x3C99EABF, 0x3C0ACD3F, 0x3B7CDB3F, 0x3AF07CBF, 0x3A66173F, 0x39DE0BFF, 0x3958BABF, 0x38D67EBF, 0x3857AB3F, 0x37DC937F, 0x376582FF, 0x36F2C03F, 0x36848CBF, 0x361B217F, 0x35B6B33F, 0x35576F3F, 0x34FD7D7F, 0x34A8FC7F, 0x345A05FF, 0x3410AABF, 0x33CCF5FF, 0x338EEA7F, 0x3356853F, 0x3323BAFF, 0x32F679FF, 0x32CEA8FF, 0x32AC293F, 0x328ED37F, 0x32767CFF, 0x3262F2BF, 0x3253FCBF, 0x32495DFF, 0x3242D1FF, 0x324012BF, 0x3240D47F, 0x3244C73F, 0x324B96BF, 0x3254ECFF, 0x32606FFF, 0x326DC47F, 0x327C8E7F, 0x328C6CFF, 0x329D00BF, 0x32ADE9FF, 0x32BEC8BF, 0x32CF3D3F, 0x32DEE8FF, 0x32ED6EFF, 0x32FA747F, 0x33059FFF, 0x330E9BFF, 0x3315137F, 0x3318BA7F, 0x3319437F, 0x331667BF, 0x330FE53F, 0x33057D3F, 0x32F6F87F, 0x32E4247F, 0x32CCD23F, 0x32B0DAFF, 0x32901DFF, 0x326A7F3F, 0x323FEAFF, 0x321050BF, 0x31DBAABF, 0x31A1F4BF, 0x316335FF, 0x311F773F, 0x30D6CABF, 0x308946BF, 0x30370A7F, 0x2FE0383F, 0x2F84F7FF, 0x2F25797F, 0x2EC1F03F, 0x2E5A92BF, 0x2DEF9FFF, 0x2D81573F, 0x2D0FFEFF, 0x2C9BE03F, 0x2C2545FF, 0x2BAC7F3F, 0x2B31DD7F, 0x2AB5B4BF, 0x2A38583F, 0x29BA1F7F, 0x293B607F, 0x28BC72BF, 0x283DACBF, 0x27BF65FF, 0x2741F2FF, 0x26C5A97F, 0x264ADA7F, 0x25D1D5FF, 0x255AEBBF, 0x24E6653F, 0x247489BF, 0x24059DBF, 0x2399E0FF, 0x23318FBF, 0x22CCDFFF, 0x226C053F, 0x220F2C7F, 0x21B67DFF, 0x21621C7F, 0x211224BF, 0x20C6AFFF, 0x207FCD7F, 0x203D8AFF, 0x1FFFEE3F, 0x1FC6F79F, 0x1F92A09F, 0x1F62DE9F, 0x1F379F3F, 0x1F10CD9F, 0x1EEE4B1F, 0x1ECFF6BF, 0x1EB5A9FF, 0x1E9F37BF, 0x1E8C713F, 0x1E7D1F5F, 0x1E71097F, 0x1E67F25F, 0x1E6198BF, 0x1E5DB91F, 0x1E5C0B5F, 0x1E5C463F, 0x1E5E1DDF, 0x1E6144DF, 0x1E656B3F, 0x1E6A415F, 0x1E6F765F, 0x1E74B87F, 0x1E79B75F, 0x1E7E227F, 0x1E81A9FF, 0x1E83FFFF, 0x1E84D7BF, 0x1E83E73F, 0x1E80E6DF, 0x1E7B907F, 0x1E73A33F, 0x1E68DF9F, 0x1E5B0AFF, 0x1E49EE7F, 0x1E35583F, 0x1E1D199F, 0x1E0109BF, 0x1DE1039F, 0x1DBCE89F, 0x1D949E1F, 0x1D680FFF, 0x1D372EDF, 0x1D01F0DF, 0x1CC8521F, 0x1C8A539F, 0x1C47FC7F, 0x1C01585F, 0x1BB67A3F, 0x1B67789F, 0x1B146FBF, 0x1ABD807F, 0x1A62D1DF, 0x1A048E7F, 0x19A2E57F, 0x193E0A7F, 0x18D634BF, 0x186B9FBF, 0x17FE88FF, 0x178F337F, 0x171DE1FF, 0x16AADBFF, 0x163669FF, 0x15C0D65F, 0x154A6C5F, 0x14D378BF, 0x145C48BF, 0x13E5295F, 0x136E675F, 0x12F84FFF, 0x12832E5F, 0x120F4C1F, 0x119CF25F, 0x112C66DF, 0x10BDEDFF, 0x1051C8FF, 0x0FE835EF, 0x0F816FAF, 0x0F1DAD5F, 0x0EBD222F, 0x0E5FFDEF, 0x0E066ABF, 0x0DB08F2F, 0x0D5E8C3F, 0x0D107EEF, 0x0CC67EAF, 0x0C809DAF, 0x0C3EE96F, 0x0C0168EF, 0x0BC81F4F, 0x0B93094F, 0x0B621F1F, 0x0B35531F, 0x0B0C923F, 0x0AE7C52F, 0x0AC6CEFF, 0x0AA98E4F, 0x0A8FDCAF, 0x0A798F8F, 0x0A6677FF, 0x0A5662FF, 0x0A4919FF, 0x0A3E62BF, 0x0A35FFAF, 0x0A2FB0AF, 0x0A2B32FF, 0x0A28416F, 0x0A26950F, 0x0A25E58F, 0x0A25E90F, 0x0A2654FF, 0x0A26DE6F, 0x0A273A4F, 0x0A271DFF, 0x0A263F4F, 0x0A24552F, 0x0A21180F, 0x0A1C418F, 0x0A158E4F, 0x0A0CBC4F, 0x0A018D2F, 0x09F3C52F, 0x09E32BBF, 0x09CF8C0F, 0x09B8B55F, 0x099E7ADF, 0x0980B3EF, 0x095F3C8F, 0x0939F58F, 0x0910C47F, 0x08E393CF, 0x08B2530F, 0x087CF72F, 0x084379DF, 0x0805DAAF, 0x07C41DB7, 0x077E4CA7, 0x07347677, 0x06E6AEE7, 0x06950EDF, 0x063FB417, 0x05E6C0FF, 0x058A5CB7, 0x052AB277, 0x04C7F1C7, 0x04624DFF, 0x03F9FE37, 0x038F3CCB, 0x03224743, 0x02B35DDF, 0x0242C357, 0x01D0BC8F, 0x015D9037, 0x00E9866A, 0x0074E85C, 0x00000000, 0xFF8B17A3, 0xFF167995, 0xFEA26FC8, 0xFE2F4370, 0xFDBD3CA8, 0xFD4CA220, 0xFCDDB8BC, 0xFC70C334, 0xFC0601C8, 0xFB9DB200, 0xFB380E38, 0xFAD54D88, 0xFA75A348, 0xFA193F00, 0xF9C04BE8, 0xF96AF120, 0xF9195118, 0xF8CB8988, 0xF881B358, 0xF83BE248, 0xF7FA2550, 0xF7BC8620, 0xF78308D0, 0xF74DACF0, 0xF71C6C30, 0xF6EF3B80, 0xF6C60A70, 0xF6A0C370, 0xF67F4C10, 0xF6618520, 0xF6474AA0, 0xF63073F0, 0xF61CD440, 0xF60C3AD0, 0xF5FE72D0, 0xF5F343B0, 0xF5EA71B0, 0xF5E3BE70, 0xF5DEE7F0, 0xF5DBAAD0, 0xF5D9C0B0, 0xF5D8E200, 0xF5D8C5B0, 0xF5D92190, 0xF5D9AB00, 0xF5DA16F0, 0xF5DA1A70, 0xF5D96AF0, 0xF5D7BE90, 0xF5D4CD00, 0xF5D04F50, 0xF5CA0050, 0xF5C19D40, 0xF5B6E600, 0xF5A99D00, 0xF5998800, 0xF5867070, 0xF5702350, 0xF55671B0, 0xF5393100, 0xF5183AD0, 0xF4F36DC0, 0xF4CAACE0, 0xF49DE0E0, 0xF46CF6B0, 0xF437E0B0, 0xF3FE9710, 0xF3C11690, 0xF37F6250, 0xF3398150, 0xF2EF8110, 0xF2A173C0, 0xF24F70D0, 0xF1F99540, 0xF1A00210, 0xF142DDD0, 0xF0E252A0, 0xF07E9050, 0xF017CA10, 0xEFAE3700, 0xEF421200, 0xEED39920, 0xEE630DA0, 0xEDF0B3E0, 0xED7CD1A0, 0xED07B000, 0xEC9198A0, 0xEC1AD6A0, 0xEBA3B740, 0xEB2C8740, 0xEAB593A0, 0xEA3F29A0, 0xE9C99600, 0xE9552400, 0xE8E21E00, 0xE870CC80, 0xE8017700, 0xE7946040, 0xE729CB40, 0xE6C1F580, 0xE65D1A80, 0xE5FB7180, 0xE59D2E20, 0xE5427F80, 0xE4EB9040, 0xE4988760, 0xE44985C0, 0xE3FEA7A0, 0xE3B80380, 0xE375AC60, 0xE337ADE0, 0xE2FE0F20, 0xE2C8D120, 0xE297F000, 0xE26B61E0, 0xE2431760, 0xE21EFC60, 0xE1FEF640, 0xE1E2E660, 0xE1CAA7C0, 0xE1B61180, 0xE1A4F500, 0xE1972060, 0xE18C5CC0, 0xE1846F80, 0xE17F1920, 0xE17C18C0, 0xE17B2840, 0xE17C0000, 0xE17E5600, 0xE181DD80, 0xE18648A0, 0xE18B4780, 0xE19089A0, 0xE195BEA0, 0xE19A94C0, 0xE19EBB20, 0xE1A1E220, 0xE1A3B9C0, 0xE1A3F4A0, 0xE1A246E0, 0xE19E6740, 0xE1980DA0, 0xE18EF680, 0xE182E0A0, 0xE1738EC0, 0xE160C840, 0xE14A5600, 0xE1300940, 0xE111B4E0, 0xE0EF3260, 0xE0C860C0, 0xE09D2160, 0xE06D5F60, 0xE0390860, 0xE00011C0, 0xDFC27500, 0xDF803280, 0xDF395000, 0xDEEDDB40, 0xDE9DE380, 0xDE498200, 0xDDF0D380, 0xDD93FAC0, 0xDD332000, 0xDCCE7040, 0xDC661F00, 0xDBFA6240, 0xDB8B7640, 0xDB199AC0, 0xDAA51440, 0xDA2E2A00, 0xD9B52580, 0xD93A5680, 0xD8BE0D00, 0xD8409A00, 0xD7C25340, 0xD7438D40, 0xD6C49F80, 0xD645E080, 0xD5C7A7C0, 0xD54A4B40, 0xD4CE2280, 0xD45380C0, 0xD3DABA00, 0xD3641FC0, 0xD2F00100, 0xD27EA8C0, 0xD2106000, 0xD1A56D40, 0xD13E0FC0, 0xD0DA8680, 0xD07B0800, 0xD01FC7C0, 0xCFC8F580, 0xCF76B940, 0xCF293540, 0xCEE088C0, 0xCE9CCA00, 0xCE5E0B40, 0xCE245540, 0xCDEFAF40, 0xCDC01500, 0xCD9580C0, 0xCD6FE200, 0xCD4F2500, 0xCD332DC0, 0xCD1BDB80, 0xCD090780, 0xCCFA82C0, 0xCCF01AC0, 0xCCE99840, 0xCCE6BC80, 0xCCE74580, 0xCCEAEC80, 0xCCF16400, 0xCCFA6000, 0xCD058B80, 0xCD129100, 0xCD211700, 0xCD30C2C0, 0xCD413740, 0xCD521600, 0xCD62FF40, 0xCD739300, 0xCD837180, 0xCD923B80, 0xCD9F9000, 0xCDAB1300, 0xCDB46940, 0xCDBB38C0, 0xCDBF2B80, 0xCDBFED40, 0xCDBD2E00, 0xCDB6A200, 0xCDAC0340, 0xCD9D0D40, 0xCD898300, 0xCD712C80, 0xCD53D6C0, 0xCD315700, 0xCD098600, 0xCCDC4500, 0xCCA97AC0, 0xCC711580, 0xCC330A00, 0xCBEF5540, 0xCBA5FA00, 0xCB570380, 0xCB028280, 0xCAA890C0, 0xCA494CC0, 0xC9E4DE80, 0xC97B7340, 0xC90D3FC0, 0xC89A7D00, 0xC8236C80, 0xC7A854C0, 0xC7298140, 0xC6A74540, 0xC621F400, 0xC599E8C0, 0xC50F8340, 0xC48324C0, 0xC3F532C0, 0xC3661540, 0xC2D634C0, 0xC245FE80, 0xC1B5DFC0, 0xC1264440, 0xC0979B00, 0xC00A4F80, 0xBF7ED000, 0xBEF58580, 0xBE6ED900, 0xBDEB2F00, 0xBD6AEB00, 0xBCEE6E00, 0xBC761200, 0xBC022B00, 0xBB930D00, 0xBB290380, 0xBAC45480, 0xBA653F80, 0xBA0BFE00, 0xB9B8C180, 0xB96BB680, 0xB924FF00, 0xB8E4B780, 0xB8AAF400, 0xB877BF80, 0xB84B1D80, 0xB8250A00, 0xB8057780, 0xB7EC5000, 0xB7D97780, 0xB7CCC680, 0xB7C60F80, 0xB7C51C80, 0xB7C9B000, 0xB7D38580, 0xB7E24F80, 0xB7F5BC00, 0xB80D7000, 0xB8290D00, 0xB8482C80, 0xB86A6300, 0xB88F4300, 0xB8B65680, 0xB8DF2600, 0xB9093800, 0xB9340E80, 0xB95F2780, 0xB98A0300, 0xB9B42000, 0xB9DCFC00, 0xBA041500, 0xBA28E980, 0xBA4AFC00, 0xBA69CF80, 0xBA84E900, 0xBA9BD400, 0xBAAE1C00, 0xBABB5700, 0xBAC31C00, 0xBAC50700, 0xBAC0BF00, 0xBAB5EE80, 0xBAA44900, 0xBA8B8880, 0xBA6B7000, 0xBA43CB80, 0xBA146F80, 0xB9DD3A00, 0xB99E1280, 0xB956EA80, 0xB907BC80, 0xB8B08F00, 0xB8516F00, 0xB7EA7900, 0xB77BCE80, 0xB7059F00, 0xB6882100, 0xB6039680, 0xB5784B00, 0xB4E69180, 0xB44EC880, 0xB3B15680, 0xB30EA880, 0xB2673780, 0xB1BB7E00, 0xB10C0080, 0xB0594C00, 0xAFA3EF00, 0xAEEC7E80, 0xAE339500, 0xAD79CF80, 0xACBFCD00, 0xAC063200, 0xAB4DA180, 0xAA96C000, 0xA9E23280, 0xA9309B80, 0xA8829E80, 0xA7D8D800, 0xA733E700, 0xA6946300, 0xA5FADF80, 0xA567E980, 0xA4DC0800, 0xA457BB80, 0xA3DB7C00, 0xA367B980, 0xA2FCDC00, 0xA29B4000, 0xA2433780, 0xA1F50A80, 0xA1B0F480, 0xA1772900, 0xA147CA80, 0xA122F200, 0xA108AB00, 0xA0F8F300, 0xA0F3BA00, 0xA0F8E780, 0xA1084E00, 0xA121B780, 0xA144E000, 0xA1717580, 0xA1A71A80, 0xA1E56380, 0xA22BD700, 0xA279F080, 0xA2CF2500, 0xA32AD600, 0xA38C5E80, 0xA3F31080, 0xA45E3300, 0xA4CD0280, 0xA53EBA00, 0xA5B28600, 0xA6279280, 0xA69D0480, 0xA711F800, 0xA7858D80, 0xA7F6DD80, 0xA8650280, 0xA8CF1300, 0xA9342A80, 0xA9936280, 0xA9EBDA00, 0xAA3CB180, 0xAA851200, 0xAAC42800, 0xAAF92880, 0xAB234F80, 0xAB41E480, 0xAB543780, 0xAB59A480, 0xAB519380, 0xAB3B7C00, 0xAB16E080, 0xAAE35480, 0xAAA07B00, 0xAA4E0700, 0xA9EBBD80, 0xA9797500, 0xA8F71680, 0xA8649F80, 0xA7C21D00, 0xA70FB480, 0xA64D9C00, 0xA57C2000, 0xA49BA180, 0xA3AC9280, 0xA2AF7E00, 0xA1A4FF80, 0xA08DCB80, 0x9F6AA480, 0x9E3C6680, 0x9D03FA80, 0x9BC26080, 0x9A78AB00, 0x9927F900, 0x97D18000, 0x96768100, 0x95185000, 0x93B84A00, 0x9257DB80, 0x90F87F80, 0x8F9BB700, 0x8E431000, 0x8CF02080, 0x8BA48080, 0x8A61D680, 0x8929C600, 0x87FDF980, 0x86E01A80, 0x85D1D480, 0x84D4D000, 0x83EAB380, 0x83151F80, 0x8255B380, 0x81AE0180, 0x811F9480, 0x80ABEF80, 0x80548700, 0x801AC380, 0x80000001, 0x80058400, 0x802C8A80, 0x80763900, 0x80E3A180, 0x8175C400, 0x822D8580, 0x830BB880, 0x84111580, 0x853E3D00, 0x8693B780, 0x8811F100, 0x89B93880, 0x8B89C800, 0x8D83B980, 0x8FA70B80, 0x91F39E80, 0x94693900, 0x97078380, 0x99CE0A80, 0x9CBC3D00, 0x9FD16E00, 0xA30CD400, 0xA66D8D80, 0xA9F29680, 0xAD9AD880, 0xB1651D00, 0xB5501900, 0xB95A6580, 0xBD828700, 0xC1C6EA80, 0xC625E980, 0xCA9DC6C0, 0xCF2CB400, 0xD3D0D2C0, 0xD8883200, 0xDD50D480, 0xE228AEA0, 0xE70DA960, 0xEBFDA4A0, 0xF0F67680, 0xF5F5EF70, 0xFAF9DAC0, } , 
@@ -0,0 +1,679 @@
+// generated by utils/tabletool/wavtab_mip from wavtab_mip.txt
+#if OSC_MIP_BITS != 10 || OSC_MIP_LEVELS != 6
+#error "table data doesn't match osc_mip.h"
+#endif
+// shape 0
+{
+  // level 0
+  0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210, 2410, 2611, 2811, 3012,
+  3212, 3412, 3612, 3811, 4011, 4210, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195,
+  6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767, 7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319,
+  9512, 9704, 9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605, 11793, 11980, 12167, 12353,
+  12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828, 14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269,
+  15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+  18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000, 20159, 20317, 20475, 20631,
+  20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856, 22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027,
+  23170, 23311, 23452, 23592, 23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+  25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198, 26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133,
+  27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001, 28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803,
+  28898, 28992, 29085, 29177, 29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+  30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297,
+  31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736, 31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098,
+  32137, 32176, 32213, 32250, 32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+  32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752, 32757, 32761, 32765, 32766,
+  32767, 32766, 32765, 32761, 32757, 32752, 32745, 32737, 32728, 32717, 32705, 32692, 32678, 32663, 32646, 32628,
+  32609, 32589, 32567, 32545, 32521, 32495, 32469, 32441, 32412, 32382, 32351, 32318, 32285, 32250, 32213, 32176,
+  32137, 32098, 32057, 32014, 31971, 31926, 31880, 31833, 31785, 31736, 31685, 31633, 31580, 31526, 31470, 31414,
+  31356, 31297, 31237, 31176, 31113, 31050, 30985, 30919, 30852, 30783, 30714, 30643, 30571, 30498, 30424, 30349,
+  30273, 30195, 30117, 30037, 29956, 29874, 29791, 29706, 29621, 29534, 29447, 29358, 29268, 29177, 29085, 28992,
+  28898, 28803, 28706, 28609, 28510, 28411, 28310, 28208, 28105, 28001, 27896, 27790, 27683, 27575, 27466, 27356,
+  27245, 27133, 27019, 26905, 26790, 26674, 26556, 26438, 26319, 26198, 26077, 25955, 25832, 25708, 25582, 25456,
+  25329, 25201, 25072, 24942, 24811, 24680, 24547, 24413, 24279, 24143, 24007, 23870, 23731, 23592, 23452, 23311,
+  23170, 23027, 22884, 22739, 22594, 22448, 22301, 22154, 22005, 21856, 21705, 21554, 21403, 21250, 21096, 20942,
+  20787, 20631, 20475, 20317, 20159, 20000, 19841, 19680, 19519, 19357, 19195, 19032, 18868, 18703, 18537, 18371,
+  18204, 18037, 17869, 17700, 17530, 17360, 17189, 17018, 16846, 16673, 16499, 16325, 16151, 15976, 15800, 15623,
+  15446, 15269, 15090, 14912, 14732, 14553, 14372, 14191, 14010, 13828, 13645, 13462, 13279, 13094, 12910, 12725,
+  12539, 12353, 12167, 11980, 11793, 11605, 11417, 11228, 11039, 10849, 10659, 10469, 10278, 10087, 9896, 9704,
+  9512, 9319, 9126, 8933, 8739, 8545, 8351, 8157, 7962, 7767, 7571, 7375, 7179, 6983, 6786, 6590,
+  6393, 6195, 5998, 5800, 5602, 5404, 5205, 5007, 4808, 4609, 4410, 4210, 4011, 3811, 3612, 3412,
+  3212, 3012, 2811, 2611, 2410, 2210, 2009, 1809, 1608, 1407, 1206, 1005, 804, 603, 402, 201,
+  0, -201, -402, -603, -804, -1005, -1206, -1407, -1608, -1809, -2009, -2210, -2410, -2611, -2811, -3012,
+  -3212, -3412, -3612, -3811, -4011, -4210, -4410, -4609, -4808, -5007, -5205, -5404, -5602, -5800, -5998, -6195,
+  -6393, -6590, -6786, -6983, -7179, -7375, -7571, -7767, -7962, -8157, -8351, -8545, -8739, -8933, -9126, -9319,
+  -9512, -9704, -9896, -10087, -10278, -10469, -10659, -10849, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12353,
+  -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553, -14732, -14912, -15090, -15269,
+  -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673, -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037,
+  -18204, -18371, -18537, -18703, -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631,
+  -20787, -20942, -21096, -21250, -21403, -21554, -21705, -21856, -22005, -22154, -22301, -22448, -22594, -22739, -22884, -23027,
+  -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143, -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201,
+  -25329, -25456, -25582, -25708, -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905, -27019, -27133,
+  -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001, -28105, -28208, -28310, -28411, -28510, -28609, -28706, -28803,
+  -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534, -29621, -29706, -29791, -29874, -29956, -30037, -30117, -30195,
+  -30273, -30349, -30424, -30498, -30571, -30643, -30714, -30783, -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+  -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833, -31880, -31926, -31971, -32014, -32057, -32098,
+  -32137, -32176, -32213, -32250, -32285, -32318, -32351, -32382, -32412, -32441, -32469, -32495, -32521, -32545, -32567, -32589,
+  -32609, -32628, -32646, -32663, -32678, -32692, -32705, -32717, -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766,
+  -32767, -32766, -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692, -32678, -32663, -32646, -32628,
+  -32609, -32589, -32567, -32545, -32521, -32495, -32469, -32441, -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176,
+  -32137, -32098, -32057, -32014, -31971, -31926, -31880, -31833, -31785, -31736, -31685, -31633, -31580, -31526, -31470, -31414,
+  -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919, -30852, -30783, -30714, -30643, -30571, -30498, -30424, -30349,
+  -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706, -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992,
+  -28898, -28803, -28706, -28609, -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356,
+  -27245, -27133, -27019, -26905, -26790, -26674, -26556, -26438, -26319, -26198, -26077, -25955, -25832, -25708, -25582, -25456,
+  -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413, -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311,
+  -23170, -23027, -22884, -22739, -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250, -21096, -20942,
+  -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680, -19519, -19357, -19195, -19032, -18868, -18703, -18537, -18371,
+  -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018, -16846, -16673, -16499, -16325, -16151, -15976, -15800, -15623,
+  -15446, -15269, -15090, -14912, -14732, -14553, -14372, -14191, -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+  -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849, -10659, -10469, -10278, -10087, -9896, -9704,
+  -9512, -9319, -9126, -8933, -8739, -8545, -8351, -8157, -7962, -7767, -7571, -7375, -7179, -6983, -6786, -6590,
+  -6393, -6195, -5998, -5800, -5602, -5404, -5205, -5007, -4808, -4609, -4410, -4210, -4011, -3811, -3612, -3412,
+  -3212, -3012, -2811, -2611, -2410, -2210, -2009, -1809, -1608, -1407, -1206, -1005, -804, -603, -402, -201,
+  // level 1
+  0, 402, 804, 1206, 1608, 2009, 2410, 2811, 3212, 3612, 4011, 4410, 4808, 5205, 5602, 5998,
+  6393, 6786, 7179, 7571, 7962, 8351, 8739, 9126, 9512, 9896, 10278, 10659, 11039, 11417, 11793, 12167,
+  12539, 12910, 13279, 13645, 14010, 14372, 14732, 15090, 15446, 15800, 16151, 16499, 16846, 17189, 17530, 17869,
+  18204, 18537, 18868, 19195, 19519, 19841, 20159, 20475, 20787, 21096, 21403, 21705, 22005, 22301, 22594, 22884,
+  23170, 23452, 23731, 24007, 24279, 24547, 24811, 25072, 25329, 25582, 25832, 26077, 26319, 26556, 26790, 27019,
+  27245, 27466, 27683, 27896, 28105, 28310, 28510, 28706, 28898, 29085, 29268, 29447, 29621, 29791, 29956, 30117,
+  30273, 30424, 30571, 30714, 30852, 30985, 31113, 31237, 31356, 31470, 31580, 31685, 31785, 31880, 31971, 32057,
+  32137, 32213, 32285, 32351, 32412, 32469, 32521, 32567, 32609, 32646, 32678, 32705, 32728, 32745, 32757, 32765,
+  32767, 32765, 32757, 32745, 32728, 32705, 32678, 32646, 32609, 32567, 32521, 32469, 32412, 32351, 32285, 32213,
+  32137, 32057, 31971, 31880, 31785, 31685, 31580, 31470, 31356, 31237, 31113, 30985, 30852, 30714, 30571, 30424,
+  30273, 30117, 29956, 29791, 29621, 29447, 29268, 29085, 28898, 28706, 28510, 28310, 28105, 27896, 27683, 27466,
+  27245, 27019, 26790, 26556, 26319, 26077, 25832, 25582, 25329, 25072, 24811, 24547, 24279, 24007, 23731, 23452,
+  23170, 22884, 22594, 22301, 22005, 21705, 21403, 21096, 20787, 20475, 20159, 19841, 19519, 19195, 18868, 18537,
+  18204, 17869, 17530, 17189, 16846, 16499, 16151, 15800, 15446, 15090, 14732, 14372, 14010, 13645, 13279, 12910,
+  12539, 12167, 11793, 11417, 11039, 10659, 10278, 9896, 9512, 9126, 8739, 8351, 7962, 7571, 7179, 6786,
+  6393, 5998, 5602, 5205, 4808, 4410, 4011, 3612, 3212, 2811, 2410, 2009, 1608, 1206, 804, 402,
+  0, -402, -804, -1206, -1608, -2009, -2410, -2811, -3212, -3612, -4011, -4410, -4808, -5205, -5602, -5998,
+  -6393, -6786, -7179, -7571, -7962, -8351, -8739, -9126, -9512, -9896, -10278, -10659, -11039, -11417, -11793, -12167,
+  -12539, -12910, -13279, -13645, -14010, -14372, -14732, -15090, -15446, -15800, -16151, -16499, -16846, -17189, -17530, -17869,
+  -18204, -18537, -18868, -19195, -19519, -19841, -20159, -20475, -20787, -21096, -21403, -21705, -22005, -22301, -22594, -22884,
+  -23170, -23452, -23731, -24007, -24279, -24547, -24811, -25072, -25329, -25582, -25832, -26077, -26319, -26556, -26790, -27019,
+  -27245, -27466, -27683, -27896, -28105, -28310, -28510, -28706, -28898, -29085, -29268, -29447, -29621, -29791, -29956, -30117,
+  -30273, -30424, -30571, -30714, -30852, -30985, -31113, -31237, -31356, -31470, -31580, -31685, -31785, -31880, -31971, -32057,
+  -32137, -32213, -32285, -32351, -32412, -32469, -32521, -32567, -32609, -32646, -32678, -32705, -32728, -32745, -32757, -32765,
+  -32767, -32765, -32757, -32745, -32728, -32705, -32678, -32646, -32609, -32567, -32521, -32469, -32412, -32351, -32285, -32213,
+  -32137, -32057, -31971, -31880, -31785, -31685, -31580, -31470, -31356, -31237, -31113, -30985, -30852, -30714, -30571, -30424,
+  -30273, -30117, -29956, -29791, -29621, -29447, -29268, -29085, -28898, -28706, -28510, -28310, -28105, -27896, -27683, -27466,
+  -27245, -27019, -26790, -26556, -26319, -26077, -25832, -25582, -25329, -25072, -24811, -24547, -24279, -24007, -23731, -23452,
+  -23170, -22884, -22594, -22301, -22005, -21705, -21403, -21096, -20787, -20475, -20159, -19841, -19519, -19195, -18868, -18537,
+  -18204, -17869, -17530, -17189, -16846, -16499, -16151, -15800, -15446, -15090, -14732, -14372, -14010, -13645, -13279, -12910,
+  -12539, -12167, -11793, -11417, -11039, -10659, -10278, -9896, -9512, -9126, -8739, -8351, -7962, -7571, -7179, -6786,
+  -6393, -5998, -5602, -5205, -4808, -4410, -4011, -3612, -3212, -2811, -2410, -2009, -1608, -1206, -804, -402,
+  // level 2
+  0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+  12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+  23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+  30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+  32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+  30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+  23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+  12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179, 6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+  0, -804, -1608, -2410, -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+  -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+  -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+  -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+  -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+  -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+  -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+  -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+  // level 3
+  0, 1608, 3212, 4808, 6393, 7962, 9512, 11039, 12539, 14010, 15446, 16846, 18204, 19519, 20787, 22005,
+  23170, 24279, 25329, 26319, 27245, 28105, 28898, 29621, 30273, 30852, 31356, 31785, 32137, 32412, 32609, 32728,
+  32767, 32728, 32609, 32412, 32137, 31785, 31356, 30852, 30273, 29621, 28898, 28105, 27245, 26319, 25329, 24279,
+  23170, 22005, 20787, 19519, 18204, 16846, 15446, 14010, 12539, 11039, 9512, 7962, 6393, 4808, 3212, 1608,
+  0, -1608, -3212, -4808, -6393, -7962, -9512, -11039, -12539, -14010, -15446, -16846, -18204, -19519, -20787, -22005,
+  -23170, -24279, -25329, -26319, -27245, -28105, -28898, -29621, -30273, -30852, -31356, -31785, -32137, -32412, -32609, -32728,
+  -32767, -32728, -32609, -32412, -32137, -31785, -31356, -30852, -30273, -29621, -28898, -28105, -27245, -26319, -25329, -24279,
+  -23170, -22005, -20787, -19519, -18204, -16846, -15446, -14010, -12539, -11039, -9512, -7962, -6393, -4808, -3212, -1608,
+  // level 4
+  0, 3212, 6393, 9512, 12539, 15446, 18204, 20787, 23170, 25329, 27245, 28898, 30273, 31356, 32137, 32609,
+  32767, 32609, 32137, 31356, 30273, 28898, 27245, 25329, 23170, 20787, 18204, 15446, 12539, 9512, 6393, 3212,
+  0, -3212, -6393, -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+  -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539, -9512, -6393, -3212,
+  // level 5
+  0, 6393, 12539, 18204, 23170, 27245, 30273, 32137, 32767, 32137, 30273, 27245, 23170, 18204, 12539, 6393,
+  0, -6393, -12539, -18204, -23170, -27245, -30273, -32137, -32767, -32137, -30273, -27245, -23170, -18204, -12539, -6393,
+},
+// shape 1
+{
+  // level 0
+  0, 646, 1292, 1938, 2582, 3225, 3867, 4508, 5146, 5782, 6415, 7046, 7674, 8298, 8919, 9536,
+  10148, 10757, 11360, 11959, 12552, 13141, 13723, 14300, 14870, 15435, 15992, 16543, 17087, 17624, 18153, 18675,
+  19189, 19695, 20193, 20683, 21164, 21636, 22100, 22555, 23001, 23437, 23864, 24282, 24690, 25089, 25478, 25856,
+  26225, 26584, 26933, 27272, 27600, 27918, 28226, 28524, 28811, 29088, 29354, 29610, 29856, 30091, 30316, 30530,
+  30734, 30928, 31112, 31285, 31449, 31602, 31745, 31879, 32002, 32116, 32221, 32315, 32401, 32477, 32544, 32602,
+  32651, 32691, 32722, 32746, 32760, 32767, 32766, 32757, 32740, 32716, 32684, 32645, 32600, 32548, 32489, 32424,
+  32353, 32275, 32193, 32104, 32011, 31912, 31809, 31700, 31588, 31471, 31350, 31226, 31098, 30966, 30832, 30695,
+  30555, 30412, 30268, 30121, 29973, 29823, 29672, 29520, 29367, 29213, 29059, 28904, 28750, 28595, 28441, 28288,
+  28135, 27983, 27833, 27683, 27535, 27389, 27245, 27102, 26962, 26824, 26689, 26556, 26426, 26299, 26175, 26054,
+  25936, 25822, 25711, 25605, 25501, 25402, 25307, 25216, 25128, 25045, 24967, 24892, 24822, 24757, 24696, 24639,
+  24588, 24540, 24498, 24460, 24426, 24398, 24374, 24355, 24340, 24330, 24325, 24324, 24328, 24336, 24349, 24366,
+  24388, 24414, 24444, 24478, 24517, 24560, 24606, 24657, 24711, 24769, 24831, 24896, 24964, 25036, 25111, 25189,
+  25270, 25354, 25440, 25530, 25621, 25715, 25811, 25909, 26009, 26111, 26214, 26319, 26425, 26533, 26641, 26750,
+  26860, 26971, 27082, 27194, 27305, 27417, 27528, 27639, 27750, 27860, 27970, 28079, 28186, 28293, 28398, 28502,
+  28604, 28705, 28803, 28900, 28995, 29088, 29178, 29266, 29352, 29434, 29515, 29592, 29666, 29738, 29806, 29871,
+  29933, 29991, 30046, 30098, 30146, 30190, 30231, 30268, 30301, 30330, 30356, 30377, 30395, 30409, 30419, 30425,
+  30427, 30425, 30419, 30409, 30395, 30377, 30356, 30330, 30301, 30268, 30231, 30190, 30146, 30098, 30046, 29991,
+  29933, 29871, 29806, 29738, 29666, 29592, 29515, 29434, 29352, 29266, 29178, 29088, 28995, 28900, 28803, 28705,
+  28604, 28502, 28398, 28293, 28186, 28079, 27970, 27860, 27750, 27639, 27528, 27417, 27305, 27194, 27082, 26971,
+  26860, 26750, 26641, 26533, 26425, 26319, 26214, 26111, 26009, 25909, 25811, 25715, 25621, 25530, 25440, 25354,
+  25270, 25189, 25111, 25036, 24964, 24896, 24831, 24769, 24711, 24657, 24606, 24560, 24517, 24478, 24444, 24414,
+  24388, 24366, 24349, 24336, 24328, 24324, 24325, 24330, 24340, 24355, 24374, 24398, 24426, 24460, 24498, 24540,
+  24588, 24639, 24696, 24757, 24822, 24892, 24967, 25045, 25128, 25216, 25307, 25402, 25501, 25605, 25711, 25822,
+  25936, 26054, 26175, 26299, 26426, 26556, 26689, 26824, 26962, 27102, 27245, 27389, 27535, 27683, 27833, 27983,
+  28135, 28288, 28441, 28595, 28750, 28904, 29059, 29213, 29367, 29520, 29672, 29823, 29973, 30121, 30268, 30412,
+  30555, 30695, 30832, 30966, 31098, 31226, 31350, 31471, 31588, 31700, 31809, 31912, 32011, 32104, 32193, 32275,
+  32353, 32424, 32489, 32548, 32600, 32645, 32684, 32716, 32740, 32757, 32766, 32767, 32760, 32746, 32722, 32691,
+  32651, 32602, 32544, 32477, 32401, 32315, 32221, 32116, 32002, 31879, 31745, 31602, 31449, 31285, 31112, 30928,
+  30734, 30530, 30316, 30091, 29856, 29610, 29354, 29088, 28811, 28524, 28226, 27918, 27600, 27272, 26933, 26584,
+  26225, 25856, 25478, 25089, 24690, 24282, 23864, 23437, 23001, 22555, 22100, 21636, 21164, 20683, 20193, 19695,
+  19189, 18675, 18153, 17624, 17087, 16543, 15992, 15435, 14870, 14300, 13723, 13141, 12552, 11959, 11360, 10757,
+  10148, 9536, 8919, 8298, 7674, 7046, 6415, 5782, 5146, 4508, 3867, 3225, 2582, 1938, 1292, 646,
+  0, -646, -1292, -1938, -2582, -3225, -3867, -4508, -5146, -5782, -6415, -7046, -7674, -8298, -8919, -9536,
+  -10148, -10757, -11360, -11959, -12552, -13141, -13723, -14300, -14870, -15435, -15992, -16543, -17087, -17624, -18153, -18675,
+  -19189, -19695, -20193, -20683, -21164, -21636, -22100, -22555, -23001, -23437, -23864, -24282, -24690, -25089, -25478, -25856,
+  -26225, -26584, -26933, -27272, -27600, -27918, -28226, -28524, -28811, -29088, -29354, -29610, -29856, -30091, -30316, -30530,
+  -30734, -30928, -31112, -31285, -31449, -31602, -31745, -31879, -32002, -32116, -32221, -32315, -32401, -32477, -32544, -32602,
+  -32651, -32691, -32722, -32746, -32760, -32767, -32766, -32757, -32740, -32716, -32684, -32645, -32600, -32548, -32489, -32424,
+  -32353, -32275, -32193, -32104, -32011, -31912, -31809, -31700, -31588, -31471, -31350, -31226, -31098, -30966, -30832, -30695,
+  -30555, -30412, -30268, -30121, -29973, -29823, -29672, -29520, -29367, -29213, -29059, -28904, -28750, -28595, -28441, -28288,
+  -28135, -27983, -27833, -27683, -27535, -27389, -27245, -27102, -26962, -26824, -26689, -26556, -26426, -26299, -26175, -26054,
+  -25936, -25822, -25711, -25605, -25501, -25402, -25307, -25216, -25128, -25045, -24967, -24892, -24822, -24757, -24696, -24639,
+  -24588, -24540, -24498, -24460, -24426, -24398, -24374, -24355, -24340, -24330, -24325, -24324, -24328, -24336, -24349, -24366,
+  -24388, -24414, -24444, -24478, -24517, -24560, -24606, -24657, -24711, -24769, -24831, -24896, -24964, -25036, -25111, -25189,
+  -25270, -25354, -25440, -25530, -25621, -25715, -25811, -25909, -26009, -26111, -26214, -26319, -26425, -26533, -26641, -26750,
+  -26860, -26971, -27082, -27194, -27305, -27417, -27528, -27639, -27750, -27860, -27970, -28079, -28186, -28293, -28398, -28502,
+  -28604, -28705, -28803, -28900, -28995, -29088, -29178, -29266, -29352, -29434, -29515, -29592, -29666, -29738, -29806, -29871,
+  -29933, -29991, -30046, -30098, -30146, -30190, -30231, -30268, -30301, -30330, -30356, -30377, -30395, -30409, -30419, -30425,
+  -30427, -30425, -30419, -30409, -30395, -30377, -30356, -30330, -30301, -30268, -30231, -30190, -30146, -30098, -30046, -29991,
+  -29933, -29871, -29806, -29738, -29666, -29592, -29515, -29434, -29352, -29266, -29178, -29088, -28995, -28900, -28803, -28705,
+  -28604, -28502, -28398, -28293, -28186, -28079, -27970, -27860, -27750, -27639, -27528, -27417, -27305, -27194, -27082, -26971,
+  -26860, -26750, -26641, -26533, -26425, -26319, -26214, -26111, -26009, -25909, -25811, -25715, -25621, -25530, -25440, -25354,
+  -25270, -25189, -25111, -25036, -24964, -24896, -24831, -24769, -24711, -24657, -24606, -24560, -24517, -24478, -24444, -24414,
+  -24388, -24366, -24349, -24336, -24328, -24324, -24325, -24330, -24340, -24355, -24374, -24398, -24426, -24460, -24498, -24540,
+  -24588, -24639, -24696, -24757, -24822, -24892, -24967, -25045, -25128, -25216, -25307, -25402, -25501, -25605, -25711, -25822,
+  -25936, -26054, -26175, -26299, -26426, -26556, -26689, -26824, -26962, -27102, -27245, -27389, -27535, -27683, -27833, -27983,
+  -28135, -28288, -28441, -28595, -28750, -28904, -29059, -29213, -29367, -29520, -29672, -29823, -29973, -30121, -30268, -30412,
+  -30555, -30695, -30832, -30966, -31098, -31226, -31350, -31471, -31588, -31700, -31809, -31912, -32011, -32104, -32193, -32275,
+  -32353, -32424, -32489, -32548, -32600, -32645, -32684, -32716, -32740, -32757, -32766, -32767, -32760, -32746, -32722, -32691,
+  -32651, -32602, -32544, -32477, -32401, -32315, -32221, -32116, -32002, -31879, -31745, -31602, -31449, -31285, -31112, -30928,
+  -30734, -30530, -30316, -30091, -29856, -29610, -29354, -29088, -28811, -28524, -28226, -27918, -27600, -27272, -26933, -26584,
+  -26225, -25856, -25478, -25089, -24690, -24282, -23864, -23437, -23001, -22555, -22100, -21636, -21164, -20683, -20193, -19695,
+  -19189, -18675, -18153, -17624, -17087, -16543, -15992, -15435, -14870, -14300, -13723, -13141, -12552, -11959, -11360, -10757,
+  -10148, -9536, -8919, -8298, -7674, -7046, -6415, -5782, -5146, -4508, -3867, -3225, -2582, -1938, -1292, -646,
+  // level 1
+  0, 1292, 2582, 3867, 5146, 6415, 7674, 8919, 10148, 11360, 12552, 13723, 14870, 15992, 17087, 18153,
+  19189, 20193, 21164, 22100, 23001, 23864, 24690, 25478, 26225, 26933, 27600, 28226, 28811, 29354, 29856, 30316,
+  30734, 31112, 31449, 31745, 32002, 32221, 32401, 32544, 32651, 32722, 32760, 32766, 32740, 32684, 32600, 32489,
+  32353, 32193, 32011, 31809, 31588, 31350, 31098, 30832, 30555, 30268, 29973, 29672, 29367, 29059, 28750, 28441,
+  28135, 27833, 27535, 27245, 26962, 26689, 26426, 26175, 25936, 25711, 25501, 25307, 25128, 24967, 24822, 24696,
+  24588, 24498, 24426, 24374, 24340, 24325, 24328, 24349, 24388, 24444, 24517, 24606, 24711, 24831, 24964, 25111,
+  25270, 25440, 25621, 25811, 26009, 26214, 26425, 26641, 26860, 27082, 27305, 27528, 27750, 27970, 28186, 28398,
+  28604, 28803, 28995, 29178, 29352, 29515, 29666, 29806, 29933, 30046, 30146, 30231, 30301, 30356, 30395, 30419,
+  30427, 30419, 30395, 30356, 30301, 30231, 30146, 30046, 29933, 29806, 29666, 29515, 29352, 29178, 28995, 28803,
+  28604, 28398, 28186, 27970, 27750, 27528, 27305, 27082, 26860, 26641, 26425, 26214, 26009, 25811, 25621, 25440,
+  25270, 25111, 24964, 24831, 24711, 24606, 24517, 24444, 24388, 24349, 24328, 24325, 24340, 24374, 24426, 24498,
+  24588, 24696, 24822, 24967, 25128, 25307, 25501, 25711, 25936, 26175, 26426, 26689, 26962, 27245, 27535, 27833,
+  28135, 28441, 28750, 29059, 29367, 29672, 29973, 30268, 30555, 30832, 31098, 31350, 31588, 31809, 32011, 32193,
+  32353, 32489, 32600, 32684, 32740, 32766, 32760, 32722, 32651, 32544, 32401, 32221, 32002, 31745, 31449, 31112,
+  30734, 30316, 29856, 29354, 28811, 28226, 27600, 26933, 26225, 25478, 24690, 23864, 23001, 22100, 21164, 20193,
+  19189, 18153, 17087, 15992, 14870, 13723, 12552, 11360, 10148, 8919, 7674, 6415, 5146, 3867, 2582, 1292,
+  0, -1292, -2582, -3867, -5146, -6415, -7674, -8919, -10148, -11360, -12552, -13723, -14870, -15992, -17087, -18153,
+  -19189, -20193, -21164, -22100, -23001, -23864, -24690, -25478, -26225, -26933, -27600, -28226, -28811, -29354, -29856, -30316,
+  -30734, -31112, -31449, -31745, -32002, -32221, -32401, -32544, -32651, -32722, -32760, -32766, -32740, -32684, -32600, -32489,
+  -32353, -32193, -32011, -31809, -31588, -31350, -31098, -30832, -30555, -30268, -29973, -29672, -29367, -29059, -28750, -28441,
+  -28135, -27833, -27535, -27245, -26962, -26689, -26426, -26175, -25936, -25711, -25501, -25307, -25128, -24967, -24822, -24696,
+  -24588, -24498, -24426, -24374, -24340, -24325, -24328, -24349, -24388, -24444, -24517, -24606, -24711, -24831, -24964, -25111,
+  -25270, -25440, -25621, -25811, -26009, -26214, -26425, -26641, -26860, -27082, -27305, -27528, -27750, -27970, -28186, -28398,
+  -28604, -28803, -28995, -29178, -29352, -29515, -29666, -29806, -29933, -30046, -30146, -30231, -30301, -30356, -30395, -30419,
+  -30427, -30419, -30395, -30356, -30301, -30231, -30146, -30046, -29933, -29806, -29666, -29515, -29352, -29178, -28995, -28803,
+  -28604, -28398, -28186, -27970, -27750, -27528, -27305, -27082, -26860, -26641, -26425, -26214, -26009, -25811, -25621, -25440,
+  -25270, -25111, -24964, -24831, -24711, -24606, -24517, -24444, -24388, -24349, -24328, -24325, -24340, -24374, -24426, -24498,
+  -24588, -24696, -24822, -24967, -25128, -25307, -25501, -25711, -25936, -26175, -26426, -26689, -26962, -27245, -27535, -27833,
+  -28135, -28441, -28750, -29059, -29367, -29672, -29973, -30268, -30555, -30832, -31098, -31350, -31588, -31809, -32011, -32193,
+  -32353, -32489, -32600, -32684, -32740, -32766, -32760, -32722, -32651, -32544, -32401, -32221, -32002, -31745, -31449, -31112,
+  -30734, -30316, -29856, -29354, -28811, -28226, -27600, -26933, -26225, -25478, -24690, -23864, -23001, -22100, -21164, -20193,
+  -19189, -18153, -17087, -15992, -14870, -13723, -12552, -11360, -10148, -8919, -7674, -6415, -5146, -3867, -2582, -1292,
+  // level 2
+  0, 2582, 5146, 7674, 10148, 12552, 14870, 17087, 19189, 21164, 23001, 24690, 26225, 27600, 28811, 29856,
+  30734, 31449, 32002, 32401, 32651, 32760, 32740, 32600, 32353, 32011, 31588, 31098, 30555, 29973, 29367, 28750,
+  28135, 27535, 26962, 26426, 25936, 25501, 25128, 24822, 24588, 24426, 24340, 24328, 24388, 24517, 24711, 24964,
+  25270, 25621, 26009, 26425, 26860, 27305, 27750, 28186, 28604, 28995, 29352, 29666, 29933, 30146, 30301, 30395,
+  30427, 30395, 30301, 30146, 29933, 29666, 29352, 28995, 28604, 28186, 27750, 27305, 26860, 26425, 26009, 25621,
+  25270, 24964, 24711, 24517, 24388, 24328, 24340, 24426, 24588, 24822, 25128, 25501, 25936, 26426, 26962, 27535,
+  28135, 28750, 29367, 29973, 30555, 31098, 31588, 32011, 32353, 32600, 32740, 32760, 32651, 32401, 32002, 31449,
+  30734, 29856, 28811, 27600, 26225, 24690, 23001, 21164, 19189, 17087, 14870, 12552, 10148, 7674, 5146, 2582,
+  0, -2582, -5146, -7674, -10148, -12552, -14870, -17087, -19189, -21164, -23001, -24690, -26225, -27600, -28811, -29856,
+  -30734, -31449, -32002, -32401, -32651, -32760, -32740, -32600, -32353, -32011, -31588, -31098, -30555, -29973, -29367, -28750,
+  -28135, -27535, -26962, -26426, -25936, -25501, -25128, -24822, -24588, -24426, -24340, -24328, -24388, -24517, -24711, -24964,
+  -25270, -25621, -26009, -26425, -26860, -27305, -27750, -28186, -28604, -28995, -29352, -29666, -29933, -30146, -30301, -30395,
+  -30427, -30395, -30301, -30146, -29933, -29666, -29352, -28995, -28604, -28186, -27750, -27305, -26860, -26425, -26009, -25621,
+  -25270, -24964, -24711, -24517, -24388, -24328, -24340, -24426, -24588, -24822, -25128, -25501, -25936, -26426, -26962, -27535,
+  -28135, -28750, -29367, -29973, -30555, -31098, -31588, -32011, -32353, -32600, -32740, -32760, -32651, -32401, -32002, -31449,
+  -30734, -29856, -28811, -27600, -26225, -24690, -23001, -21164, -19189, -17087, -14870, -12552, -10148, -7674, -5146, -2582,
+  // level 3
+  0, 3440, 6838, 10155, 13351, 16390, 19238, 21865, 24247, 26363, 28196, 29738, 30983, 31932, 32593, 32767,
+  32767, 32767, 32655, 32141, 31474, 30687, 29815, 28894, 27957, 27039, 26172, 25385, 24703, 24149, 23740, 23490,
+  23405, 23490, 23740, 24149, 24703, 25385, 26172, 27039, 27957, 28894, 29815, 30687, 31474, 32141, 32655, 32767,
+  32767, 32767, 32593, 31932, 30983, 29738, 28196, 26363, 24247, 21865, 19238, 16390, 13351, 10155, 6838, 3440,
+  0, -3440, -6838, -10155, -13351, -16390, -19238, -21865, -24247, -26363, -28196, -29738, -30983, -31932, -32593, -32768,
+  -32768, -32768, -32655, -32141, -31474, -30687, -29815, -28894, -27957, -27039, -26172, -25385, -24703, -24149, -23740, -23490,
+  -23405, -23490, -23740, -24149, -24703, -25385, -26172, -27039, -27957, -28894, -29815, -30687, -31474, -32141, -32655, -32768,
+  -32768, -32768, -32593, -31932, -30983, -29738, -28196, -26363, -24247, -21865, -19238, -16390, -13351, -10155, -6838, -3440,
+  // level 4
+  0, 3441, 6849, 10191, 13435, 16550, 19505, 22272, 24825, 27139, 29191, 30962, 32436, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32436, 30962, 29191, 27139, 24825, 22272, 19505, 16550, 13435, 10191, 6849, 3441,
+  0, -3441, -6849, -10191, -13435, -16550, -19505, -22272, -24825, -27139, -29191, -30962, -32436, -32768, -32768, -32768,
+  -32768, -32768, -32768, -32768, -32436, -30962, -29191, -27139, -24825, -22272, -19505, -16550, -13435, -10191, -6849, -3441,
+  // level 5
+  0, 6849, 13435, 19505, 24825, 29191, 32436, 32767, 32767, 32767, 32436, 29191, 24825, 19505, 13435, 6849,
+  0, -6849, -13435, -19505, -24825, -29191, -32436, -32768, -32768, -32768, -32436, -29191, -24825, -19505, -13435, -6849,
+},
+// shape 2
+{
+  // level 0
+  0, 689, 1377, 2065, 2752, 3437, 4120, 4801, 5480, 6156, 6828, 7497, 8161, 8822, 9478, 10128,
+  10774, 11414, 12047, 12675, 13296, 13910, 14517, 15116, 15708, 16291, 16866, 17433, 17991, 18540, 19080, 19610,
+  20131, 20642, 21142, 21633, 22113, 22583, 23041, 23489, 23926, 24352, 24767, 25171, 25563, 25944, 26313, 26671,
+  27017, 27351, 27674, 27985, 28285, 28573, 28850, 29115, 29368, 29610, 29841, 30060, 30268, 30465, 30651, 30826,
+  30991, 31145, 31288, 31421, 31544, 31657, 31760, 31854, 31938, 32013, 32079, 32136, 32184, 32224, 32256, 32280,
+  32297, 32306, 32308, 32303, 32291, 32273, 32249, 32220, 32184, 32143, 32097, 32047, 31992, 31933, 31869, 31803,
+  31732, 31659, 31583, 31504, 31423, 31340, 31256, 31169, 31082, 30993, 30904, 30815, 30725, 30635, 30545, 30456,
+  30367, 30280, 30193, 30108, 30025, 29943, 29863, 29785, 29709, 29636, 29566, 29498, 29433, 29371, 29312, 29257,
+  29204, 29156, 29111, 29069, 29031, 28997, 28967, 28941, 28919, 28901, 28887, 28877, 28871, 28869, 28871, 28877,
+  28888, 28902, 28920, 28942, 28968, 28998, 29031, 29069, 29109, 29154, 29201, 29252, 29306, 29364, 29424, 29487,
+  29553, 29621, 29692, 29765, 29840, 29918, 29997, 30078, 30160, 30244, 30329, 30415, 30501, 30589, 30677, 30765,
+  30854, 30942, 31030, 31118, 31206, 31292, 31378, 31463, 31546, 31628, 31708, 31787, 31863, 31938, 32010, 32080,
+  32147, 32212, 32273, 32332, 32388, 32440, 32488, 32534, 32575, 32613, 32647, 32677, 32703, 32724, 32741, 32754,
+  32763, 32767, 32766, 32761, 32752, 32737, 32718, 32694, 32665, 32631, 32593, 32549, 32501, 32448, 32391, 32328,
+  32261, 32189, 32112, 32031, 31945, 31855, 31760, 31661, 31557, 31449, 31338, 31222, 31102, 30978, 30851, 30720,
+  30586, 30448, 30307, 30163, 30016, 29866, 29713, 29558, 29400, 29240, 29078, 28914, 28748, 28580, 28411, 28241,
+  28069, 27896, 27723, 27548, 27374, 27198, 27022, 26847, 26671, 26495, 26320, 26145, 25971, 25797, 25625, 25453,
+  25282, 25113, 24945, 24779, 24614, 24451, 24290, 24131, 23974, 23819, 23666, 23515, 23367, 23221, 23078, 22937,
+  22799, 22663, 22531, 22400, 22273, 22148, 22027, 21907, 21791, 21678, 21567, 21459, 21353, 21251, 21151, 21053,
+  20958, 20866, 20776, 20688, 20603, 20519, 20438, 20359, 20282, 20206, 20132, 20060, 19989, 19920, 19851, 19784,
+  19718, 19652, 19587, 19523, 19459, 19395, 19331, 19267, 19203, 19138, 19072, 19006, 18939, 18870, 18800, 18729,
+  18656, 18581, 18504, 18425, 18344, 18260, 18173, 18084, 17992, 17896, 17797, 17695, 17588, 17479, 17365, 17247,
+  17125, 16998, 16867, 16732, 16592, 16447, 16297, 16142, 15982, 15816, 15646, 15470, 15289, 15102, 14909, 14712,
+  14508, 14299, 14084, 13864, 13638, 13406, 13168, 12925, 12677, 12422, 12163, 11897, 11627, 11351, 11069, 10783,
+  10492, 10195, 9894, 9588, 9277, 8962, 8642, 8319, 7991, 7659, 7324, 6985, 6643, 6298, 5950, 5600,
+  5246, 4891, 4533, 4174, 3813, 3451, 3088, 2724, 2360, 1995, 1630, 1266, 902, 538, 176, -184,
+  -544, -901, -1256, -1608, -1958, -2305, -2648, -2987, -3323, -3655, -3982, -4304, -4621, -4933, -5239, -5539,
+  -5833, -6121, -6402, -6677, -6944, -7203, -7455, -7699, -7936, -8163, -8382, -8593, -8794, -8987, -9170, -9344,
+  -9508, -9662, -9806, -9940, -10064, -10178, -10281, -10374, -10456, -10527, -10587, -10637, -10675, -10703, -10720, -10726,
+  -10721, -10704, -10677, -10639, -10590, -10530, -10459, -10378, -10286, -10183, -10070, -9947, -9813, -9669, -9516, -9352,
+  -9179, -8996, -8804, -8603, -8394, -8175, -7948, -7713, -7470, -7220, -6961, -6696, -6424, -6145, -5860, -5568,
+  -5271, -4969, -4661, -4349, -4032, -3710, -3385, -3057, -2725, -2391, -2054, -1715, -1374, -1032, -688, -344,
+  0, 344, 688, 1032, 1374, 1715, 2054, 2391, 2725, 3057, 3385, 3710, 4032, 4349, 4661, 4969,
+  5271, 5568, 5860, 6145, 6424, 6696, 6961, 7220, 7470, 7713, 7948, 8175, 8394, 8603, 8804, 8996,
+  9179, 9352, 9516, 9669, 9813, 9947, 10070, 10183, 10286, 10378, 10459, 10530, 10590, 10639, 10677, 10704,
+  10721, 10726, 10720, 10703, 10675, 10637, 10587, 10527, 10456, 10374, 10281, 10178, 10064, 9940, 9806, 9662,
+  9508, 9344, 9170, 8987, 8794, 8593, 8382, 8163, 7936, 7699, 7455, 7203, 6944, 6677, 6402, 6121,
+  5833, 5539, 5239, 4933, 4621, 4304, 3982, 3655, 3323, 2987, 2648, 2305, 1958, 1608, 1256, 901,
+  544, 184, -176, -538, -902, -1266, -1630, -1995, -2360, -2724, -3088, -3451, -3813, -4174, -4533, -4891,
+  -5246, -5600, -5950, -6298, -6643, -6985, -7324, -7659, -7991, -8319, -8642, -8962, -9277, -9588, -9894, -10195,
+  -10492, -10783, -11069, -11351, -11627, -11897, -12163, -12422, -12677, -12925, -13168, -13406, -13638, -13864, -14084, -14299,
+  -14508, -14712, -14909, -15102, -15289, -15470, -15646, -15816, -15982, -16142, -16297, -16447, -16592, -16732, -16867, -16998,
+  -17125, -17247, -17365, -17479, -17588, -17695, -17797, -17896, -17992, -18084, -18173, -18260, -18344, -18425, -18504, -18581,
+  -18656, -18729, -18800, -18870, -18939, -19006, -19072, -19138, -19203, -19267, -19331, -19395, -19459, -19523, -19587, -19652,
+  -19718, -19784, -19851, -19920, -19989, -20060, -20132, -20206, -20282, -20359, -20438, -20519, -20603, -20688, -20776, -20866,
+  -20958, -21053, -21151, -21251, -21353, -21459, -21567, -21678, -21791, -21907, -22027, -22148, -22273, -22400, -22531, -22663,
+  -22799, -22937, -23078, -23221, -23367, -23515, -23666, -23819, -23974, -24131, -24290, -24451, -24614, -24779, -24945, -25113,
+  -25282, -25453, -25625, -25797, -25971, -26145, -26320, -26495, -26671, -26847, -27022, -27198, -27374, -27548, -27723, -27896,
+  -28069, -28241, -28411, -28580, -28748, -28914, -29078, -29240, -29400, -29558, -29713, -29866, -30016, -30163, -30307, -30448,
+  -30586, -30720, -30851, -30978, -31102, -31222, -31338, -31449, -31557, -31661, -31760, -31855, -31945, -32031, -32112, -32189,
+  -32261, -32328, -32391, -32448, -32501, -32549, -32593, -32631, -32665, -32694, -32718, -32737, -32752, -32761, -32766, -32767,
+  -32763, -32754, -32741, -32724, -32703, -32677, -32647, -32613, -32575, -32534, -32488, -32440, -32388, -32332, -32273, -32212,
+  -32147, -32080, -32010, -31938, -31863, -31787, -31708, -31628, -31546, -31463, -31378, -31292, -31206, -31118, -31030, -30942,
+  -30854, -30765, -30677, -30589, -30501, -30415, -30329, -30244, -30160, -30078, -29997, -29918, -29840, -29765, -29692, -29621,
+  -29553, -29487, -29424, -29364, -29306, -29252, -29201, -29154, -29109, -29069, -29031, -28998, -28968, -28942, -28920, -28902,
+  -28888, -28877, -28871, -28869, -28871, -28877, -28887, -28901, -28919, -28941, -28967, -28997, -29031, -29069, -29111, -29156,
+  -29204, -29257, -29312, -29371, -29433, -29498, -29566, -29636, -29709, -29785, -29863, -29943, -30025, -30108, -30193, -30280,
+  -30367, -30456, -30545, -30635, -30725, -30815, -30904, -30993, -31082, -31169, -31256, -31340, -31423, -31504, -31583, -31659,
+  -31732, -31803, -31869, -31933, -31992, -32047, -32097, -32143, -32184, -32220, -32249, -32273, -32291, -32303, -32308, -32306,
+  -32297, -32280, -32256, -32224, -32184, -32136, -32079, -32013, -31938, -31854, -31760, -31657, -31544, -31421, -31288, -31145,
+  -30991, -30826, -30651, -30465, -30268, -30060, -29841, -29610, -29368, -29115, -28850, -28573, -28285, -27985, -27674, -27351,
+  -27017, -26671, -26313, -25944, -25563, -25171, -24767, -24352, -23926, -23489, -23041, -22583, -22113, -21633, -21142, -20642,
+  -20131, -19610, -19080, -18540, -17991, -17433, -16866, -16291, -15708, -15116, -14517, -13910, -13296, -12675, -12047, -11414,
+  -10774, -10128, -9478, -8822, -8161, -7497, -6828, -6156, -5480, -4801, -4120, -3437, -2752, -2065, -1377, -689,
+  // level 1
+  0, 1377, 2752, 4120, 5480, 6828, 8161, 9478, 10774, 12047, 13296, 14517, 15708, 16866, 17991, 19080,
+  20131, 21142, 22113, 23041, 23926, 24767, 25563, 26313, 27017, 27674, 28285, 28850, 29368, 29841, 30268, 30651,
+  30991, 31288, 31544, 31760, 31938, 32079, 32184, 32256, 32297, 32308, 32291, 32249, 32184, 32097, 31992, 31869,
+  31732, 31583, 31423, 31256, 31082, 30904, 30725, 30545, 30367, 30193, 30025, 29863, 29709, 29566, 29433, 29312,
+  29204, 29111, 29031, 28967, 28919, 28887, 28871, 28871, 28888, 28920, 28968, 29031, 29109, 29201, 29306, 29424,
+  29553, 29692, 29840, 29997, 30160, 30329, 30501, 30677, 30854, 31030, 31206, 31378, 31546, 31708, 31863, 32010,
+  32147, 32273, 32388, 32488, 32575, 32647, 32703, 32741, 32763, 32766, 32752, 32718, 32665, 32593, 32501, 32391,
+  32261, 32112, 31945, 31760, 31557, 31338, 31102, 30851, 30586, 30307, 30016, 29713, 29400, 29078, 28748, 28411,
+  28069, 27723, 27374, 27022, 26671, 26320, 25971, 25625, 25282, 24945, 24614, 24290, 23974, 23666, 23367, 23078,
+  22799, 22531, 22273, 22027, 21791, 21567, 21353, 21151, 20958, 20776, 20603, 20438, 20282, 20132, 19989, 19851,
+  19718, 19587, 19459, 19331, 19203, 19072, 18939, 18800, 18656, 18504, 18344, 18173, 17992, 17797, 17588, 17365,
+  17125, 16867, 16592, 16297, 15982, 15646, 15289, 14909, 14508, 14084, 13638, 13168, 12677, 12163, 11627, 11069,
+  10492, 9894, 9277, 8642, 7991, 7324, 6643, 5950, 5246, 4533, 3813, 3088, 2360, 1630, 902, 176,
+  -544, -1256, -1958, -2648, -3323, -3982, -4621, -5239, -5833, -6402, -6944, -7455, -7936, -8382, -8794, -9170,
+  -9508, -9806, -10064, -10281, -10456, -10587, -10675, -10720, -10721, -10677, -10590, -10459, -10286, -10070, -9813, -9516,
+  -9179, -8804, -8394, -7948, -7470, -6961, -6424, -5860, -5271, -4661, -4032, -3385, -2725, -2054, -1374, -688,
+  0, 688, 1374, 2054, 2725, 3385, 4032, 4661, 5271, 5860, 6424, 6961, 7470, 7948, 8394, 8804,
+  9179, 9516, 9813, 10070, 10286, 10459, 10590, 10677, 10721, 10720, 10675, 10587, 10456, 10281, 10064, 9806,
+  9508, 9170, 8794, 8382, 7936, 7455, 6944, 6402, 5833, 5239, 4621, 3982, 3323, 2648, 1958, 1256,
+  544, -176, -902, -1630, -2360, -3088, -3813, -4533, -5246, -5950, -6643, -7324, -7991, -8642, -9277, -9894,
+  -10492, -11069, -11627, -12163, -12677, -13168, -13638, -14084, -14508, -14909, -15289, -15646, -15982, -16297, -16592, -16867,
+  -17125, -17365, -17588, -17797, -17992, -18173, -18344, -18504, -18656, -18800, -18939, -19072, -19203, -19331, -19459, -19587,
+  -19718, -19851, -19989, -20132, -20282, -20438, -20603, -20776, -20958, -21151, -21353, -21567, -21791, -22027, -22273, -22531,
+  -22799, -23078, -23367, -23666, -23974, -24290, -24614, -24945, -25282, -25625, -25971, -26320, -26671, -27022, -27374, -27723,
+  -28069, -28411, -28748, -29078, -29400, -29713, -30016, -30307, -30586, -30851, -31102, -31338, -31557, -31760, -31945, -32112,
+  -32261, -32391, -32501, -32593, -32665, -32718, -32752, -32766, -32763, -32741, -32703, -32647, -32575, -32488, -32388, -32273,
+  -32147, -32010, -31863, -31708, -31546, -31378, -31206, -31030, -30854, -30677, -30501, -30329, -30160, -29997, -29840, -29692,
+  -29553, -29424, -29306, -29201, -29109, -29031, -28968, -28920, -28888, -28871, -28871, -28887, -28919, -28967, -29031, -29111,
+  -29204, -29312, -29433, -29566, -29709, -29863, -30025, -30193, -30367, -30545, -30725, -30904, -31082, -31256, -31423, -31583,
+  -31732, -31869, -31992, -32097, -32184, -32249, -32291, -32308, -32297, -32256, -32184, -32079, -31938, -31760, -31544, -31288,
+  -30991, -30651, -30268, -29841, -29368, -28850, -28285, -27674, -27017, -26313, -25563, -24767, -23926, -23041, -22113, -21142,
+  -20131, -19080, -17991, -16866, -15708, -14517, -13296, -12047, -10774, -9478, -8161, -6828, -5480, -4120, -2752, -1377,
+  // level 2
+  0, 2752, 5480, 8161, 10774, 13296, 15708, 17991, 20131, 22113, 23926, 25563, 27017, 28285, 29368, 30268,
+  30991, 31544, 31938, 32184, 32297, 32291, 32184, 31992, 31732, 31423, 31082, 30725, 30367, 30025, 29709, 29433,
+  29204, 29031, 28919, 28871, 28888, 28968, 29109, 29306, 29553, 29840, 30160, 30501, 30854, 31206, 31546, 31863,
+  32147, 32388, 32575, 32703, 32763, 32752, 32665, 32501, 32261, 31945, 31557, 31102, 30586, 30016, 29400, 28748,
+  28069, 27374, 26671, 25971, 25282, 24614, 23974, 23367, 22799, 22273, 21791, 21353, 20958, 20603, 20282, 19989,
+  19718, 19459, 19203, 18939, 18656, 18344, 17992, 17588, 17125, 16592, 15982, 15289, 14508, 13638, 12677, 11627,
+  10492, 9277, 7991, 6643, 5246, 3813, 2360, 902, -544, -1958, -3323, -4621, -5833, -6944, -7936, -8794,
+  -9508, -10064, -10456, -10675, -10721, -10590, -10286, -9813, -9179, -8394, -7470, -6424, -5271, -4032, -2725, -1374,
+  0, 1374, 2725, 4032, 5271, 6424, 7470, 8394, 9179, 9813, 10286, 10590, 10721, 10675, 10456, 10064,
+  9508, 8794, 7936, 6944, 5833, 4621, 3323, 1958, 544, -902, -2360, -3813, -5246, -6643, -7991, -9277,
+  -10492, -11627, -12677, -13638, -14508, -15289, -15982, -16592, -17125, -17588, -17992, -18344, -18656, -18939, -19203, -19459,
+  -19718, -19989, -20282, -20603, -20958, -21353, -21791, -22273, -22799, -23367, -23974, -24614, -25282, -25971, -26671, -27374,
+  -28069, -28748, -29400, -30016, -30586, -31102, -31557, -31945, -32261, -32501, -32665, -32752, -32763, -32703, -32575, -32388,
+  -32147, -31863, -31546, -31206, -30854, -30501, -30160, -29840, -29553, -29306, -29109, -28968, -28888, -28871, -28919, -29031,
+  -29204, -29433, -29709, -30025, -30367, -30725, -31082, -31423, -31732, -31992, -32184, -32291, -32297, -32184, -31938, -31544,
+  -30991, -30268, -29368, -28285, -27017, -25563, -23926, -22113, -20131, -17991, -15708, -13296, -10774, -8161, -5480, -2752,
+  // level 3
+  0, 4122, 8175, 12091, 15809, 19271, 22428, 25242, 27683, 29733, 31384, 32643, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32077, 31343, 30619, 29941, 29341, 28839, 28449, 28175, 28009, 27939, 27941, 27987, 28042,
+  28069, 28029, 27881, 27590, 27121, 26447, 25547, 24407, 23026, 21408, 19569, 17533, 15334, 13014, 10618, 8200,
+  5813, 3514, 1357, -608, -2334, -3782, -4921, -5730, -6200, -6330, -6132, -5630, -4857, -3854, -2672, -1367,
+  0, 1367, 2672, 3854, 4857, 5630, 6132, 6330, 6200, 5730, 4921, 3782, 2334, 608, -1357, -3514,
+  -5813, -8200, -10618, -13014, -15334, -17533, -19569, -21408, -23026, -24407, -25547, -26447, -27121, -27590, -27881, -28029,
+  -28069, -28042, -27987, -27941, -27939, -28009, -28175, -28449, -28839, -29341, -29941, -30619, -31343, -32077, -32768, -32768,
+  -32768, -32768, -32768, -32768, -32768, -32643, -31384, -29733, -27683, -25242, -22428, -19271, -15809, -12091, -8175, -4122,
+  // level 4
+  0, 5489, 10847, 15945, 20666, 24901, 28561, 31572, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30672,
+  28069, 25196, 22159, 19063, 16009, 13085, 10372, 7933, 5813, 4042, 2628, 1562, 818, 351, 105, 13,
+  0, -13, -105, -351, -818, -1562, -2628, -4042, -5813, -7933, -10372, -13085, -16009, -19063, -22159, -25196,
+  -28069, -30672, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -31572, -28561, -24901, -20666, -15945, -10847, -5489,
+  // level 5
+  0, 5476, 10742, 15594, 19848, 23339, 25933, 27530, 28069, 27530, 25933, 23339, 19848, 15594, 10742, 5476,
+  0, -5476, -10742, -15594, -19848, -23339, -25933, -27530, -28069, -27530, -25933, -23339, -19848, -15594, -10742, -5476,
+},
+// shape 3
+{
+  // level 0
+  0, 852, 1704, 2554, 3402, 4248, 5090, 5929, 6763, 7592, 8416, 9233, 10043, 10846, 11641, 12427,
+  13204, 13971, 14728, 15475, 16209, 16933, 17644, 18342, 19027, 19698, 20355, 20998, 21626, 22239, 22836, 23418,
+  23983, 24532, 25064, 25580, 26078, 26558, 27021, 27467, 27894, 28303, 28694, 29067, 29422, 29759, 30077, 30377,
+  30658, 30921, 31166, 31393, 31602, 31793, 31966, 32122, 32260, 32381, 32485, 32573, 32643, 32698, 32737, 32759,
+  32767, 32760, 32737, 32701, 32651, 32587, 32509, 32419, 32317, 32203, 32077, 31940, 31793, 31635, 31468, 31291,
+  31106, 30912, 30710, 30501, 30286, 30063, 29835, 29602, 29363, 29120, 28873, 28623, 28369, 28113, 27855, 27595,
+  27334, 27072, 26810, 26548, 26286, 26026, 25766, 25509, 25253, 25000, 24750, 24503, 24259, 24019, 23783, 23552,
+  23325, 23104, 22887, 22676, 22471, 22271, 22078, 21891, 21710, 21536, 21368, 21208, 21054, 20907, 20767, 20635,
+  20510, 20391, 20281, 20177, 20080, 19991, 19909, 19834, 19766, 19705, 19651, 19603, 19562, 19528, 19500, 19478,
+  19462, 19452, 19447, 19449, 19455, 19467, 19483, 19504, 19529, 19559, 19593, 19630, 19670, 19714, 19761, 19811,
+  19863, 19917, 19972, 20030, 20089, 20149, 20210, 20271, 20333, 20394, 20456, 20517, 20577, 20636, 20694, 20751,
+  20806, 20859, 20910, 20958, 21004, 21047, 21088, 21125, 21159, 21189, 21216, 21239, 21258, 21273, 21284, 21290,
+  21293, 21290, 21284, 21272, 21256, 21235, 21209, 21179, 21144, 21104, 21059, 21009, 20954, 20895, 20831, 20762,
+  20688, 20610, 20527, 20440, 20349, 20253, 20153, 20049, 19942, 19830, 19715, 19596, 19474, 19349, 19221, 19090,
+  18956, 18820, 18681, 18541, 18398, 18253, 18107, 17960, 17811, 17661, 17510, 17359, 17207, 17055, 16903, 16751,
+  16599, 16448, 16298, 16148, 16000, 15853, 15707, 15563, 15420, 15279, 15141, 15005, 14871, 14739, 14610, 14484,
+  14361, 14241, 14124, 14010, 13899, 13792, 13688, 13588, 13491, 13398, 13308, 13223, 13141, 13062, 12988, 12917,
+  12851, 12788, 12728, 12673, 12621, 12573, 12529, 12488, 12450, 12416, 12386, 12359, 12334, 12313, 12295, 12280,
+  12268, 12259, 12251, 12247, 12245, 12244, 12246, 12250, 12256, 12263, 12271, 12281, 12292, 12304, 12317, 12330,
+  12344, 12358, 12372, 12387, 12401, 12415, 12429, 12442, 12454, 12465, 12475, 12485, 12492, 12498, 12503, 12506,
+  12507, 12506, 12503, 12497, 12490, 12480, 12467, 12452, 12434, 12413, 12389, 12363, 12333, 12300, 12265, 12226,
+  12184, 12138, 12090, 12038, 11983, 11925, 11864, 11799, 11731, 11660, 11586, 11509, 11429, 11345, 11259, 11170,
+  11078, 10983, 10885, 10785, 10683, 10578, 10471, 10361, 10250, 10137, 10021, 9904, 9786, 9666, 9544, 9421,
+  9298, 9173, 9047, 8921, 8794, 8667, 8540, 8412, 8285, 8157, 8030, 7904, 7778, 7653, 7528, 7405,
+  7282, 7161, 7042, 6923, 6807, 6692, 6579, 6467, 6358, 6251, 6146, 6044, 5944, 5846, 5751, 5658,
+  5568, 5481, 5397, 5315, 5237, 5161, 5088, 5018, 4951, 4887, 4826, 4767, 4712, 4660, 4610, 4564,
+  4520, 4479, 4440, 4405, 4372, 4341, 4314, 4288, 4265, 4244, 4225, 4209, 4194, 4181, 4170, 4161,
+  4153, 4147, 4142, 4138, 4135, 4133, 4132, 4132, 4132, 4133, 4134, 4136, 4137, 4138, 4139, 4140,
+  4140, 4140, 4139, 4137, 4134, 4130, 4125, 4119, 4111, 4101, 4090, 4077, 4063, 4046, 4027, 4006,
+  3983, 3958, 3930, 3900, 3867, 3832, 3794, 3754, 3711, 3665, 3616, 3565, 3511, 3454, 3394, 3331,
+  3266, 3197, 3126, 3052, 2976, 2897, 2815, 2730, 2643, 2554, 2462, 2367, 2271, 2172, 2071, 1968,
+  1863, 1756, 1647, 1536, 1424, 1311, 1196, 1080, 963, 845, 726, 606, 486, 365, 243, 122,
+  0, -122, -243, -365, -486, -606, -726, -845, -963, -1080, -1196, -1311, -1424, -1536, -1647, -1756,
+  -1863, -1968, -2071, -2172, -2271, -2367, -2462, -2554, -2643, -2730, -2815, -2897, -2976, -3052, -3126, -3197,
+  -3266, -3331, -3394, -3454, -3511, -3565, -3616, -3665, -3711, -3754, -3794, -3832, -3867, -3900, -3930, -3958,
+  -3983, -4006, -4027, -4046, -4063, -4077, -4090, -4101, -4111, -4119, -4125, -4130, -4134, -4137, -4139, -4140,
+  -4140, -4140, -4139, -4138, -4137, -4136, -4134, -4133, -4132, -4132, -4132, -4133, -4135, -4138, -4142, -4147,
+  -4153, -4161, -4170, -4181, -4194, -4209, -4225, -4244, -4265, -4288, -4314, -4341, -4372, -4405, -4440, -4479,
+  -4520, -4564, -4610, -4660, -4712, -4767, -4826, -4887, -4951, -5018, -5088, -5161, -5237, -5315, -5397, -5481,
+  -5568, -5658, -5751, -5846, -5944, -6044, -6146, -6251, -6358, -6467, -6579, -6692, -6807, -6923, -7042, -7161,
+  -7282, -7405, -7528, -7653, -7778, -7904, -8030, -8157, -8285, -8412, -8540, -8667, -8794, -8921, -9047, -9173,
+  -9298, -9421, -9544, -9666, -9786, -9904, -10021, -10137, -10250, -10361, -10471, -10578, -10683, -10785, -10885, -10983,
+  -11078, -11170, -11259, -11345, -11429, -11509, -11586, -11660, -11731, -11799, -11864, -11925, -11983, -12038, -12090, -12138,
+  -12184, -12226, -12265, -12300, -12333, -12363, -12389, -12413, -12434, -12452, -12467, -12480, -12490, -12497, -12503, -12506,
+  -12507, -12506, -12503, -12498, -12492, -12485, -12475, -12465, -12454, -12442, -12429, -12415, -12401, -12387, -12372, -12358,
+  -12344, -12330, -12317, -12304, -12292, -12281, -12271, -12263, -12256, -12250, -12246, -12244, -12245, -12247, -12251, -12259,
+  -12268, -12280, -12295, -12313, -12334, -12359, -12386, -12416, -12450, -12488, -12529, -12573, -12621, -12673, -12728, -12788,
+  -12851, -12917, -12988, -13062, -13141, -13223, -13308, -13398, -13491, -13588, -13688, -13792, -13899, -14010, -14124, -14241,
+  -14361, -14484, -14610, -14739, -14871, -15005, -15141, -15279, -15420, -15563, -15707, -15853, -16000, -16148, -16298, -16448,
+  -16599, -16751, -16903, -17055, -17207, -17359, -17510, -17661, -17811, -17960, -18107, -18253, -18398, -18541, -18681, -18820,
+  -18956, -19090, -19221, -19349, -19474, -19596, -19715, -19830, -19942, -20049, -20153, -20253, -20349, -20440, -20527, -20610,
+  -20688, -20762, -20831, -20895, -20954, -21009, -21059, -21104, -21144, -21179, -21209, -21235, -21256, -21272, -21284, -21290,
+  -21293, -21290, -21284, -21273, -21258, -21239, -21216, -21189, -21159, -21125, -21088, -21047, -21004, -20958, -20910, -20859,
+  -20806, -20751, -20694, -20636, -20577, -20517, -20456, -20394, -20333, -20271, -20210, -20149, -20089, -20030, -19972, -19917,
+  -19863, -19811, -19761, -19714, -19670, -19630, -19593, -19559, -19529, -19504, -19483, -19467, -19455, -19449, -19447, -19452,
+  -19462, -19478, -19500, -19528, -19562, -19603, -19651, -19705, -19766, -19834, -19909, -19991, -20080, -20177, -20281, -20391,
+  -20510, -20635, -20767, -20907, -21054, -21208, -21368, -21536, -21710, -21891, -22078, -22271, -22471, -22676, -22887, -23104,
+  -23325, -23552, -23783, -24019, -24259, -24503, -24750, -25000, -25253, -25509, -25766, -26026, -26286, -26548, -26810, -27072,
+  -27334, -27595, -27855, -28113, -28369, -28623, -28873, -29120, -29363, -29602, -29835, -30063, -30286, -30501, -30710, -30912,
+  -31106, -31291, -31468, -31635, -31793, -31940, -32077, -32203, -32317, -32419, -32509, -32587, -32651, -32701, -32737, -32760,
+  -32767, -32759, -32737, -32698, -32643, -32573, -32485, -32381, -32260, -32122, -31966, -31793, -31602, -31393, -31166, -30921,
+  -30658, -30377, -30077, -29759, -29422, -29067, -28694, -28303, -27894, -27467, -27021, -26558, -26078, -25580, -25064, -24532,
+  -23983, -23418, -22836, -22239, -21626, -20998, -20355, -19698, -19027, -18342, -17644, -16933, -16209, -15475, -14728, -13971,
+  -13204, -12427, -11641, -10846, -10043, -9233, -8416, -7592, -6763, -5929, -5090, -4248, -3402, -2554, -1704, -852,
+  // level 1
+  0, 1704, 3402, 5090, 6763, 8416, 10043, 11641, 13204, 14728, 16209, 17644, 19027, 20355, 21626, 22836,
+  23983, 25064, 26078, 27021, 27894, 28694, 29422, 30077, 30658, 31166, 31602, 31966, 32260, 32485, 32643, 32737,
+  32767, 32737, 32651, 32509, 32317, 32077, 31793, 31468, 31106, 30710, 30286, 29835, 29363, 28873, 28369, 27855,
+  27334, 26810, 26286, 25766, 25253, 24750, 24259, 23783, 23325, 22887, 22471, 22078, 21710, 21368, 21054, 20767,
+  20510, 20281, 20080, 19909, 19766, 19651, 19562, 19500, 19462, 19447, 19455, 19483, 19529, 19593, 19670, 19761,
+  19863, 19972, 20089, 20210, 20333, 20456, 20577, 20694, 20806, 20910, 21004, 21088, 21159, 21216, 21258, 21284,
+  21293, 21284, 21256, 21209, 21144, 21059, 20954, 20831, 20688, 20527, 20349, 20153, 19942, 19715, 19474, 19221,
+  18956, 18681, 18398, 18107, 17811, 17510, 17207, 16903, 16599, 16298, 16000, 15707, 15420, 15141, 14871, 14610,
+  14361, 14124, 13899, 13688, 13491, 13308, 13141, 12988, 12851, 12728, 12621, 12529, 12450, 12386, 12334, 12295,
+  12268, 12251, 12245, 12246, 12256, 12271, 12292, 12317, 12344, 12372, 12401, 12429, 12454, 12475, 12492, 12503,
+  12507, 12503, 12490, 12467, 12434, 12389, 12333, 12265, 12184, 12090, 11983, 11864, 11731, 11586, 11429, 11259,
+  11078, 10885, 10683, 10471, 10250, 10021, 9786, 9544, 9298, 9047, 8794, 8540, 8285, 8030, 7778, 7528,
+  7282, 7042, 6807, 6579, 6358, 6146, 5944, 5751, 5568, 5397, 5237, 5088, 4951, 4826, 4712, 4610,
+  4520, 4440, 4372, 4314, 4265, 4225, 4194, 4170, 4153, 4142, 4135, 4132, 4132, 4134, 4137, 4139,
+  4140, 4139, 4134, 4125, 4111, 4090, 4063, 4027, 3983, 3930, 3867, 3794, 3711, 3616, 3511, 3394,
+  3266, 3126, 2976, 2815, 2643, 2462, 2271, 2071, 1863, 1647, 1424, 1196, 963, 726, 486, 243,
+  0, -243, -486, -726, -963, -1196, -1424, -1647, -1863, -2071, -2271, -2462, -2643, -2815, -2976, -3126,
+  -3266, -3394, -3511, -3616, -3711, -3794, -3867, -3930, -3983, -4027, -4063, -4090, -4111, -4125, -4134, -4139,
+  -4140, -4139, -4137, -4134, -4132, -4132, -4135, -4142, -4153, -4170, -4194, -4225, -4265, -4314, -4372, -4440,
+  -4520, -4610, -4712, -4826, -4951, -5088, -5237, -5397, -5568, -5751, -5944, -6146, -6358, -6579, -6807, -7042,
+  -7282, -7528, -7778, -8030, -8285, -8540, -8794, -9047, -9298, -9544, -9786, -10021, -10250, -10471, -10683, -10885,
+  -11078, -11259, -11429, -11586, -11731, -11864, -11983, -12090, -12184, -12265, -12333, -12389, -12434, -12467, -12490, -12503,
+  -12507, -12503, -12492, -12475, -12454, -12429, -12401, -12372, -12344, -12317, -12292, -12271, -12256, -12246, -12245, -12251,
+  -12268, -12295, -12334, -12386, -12450, -12529, -12621, -12728, -12851, -12988, -13141, -13308, -13491, -13688, -13899, -14124,
+  -14361, -14610, -14871, -15141, -15420, -15707, -16000, -16298, -16599, -16903, -17207, -17510, -17811, -18107, -18398, -18681,
+  -18956, -19221, -19474, -19715, -19942, -20153, -20349, -20527, -20688, -20831, -20954, -21059, -21144, -21209, -21256, -21284,
+  -21293, -21284, -21258, -21216, -21159, -21088, -21004, -20910, -20806, -20694, -20577, -20456, -20333, -20210, -20089, -19972,
+  -19863, -19761, -19670, -19593, -19529, -19483, -19455, -19447, -19462, -19500, -19562, -19651, -19766, -19909, -20080, -20281,
+  -20510, -20767, -21054, -21368, -21710, -22078, -22471, -22887, -23325, -23783, -24259, -24750, -25253, -25766, -26286, -26810,
+  -27334, -27855, -28369, -28873, -29363, -29835, -30286, -30710, -31106, -31468, -31793, -32077, -32317, -32509, -32651, -32737,
+  -32767, -32737, -32643, -32485, -32260, -31966, -31602, -31166, -30658, -30077, -29422, -28694, -27894, -27021, -26078, -25064,
+  -23983, -22836, -21626, -20355, -19027, -17644, -16209, -14728, -13204, -11641, -10043, -8416, -6763, -5090, -3402, -1704,
+  // level 2
+  0, 3402, 6763, 10043, 13204, 16209, 19027, 21626, 23983, 26078, 27894, 29422, 30658, 31602, 32260, 32643,
+  32767, 32651, 32317, 31793, 31106, 30286, 29363, 28369, 27334, 26286, 25253, 24259, 23325, 22471, 21710, 21054,
+  20510, 20080, 19766, 19562, 19462, 19455, 19529, 19670, 19863, 20089, 20333, 20577, 20806, 21004, 21159, 21258,
+  21293, 21256, 21144, 20954, 20688, 20349, 19942, 19474, 18956, 18398, 17811, 17207, 16599, 16000, 15420, 14871,
+  14361, 13899, 13491, 13141, 12851, 12621, 12450, 12334, 12268, 12245, 12256, 12292, 12344, 12401, 12454, 12492,
+  12507, 12490, 12434, 12333, 12184, 11983, 11731, 11429, 11078, 10683, 10250, 9786, 9298, 8794, 8285, 7778,
+  7282, 6807, 6358, 5944, 5568, 5237, 4951, 4712, 4520, 4372, 4265, 4194, 4153, 4135, 4132, 4137,
+  4140, 4134, 4111, 4063, 3983, 3867, 3711, 3511, 3266, 2976, 2643, 2271, 1863, 1424, 963, 486,
+  0, -486, -963, -1424, -1863, -2271, -2643, -2976, -3266, -3511, -3711, -3867, -3983, -4063, -4111, -4134,
+  -4140, -4137, -4132, -4135, -4153, -4194, -4265, -4372, -4520, -4712, -4951, -5237, -5568, -5944, -6358, -6807,
+  -7282, -7778, -8285, -8794, -9298, -9786, -10250, -10683, -11078, -11429, -11731, -11983, -12184, -12333, -12434, -12490,
+  -12507, -12492, -12454, -12401, -12344, -12292, -12256, -12245, -12268, -12334, -12450, -12621, -12851, -13141, -13491, -13899,
+  -14361, -14871, -15420, -16000, -16599, -17207, -17811, -18398, -18956, -19474, -19942, -20349, -20688, -20954, -21144, -21256,
+  -21293, -21258, -21159, -21004, -20806, -20577, -20333, -20089, -19863, -19670, -19529, -19455, -19462, -19562, -19766, -20080,
+  -20510, -21054, -21710, -22471, -23325, -24259, -25253, -26286, -27334, -28369, -29363, -30286, -31106, -31793, -32317, -32651,
+  -32767, -32643, -32260, -31602, -30658, -29422, -27894, -26078, -23983, -21626, -19027, -16209, -13204, -10043, -6763, -3402,
+  // level 3
+  0, 3884, 7698, 11374, 14849, 18063, 20966, 23515, 25678, 27432, 28766, 29679, 30182, 30295, 30048, 29477,
+  28627, 27546, 26286, 24902, 23445, 21967, 20516, 19133, 17854, 16709, 15720, 14898, 14250, 13771, 13454, 13280,
+  13227, 13270, 13379, 13523, 13672, 13794, 13862, 13852, 13745, 13525, 13184, 12718, 12129, 11427, 10623, 9736,
+  8786, 7796, 6792, 5797, 4837, 3933, 3104, 2365, 1728, 1199, 778, 462, 241, 103, 31, 4,
+  0, -4, -31, -103, -241, -462, -778, -1199, -1728, -2365, -3104, -3933, -4837, -5797, -6792, -7796,
+  -8786, -9736, -10623, -11427, -12129, -12718, -13184, -13525, -13745, -13852, -13862, -13794, -13672, -13523, -13379, -13270,
+  -13227, -13280, -13454, -13771, -14250, -14898, -15720, -16709, -17854, -19133, -20516, -21967, -23445, -24902, -26286, -27546,
+  -28627, -29477, -30048, -30295, -30182, -29679, -28766, -27432, -25678, -23515, -20966, -18063, -14849, -11374, -7698, -3884,
+  // level 4
+  0, 3880, 7667, 11271, 14608, 17601, 20188, 22317, 23950, 25067, 25662, 25747, 25345, 24498, 23256, 21681,
+  19841, 17810, 15663, 13475, 11316, 9250, 7332, 5607, 4109, 2857, 1858, 1104, 578, 248, 74, 9,
+  0, -9, -74, -248, -578, -1104, -1858, -2857, -4109, -5607, -7332, -9250, -11316, -13475, -15663, -17810,
+  -19841, -21681, -23256, -24498, -25345, -25747, -25662, -25067, -23950, -22317, -20188, -17601, -14608, -11271, -7667, -3880,
+  // level 5
+  0, 3871, 7593, 11023, 14030, 16497, 18331, 19460, 19841, 19460, 18331, 16497, 14030, 11023, 7593, 3871,
+  0, -3871, -7593, -11023, -14030, -16497, -18331, -19460, -19841, -19460, -18331, -16497, -14030, -11023, -7593, -3871,
+},
+// shape 4
+{
+  // level 0
+  0, 1286, 2570, 3849, 5122, 6386, 7639, 8879, 10103, 11311, 12499, 13666, 14810, 15929, 17021, 18085,
+  19119, 20122, 21093, 22029, 22930, 23794, 24622, 25411, 26161, 26872, 27542, 28172, 28760, 29307, 29813, 30278,
+  30701, 31083, 31425, 31726, 31987, 32209, 32393, 32539, 32649, 32722, 32761, 32767, 32740, 32682, 32595, 32479,
+  32337, 32169, 31978, 31764, 31530, 31277, 31007, 30721, 30421, 30109, 29787, 29455, 29116, 28771, 28423, 28071,
+  27719, 27367, 27017, 26670, 26327, 25991, 25661, 25339, 25027, 24725, 24433, 24154, 23888, 23635, 23396, 23171,
+  22962, 22768, 22589, 22427, 22280, 22150, 22036, 21937, 21855, 21788, 21736, 21700, 21678, 21670, 21675, 21693,
+  21724, 21766, 21819, 21882, 21955, 22035, 22124, 22219, 22320, 22426, 22536, 22650, 22765, 22882, 23000, 23117,
+  23233, 23346, 23457, 23564, 23667, 23764, 23856, 23941, 24019, 24090, 24152, 24206, 24250, 24286, 24311, 24326,
+  24332, 24326, 24311, 24284, 24247, 24200, 24142, 24074, 23996, 23908, 23810, 23704, 23588, 23464, 23331, 23191,
+  23044, 22891, 22731, 22566, 22397, 22223, 22045, 21865, 21682, 21497, 21312, 21126, 20940, 20755, 20571, 20390,
+  20211, 20036, 19864, 19697, 19534, 19377, 19225, 19079, 18940, 18807, 18682, 18564, 18453, 18350, 18255, 18168,
+  18089, 18017, 17954, 17899, 17852, 17812, 17780, 17755, 17738, 17727, 17722, 17724, 17732, 17745, 17764, 17787,
+  17814, 17844, 17879, 17915, 17954, 17995, 18037, 18080, 18123, 18166, 18208, 18249, 18288, 18325, 18359, 18390,
+  18418, 18442, 18461, 18476, 18486, 18490, 18489, 18483, 18470, 18451, 18426, 18394, 18356, 18312, 18260, 18203,
+  18138, 18068, 17991, 17907, 17818, 17723, 17622, 17516, 17405, 17289, 17169, 17045, 16916, 16785, 16650, 16513,
+  16373, 16232, 16089, 15946, 15802, 15657, 15513, 15370, 15228, 15088, 14950, 14814, 14680, 14550, 14423, 14300,
+  14181, 14066, 13956, 13851, 13750, 13655, 13565, 13481, 13402, 13328, 13261, 13199, 13142, 13091, 13046, 13006,
+  12972, 12942, 12918, 12899, 12884, 12873, 12866, 12864, 12864, 12868, 12875, 12885, 12896, 12909, 12924, 12940,
+  12957, 12974, 12990, 13007, 13023, 13037, 13050, 13061, 13070, 13077, 13080, 13081, 13078, 13071, 13061, 13047,
+  13028, 13004, 12976, 12944, 12906, 12864, 12816, 12763, 12706, 12643, 12575, 12502, 12425, 12343, 12256, 12165,
+  12069, 11970, 11866, 11759, 11649, 11536, 11420, 11301, 11180, 11058, 10933, 10808, 10682, 10555, 10428, 10301,
+  10175, 10050, 9925, 9803, 9682, 9563, 9446, 9332, 9221, 9114, 9009, 8909, 8812, 8719, 8630, 8546,
+  8466, 8390, 8320, 8253, 8192, 8135, 8082, 8035, 7991, 7953, 7918, 7888, 7861, 7839, 7820, 7805,
+  7793, 7784, 7777, 7773, 7772, 7772, 7774, 7777, 7781, 7786, 7791, 7796, 7801, 7806, 7809, 7812,
+  7813, 7812, 7809, 7803, 7795, 7785, 7771, 7754, 7733, 7709, 7681, 7649, 7613, 7572, 7528, 7479,
+  7426, 7368, 7306, 7240, 7169, 7094, 7015, 6932, 6845, 6755, 6660, 6563, 6462, 6358, 6251, 6142,
+  6031, 5918, 5803, 5686, 5569, 5450, 5331, 5212, 5093, 4974, 4856, 4739, 4623, 4509, 4396, 4286,
+  4178, 4072, 3969, 3870, 3773, 3680, 3590, 3504, 3422, 3344, 3270, 3201, 3135, 3073, 3016, 2963,
+  2914, 2869, 2828, 2792, 2759, 2729, 2704, 2681, 2662, 2646, 2633, 2622, 2614, 2608, 2603, 2600,
+  2599, 2598, 2598, 2598, 2599, 2599, 2599, 2598, 2596, 2593, 2588, 2581, 2573, 2561, 2548, 2531,
+  2511, 2489, 2462, 2433, 2399, 2362, 2321, 2276, 2226, 2173, 2115, 2054, 1988, 1918, 1844, 1767,
+  1685, 1600, 1511, 1418, 1323, 1224, 1122, 1018, 911, 802, 691, 579, 465, 350, 234, 117,
+  0, -117, -234, -350, -465, -579, -691, -802, -911, -1018, -1122, -1224, -1323, -1418, -1511, -1600,
+  -1685, -1767, -1844, -1918, -1988, -2054, -2115, -2173, -2226, -2276, -2321, -2362, -2399, -2433, -2462, -2489,
+  -2511, -2531, -2548, -2561, -2573, -2581, -2588, -2593, -2596, -2598, -2599, -2599, -2599, -2598, -2598, -2598,
+  -2599, -2600, -2603, -2608, -2614, -2622, -2633, -2646, -2662, -2681, -2704, -2729, -2759, -2792, -2828, -2869,
+  -2914, -2963, -3016, -3073, -3135, -3201, -3270, -3344, -3422, -3504, -3590, -3680, -3773, -3870, -3969, -4072,
+  -4178, -4286, -4396, -4509, -4623, -4739, -4856, -4974, -5093, -5212, -5331, -5450, -5569, -5686, -5803, -5918,
+  -6031, -6142, -6251, -6358, -6462, -6563, -6660, -6755, -6845, -6932, -7015, -7094, -7169, -7240, -7306, -7368,
+  -7426, -7479, -7528, -7572, -7613, -7649, -7681, -7709, -7733, -7754, -7771, -7785, -7795, -7803, -7809, -7812,
+  -7813, -7812, -7809, -7806, -7801, -7796, -7791, -7786, -7781, -7777, -7774, -7772, -7772, -7773, -7777, -7784,
+  -7793, -7805, -7820, -7839, -7861, -7888, -7918, -7953, -7991, -8035, -8082, -8135, -8192, -8253, -8320, -8390,
+  -8466, -8546, -8630, -8719, -8812, -8909, -9009, -9114, -9221, -9332, -9446, -9563, -9682, -9803, -9925, -10050,
+  -10175, -10301, -10428, -10555, -10682, -10808, -10933, -11058, -11180, -11301, -11420, -11536, -11649, -11759, -11866, -11970,
+  -12069, -12165, -12256, -12343, -12425, -12502, -12575, -12643, -12706, -12763, -12816, -12864, -12906, -12944, -12976, -13004,
+  -13028, -13047, -13061, -13071, -13078, -13081, -13080, -13077, -13070, -13061, -13050, -13037, -13023, -13007, -12990, -12974,
+  -12957, -12940, -12924, -12909, -12896, -12885, -12875, -12868, -12864, -12864, -12866, -12873, -12884, -12899, -12918, -12942,
+  -12972, -13006, -13046, -13091, -13142, -13199, -13261, -13328, -13402, -13481, -13565, -13655, -13750, -13851, -13956, -14066,
+  -14181, -14300, -14423, -14550, -14680, -14814, -14950, -15088, -15228, -15370, -15513, -15657, -15802, -15946, -16089, -16232,
+  -16373, -16513, -16650, -16785, -16916, -17045, -17169, -17289, -17405, -17516, -17622, -17723, -17818, -17907, -17991, -18068,
+  -18138, -18203, -18260, -18312, -18356, -18394, -18426, -18451, -18470, -18483, -18489, -18490, -18486, -18476, -18461, -18442,
+  -18418, -18390, -18359, -18325, -18288, -18249, -18208, -18166, -18123, -18080, -18037, -17995, -17954, -17915, -17879, -17844,
+  -17814, -17787, -17764, -17745, -17732, -17724, -17722, -17727, -17738, -17755, -17780, -17812, -17852, -17899, -17954, -18017,
+  -18089, -18168, -18255, -18350, -18453, -18564, -18682, -18807, -18940, -19079, -19225, -19377, -19534, -19697, -19864, -20036,
+  -20211, -20390, -20571, -20755, -20940, -21126, -21312, -21497, -21682, -21865, -22045, -22223, -22397, -22566, -22731, -22891,
+  -23044, -23191, -23331, -23464, -23588, -23704, -23810, -23908, -23996, -24074, -24142, -24200, -24247, -24284, -24311, -24326,
+  -24332, -24326, -24311, -24286, -24250, -24206, -24152, -24090, -24019, -23941, -23856, -23764, -23667, -23564, -23457, -23346,
+  -23233, -23117, -23000, -22882, -22765, -22650, -22536, -22426, -22320, -22219, -22124, -22035, -21955, -21882, -21819, -21766,
+  -21724, -21693, -21675, -21670, -21678, -21700, -21736, -21788, -21855, -21937, -22036, -22150, -22280, -22427, -22589, -22768,
+  -22962, -23171, -23396, -23635, -23888, -24154, -24433, -24725, -25027, -25339, -25661, -25991, -26327, -26670, -27017, -27367,
+  -27719, -28071, -28423, -28771, -29116, -29455, -29787, -30109, -30421, -30721, -31007, -31277, -31530, -31764, -31978, -32169,
+  -32337, -32479, -32595, -32682, -32740, -32767, -32761, -32722, -32649, -32539, -32393, -32209, -31987, -31726, -31425, -31083,
+  -30701, -30278, -29813, -29307, -28760, -28172, -27542, -26872, -26161, -25411, -24622, -23794, -22930, -22029, -21093, -20122,
+  -19119, -18085, -17021, -15929, -14810, -13666, -12499, -11311, -10103, -8879, -7639, -6386, -5122, -3849, -2570, -1286,
+  // level 1
+  0, 2570, 5122, 7639, 10103, 12499, 14810, 17021, 19119, 21093, 22930, 24622, 26161, 27542, 28760, 29813,
+  30701, 31425, 31987, 32393, 32649, 32761, 32740, 32595, 32337, 31978, 31530, 31007, 30421, 29787, 29116, 28423,
+  27719, 27017, 26327, 25661, 25027, 24433, 23888, 23396, 22962, 22589, 22280, 22036, 21855, 21736, 21678, 21675,
+  21724, 21819, 21955, 22124, 22320, 22536, 22765, 23000, 23233, 23457, 23667, 23856, 24019, 24152, 24250, 24311,
+  24332, 24311, 24247, 24142, 23996, 23810, 23588, 23331, 23044, 22731, 22397, 22045, 21682, 21312, 20940, 20571,
+  20211, 19864, 19534, 19225, 18940, 18682, 18453, 18255, 18089, 17954, 17852, 17780, 17738, 17722, 17732, 17764,
+  17814, 17879, 17954, 18037, 18123, 18208, 18288, 18359, 18418, 18461, 18486, 18489, 18470, 18426, 18356, 18260,
+  18138, 17991, 17818, 17622, 17405, 17169, 16916, 16650, 16373, 16089, 15802, 15513, 15228, 14950, 14680, 14423,
+  14181, 13956, 13750, 13565, 13402, 13261, 13142, 13046, 12972, 12918, 12884, 12866, 12864, 12875, 12896, 12924,
+  12957, 12990, 13023, 13050, 13070, 13080, 13078, 13061, 13028, 12976, 12906, 12816, 12706, 12575, 12425, 12256,
+  12069, 11866, 11649, 11420, 11180, 10933, 10682, 10428, 10175, 9925, 9682, 9446, 9221, 9009, 8812, 8630,
+  8466, 8320, 8192, 8082, 7991, 7918, 7861, 7820, 7793, 7777, 7772, 7774, 7781, 7791, 7801, 7809,
+  7813, 7809, 7795, 7771, 7733, 7681, 7613, 7528, 7426, 7306, 7169, 7015, 6845, 6660, 6462, 6251,
+  6031, 5803, 5569, 5331, 5093, 4856, 4623, 4396, 4178, 3969, 3773, 3590, 3422, 3270, 3135, 3016,
+  2914, 2828, 2759, 2704, 2662, 2633, 2614, 2603, 2599, 2598, 2599, 2599, 2596, 2588, 2573, 2548,
+  2511, 2462, 2399, 2321, 2226, 2115, 1988, 1844, 1685, 1511, 1323, 1122, 911, 691, 465, 234,
+  0, -234, -465, -691, -911, -1122, -1323, -1511, -1685, -1844, -1988, -2115, -2226, -2321, -2399, -2462,
+  -2511, -2548, -2573, -2588, -2596, -2599, -2599, -2598, -2599, -2603, -2614, -2633, -2662, -2704, -2759, -2828,
+  -2914, -3016, -3135, -3270, -3422, -3590, -3773, -3969, -4178, -4396, -4623, -4856, -5093, -5331, -5569, -5803,
+  -6031, -6251, -6462, -6660, -6845, -7015, -7169, -7306, -7426, -7528, -7613, -7681, -7733, -7771, -7795, -7809,
+  -7813, -7809, -7801, -7791, -7781, -7774, -7772, -7777, -7793, -7820, -7861, -7918, -7991, -8082, -8192, -8320,
+  -8466, -8630, -8812, -9009, -9221, -9446, -9682, -9925, -10175, -10428, -10682, -10933, -11180, -11420, -11649, -11866,
+  -12069, -12256, -12425, -12575, -12706, -12816, -12906, -12976, -13028, -13061, -13078, -13080, -13070, -13050, -13023, -12990,
+  -12957, -12924, -12896, -12875, -12864, -12866, -12884, -12918, -12972, -13046, -13142, -13261, -13402, -13565, -13750, -13956,
+  -14181, -14423, -14680, -14950, -15228, -15513, -15802, -16089, -16373, -16650, -16916, -17169, -17405, -17622, -17818, -17991,
+  -18138, -18260, -18356, -18426, -18470, -18489, -18486, -18461, -18418, -18359, -18288, -18208, -18123, -18037, -17954, -17879,
+  -17814, -17764, -17732, -17722, -17738, -17780, -17852, -17954, -18089, -18255, -18453, -18682, -18940, -19225, -19534, -19864,
+  -20211, -20571, -20940, -21312, -21682, -22045, -22397, -22731, -23044, -23331, -23588, -23810, -23996, -24142, -24247, -24311,
+  -24332, -24311, -24250, -24152, -24019, -23856, -23667, -23457, -23233, -23000, -22765, -22536, -22320, -22124, -21955, -21819,
+  -21724, -21675, -21678, -21736, -21855, -22036, -22280, -22589, -22962, -23396, -23888, -24433, -25027, -25661, -26327, -27017,
+  -27719, -28423, -29116, -29787, -30421, -31007, -31530, -31978, -32337, -32595, -32740, -32761, -32649, -32393, -31987, -31425,
+  -30701, -29813, -28760, -27542, -26161, -24622, -22930, -21093, -19119, -17021, -14810, -12499, -10103, -7639, -5122, -2570,
+  // level 2
+  0, 3733, 7409, 10972, 14369, 17553, 20479, 23112, 25422, 27388, 28998, 30246, 31137, 31683, 31903, 31824,
+  31478, 30901, 30134, 29218, 28197, 27113, 26007, 24917, 23876, 22916, 22059, 21324, 20723, 20263, 19944, 19761,
+  19703, 19755, 19900, 20116, 20381, 20671, 20962, 21233, 21464, 21635, 21734, 21748, 21672, 21501, 21238, 20886,
+  20455, 19955, 19400, 18806, 18189, 17567, 16956, 16372, 15828, 15337, 14909, 14549, 14262, 14047, 13902, 13821,
+  13796, 13817, 13872, 13947, 14030, 14106, 14162, 14186, 14168, 14100, 13975, 13789, 13543, 13237, 12876, 12466,
+  12015, 11534, 11033, 10524, 10020, 9531, 9069, 8642, 8259, 7926, 7646, 7420, 7247, 7125, 7047, 7007,
+  6996, 7004, 7020, 7033, 7034, 7012, 6957, 6863, 6724, 6537, 6298, 6010, 5674, 5296, 4882, 4439,
+  3978, 3507, 3037, 2579, 2142, 1734, 1364, 1036, 755, 522, 338, 200, 105, 45, 13, 2,
+  0, -2, -13, -45, -105, -200, -338, -522, -755, -1036, -1364, -1734, -2142, -2579, -3037, -3507,
+  -3978, -4439, -4882, -5296, -5674, -6010, -6298, -6537, -6724, -6863, -6957, -7012, -7034, -7033, -7020, -7004,
+  -6996, -7007, -7047, -7125, -7247, -7420, -7646, -7926, -8259, -8642, -9069, -9531, -10020, -10524, -11033, -11534,
+  -12015, -12466, -12876, -13237, -13543, -13789, -13975, -14100, -14168, -14186, -14162, -14106, -14030, -13947, -13872, -13817,
+  -13796, -13821, -13902, -14047, -14262, -14549, -14909, -15337, -15828, -16372, -16956, -17567, -18189, -18806, -19400, -19955,
+  -20455, -20886, -21238, -21501, -21672, -21748, -21734, -21635, -21464, -21233, -20962, -20671, -20381, -20116, -19900, -19755,
+  -19703, -19761, -19944, -20263, -20723, -21324, -22059, -22916, -23876, -24917, -26007, -27113, -28197, -29218, -30134, -30901,
+  -31478, -31824, -31903, -31683, -31137, -30246, -28998, -27388, -25422, -23112, -20479, -17553, -14369, -10972, -7409, -3733,
+  // level 3
+  0, 3731, 7395, 10927, 14265, 17352, 20141, 22590, 24668, 26353, 27634, 28512, 28995, 29103, 28865, 28317,
+  27500, 26462, 25252, 23922, 22523, 21103, 19709, 18380, 17152, 16052, 15101, 14312, 13689, 13230, 12924, 12757,
+  12707, 12748, 12853, 12991, 13134, 13251, 13317, 13307, 13204, 12993, 12665, 12217, 11652, 10977, 10205, 9353,
+  8440, 7489, 6524, 5569, 4647, 3778, 2981, 2272, 1660, 1151, 747, 443, 232, 99, 30, 4,
+  0, -4, -30, -99, -232, -443, -747, -1151, -1660, -2272, -2981, -3778, -4647, -5569, -6524, -7489,
+  -8440, -9353, -10205, -10977, -11652, -12217, -12665, -12993, -13204, -13307, -13317, -13251, -13134, -12991, -12853, -12748,
+  -12707, -12757, -12924, -13230, -13689, -14312, -15101, -16052, -17152, -18380, -19709, -21103, -22523, -23922, -25252, -26462,
+  -27500, -28317, -28865, -29103, -28995, -28512, -27634, -26353, -24668, -22590, -20141, -17352, -14265, -10927, -7395, -3731,
+  // level 4
+  0, 3727, 7366, 10828, 14033, 16909, 19394, 21439, 23008, 24081, 24653, 24734, 24348, 23534, 22341, 20828,
+  19060, 17109, 15047, 12945, 10871, 8886, 7043, 5387, 3948, 2745, 1785, 1061, 555, 238, 71, 9,
+  0, -9, -71, -238, -555, -1061, -1785, -2745, -3948, -5387, -7043, -8886, -10871, -12945, -15047, -17109,
+  -19060, -20828, -22341, -23534, -24348, -24734, -24653, -24081, -23008, -21439, -19394, -16909, -14033, -10828, -7366, -3727,
+  // level 5
+  0, 3718, 7294, 10589, 13478, 15848, 17609, 18694, 19060, 18694, 17609, 15848, 13478, 10589, 7294, 3718,
+  0, -3718, -7294, -10589, -13478, -15848, -17609, -18694, -19060, -18694, -17609, -15848, -13478, -10589, -7294, -3718,
+},
@@ -0,0 +1,444 @@
+/* lines.c
+   aleph-audio
+
+   multichannel, routable delay lines + filters.
+   suitable for echoes, loopers, etc
+
+   block-processing version.
+   same parameters as modules/lines, with these differences:
+   - delay -> delay feedback is taken from the previous block,
+     which adds MODULE_BLOCKSIZE frames to that feedback path.
+   - param slews are stepped once per block;
+     filter cutoff / rq are applied once per block,
+     and dry / wet levels are ramped linearly across it.
+   - no cv output (the block runtime has no cv driver yet).
+*/
+
+// std
+#include <string.h>
+
+// aleph-common
+#include "fix.h"
+#include "types.h"
+
+// bfin
+#include "fract_math.h"
+
+// audio
+#include "buffer.h"
+#include "filter_svf.h"
+#include "filter_1p.h"
+#include "filter_ramp.h"
+#include "slew_bank.h"
+
+#include "delayFadeN.h"
+#ifdef ARCH_BFIN
+#include "mdma.h"
+#endif
+#include "module.h"
+/// lines
+#include "params.h"
+
+//-----------------------
+//------ static variables
+
+// total SDRAM is 64M
+// each line 4 * FR16_MAX * 48 samples
+// = 0x5FFF40 ... because:
+// time idx is 48 samples (1ms)
+// time param is 16 bit
+// max time multipler is 4.0
+#define LINES_BUF_FRAMES 0x5FFF40
+
+#define NLINES 2
+
+// data structure of external memory
+typedef struct _linesData {
+  ModuleData super;
+  ParamData mParamData[eParamNumParams];
+  volatile fract32 audioBuffer[NLINES][LINES_BUF_FRAMES];
+} linesData;
+
+MODULE_SDRAM(linesData);
+
+//-------------------------
+//----- extern vars (initialized here)
+ModuleData* gModuleData;
+
+//-----------------------
+//------ static variables
+
+// pointer to all external memory
+linesData* pLinesData;
+
+// delay lines (each has buffer descriptor and read/write taps)
+delayFadeN lines[NLINES];
+
+#ifdef ARCH_BFIN
+// delay taps are staged in L1 by memory DMA
+static bufferStageCopier mdmaCopier = { &mdma_copy, &mdma_wait, 0, 0 };
+#endif
+
+// state variable filters
+filter_svf svf[NLINES];
+
+//---- mix points
+// each input -> one delay
+fract16 mix_adc_del[4][2] = { {0, 0}, {0, 0}, {0, 0}, {0, 0} };
+// each delay -> each delay
+fract32 mix_del_del[2][2] = { { 0, 0 }, { 0, 0 } };
+// each input -> each output
+fract16 mix_adc_dac[4][4] = { { 0, 0, 0, 0 },
+			      { 0, 0, 0, 0 },
+			      { 0, 0, 0, 0 },
+			      { 0, 0, 0, 0 } };
+// each delay -> each dac
+fract16 mix_del_dac[2][4] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+
+//-- parameter integrators
+slewBank paramSlews;
+// smoothed svf params
+fract32 svfCut[NLINES];
+fract32 svfRq[NLINES];
+// smoothed svf balance
+fract32 mix_fwet[NLINES];
+fract32 mix_fdry[NLINES];
+// balance at the end of the previous block
+static fract32 lastWet[NLINES];
+static fract32 lastDry[NLINES];
+// indices in paramSlews
+u8 svfCutSlew[NLINES];
+u8 svfRqSlew[NLINES];
+u8 drySlew[NLINES];
+u8 wetSlew[NLINES];
+#if NLINES * 4 > SLEW_BANK_MAX
+#error "param slews don't fit in one slew bank"
+#endif
+
+//--- crossfade stuff
+/// which tap we are fading towards...
+u8 fadeTargetRd[2] = { 0, 0 };
+
+// crossfade integrators
+filter_ramp lpFadeRd[2];
+
+// cv params are kept so param_set.c is shared with the frame module,
+// but nothing drives the cv dac in the block runtime.
+filter_1p_lo cvSlew[4];
+
+//---- per-block busses
+// truncated inputs
+static fract16 in16[4][MODULE_BLOCKSIZE];
+// delay inputs
+static fract32 in_del[NLINES][MODULE_BLOCKSIZE];
+// delay outputs (after filter mix), kept for feedback into the next block
+static fract32 out_del[NLINES][MODULE_BLOCKSIZE];
+// raw delay output
+static fract32 tmpDel[MODULE_BLOCKSIZE];
+// filter output
+static fract32 tmpSvf[MODULE_BLOCKSIZE];
+// read crossfade position
+static fract32 fadeBuf[MODULE_BLOCKSIZE];
+// dry / wet levels
+static fract32 dryBuf[MODULE_BLOCKSIZE];
+static fract32 wetBuf[MODULE_BLOCKSIZE];
+
+// initial param set
+static inline void param_setup(u32 id, ParamValue v) {
+  gModuleData->paramData[id].value = v;
+  module_set_param(id, v);
+}
+
+// linear ramp over a block, from the last value (exclusive) to the next
+static void ramp_block(fract32* dst, fract32* last, fract32 next) {
+  const fract32 step = sub_fr1x32(next, *last) / MODULE_BLOCKSIZE;
+  fract32 y = *last;
+  u16 k;
+  for(k=0; k < MODULE_BLOCKSIZE - 1; k++) {
+    y = add_fr1x32(y, step);
+    dst[k] = y;
+  }
+  dst[MODULE_BLOCKSIZE - 1] = next;
+  *last = next;
+}
+
+static void truncate_ins(buffer_t *inChannels) {
+  int i;
+  u16 j;
+  for(i=0; i < 4; i++) {
+    for(j=0; j < MODULE_BLOCKSIZE; j++) {
+      in16[i][j] = trunc_fr1x32((*inChannels)[i][j]);
+    }
+  }
+}
+
+// mix delay inputs
+// (out_del still holds the previous block here)
+static void mix_del_inputs(void) {
+  int i, j;
+  u16 k;
+  fract32* dst;
+  for(i=0; i < 2; i++) {// delays
+    dst = in_del[i];
+    for(k=0; k < MODULE_BLOCKSIZE; k++) {
+      dst[k] = 0;
+    }
+    for(j=0; j < 4; j++) {// adcs
+      if(mix_adc_del[j][i] == 0) { continue; }
+      for(k=0; k < MODULE_BLOCKSIZE; k++) {
+	dst[k] = add_fr1x32(dst[k], mult_fr1x32(in16[j][k], mix_adc_del[j][i]));
+      }
+    }
+    for(j=0; j < 2; j++) {// dels
+      if(mix_del_del[j][i] == 0) { continue; }
+      for(k=0; k < MODULE_BLOCKSIZE; k++) {
+	dst[k] = add_fr1x32(dst[k], mult_fr1x32x32(out_del[j][k], mix_del_del[j][i]));
+      }
+    }
+  }
+}
+
+static void mix_outputs(buffer_t *outChannels) {
+  int i, j;
+  u16 k;
+  fract32* dst;
+
+  for(i=0; i < 4; i++) {// dacs
+    dst = (*outChannels)[i];
+    for(k=0; k < MODULE_BLOCKSIZE; k++) {
+      dst[k] = 0;
+    }
+    for(j=0; j < 2; j++) {// delays
+      if(mix_del_dac[j][i] == 0) { continue; }
+      for(k=0; k < MODULE_BLOCKSIZE; k++) {
+	dst[k] = add_fr1x32(dst[k], mult_fr1x32(trunc_fr1x32(out_del[j][k]),
+						mix_del_dac[j][i]));
+      }
+    }
+    for(j=0; j < 4; j++) {// adcs
+      if(mix_adc_dac[j][i] == 0) { continue; }
+      for(k=0; k < MODULE_BLOCKSIZE; k++) {
+	dst[k] = add_fr1x32(dst[k], mult_fr1x32(in16[j][k], mix_adc_dac[j][i]));
+      }
+    }
+  }
+}
+
+// process one delay line and its filter over a block
+static void calc_line(int i) {
+  u16 k;
+
+  // read crossfade
+  filter_ramp_process_block(&(lpFadeRd[i]), fadeBuf, MODULE_BLOCKSIZE);
+  if(fadeTargetRd[i] == 0) {
+    for(k=0; k < MODULE_BLOCKSIZE; k++) {
+      fadeBuf[k] = FR32_MAX - fadeBuf[k];
+    }
+  }
+
+  // process delay line
+  delayFadeN_process_block(&(lines[i]), in_del[i], tmpDel, fadeBuf, MODULE_BLOCKSIZE);
+
+  // filter params at block rate
+  filter_svf_set_coeff( &(svf[i]), svfCut[i] );
+  filter_svf_set_rq( &(svf[i]), svfRq[i] );
+
+  for(k=0; k < MODULE_BLOCKSIZE; k++) {
+    tmpSvf[k] = tmpDel[k];
+  }
+  filter_svf_process_block( &(svf[i]), tmpSvf, MODULE_BLOCKSIZE );
+
+  // mix
+  ramp_block(dryBuf, &(lastDry[i]), mix_fdry[i]);
+  ramp_block(wetBuf, &(lastWet[i]), mix_fwet[i]);
+  for(k=0; k < MODULE_BLOCKSIZE; k++) {
+    out_del[i][k] = add_fr1x32(mult_fr1x32x32(tmpDel[k], dryBuf[k]),
+			       mult_fr1x32x32(tmpSvf[k], wetBuf[k]));
+  }
+}
+
+//----------------------
+//----- external functions
+
+// time scaler in 3.12 fixed-point
+static volatile s16 globalTimescale;
+s32 calc_ms(s16 ticks) {
+  // ticks are signed 0.15, ticklength is signed 3.12
+  s32 ret = mult_fr1x32(ticks, globalTimescale);
+  ret = add_fr1x32(ret, shr_fr1x32(globalTimescale, 2));
+  ret = shr_fr1x32(ret, 12);
+  return ret;
+}
+
+void module_init(void) {
+  u8 i;
+  // init module/params
+  pLinesData = (linesData*)SDRAM_ADDRESS;
+
+  gModuleData = &(pLinesData->super);
+  strcpy(gModuleData->name, "lines");
+
+  gModuleData->paramData = (ParamData*)pLinesData->mParamData;
+  gModuleData->numParams = eParamNumParams;
+
+  slew_bank_init(&paramSlews);
+  for(i=0; i<NLINES; i++) {
+    delayFadeN_init(&(lines[i]), pLinesData->audioBuffer[i], LINES_BUF_FRAMES);
+#ifdef ARCH_BFIN
+    buffer_stage_set_copier(&(lines[i].stage), &mdmaCopier);
+#endif
+    filter_svf_init(&(svf[i]));
+
+    svfCut[i] = 0x3fffffff;
+    svfRq[i] = 0x3fffffff;
+    mix_fwet[i] = 0x3fffffff;
+    mix_fdry[i] = 0x3fffffff;
+    lastWet[i] = mix_fwet[i];
+    lastDry[i] = mix_fdry[i];
+    svfCutSlew[i] = slew_bank_add(&paramSlews, &(svfCut[i]), 0);
+    svfRqSlew[i] = slew_bank_add(&paramSlews, &(svfRq[i]), 0);
+    wetSlew[i] = slew_bank_add(&paramSlews, &(mix_fwet[i]), 0);
+    drySlew[i] = slew_bank_add(&paramSlews, &(mix_fdry[i]), 0);
+
+    filter_ramp_init(&(lpFadeRd[i]));
+
+    // need to zero everything to avoid horrible noise at boot...
+    memset((void*)pLinesData->audioBuffer[i], 0, LINES_BUF_FRAMES * sizeof(fract32));
+    memset(out_del[i], 0, MODULE_BLOCKSIZE * sizeof(fract32));
+  }
+
+  // dac
+  filter_1p_lo_init( &(cvSlew[0]), 0xf );
+  filter_1p_lo_init( &(cvSlew[1]), 0xf );
+  filter_1p_lo_init( &(cvSlew[2]), 0xf );
+  filter_1p_lo_init( &(cvSlew[3]), 0xf );
+
+  /// setup params with intial values
+
+  param_setup(eParamTimescale,  1 << 16);
+
+  param_setup( eParamFade0 , 0x100000 );
+  param_setup( eParamFade1 , 0x100000 );
+
+  param_setup( 	eParam_loop0,		10000 << 16 );
+  param_setup( 	eParam_rMul0,		0x10000 );
+  param_setup( 	eParam_rDiv0,		0x10000 );
+  param_setup( 	eParam_write0,		FRACT32_MAX );
+  param_setup( 	eParam_pre0,		0 );
+  param_setup( 	eParam_pos_write0,		0 );
+  param_setup( 	eParam_pos_read0,		0 );
+
+  param_setup( 	eParam_delay0, 1000 << 16);
+
+  param_setup( 	eParam_run_read0, 1 );
+  param_setup( 	eParam_run_write0, 1 );
+
+  param_setup( 	eParam_loop1,		10000 << 16 );
+  param_setup( 	eParam_rMul1,		0x10000 );
+  param_setup( 	eParam_rDiv1,		0x10000 );
+  param_setup( 	eParam_write1,		FRACT32_MAX );
+  param_setup( 	eParam_pre1,		0 );
+  param_setup( 	eParam_pos_write1,		0 );
+  param_setup( 	eParam_pos_read1,		0 );
+
+  param_setup( 	eParam_delay1, 500 << 16);
+
+  param_setup( 	eParam_run_read1, 1 );
+  param_setup( 	eParam_run_write1, 1 );
+
+  param_setup( 	eParam_del0_del0,		0 );
+  param_setup( 	eParam_del0_del1,		0 );
+  param_setup( 	eParam_del1_del0,		0 );
+  param_setup( 	eParam_del1_del1,		0 );
+
+  param_setup(eParam_adc0_del0, PARAM_AMP_6);
+  param_setup(eParam_adc0_del1, PARAM_AMP_6);
+  param_setup(eParam_adc1_del0, 0);
+  param_setup(eParam_adc1_del1, 0);
+  param_setup(eParam_adc2_del0, 0);
+  param_setup(eParam_adc2_del1, 0);
+  param_setup(eParam_adc3_del0, 0);
+  param_setup(eParam_adc3_del1, 0);
+
+  param_setup(eParam_del0_dac0, PARAM_AMP_6);
+  param_setup(eParam_del0_dac1, 0);
+  param_setup(eParam_del0_dac2, 0);
+  param_setup(eParam_del0_dac3, 0);
+
+  param_setup( 	eParam_del1_dac0,		PARAM_AMP_12 );
+  param_setup( 	eParam_del1_dac1,		PARAM_AMP_6 );
+  param_setup( 	eParam_del1_dac2,		PARAM_AMP_12 );
+  param_setup( 	eParam_del1_dac3,		PARAM_AMP_6 );
+
+  param_setup( 	eParam_adc0_dac0,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc0_dac1,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc0_dac2,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc0_dac3,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc1_dac0,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc1_dac1,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc1_dac2,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc1_dac3,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc2_dac0,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc2_dac1,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc2_dac2,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc2_dac3,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc3_dac0,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc3_dac1,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc3_dac2,		PARAM_AMP_12 );
+  param_setup( 	eParam_adc3_dac3,		PARAM_AMP_12 );
+
+  param_setup(  eParam_freq1,	PARAM_CUT_DEFAULT);
+  param_setup(  eParam_rq1,	PARAM_RQ_DEFAULT);
+  param_setup(  eParam_low1,       PARAM_AMP_6 );
+  param_setup(  eParam_high1,	0 );
+  param_setup(  eParam_band1,	0 );
+  param_setup(  eParam_notch1,	0 );
+  param_setup(  eParam_fwet1,	PARAM_AMP_6 );
+  param_setup(  eParam_fdry1,	PARAM_AMP_6 );
+
+  param_setup(  eParam_freq0, 	PARAM_CUT_DEFAULT );
+  param_setup(  eParam_rq0, 	PARAM_RQ_DEFAULT );
+  param_setup(  eParam_low0,	FRACT32_MAX >> 1 );
+  param_setup(  eParam_high0,	0 );
+  param_setup(  eParam_band0,	0 );
+  param_setup(  eParam_notch0,	0 );
+  param_setup(  eParam_fwet0,	PARAM_AMP_6 );
+  param_setup(  eParam_fdry0,	PARAM_AMP_6 );
+
+  param_setup(  eParamCut0Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamCut1Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamRq0Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamRq1Slew, PARAM_SLEW_DEFAULT );
+
+  param_setup(  eParam_cvSlew0, PARAM_SLEW_DEFAULT );
+  param_setup(  eParam_cvSlew1, PARAM_SLEW_DEFAULT );
+  param_setup(  eParam_cvSlew2, PARAM_SLEW_DEFAULT );
+  param_setup(  eParam_cvSlew3, PARAM_SLEW_DEFAULT );
+
+  param_setup(  eParam_cvVal0, PARAM_CV_VAL_DEFAULT );
+  param_setup(  eParam_cvVal1, PARAM_CV_VAL_DEFAULT );
+  param_setup(  eParam_cvVal2, PARAM_CV_VAL_DEFAULT );
+  param_setup(  eParam_cvVal3, PARAM_CV_VAL_DEFAULT );
+}
+
+void module_process_block(buffer_t *inChannels, buffer_t *outChannels) {
+  int i;
+
+  truncate_ins(inChannels);
+
+  // mix inputs (and last block's delay outputs) to delay lines
+  mix_del_inputs();
+
+  // param integrators
+  slew_bank_next_block(&paramSlews, MODULE_BLOCKSIZE);
+
+  for(i=0; i<NLINES; i++) {
+    calc_line(i);
+  }
+
+  mix_outputs(outChannels);
+}
+
+// parameter set function
+// (a very long switch statement, shared with the frame module)
+#include "param_set.c"
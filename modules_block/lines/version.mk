@@ -0,0 +1,3 @@
+maj = 0
+min = 2
+rev = 5
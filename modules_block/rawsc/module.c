@@ -23,6 +23,8 @@ void module_init(void) {
   gModuleData->paramData = mParamData;
   gModuleData->numParams = eParamNumParams;
 
+  osc_init();
+
   // detune!
   param_setup( eParamFreqFine0, 0x00000000);
   param_setup( eParamFreqFine1, 0x000f0000);
@@ -54,9 +56,7 @@ void module_process_block(buffer_t *inChannels, buffer_t *outChannels) {
     }
   }
 
-  for(i=0; i<NUM_OSCS; i++) { 
-    osc_process_block(i, outChannels);
-  }
+  osc_process_block(outChannels);
 }
 
 void module_set_param(u32 idx, ParamValue val) {
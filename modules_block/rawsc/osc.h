@@ -9,6 +9,9 @@
 
 #define NUM_OSCS 4
 
+// set up the oscillator bank
+extern void osc_init(void);
+
 // set phase directly
 extern void osc_set_phase(u16 idx, u32 val);
 
@@ -27,8 +30,8 @@ extern void osc_set_amp(u16 idx, fract32 amp);
 // set mix point amplitude
 extern void osc_set_mix(u16 oscIdx, u16 outIdx, fract32 amp);
 
-// process one block and mix to buffer 
+// process one block of all oscillators and mix to buffer 
 //extern void osc_process_block(fract32* dst, u16 frameCount);
-extern void osc_process_block( u16 idx, buffer_t *outChannels);
+extern void osc_process_block(buffer_t *outChannels);
 
 #endif
@@ -1,2 +0,0 @@
-
-0x00000000, 0x00C90F87, 0x01921D1F, 0x025B26D7, 0x03242ABF, 0x03ED26E7, 0x04B6195F, 0x057F0037, 0x0647D97F, 0x0710A347, 0x07D95B9F, 0x08A2009F, 0x096A904F, 0x0A3308BF, 0x0AFB67FF, 0x0BC3AC2F, 0x0C8BD35F, 0x0D53DB8F, 0x0E1BC2DF, 0x0EE3875F, 0x0FAB272F, 0x1072A03F, 0x1139F0BF, 0x120116DF, 0x12C8105F, 0x138EDBBF, 0x145576BF, 0x151BDF7F, 0x15E2143F, 0x16A812FF, 0x176DD9DF, 0x183366DF, 0x18F8B83F, 0x19BDCBFF, 0x1A82A01F, 0x1B4732DF, 0x1C0B825F, 0x1CCF8CBF, 0x1D934FDF, 0x1E56CA1F, 0x1F19F97F, 0x1FDCDC1F, 0x209F6FFF, 0x2161B37F, 0x2223A4BF, 0x22E541BF, 0x23A6887F, 0x2467773F, 0x25280C3F, 0x25E845BF, 0x26A8217F, 0x27679DFF, 0x2826B93F, 0x28E5713F, 0x29A3C47F, 0x2A61B0FF, 0x2B1F34FF, 0x2BDC4E7F, 0x2C98FBBF, 0x2D553AFF, 0x2E110A7F, 0x2ECC67FF, 0x2F87527F, 0x3041C77F, 0x30FBC53F, 0x31B54A3F, 0x326E54BF, 0x3326E2BF, 0x33DEF27F, 0x3496823F, 0x354D903F, 0x36041ABF, 0x36BA1FFF, 0x376F9E3F, 0x382493BF, 0x38D8FE7F, 0x398CDD3F, 0x3A402DBF, 0x3AF2EEBF, 0x3BA51E3F, 0x3C56BA7F, 0x3D07C1BF, 0x3DB832BF, 0x3E680B3F, 0x3F1749BF, 0x3FC5EC7F, 0x4073F1FF, 0x4121587F, 0x41CE1E7F, 0x427A41FF, 0x4325C0FF, 0x43D09AFF, 0x447ACD7F, 0x4524567F, 0x45CD357F, 0x467567FF, 0x471CECFF, 0x47C3C1FF, 0x4869E67F, 0x490F57FF, 0x49B414FF, 0x4A581C7F, 0x4AFB6C7F, 0x4B9E037F, 0x4C3FDFFF, 0x4CE0FFFF, 0x4D8162FF, 0x4E2105FF, 0x4EBFE87F, 0x4F5E08FF, 0x4FFB657F, 0x5097FC7F, 0x5133CC7F, 0x51CED47F, 0x5269127F, 0x530284FF, 0x539B2AFF, 0x5433027F, 0x54CA0A7F, 0x556040FF, 0x55F5A4FF, 0x568A347F, 0x571DEEFF, 0x57B0D27F, 0x5842DD7F, 0x58D40E7F, 0x5964647F, 0x59F3DDFF, 0x5A82797F, 0x5B1035FF, 0x5B9D117F, 0x5C290AFF, 0x5CB420FF, 0x5D3E51FF, 0x5DC79D7F, 0x5E50017F, 0x5ED77C7F, 0x5F5E0D7F, 0x5FE3B37F, 0x60686CFF, 0x60EC37FF, 0x616F147F, 0x61F0FFFF, 0x6271FA7F, 0x62F2017F, 0x637114FF, 0x63EF327F, 0x646C597F, 0x64E888FF, 0x6563BF7F, 0x65DDFBFF, 0x66573C7F, 0x66CF80FF, 0x6746C7FF, 0x67BD0F7F, 0x6832577F, 0x68A69E7F, 0x6919E2FF, 0x698C247F, 0x69FD617F, 0x6A6D987F, 0x6ADCC97F, 0x6B4AF27F, 0x6BB812FF, 0x6C24297F, 0x6C8F34FF, 0x6CF934FF, 0x6D6227FF, 0x6DCA0CFF, 0x6E30E37F, 0x6E96A97F, 0x6EFB5EFF, 0x6F5F027F, 0x6FC1937F, 0x7023107F, 0x708378FF, 0x70E2CBFF, 0x714107FF, 0x719E2CFF, 0x71FA397F, 0x72552C7F, 0x72AF057F, 0x7307C3FF, 0x735F65FF, 0x73B5EBFF, 0x740B53FF, 0x745F9DFF, 0x74B2C87F, 0x7504D37F, 0x7555BD7F, 0x75A585FF, 0x75F42BFF, 0x7641AEFF, 0x768E0E7F, 0x76D9497F, 0x77235EFF, 0x776C4EFF, 0x77B417FF, 0x77FAB97F, 0x784032FF, 0x788483FF, 0x78C7AB7F, 0x7909A8FF, 0x794A7BFF, 0x798A237F, 0x79C89F7F, 0x7A05EE7F, 0x7A4210FF, 0x7A7D057F, 0x7AB6CB7F, 0x7AEF62FF, 0x7B26CB7F, 0x7B5D037F, 0x7B920B7F, 0x7BC5E27F, 0x7BF887FF, 0x7C29FBFF, 0x7C5A3D7F, 0x7C894BFF, 0x7CB726FF, 0x7CE3CE7F, 0x7D0F41FF, 0x7D3980FF, 0x7D628AFF, 0x7D8A5EFF, 0x7DB0FDFF, 0x7DD6667F, 0x7DFA987F, 0x7E1D93FF, 0x7E3F57FF, 0x7E5FE47F, 0x7E7F397F, 0x7E9D55FF, 0x7EBA39FF, 0x7ED5E5FF, 0x7EF0587F, 0x7F0991FF, 0x7F21917F, 0x7F3857FF, 0x7F4DE47F, 0x7F62367F, 0x7F754E7F, 0x7F872BFF, 0x7F97CE7F, 0x7FA7367F, 0x7FB5637F, 0x7FC2557F, 0x7FCE0BFF, 0x7FD8877F, 0x7FE1C77F, 0x7FE9CB7F, 0x7FF0947F, 0x7FF6217F, 0x7FFA72FF, 0x7FFD887F, 0x7FFF61FF, 0x7FFFFFFF, 0x7FFF61FF, 0x7FFD887F, 0x7FFA72FF, 0x7FF6217F, 0x7FF0947F, 0x7FE9CB7F, 0x7FE1C77F, 0x7FD8877F, 0x7FCE0BFF, 0x7FC2557F, 0x7FB5637F, 0x7FA7367F, 0x7F97CE7F, 0x7F872BFF, 0x7F754E7F, 0x7F62367F, 0x7F4DE47F, 0x7F3857FF, 0x7F21917F, 0x7F0991FF, 0x7EF0587F, 0x7ED5E5FF, 0x7EBA39FF, 0x7E9D55FF, 0x7E7F397F, 0x7E5FE47F, 0x7E3F57FF, 0x7E1D93FF, 0x7DFA987F, 0x7DD6667F, 0x7DB0FDFF, 0x7D8A5EFF, 0x7D628AFF, 0x7D3980FF, 0x7D0F41FF, 0x7CE3CE7F, 0x7CB726FF, 0x7C894BFF, 0x7C5A3D7F, 0x7C29FBFF, 0x7BF887FF, 0x7BC5E27F, 0x7B920B7F, 0x7B5D037F, 0x7B26CB7F, 0x7AEF62FF, 0x7AB6CB7F, 0x7A7D057F, 0x7A4210FF, 0x7A05EE7F, 0x79C89F7F, 0x798A237F, 0x794A7BFF, 0x7909A8FF, 0x78C7AB7F, 0x788483FF, 0x784032FF, 0x77FAB97F, 0x77B417FF, 0x776C4EFF, 0x77235EFF, 0x76D9497F, 0x768E0E7F, 0x7641AEFF, 0x75F42BFF, 0x75A585FF, 0x7555BD7F, 0x7504D37F, 0x74B2C87F, 0x745F9DFF, 0x740B53FF, 0x73B5EBFF, 0x735F65FF, 0x7307C3FF, 0x72AF057F, 0x72552C7F, 0x71FA397F, 0x719E2CFF, 0x714107FF, 0x70E2CBFF, 0x708378FF, 0x7023107F, 0x6FC1937F, 0x6F5F027F, 0x6EFB5EFF, 0x6E96A97F, 0x6E30E37F, 0x6DCA0CFF, 0x6D6227FF, 0x6CF934FF, 0x6C8F34FF, 0x6C24297F, 0x6BB812FF, 0x6B4AF27F, 0x6ADCC97F, 0x6A6D987F, 0x69FD617F, 0x698C247F, 0x6919E2FF, 0x68A69E7F, 0x6832577F, 0x67BD0F7F, 0x6746C7FF, 0x66CF80FF, 0x66573C7F, 0x65DDFBFF, 0x6563BF7F, 0x64E888FF, 0x646C597F, 0x63EF327F, 0x637114FF, 0x62F2017F, 0x6271FA7F, 0x61F0FFFF, 0x616F147F, 0x60EC37FF, 0x60686CFF, 0x5FE3B37F, 0x5F5E0D7F, 0x5ED77C7F, 0x5E50017F, 0x5DC79D7F, 0x5D3E51FF, 0x5CB420FF, 0x5C290AFF, 0x5B9D117F, 0x5B1035FF, 0x5A82797F, 0x59F3DDFF, 0x5964647F, 0x58D40E7F, 0x5842DD7F, 0x57B0D27F, 0x571DEEFF, 0x568A347F, 0x55F5A4FF, 0x556040FF, 0x54CA0A7F, 0x5433027F, 0x539B2AFF, 0x530284FF, 0x5269127F, 0x51CED47F, 0x5133CC7F, 0x5097FC7F, 0x4FFB657F, 0x4F5E08FF, 0x4EBFE87F, 0x4E2105FF, 0x4D8162FF, 0x4CE0FFFF, 0x4C3FDFFF, 0x4B9E037F, 0x4AFB6C7F, 0x4A581C7F, 0x49B414FF, 0x490F57FF, 0x4869E67F, 0x47C3C1FF, 0x471CECFF, 0x467567FF, 0x45CD357F, 0x4524567F, 0x447ACD7F, 0x43D09AFF, 0x4325C0FF, 0x427A41FF, 0x41CE1E7F, 0x4121587F, 0x4073F1FF, 0x3FC5EC7F, 0x3F1749BF, 0x3E680B3F, 0x3DB832BF, 0x3D07C1BF, 0x3C56BA7F, 0x3BA51E3F, 0x3AF2EEBF, 0x3A402DBF, 0x398CDD3F, 0x38D8FE7F, 0x382493BF, 0x376F9E3F, 0x36BA1FFF, 0x36041ABF, 0x354D903F, 0x3496823F, 0x33DEF27F, 0x3326E2BF, 0x326E54BF, 0x31B54A3F, 0x30FBC53F, 0x3041C77F, 0x2F87527F, 0x2ECC67FF, 0x2E110A7F, 0x2D553AFF, 0x2C98FBBF, 0x2BDC4E7F, 0x2B1F34FF, 0x2A61B0FF, 0x29A3C47F, 0x28E5713F, 0x2826B93F, 0x27679DFF, 0x26A8217F, 0x25E845BF, 0x25280C3F, 0x2467773F, 0x23A6887F, 0x22E541BF, 0x2223A4BF, 0x2161B37F, 0x209F6FFF, 0x1FDCDC1F, 0x1F19F97F, 0x1E56CA1F, 0x1D934FDF, 0x1CCF8CBF, 0x1C0B825F, 0x1B4732DF, 0x1A82A01F, 0x19BDCBFF, 0x18F8B83F, 0x183366DF, 0x176DD9DF, 0x16A812FF, 0x15E2143F, 0x151BDF7F, 0x145576BF, 0x138EDBBF, 0x12C8105F, 0x120116DF, 0x1139F0BF, 0x1072A03F, 0x0FAB272F, 0x0EE3875F, 0x0E1BC2DF, 0x0D53DB8F, 0x0C8BD35F, 0x0BC3AC2F, 0x0AFB67FF, 0x0A3308BF, 0x096A904F, 0x08A2009F, 0x07D95B9F, 0x0710A347, 0x0647D97F, 0x057F0037, 0x04B6195F, 0x03ED26E7, 0x03242ABF, 0x025B26D7, 0x01921D1F, 0x00C90F87, 0xFFFFFFFF, 0xFF36F078, 0xFE6DE2E0, 0xFDA4D928, 0xFCDBD540, 0xFC12D918, 0xFB49E6A0, 0xFA80FFC8, 0xF9B82680, 0xF8EF5CB8, 0xF826A460, 0xF75DFF60, 0xF6956FB0, 0xF5CCF740, 0xF5049800, 0xF43C53D0, 0xF3742CA0, 0xF2AC2470, 0xF1E43D20, 0xF11C78A0, 0xF054D8D0, 0xEF8D5FC0, 0xEEC60F40, 0xEDFEE920, 0xED37EFA0, 0xEC712440, 0xEBAA8940, 0xEAE42080, 0xEA1DEBC0, 0xE957ED00, 0xE8922620, 0xE7CC9920, 0xE70747C0, 0xE6423400, 0xE57D5FE0, 0xE4B8CD20, 0xE3F47DA0, 0xE3307340, 0xE26CB020, 0xE1A935E0, 0xE0E60680, 0xE02323E0, 0xDF609000, 0xDE9E4C80, 0xDDDC5B40, 0xDD1ABE40, 0xDC597780, 0xDB9888C0, 0xDAD7F3C0, 0xDA17BA40, 0xD957DE80, 0xD8986200, 0xD7D946C0, 0xD71A8EC0, 0xD65C3B80, 0xD59E4F00, 0xD4E0CB00, 0xD423B180, 0xD3670440, 0xD2AAC500, 0xD1EEF580, 0xD1339800, 0xD078AD80, 0xCFBE3880, 0xCF043AC0, 0xCE4AB5C0, 0xCD91AB40, 0xCCD91D40, 0xCC210D80, 0xCB697DC0, 0xCAB26FC0, 0xC9FBE540, 0xC945E000, 0xC89061C0, 0xC7DB6C40, 0xC7270180, 0xC67322C0, 0xC5BFD240, 0xC50D1140, 0xC45AE1C0, 0xC3A94580, 0xC2F83E40, 0xC247CD40, 0xC197F4C0, 0xC0E8B640, 0xC03A1380, 0xBF8C0E00, 0xBEDEA780, 0xBE31E180, 0xBD85BE00, 0xBCDA3F00, 0xBC2F6500, 0xBB853280, 0xBADBA980, 0xBA32CA80, 0xB98A9800, 0xB8E31300, 0xB83C3E00, 0xB7961980, 0xB6F0A800, 0xB64BEB00, 0xB5A7E380, 0xB5049380, 0xB461FC80, 0xB3C02000, 0xB31F0000, 0xB27E9D00, 0xB1DEFA00, 0xB1401780, 0xB0A1F700, 0xB0049A80, 0xAF680380, 0xAECC3380, 0xAE312B80, 0xAD96ED80, 0xACFD7B00, 0xAC64D500, 0xABCCFD80, 0xAB35F580, 0xAA9FBF00, 0xAA0A5B00, 0xA975CB80, 0xA8E21100, 0xA84F2D80, 0xA7BD2280, 0xA72BF180, 0xA69B9B80, 0xA60C2200, 0xA57D8680, 0xA4EFCA00, 0xA462EE80, 0xA3D6F500, 0xA34BDF00, 0xA2C1AE00, 0xA2386280, 0xA1AFFE80, 0xA1288380, 0xA0A1F280, 0xA01C4C80, 0x9F979300, 0x9F13C800, 0x9E90EB80, 0x9E0F0000, 0x9D8E0580, 0x9D0DFE80, 0x9C8EEB00, 0x9C10CD80, 0x9B93A680, 0x9B177700, 0x9A9C4080, 0x9A220400, 0x99A8C380, 0x99307F00, 0x98B93800, 0x9842F080, 0x97CDA880, 0x97596180, 0x96E61D00, 0x9673DB80, 0x96029E80, 0x95926780, 0x95233680, 0x94B50D80, 0x9447ED00, 0x93DBD680, 0x9370CB00, 0x9306CB00, 0x929DD800, 0x9235F300, 0x91CF1C80, 0x91695680, 0x9104A100, 0x90A0FD80, 0x903E6C80, 0x8FDCEF80, 0x8F7C8700, 0x8F1D3400, 0x8EBEF800, 0x8E61D300, 0x8E05C680, 0x8DAAD380, 0x8D50FA80, 0x8CF83C00, 0x8CA09A00, 0x8C4A1400, 0x8BF4AC00, 0x8BA06200, 0x8B4D3780, 0x8AFB2C80, 0x8AAA4280, 0x8A5A7A00, 0x8A0BD400, 0x89BE5100, 0x8971F180, 0x8926B680, 0x88DCA100, 0x8893B100, 0x884BE800, 0x88054680, 0x87BFCD00, 0x877B7C00, 0x87385480, 0x86F65700, 0x86B58400, 0x8675DC80, 0x86376080, 0x85FA1180, 0x85BDEF00, 0x8582FA80, 0x85493480, 0x85109D00, 0x84D93480, 0x84A2FC80, 0x846DF480, 0x843A1D80, 0x84077800, 0x83D60400, 0x83A5C280, 0x8376B400, 0x8348D900, 0x831C3180, 0x82F0BE00, 0x82C67F00, 0x829D7500, 0x8275A100, 0x824F0200, 0x82299980, 0x82056780, 0x81E26C00, 0x81C0A800, 0x81A01B80, 0x8180C680, 0x8162AA00, 0x8145C600, 0x812A1A00, 0x810FA780, 0x80F66E00, 0x80DE6E80, 0x80C7A800, 0x80B21B80, 0x809DC980, 0x808AB180, 0x8078D400, 0x80683180, 0x8058C980, 0x804A9C80, 0x803DAA80, 0x8031F400, 0x80277880, 0x801E3880, 0x80163480, 0x800F6B80, 0x8009DE80, 0x80058D00, 0x80027780, 0x80009E00, 0x80000001, 0x80009E00, 0x80027780, 0x80058D00, 0x8009DE80, 0x800F6B80, 0x80163480, 0x801E3880, 0x80277880, 0x8031F400, 0x803DAA80, 0x804A9C80, 0x8058C980, 0x80683180, 0x8078D400, 0x808AB180, 0x809DC980, 0x80B21B80, 0x80C7A800, 0x80DE6E80, 0x80F66E00, 0x810FA780, 0x812A1A00, 0x8145C600, 0x8162AA00, 0x8180C680, 0x81A01B80, 0x81C0A800, 0x81E26C00, 0x82056780, 0x82299980, 0x824F0200, 0x8275A100, 0x829D7500, 0x82C67F00, 0x82F0BE00, 0x831C3180, 0x8348D900, 0x8376B400, 0x83A5C280, 0x83D60400, 0x84077800, 0x843A1D80, 0x846DF480, 0x84A2FC80, 0x84D93480, 0x85109D00, 0x85493480, 0x8582FA80, 0x85BDEF00, 0x85FA1180, 0x86376080, 0x8675DC80, 0x86B58400, 0x86F65700, 0x87385480, 0x877B7C00, 0x87BFCD00, 0x88054680, 0x884BE800, 0x8893B100, 0x88DCA100, 0x8926B680, 0x8971F180, 0x89BE5100, 0x8A0BD400, 0x8A5A7A00, 0x8AAA4280, 0x8AFB2C80, 0x8B4D3780, 0x8BA06200, 0x8BF4AC00, 0x8C4A1400, 0x8CA09A00, 0x8CF83C00, 0x8D50FA80, 0x8DAAD380, 0x8E05C680, 0x8E61D300, 0x8EBEF800, 0x8F1D3400, 0x8F7C8700, 0x8FDCEF80, 0x903E6C80, 0x90A0FD80, 0x9104A100, 0x91695680, 0x91CF1C80, 0x9235F300, 0x929DD800, 0x9306CB00, 0x9370CB00, 0x93DBD680, 0x9447ED00, 0x94B50D80, 0x95233680, 0x95926780, 0x96029E80, 0x9673DB80, 0x96E61D00, 0x97596180, 0x97CDA880, 0x9842F080, 0x98B93800, 0x99307F00, 0x99A8C380, 0x9A220400, 0x9A9C4080, 0x9B177700, 0x9B93A680, 0x9C10CD80, 0x9C8EEB00, 0x9D0DFE80, 0x9D8E0580, 0x9E0F0000, 0x9E90EB80, 0x9F13C800, 0x9F979300, 0xA01C4C80, 0xA0A1F280, 0xA1288380, 0xA1AFFE80, 0xA2386280, 0xA2C1AE00, 0xA34BDF00, 0xA3D6F500, 0xA462EE80, 0xA4EFCA00, 0xA57D8680, 0xA60C2200, 0xA69B9B80, 0xA72BF180, 0xA7BD2280, 0xA84F2D80, 0xA8E21100, 0xA975CB80, 0xAA0A5B00, 0xAA9FBF00, 0xAB35F580, 0xABCCFD80, 0xAC64D500, 0xACFD7B00, 0xAD96ED80, 0xAE312B80, 0xAECC3380, 0xAF680380, 0xB0049A80, 0xB0A1F700, 0xB1401780, 0xB1DEFA00, 0xB27E9D00, 0xB31F0000, 0xB3C02000, 0xB461FC80, 0xB5049380, 0xB5A7E380, 0xB64BEB00, 0xB6F0A800, 0xB7961980, 0xB83C3E00, 0xB8E31300, 0xB98A9800, 0xBA32CA80, 0xBADBA980, 0xBB853280, 0xBC2F6500, 0xBCDA3F00, 0xBD85BE00, 0xBE31E180, 0xBEDEA780, 0xBF8C0E00, 0xC03A1380, 0xC0E8B640, 0xC197F4C0, 0xC247CD40, 0xC2F83E40, 0xC3A94580, 0xC45AE1C0, 0xC50D1140, 0xC5BFD240, 0xC67322C0, 0xC7270180, 0xC7DB6C40, 0xC89061C0, 0xC945E000, 0xC9FBE540, 0xCAB26FC0, 0xCB697DC0, 0xCC210D80, 0xCCD91D40, 0xCD91AB40, 0xCE4AB5C0, 0xCF043AC0, 0xCFBE3880, 0xD078AD80, 0xD1339800, 0xD1EEF580, 0xD2AAC500, 0xD3670440, 0xD423B180, 0xD4E0CB00, 0xD59E4F00, 0xD65C3B80, 0xD71A8EC0, 0xD7D946C0, 0xD8986200, 0xD957DE80, 0xDA17BA40, 0xDAD7F3C0, 0xDB9888C0, 0xDC597780, 0xDD1ABE40, 0xDDDC5B40, 0xDE9E4C80, 0xDF609000, 0xE02323E0, 0xE0E60680, 0xE1A935E0, 0xE26CB020, 0xE3307340, 0xE3F47DA0, 0xE4B8CD20, 0xE57D5FE0, 0xE6423400, 0xE70747C0, 0xE7CC9920, 0xE8922620, 0xE957ED00, 0xEA1DEBC0, 0xEAE42080, 0xEBAA8940, 0xEC712440, 0xED37EFA0, 0xEDFEE920, 0xEEC60F40, 0xEF8D5FC0, 0xF054D8D0, 0xF11C78A0, 0xF1E43D20, 0xF2AC2470, 0xF3742CA0, 0xF43C53D0, 0xF5049800, 0xF5CCF740, 0xF6956FB0, 0xF75DFF60, 0xF826A460, 0xF8EF5CB8, 0xF9B82680, 0xFA80FFC8, 0xFB49E6A0, 0xFC12D918, 0xFCDBD540, 0xFDA4D928, 0xFE6DE2E0, 0xFF36F078
@@ -0,0 +1,3 @@
+maj = 0
+min = 4
+rev = 5
@@ -0,0 +1,379 @@
+/* waves.c
+ * aleph-bfin
+ *
+ * wavetable synthesis module, block-processing version.
+ *
+ * same parameters and sound as modules/waves,
+ * but each voice runs over a whole block at a time.
+ *
+ * differences from the frame-based module:
+ * - filter cutoff / rq are applied once per block.
+ * - cross-modulation delay can't be shorter than one block.
+ * - no cv output (the block runtime has no cv driver yet).
+ */
+
+// std
+#include <string.h>
+
+// aleph-common
+#include "fix.h"
+#include "types.h"
+// audio lib
+#include "filter_1p.h"
+#include "filter_svf.h"
+// bfin
+#include "fract_math.h"
+#include "module.h"
+#include "params.h"
+
+// waves
+#include "osc_waves.h"
+#include "slew.h"
+
+#define WAVES_NVOICES 2
+
+#define WAVES_PM_DEL_SAMPS 0x400
+#define WAVES_PM_DEL_SAMPS_1 0x3ff
+
+//-------- data types
+
+// define a local data structure that subclasses moduleData.
+typedef struct _wavesData {
+  ModuleData super;
+  ParamData mParamData[eParamNumParams];
+} wavesData;
+
+MODULE_SDRAM(wavesData);
+
+// single "voice" structure
+typedef struct _waveVoice {
+  // oscillator
+  osc osc;
+  // filter
+  filter_svf svf;
+  // osc amp
+  fract32 amp;
+
+  // amp smoother
+  Slew32 ampSlew;
+  // cutoff smoother
+  Slew32 cutSlew;
+  // rq smoother
+  Slew32 rqSlew;
+
+  // dry mix
+  Slew16 drySlew;
+  // wet mix
+  Slew16 wetSlew;
+
+  // last value read from the PM delay
+  fract32 pmIn;
+
+  // PM delay buffer
+  fract32 modDelBuf[WAVES_PM_DEL_SAMPS];
+  // PM delay write index
+  u32 modDelWrIdx;
+  // PM delay read index
+  u32 modDelRdIdx;
+
+} wavesVoice;
+
+wavesVoice voice[WAVES_NVOICES];
+
+//-------------------------
+//----- extern vars (initialized here)
+ModuleData * gModuleData; // module data
+
+//-----------------------
+//------ static variables
+// pointer to local module data, initialize at top of SDRAM
+static wavesData * data;
+
+// band-limited per octave; see modules/waves/wavtab_mip.txt
+static const fract16 wavtab[WAVE_SHAPE_NUM][OSC_MIP_SHAPE_SIZE] = {
+#include "wavtab_mip_inc.c"
+};
+
+// oscillator phases and table lookup
+static oscMipBank oscBank;
+
+// per-block busses
+static fract32 modBuf[MODULE_BLOCKSIZE];
+static fract32 oscOut[WAVES_NVOICES][MODULE_BLOCKSIZE];
+static fract32 svfOut[MODULE_BLOCKSIZE];
+static fract32 voiceOut[WAVES_NVOICES][MODULE_BLOCKSIZE];
+
+// patch points
+static u8 patch_adc_dac[4][4];
+static u8 patch_osc_dac[2][4];
+
+// cv params are kept so param_set.c is shared with the frame module,
+// but nothing drives the cv dac in the block runtime.
+static filter_1p_lo cvSlew[4];
+
+//----------------------
+//----- static functions
+
+// initial param set
+static inline void param_setup(u32 id, ParamValue v) {
+  gModuleData->paramData[id].value = v;
+  module_set_param(id, v);
+}
+
+// process one voice over a block
+static void calc_voice(int i) {
+  wavesVoice* v = &(voice[i]);
+  fract32* osc = oscOut[i];
+  fract32* vout = voiceOut[i];
+  u32 rd = v->modDelRdIdx;
+  u16 j;
+
+  // modulation input for each frame is the value read on the frame before
+  for(j=0; j<MODULE_BLOCKSIZE; j++) {
+    modBuf[j] = v->pmIn;
+    rd = (rd + 1) & WAVES_PM_DEL_SAMPS_1;
+    v->pmIn = v->modDelBuf[rd];
+  }
+  v->modDelRdIdx = rd;
+
+  // oscillator class includes hz and mod integrators
+  // no tricky modulation routing here!
+  osc_process_block( &(v->osc), osc, modBuf, modBuf, MODULE_BLOCKSIZE );
+  for(j=0; j<MODULE_BLOCKSIZE; j++) {
+    osc[j] = shr_fr1x32(osc[j], 2);
+    svfOut[j] = shr_fr1x32(osc[j], 1);
+  }
+
+  // filter params at block rate
+  for(j=0; j<MODULE_BLOCKSIZE; j++) {
+    slew32_calc(v->cutSlew);
+    slew32_calc(v->rqSlew);
+  }
+  filter_svf_set_coeff( &(v->svf), v->cutSlew.y );
+  filter_svf_set_rq( &(v->svf), v->rqSlew.y );
+
+  switch(svf_mode[i]) {
+  case 1 :
+    filter_svf_hpf_process_block( &(v->svf), svfOut, MODULE_BLOCKSIZE );
+    break;
+  case 2 :
+    filter_svf_bpf_process_block( &(v->svf), svfOut, MODULE_BLOCKSIZE );
+    break;
+  default :
+    filter_svf_lpf_process_block( &(v->svf), svfOut, MODULE_BLOCKSIZE );
+    break;
+  }
+
+  // mix dry/filter and apply amp
+  for(j=0; j<MODULE_BLOCKSIZE; j++) {
+    slew32_calc(v->ampSlew);
+    slew16_calc(v->drySlew);
+    slew16_calc(v->wetSlew);
+    vout[j] = mult_fr1x32x32(v->ampSlew.y,
+			     add_fr1x32(mult_fr1x32(trunc_fr1x32(osc[j]),
+						    v->drySlew.y),
+					mult_fr1x32(trunc_fr1x32(svfOut[j]),
+						    v->wetSlew.y)
+					)
+			     );
+  }
+}
+
+// write each oscillator into the other's PM delay
+static void write_mod_delay(wavesVoice* v, const fract32* src) {
+  u32 wr = v->modDelWrIdx;
+  u16 j;
+  for(j=0; j<MODULE_BLOCKSIZE; j++) {
+    wr = (wr + 1) & WAVES_PM_DEL_SAMPS_1;
+    v->modDelBuf[wr] = src[j];
+  }
+  v->modDelWrIdx = wr;
+}
+
+//----------------------
+//----- external functions
+
+void module_init(void) {
+  int i, j;
+
+  // init module/param descriptor
+  // intialize local data at start of SDRAM
+  data = (wavesData * )SDRAM_ADDRESS;
+  // initialize moduleData superclass for core routines
+  gModuleData = &(data->super);
+  strcpy(gModuleData->name, "waves");
+  gModuleData->paramData = data->mParamData;
+  gModuleData->numParams = eParamNumParams;
+
+  osc_mip_bank_init( &oscBank, wavtab[0], WAVE_SHAPE_NUM, WAVES_NVOICES );
+  for(i=0; i<WAVES_NVOICES; i++) {
+    fract32 tmp = FRACT32_MAX >> 2;
+    osc_init( &(voice[i].osc), &oscBank, i );
+    filter_svf_init( &(voice[i].svf) );
+    voice[i].amp = tmp;
+
+    slew_init((voice[i].ampSlew), 0, 0, 0 );
+    slew_init((voice[i].cutSlew), 0, 0, 0 );
+    slew_init((voice[i].rqSlew), 0, 0, 0 );
+
+    slew_init((voice[i].wetSlew), 0, 0, 0 );
+    slew_init((voice[i].drySlew), 0, 0, 0 );
+
+    voice[i].pmIn = 0;
+    voice[i].modDelWrIdx = 0;
+    voice[i].modDelRdIdx = 0;
+    memset(voice[i].modDelBuf, 0, WAVES_PM_DEL_SAMPS * sizeof(fract32));
+  }
+
+  for(i=0; i<4; i++) {
+    for(j=0; j<4; j++) {
+      patch_adc_dac[i][j] = 0;
+    }
+  }
+
+  for(i=0; i<2; i++) {
+    for(j=0; j<4; j++) {
+      patch_osc_dac[i][j] = 0;
+    }
+  }
+
+  // cv
+  filter_1p_lo_init( &(cvSlew[0]), 0xf );
+  filter_1p_lo_init( &(cvSlew[1]), 0xf );
+  filter_1p_lo_init( &(cvSlew[2]), 0xf );
+  filter_1p_lo_init( &(cvSlew[3]), 0xf );
+
+  // set parameters to defaults
+  /// slew first
+  param_setup(  eParamHz1Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamHz0Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamPm10Slew, 	PARAM_SLEW_DEFAULT );
+  param_setup(  eParamPm01Slew, 	PARAM_SLEW_DEFAULT );
+  param_setup(  eParamWm10Slew, 	PARAM_SLEW_DEFAULT );
+  param_setup(  eParamWm01Slew, 	PARAM_SLEW_DEFAULT );
+  param_setup(  eParamWave1Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamWave0Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamAmp1Slew, 	PARAM_SLEW_DEFAULT );
+  param_setup(  eParamAmp0Slew, PARAM_SLEW_DEFAULT );
+
+  param_setup(  eParamCut0Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamCut1Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamRq0Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamRq1Slew, PARAM_SLEW_DEFAULT );
+
+  param_setup(  eParamWet0Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamWet1Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamDry0Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamDry1Slew, PARAM_SLEW_DEFAULT );
+  param_setup(  eParamHz1, 	220 << 16 );
+  param_setup(  eParamHz0, 	330 << 16 );
+  param_setup(  eParamTune1, 	FIX16_ONE );
+  param_setup(  eParamTune0, 	FIX16_ONE );
+  param_setup(  eParamWave1, 	0 );
+  param_setup(  eParamWave0, 	0 );
+  param_setup(  eParamAmp1, 	PARAM_AMP_6 );
+  param_setup(  eParamAmp0, 	PARAM_AMP_6 );
+
+  param_setup(  eParamPm10, 	0 );
+  param_setup(  eParamPm01, 	0 );
+  param_setup(  eParamWm10, 	0 );
+  param_setup(  eParamWm01, 	0 );
+
+  param_setup(  eParam_cut1,	PARAM_CUT_DEFAULT);
+  param_setup(  eParam_rq1,	PARAM_RQ_DEFAULT);
+  param_setup(  eParam_mode1,	0);
+
+  param_setup(  eParam_fwet1,	PARAM_AMP_6 );
+  param_setup(  eParam_fdry1,	PARAM_AMP_6 );
+
+  param_setup(  eParam_cut0, 	PARAM_CUT_DEFAULT );
+  param_setup(  eParam_rq0, 	PARAM_RQ_DEFAULT );
+  param_setup(  eParam_mode0,	0);
+
+  param_setup(  eParam_fwet0,	PARAM_AMP_6 );
+  param_setup(  eParam_fdry0,	PARAM_AMP_6 );
+
+  param_setup(  eParam_adc0_dac0, 	1 );
+  param_setup(  eParam_adc1_dac1,  	1 );
+  param_setup(  eParam_adc2_dac2, 	1 );
+  param_setup(  eParam_adc3_dac3, 	1 );
+
+  param_setup(  eParam_osc0_dac0, 	1 );
+  param_setup(  eParam_osc0_dac1,  	1 );
+  param_setup(  eParam_osc0_dac2, 	1 );
+  param_setup(  eParam_osc0_dac3, 	1 );
+  param_setup(  eParam_osc1_dac0, 	1 );
+  param_setup(  eParam_osc1_dac1,  	1 );
+  param_setup(  eParam_osc1_dac2, 	1 );
+  param_setup(  eParam_osc1_dac3, 	1 );
+
+  param_setup(  eParam_cvVal0, 	FRACT32_MAX >> 1 );
+  param_setup(  eParam_cvVal1, 	FRACT32_MAX >> 1 );
+  param_setup(  eParam_cvVal2, 	FRACT32_MAX >> 1 );
+  param_setup(  eParam_cvVal3, 	FRACT32_MAX >> 1 );
+  param_setup(  eParam_cvSlew0, 	PARAM_SLEW_DEFAULT );
+  param_setup(  eParam_cvSlew1, 	PARAM_SLEW_DEFAULT );
+  param_setup(  eParam_cvSlew2, 	PARAM_SLEW_DEFAULT );
+  param_setup(  eParam_cvSlew3, 	PARAM_SLEW_DEFAULT );
+}
+
+// block callback
+void module_process_block(buffer_t *inChannels, buffer_t *outChannels) {
+  int i, o;
+  u16 j;
+
+  for(i=0; i<WAVES_NVOICES; i++) {
+    calc_voice(i);
+  }
+
+  // // simple cross-patch modulation
+  // add delay, before filter
+  write_mod_delay(&(voice[0]), oscOut[1]);
+  write_mod_delay(&(voice[1]), oscOut[0]);
+
+  for(o=0; o<AUDIO_CHANNELS; o++) {
+    fract32* dst = (*outChannels)[o];
+    for(j=0; j<MODULE_BLOCKSIZE; j++) {
+      dst[j] = 0;
+    }
+    // patch filtered oscs outputs
+    for(i=0; i<WAVES_NVOICES; i++) {
+      if(patch_osc_dac[i][o]) {
+	for(j=0; j<MODULE_BLOCKSIZE; j++) {
+	  dst[j] = add_fr1x32(dst[j], voiceOut[i][j]);
+	}
+      }
+    }
+    // patch adc
+    for(i=0; i<AUDIO_CHANNELS; i++) {
+      if(patch_adc_dac[i][o]) {
+	for(j=0; j<MODULE_BLOCKSIZE; j++) {
+	  dst[j] = add_fr1x32(dst[j], (*inChannels)[i][j]);
+	}
+      }
+    }
+  }
+}
+
+//----- patch helpers for param_set.c
+
+// set adc_dac patch point
+static inline void param_set_adc_patch(int i, int o, ParamValue v) {
+  patch_adc_dac[i][o] = (v > 0);
+}
+
+static inline void param_set_osc_patch(int i, int o, ParamValue v) {
+  patch_osc_dac[i][o] = (v > 0);
+}
+
+// set delay time in samples.
+// blocks are processed one voice at a time,
+// so the other voice's output is only available one block later.
+static inline void param_set_pm_del(int i, ParamValue v) {
+  u32 samps = v >> 6;
+  if(samps < MODULE_BLOCKSIZE) { samps = MODULE_BLOCKSIZE; }
+  voice[i].modDelRdIdx = (voice[i].modDelWrIdx - samps) & WAVES_PM_DEL_SAMPS_1;
+}
+
+// shared with the frame-based module
+#include "param_set.c"
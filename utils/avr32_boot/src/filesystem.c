@@ -34,7 +34,7 @@ volatile avr32_pdca_channel_t* pdcaTxChan ;
 //---- low level i/o
 int media_read(unsigned long sector, unsigned char *buffer, unsigned long sector_count);
 int media_read(unsigned long sector, unsigned char *buffer, unsigned long sector_count) {
-  unsigned long i;
+  unsigned long i, j;
 
   for (i=0;i<sector_count;i++) {
     pdca_load_channel( AVR32_PDCA_CHANNEL_SPI_RX,
@@ -58,9 +58,9 @@ int media_read(unsigned long sector, unsigned char *buffer, unsigned long sector
       pdcaTxChan->cr = AVR32_PDCA_TEN_MASK; // and TX PDCA transfer
       // wait for signal from ISR
       while(!fsEndTransfer) { ;; }
-      // copy FIXME: could optimize
-      for(i=0; i<FS_BUF_SIZE; i++) {
-	buffer[i] = pdcaRxBuf[i];
+      // copy out of the DMA buffer (separate index from the sector count!)
+      for(j=0; j<FS_BUF_SIZE; j++) {
+	buffer[j] = pdcaRxBuf[j];
       }
     } else {
       screen_line(0, 7, "filesystem error!", 0xf);
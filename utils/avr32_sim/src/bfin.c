@@ -11,9 +11,11 @@
 /* #include "gpio.h" */
 /* #include "spi.h" */
 /* #include "print_funcs.h" */
+#include <stddef.h>
 
 // aleph/common
 #include "module_common.h"
+#include "param_batch.h"
 #include "param_common.h"
 #include "protocol.h"
 
@@ -35,6 +37,26 @@ static void bfin_start_transfer(void);
 static void bfin_end_transfer(void); 
 static void bfin_transfer_byte(u8 data);
 
+// encoded batch message
+static u8 batchBuf[PARAM_BATCH_BYTES(PARAM_BATCH_MAX)];
+// count of bytes sent (or that would have been sent) on the bus
+static u32 spiBytes = 0;
+
+// queued frames
+static BfinTxRing txRing;
+// bytes the simulated bus moves per poll (0: everything queued)
+static u32 txRate = 0;
+// receiving end: param changes decoded from the bytes on the bus
+static bfin_sim_rx_fn rxFn = NULL;
+// receiving end: every byte on the bus
+static bfin_sim_rx_byte_fn rxByteFn = NULL;
+// state of the ready pin (NULL: always ready)
+static bfin_sim_ready_fn readyFn = NULL;
+static ParamBatchDecoder rxDec;
+static u8 rxInBatch = 0;
+
+static void bfin_sim_rx_byte(u8 b);
+
 //---------------------------------------
 //--- external function definition
 
@@ -99,6 +121,8 @@ void bfin_load_buf(void) {
 //void bfin_set_param(u8 idx, f32 x ) {
 void bfin_set_param(u8 idx, fix16_t x ) {
 #if 1
+  // command, index, 4 value bytes
+  spiBytes += 6;
 #else
   //static u32 ticks = 0;
   ParamValueCommon pval;
@@ -154,6 +178,109 @@ void bfin_set_param(u8 idx, fix16_t x ) {
 #endif
 }
 
+// queue many parameters as one batch message
+u8 bfin_set_params(const u8* idx, const ParamValue* val, u8 count) {
+  u32 bytes;
+  if(count == 0) { return 0; }
+  bytes = param_batch_encode(batchBuf, idx, val, count);
+  return bfin_tx_frame(batchBuf, (u16)bytes, NULL, 0);
+}
+
+// queue a frame
+u8 bfin_tx_frame(const u8* data, u16 len, bfin_tx_done_fn done, u32 arg) {
+  u8 ret = bfin_tx_push(&txRing, data, len, done, arg);
+  bfin_tx_poll();
+  return ret;
+}
+
+// simulated transport: move up to txRate bytes, then reap.
+// like the DMA handler, each byte waits for the ready pin.
+void bfin_tx_poll(void) {
+  const u8* data;
+  u8 first;
+  u16 n, i;
+  u32 budget = txRate;
+  while((n = bfin_tx_chunk(&txRing, &data, &first)) > 0) {
+    if(txRate > 0) {
+      if(budget == 0) { break; }
+      if(n > budget) { n = (u16)budget; }
+    }
+    if(first) { rxInBatch = 0; }
+    for(i=0; i<n; ++i) {
+      if(readyFn != NULL && !(*readyFn)()) { break; }
+      bfin_sim_rx_byte(data[i]);
+      if(rxByteFn != NULL) { (*rxByteFn)(data[i]); }
+    }
+    if(txRate > 0) { budget -= i; }
+    spiBytes += i;
+    if(i > 0) { bfin_tx_advance(&txRing, i); }
+    // not ready; the next poll resumes
+    if(i < n) { break; }
+  }
+  bfin_tx_reap(&txRing);
+}
+
+// send everything queued
+// (with a ready gate, only while the simulated bfin is ready)
+void bfin_tx_flush(void) {
+  u32 rate = txRate;
+  txRate = 0;
+  bfin_tx_poll();
+  txRate = rate;
+}
+
+// limit the simulated bus to n bytes per poll (0: unlimited)
+void bfin_sim_set_tx_rate(u32 n) {
+  txRate = n;
+}
+
+// receive decoded param changes, in bus order
+void bfin_sim_set_rx(bfin_sim_rx_fn fn) {
+  rxFn = fn;
+}
+
+// receive the raw bytes, in bus order
+void bfin_sim_set_rx_byte(bfin_sim_rx_byte_fn fn) {
+  rxByteFn = fn;
+}
+
+// gate each byte on the ready pin
+void bfin_sim_set_ready(bfin_sim_ready_fn fn) {
+  readyFn = fn;
+}
+
+// frames pushed but not yet on the bus
+u16 bfin_sim_tx_pending(void) {
+  return bfin_tx_pending(&txRing);
+}
+
+// pushes refused because the ring was full
+u32 bfin_sim_tx_full(void) {
+  return txRing.full;
+}
+
+// what the bfin's spi_process() would see for batch messages
+static void bfin_sim_rx_byte(u8 b) {
+  u8 idx;
+  ParamValue val;
+  if(!rxInBatch) {
+    if(b == MSG_SET_PARAM_BATCH_COM) {
+      param_batch_decode_start(&rxDec);
+      rxInBatch = 1;
+    }
+    return;
+  }
+  if(param_batch_decode(&rxDec, b, &idx, &val)) {
+    if(rxFn != NULL) { (*rxFn)(idx, val); }
+  }
+  if(rxDec.byte == eCom) { rxInBatch = 0; }
+}
+
+// bytes that would have gone out on the SPI bus so far
+u32 bfin_spi_bytes(void) {
+  return spiBytes;
+}
+
 void bfin_get_num_params(volatile u32* num) {
 #if 1
 
@@ -12,6 +12,7 @@ extern "C" {
 #endif
 
 //#include "compiler.h"
+#include "bfin_tx.h"
 #include "fix.h"
 #include "module_common.h"
 #include "param_common.h"
@@ -34,6 +35,37 @@ void bfin_load_buf(void);
 // set a parameter
 void bfin_set_param(u8 idx, fix16_t val);
 
+// queue many parameters as one batch message (see param_batch.h)
+// returns 0, or 1 if the transmit ring is full
+u8 bfin_set_params(const u8* idx, const ParamValue* val, u8 count);
+
+// queue a frame (see bfin_tx.h); returns 0, or 1 if the ring is full
+u8 bfin_tx_frame(const u8* data, u16 len, bfin_tx_done_fn done, u32 arg);
+// run the transport and completion callbacks
+void bfin_tx_poll(void);
+// send everything queued
+void bfin_tx_flush(void);
+
+//--- simulated transport
+// receives each param change as the simulated bfin decodes it
+typedef void (*bfin_sim_rx_fn)(u8 idx, ParamValue val);
+// limit the bus to n bytes per poll (0: unlimited)
+extern void bfin_sim_set_tx_rate(u32 n);
+extern void bfin_sim_set_rx(bfin_sim_rx_fn fn);
+// receives each byte as it goes out on the bus
+typedef void (*bfin_sim_rx_byte_fn)(u8 b);
+extern void bfin_sim_set_rx_byte(bfin_sim_rx_byte_fn fn);
+// state of the bfin's ready pin; the bus only moves a byte while it's high
+typedef u8 (*bfin_sim_ready_fn)(void);
+extern void bfin_sim_set_ready(bfin_sim_ready_fn fn);
+// frames pushed but not yet on the bus
+extern u16 bfin_sim_tx_pending(void);
+// pushes refused because the ring was full
+extern u32 bfin_sim_tx_full(void);
+
+// bytes that would have gone out on the SPI bus so far
+extern u32 bfin_spi_bytes(void);
+
 // TODO: 
 // fix16_t bfin_get_param(u8 idx);
 
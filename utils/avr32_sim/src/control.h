@@ -4,12 +4,11 @@
   avr32
   aleph
  
-  FIXME:  
-  duplicating param change queue from the blackfin.
-  this is decidedly sub-optimal but lets get things working.
-
   parameter changes are stored in a set structure.
-  maximum one request per parameter enters the queue
+  maximum one request per parameter enters the queue;
+  the queue is handed to the transmit ring as a single batch message
+  (see param_batch.h, bfin_tx.h) once per pass of the event loop;
+  if the ring is full the changes wait for the next pass.
   
  */
 
@@ -20,16 +19,26 @@
 extern "C" {
 #endif
 
+#include "param_batch.h"
 #include "param_common.h"
 #include "types.h"
 
 //---------------------------------------------
 //---- definitions / types
 
+// param indices are single bytes on the wire
+#define CTL_PARAMS_MAX 256
+
 // add param change to buffer
 /// FIXME: uh will this work for params < 0 ?
 extern u8 ctl_param_change(u32 param, u32 value);
 
+// queue pending param changes for the bfin (never blocks)
+extern void ctl_param_flush(void);
+
+// discard all pending param changes
+extern void ctl_param_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
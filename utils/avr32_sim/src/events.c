@@ -1,8 +1,27 @@
 /* events.c
  * aleph
  *
- * simple event queue
- * disables interrupts around queue manipulation
+ * event queue.
+ *
+ * each posting context (main loop, or an interrupt level) has its own
+ * single-producer / single-consumer ring, so posting never disables
+ * interrupts: an interrupt can't preempt another at its own level,
+ * and the main loop is the only reader.
+ *
+ * events that only carry state are not queued:
+ * the producer folds them into a latch, which the main loop reads
+ * - refreshes and polls are delivered once,
+ * - encoder deltas are summed,
+ * - the latest ADC value wins.
+ * the first post to a latch since the main loop last read it
+ * also puts a marker in the ring, so the latch is read in its place.
+ * so floods of them take at most one ring slot, and never get dropped.
+ *
+ * every event and marker is stamped from one counter when posted,
+ * and the main loop takes the oldest stamp at the head of any ring,
+ * so events come out in the order they were posted, across contexts.
+ * they go to a merge queue,
+ * which folds in repeats of latched events that are already waiting.
  */
 
 // ASF
@@ -18,117 +37,395 @@
 
 /// NOTE: if we are ever over-filling the event queue, we have problems.
 /// making the event queue bigger not likely to solve the problems.
+// events per context ring (power of 2)
 #define MAX_EVENTS   32
+#define EVENT_MASK   (MAX_EVENTS - 1)
+// events waiting for the main loop, after merging (power of 2)
+#define MERGE_EVENTS 64
+#define MERGE_MASK   (MERGE_EVENTS - 1)
+
+// producer/consumer ordering
+#ifdef ARCH_AVR32
+#define event_barrier() asm volatile ("" ::: "memory")
+#else
+#define event_barrier() __sync_synchronize()
+#endif
 
-// macro for incrementing an index into a circular buffer.
-#define INCR_EVENT_INDEX( x )  { if ( ++x == MAX_EVENTS ) x = 0; }
+//-----------------------------
+//---- types
 
-// et/Put indexes inxto sysEvents[] array
-//static int putIdx = 0;
-//static int getIdx = 0;
-//
-//// The system event queue is a circular array of event records.
-//static event_t sysEvents[ MAX_EVENTS ];
+// how repeats of an event type are merged
+typedef enum {
+  eEventMergeLatest,  // latest data wins
+  eEventMergeSum,     // data is summed
+} eEventMerge;
 
-// initializes (or re-initializes)  the system event queue.
-void init_events( void ) {
-#if 1
+// event types that are latched instead of queued
+#define EVENT_LATCHES 12
+
+typedef struct {
+  etype type;
+  u8 merge;
+} eventLatchType;
+
+// ring and latches for one posting context
+typedef struct {
+  //--- written only by the producer
+  volatile u32 put;
+  u32 posted;
+  u32 dropped;
+  u32 highWater;
+  // latched data, and how many times each latch was posted
+  volatile u32 latchData[EVENT_LATCHES];
+  volatile u32 latchCount[EVENT_LATCHES];
+  // posting stamp of the latched data
+  volatile u32 latchStamp[EVENT_LATCHES];
+  // bumped after any latch is posted
+  volatile u32 latchSeq;
+  // ring index of the last marker of each latch
+  u32 markPut[EVENT_LATCHES];
+  //--- written only by the consumer
+  volatile u32 get;
+  u32 seenSeq;
+  u32 seenCount[EVENT_LATCHES];
+  // latched sums already delivered
+  u32 takenData[EVENT_LATCHES];
+  event_t ev[MAX_EVENTS];
+  // posting order of each event
+  u32 stamp[MAX_EVENTS];
+} eventRing;
+
+//-----------------------------
+//---- static variables
+
+static const eventLatchType latchTypes[EVENT_LATCHES] = {
+  { kEventAdc0, eEventMergeLatest },
+  { kEventAdc1, eEventMergeLatest },
+  { kEventAdc2, eEventMergeLatest },
+  { kEventAdc3, eEventMergeLatest },
+  { kEventEncoder0, eEventMergeSum },
+  { kEventEncoder1, eEventMergeSum },
+  { kEventEncoder2, eEventMergeSum },
+  { kEventEncoder3, eEventMergeSum },
+  { kEventMonomePoll, eEventMergeLatest },
+  { kEventMonomeRefresh, eEventMergeLatest },
+  { kEventMidiRefresh, eEventMergeLatest },
+  { kEventScreenRefresh, eEventMergeLatest },
+};
+
+// latch of each event type, plus 1; 0 if queued
+static u8 latchOf[kNumEventTypes];
+
+static eventRing rings[EVENT_CONTEXTS];
+// next posting stamp
+static volatile u32 postSeq = 0;
+
+// merged events, in order
+static event_t merged[MERGE_EVENTS];
+static u8 mergePut = 0;
+static u8 mergeGet = 0;
+// index in merged[] of the waiting event of each latch, or -1
+static s8 pending[EVENT_LATCHES];
+// posting stamp of its data
+static u32 pendingStamp[EVENT_LATCHES];
+static u32 coalesced = 0;
+
+#ifndef ARCH_AVR32
+static __thread u8 eventContext = 0;
+#endif
+
+//-----------------------------
+//---- static functions
+
+// posting context of the caller
+static inline u8 event_context(void) {
+#ifdef ARCH_AVR32
+  // status register mode bits: 0/1 application/supervisor, 2-5 INT0-INT3
+  u32 mode = (__builtin_mfsr(AVR32_SR) >> AVR32_SR_M0_OFFSET) & 7;
+  return (mode >= 2 && mode <= 5) ? mode - 1 : 0;
 #else
-  int k;
-  
-  // set queue (circular list) to empty
-  putIdx = 0;
-  getIdx = 0;
-
-  // zero out the event records
-  for ( k = 0; k < MAX_EVENTS; k++ ) {
-    sysEvents[ k ].type = 0;
-    sysEvents[ k ].data = 0;
-  }
+  return eventContext;
 #endif
 }
 
-// get next event
-// Returns non-zero if an event was available
-u8 event_next( event_t *e ) {
-#if 1
-    return 0;
+// take the next posting stamp, from any context
+static inline u32 event_stamp(void) {
+#ifdef ARCH_AVR32
+  u32 s;
+  // ssrf sets the lock flag, which taking an interrupt clears,
+  // and stcond only stores while it is set
+  asm volatile ("1: ssrf 5 \n\t"
+		"ld.w %0, %1[0] \n\t"
+		"sub %0, -1 \n\t"
+		"stcond %1[0], %0 \n\t"
+		"brne 1b"
+		: "=&r"(s) : "r"(&postSeq) : "cc", "memory");
+  return s - 1;
 #else
-  u8 status;
-  cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
-  
-  // if pointers are equal, the queue is empty... don't allow idx's to wrap!
-  if ( getIdx != putIdx ) {
-    INCR_EVENT_INDEX( getIdx );
-    e->type = sysEvents[ getIdx ].type;
-    e->data = sysEvents[ getIdx ].data;
-    status = true;
-  } else {
-    e->type  = 0xff;
-    e->data = 0;
-    status = false;
+  return __sync_fetch_and_add(&postSeq, 1);
+#endif
+}
+
+// latch of an event type, or -1
+static inline s8 event_latch(etype type) {
+  if(type >= kNumEventTypes) { return -1; }
+  return (s8)latchOf[type] - 1;
+}
+
+// return 1 if an event of latch k (or none, -1) fits in the merge queue
+static inline u8 event_merge_room(s8 k) {
+  return (k >= 0 && pending[k] >= 0) || (u8)(mergePut - mergeGet) < MERGE_EVENTS;
+}
+
+// add one event to the merge queue;
+// stamp is the posting stamp of a latched event's data
+// return 0 if it is full
+static u8 event_merge(const event_t* e, u32 stamp) {
+  const s8 k = event_latch(e->type);
+  event_t* p;
+
+  if(k >= 0 && pending[k] >= 0) {
+    // fold into the one waiting
+    p = &(merged[pending[k]]);
+    if(latchTypes[k].merge == eEventMergeSum) {
+      p->data += e->data;
+    } else if((s32)(stamp - pendingStamp[k]) >= 0) {
+      // another context's latch may hold older data
+      p->data = e->data;
+      pendingStamp[k] = stamp;
+    }
+    ++coalesced;
+    return 1;
   }
 
-  cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
-  return status;
-#endif
+  if((u8)(mergePut - mergeGet) == MERGE_EVENTS) { return 0; }
+  merged[mergePut & MERGE_MASK] = *e;
+  if(k >= 0) {
+    pending[k] = mergePut & MERGE_MASK;
+    pendingStamp[k] = stamp;
+  }
+  ++mergePut;
+  return 1;
 }
 
+// move a latch's change, if any, to the merge queue
+// return 0 if it is full
+static u8 event_take_latch(eventRing* r, u8 k) {
+  const u32 count = r->latchCount[k];
+  event_t e;
+  u32 data;
+  u32 stamp;
 
-// add event to queue, return success status
-u8 event_post( event_t *e ) {
-#if 1
-    return 0;
-#else
-  u8 status = false;
-  int saveIndex;
-
-  //  print_dbg("\r\n posting event, type: ");
-  //  print_dbg_ulong(e->type);
-
-  cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
-  
-  // increment write idx, posbily wrapping
-  saveIndex = putIdx;
-  INCR_EVENT_INDEX( putIdx );
-  if ( putIdx != getIdx  ) {
-    sysEvents[ putIdx ].type = e->type;
-    sysEvents[ putIdx ].data = e->data;
-    status = true;
+  if(count == r->seenCount[k]) { return 1; }
+  event_barrier();
+  // data is at least as new as count
+  data = r->latchData[k];
+  stamp = r->latchStamp[k];
+  e.type = latchTypes[k].type;
+  if(latchTypes[k].merge == eEventMergeSum) {
+    e.data = (s32)(data - r->takenData[k]);
   } else {
-    // idx wrapped, so queue is full, restore idx
-    putIdx = saveIndex;
-    print_dbg("\r\n event queue full!");
-  } 
+    e.data = (s32)data;
+  }
+  if(!event_merge(&e, stamp)) { return 0; }
+  coalesced += count - r->seenCount[k] - 1;
+  r->seenCount[k] = count;
+  r->takenData[k] = data;
+  return 1;
+}
 
-  cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
-  return status;
-#endif
+// move a context's changed latches to the merge queue;
+// these were posted while the ring was full, so have no marker.
+// return 0 if it is full
+static u8 event_drain_latches(eventRing* r) {
+  const u32 seq = r->latchSeq;
+  u8 k;
+
+  if(seq == r->seenSeq) { return 1; }
+  event_barrier();
+  for(k=0; k<EVENT_LATCHES; ++k) {
+    if(!event_take_latch(r, k)) { return 0; }
+  }
+  r->seenSeq = seq;
+  return 1;
 }
 
+// move the event at the head of a ring to the merge queue
+// return 0 if it is full
+static u8 event_take(eventRing* r) {
+  const event_t e = r->ev[r->get & EVENT_MASK];
+  const s8 k = event_latch(e.type);
 
+  if(k < 0) {
+    if(!event_merge(&e, 0)) { return 0; }
+    event_barrier();
+    ++(r->get);
+    return 1;
+  }
+  // a latch marker.
+  // pass it before reading the latch: a post that misses this read
+  // sees the marker gone, and leaves a new one
+  if(!event_merge_room(k)) { return 0; }
+  ++(r->get);
+  event_barrier();
+  return event_take_latch(r, (u8)k);
+}
+
+// move everything posted so far to the merge queue, in posting order
+static void event_drain(void) {
+  eventRing* r;
+  eventRing* oldest;
+  u32 stamp = 0;
+  u32 put;
+  u8 i;
 
-//////////////////////////////////////////////////////////
-/// testing
-//u32 get_max_events(void) { return MAX_EVENTS; }
-//extern event_t* get_sys_events(void) { return (event_t*)sysEvents; }
-/*
-void print_pending_events(void) {
-  u32 i;
-  i = getIdx;
+  for(;;) {
+    // the ring whose head was posted first
+    oldest = 0;
+    for(i=0; i<EVENT_CONTEXTS; ++i) {
+      r = &(rings[i]);
+      put = r->put;
+      event_barrier();
+      if(r->get == put) { continue; }
+      if(oldest == 0 || (s32)(r->stamp[r->get & EVENT_MASK] - stamp) < 0) {
+	oldest = r;
+	stamp = r->stamp[r->get & EVENT_MASK];
+      }
+    }
+    if(oldest == 0) { break; }
+    // if the merge queue is full, the rest waits
+    if(!event_take(oldest)) { return; }
+  }
+  for(i=0; i<EVENT_CONTEXTS; ++i) {
+    if(!event_drain_latches(&(rings[i]))) { return; }
+  }
+}
 
-  while(i != putIdx) {
-    print_dbg("\r\n  pending system events:");
-    
-    print_dbg("\r\v event at idx ");
-    print_dbg_ulong(i);
-    print_dbg(" type: ");
-    print_dbg_ulong( sysEvents[i].type);
-    print_dbg(" data: 0x");
-    print_dbg_hex(sysEvents[i].type);
+//-----------------------------
+//---- external functions
 
-    INCR_EVENT_INDEX(i);
+// initializes (or re-initializes)  the system event queue.
+void init_events( void ) {
+  eventRing* r;
+  u8 i;
+  u8 k;
+  for(i=0; i<EVENT_CONTEXTS; ++i) {
+    r = &(rings[i]);
+    r->put = 0;
+    r->get = 0;
+    r->posted = 0;
+    r->dropped = 0;
+    r->highWater = 0;
+    r->latchSeq = 0;
+    r->seenSeq = 0;
+    for(k=0; k<EVENT_LATCHES; ++k) {
+      // no marker waiting
+      r->markPut[k] = (u32)-1;
+      r->latchData[k] = 0;
+      r->latchCount[k] = 0;
+      r->latchStamp[k] = 0;
+      r->seenCount[k] = 0;
+      r->takenData[k] = 0;
+    }
+  }
+  for(i=0; i<kNumEventTypes; ++i) {
+    latchOf[i] = 0;
+  }
+  for(k=0; k<EVENT_LATCHES; ++k) {
+    latchOf[latchTypes[k].type] = k + 1;
+    pending[k] = -1;
   }
+  mergePut = 0;
+  mergeGet = 0;
+  coalesced = 0;
+  postSeq = 0;
 }
-*/
-//////////////////////////////
+
+// get next event
+// Returns non-zero if an event was available
+u8 event_next( event_t *e ) {
+  s8 k;
+  event_drain();
+
+  while(mergeGet != mergePut) {
+    *e = merged[mergeGet & MERGE_MASK];
+    ++mergeGet;
+    k = event_latch(e->type);
+    if(k < 0) { return 1; }
+    pending[k] = -1;
+    // latched sums that came to nothing are skipped
+    if(latchTypes[k].merge != eEventMergeSum || e->data != 0) { return 1; }
+  }
+  e->type = 0xff;
+  e->data = 0;
+  return 0;
+}
+
+
+// add event to queue, return success status
+u8 event_post( event_t *e ) {
+  eventRing* r = &(rings[event_context()]);
+  const s8 k = event_latch(e->type);
+  const u32 put = r->put;
+  u32 stamp;
+  u32 get;
+  u32 fill;
+
+  if(k >= 0) {
+    stamp = event_stamp();
+    if(latchTypes[k].merge == eEventMergeSum) {
+      r->latchData[k] += (u32)e->data;
+    } else {
+      r->latchData[k] = (u32)e->data;
+    }
+    r->latchStamp[k] = stamp;
+    event_barrier();
+    ++(r->latchCount[k]);
+    event_barrier();
+    ++(r->latchSeq);
+    ++(r->posted);
+    // read get after the count: if the reader has passed the last marker,
+    // it may have read the latch before this post, so leave a new one
+    get = r->get;
+    if((s32)(r->markPut[k] - get) < 0 && put - get < MAX_EVENTS) {
+      r->ev[put & EVENT_MASK] = *e;
+      r->stamp[put & EVENT_MASK] = stamp;
+      r->markPut[k] = put;
+      event_barrier();
+      r->put = put + 1;
+    }
+    // if the ring is full, the reader sweeps the latch when it catches up
+    return 1;
+  }
+
+  fill = put - r->get;
+  if(fill >= MAX_EVENTS) {
+    // full; the reader is behind
+    ++(r->dropped);
+    return 0;
+  }
+  r->ev[put & EVENT_MASK] = *e;
+  r->stamp[put & EVENT_MASK] = event_stamp();
+  event_barrier();
+  r->put = put + 1;
+  ++(r->posted);
+  if(fill + 1 > r->highWater) { r->highWater = fill + 1; }
+  return 1;
+}
+
+void event_get_stats( u8 ctx, eventQueueStats* st ) {
+  eventRing* r = &(rings[ctx]);
+  st->posted = r->posted;
+  st->dropped = r->dropped;
+  st->highWater = r->highWater;
+}
+
+u32 event_coalesced( void ) {
+  return coalesced;
+}
+
+#ifndef ARCH_AVR32
+void event_set_context( u8 ctx ) {
+  eventContext = ctx;
+}
+#endif
@@ -17,6 +17,20 @@ typedef struct {
   s32 data;
 } event_t;
 
+// posting contexts: the main loop, and interrupt levels INT0-INT3.
+// each context posts into its own queue.
+#define EVENT_CONTEXTS 5
+
+// per-context queue counters
+typedef struct {
+  // events queued
+  u32 posted;
+  // events dropped because the queue was full
+  u32 dropped;
+  // most events ever waiting in the queue
+  u32 highWater;
+} eventQueueStats;
+
 
 // init event queue
 void init_events( void );
@@ -31,6 +45,18 @@ u8 event_next( event_t *e );
 // return 1 if success
 u8 event_post( event_t *e );
 
+// counters for one context's queue
+void event_get_stats( u8 ctx, eventQueueStats* st );
+
+// events merged into one already pending
+u32 event_coalesced( void );
+
+#ifndef ARCH_AVR32
+// the host has no interrupt levels;
+// a thread standing in for an interrupt sets its context here.
+void event_set_context( u8 ctx );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,8 @@
  * pixel(x,y) = (bool)(font_data[x].data & (1 << y)) */
 
 //#include "compiler.h"
+#include <string.h>
+
 #include "types.h"
 #include "font.h"
 
@@ -384,116 +386,289 @@ u8* font_string_bigbig(const char* str, u8* buf, u32 size, u8 w, u8 a, u8 b) {
 //-------------
 //----- anti-aliased fonts (bitmaps)
 
-// render an anti-aliased (4-bit) glyph to a buffer
-// arguments are character, buffer, target row size, invert flag
-extern u8* font_glyph_aa(char ch, u8* buf, u8 w, u8 inv) {
-  //#if 0
-  const char* gl; // glyph data
-  //  u8 gw, gh; // glyph width and height
-  u8 i, j;
-  // how many bytes to move buf pointer for 1st column of next row
-  u32 nextRowBytes;
-    // buf pointer;
-  char* p;
-  // pointer to copy function
-  //  void (*fp)(const char* src, char* dst);
-  
-  // fixme: wtf why
-  //  if(inv) { fp = &copyPxInv; } else { fp = &copyPx; }
-
-#if 0
-  /// FIXME: might want only numerals
-  //// hackish
-  if( (ch > 45) && (ch < 58)) { // dot + numerals
-    gl = FONT_AA[ch - 46].glyph.data;
-    // print_dbg("\r\n printing numeral ");
-    // print_dbg_char(ch);
-    // print_dbg(" , glyphidx: ");
-    // print_dbg_ulong(ch - 46);
-  } else { 
-    return buf;
+/*
+glyphs are drawn from an atlas, packed 2px per byte,
+generated from the font table by utils/tabletool/glyph_atlas.
+a glyph row is one 32-bit word with the first 8 pixels, plus one nibble.
+in a word, byte k has pixel k in its low nibble and pixel k+4 in its high nibble,
+so a word unpacks to 8 target pixels with two masks, and inverting is an XOR.
+strings drawn more than once are cached in the same format, keyed on (string, font, invert).
+*/
+
+#define FONT_AA_NGLYPHS FONT_UME_TG05_18_NGLYPHS
+
+#if FONT_AA_CHARW != 9
+#error "glyph atlas rows are 8 pixels + 1"
+#endif
+
+// low nibble of each byte
+#define FONT_AA_NIB 0x0f0f0f0f
+
+// cached strings
+#define FONT_AA_CACHE_ENTRIES 4
+// longest cached string
+#define FONT_AA_CACHE_CHARS 10
+// words per cached row
+#define FONT_AA_CACHE_WORDS ((FONT_AA_CACHE_CHARS * FONT_AA_CHARW + 7) >> 3)
+// recent misses remembered; a string is cached when it misses twice
+#define FONT_AA_CACHE_SEEN 8
+
+//-----------------------------
+//---- types
+
+// packed glyph row; the atlas data initializes the bytes
+typedef union {
+  u8 b[4];
+  u32 w;
+} glyphRowAa;
+
+// packed glyph
+typedef struct {
+  // first 8 pixels of each row
+  glyphRowAa rows[FONT_AA_CHARH];
+  // last column, 2 rows per byte
+  u8 last[(FONT_AA_CHARH + 1) >> 1];
+} glyphAa;
+
+// rendered string
+typedef struct {
+  // key
+  const void* font;
+  u8 inv;
+  u8 len;
+  char str[FONT_AA_CACHE_CHARS];
+  // last use, 0 if empty
+  u32 used;
+  // pixels, inverted if inv is set
+  u32 rows[FONT_AA_CHARH][FONT_AA_CACHE_WORDS];
+} stringAa;
+
+//-----------------------------
+//---- static variables
+
+static const glyphAa atlas[FONT_AA_NGLYPHS] = {
+#include "fonts/ume_tgo5_18_atlas_inc.c"
+};
+
+static stringAa cache[FONT_AA_CACHE_ENTRIES];
+static u32 cacheClock = 0;
+static u32 cacheSeen[FONT_AA_CACHE_SEEN];
+static u8 cacheSeenIdx = 0;
+static fontAaStats stats = { 0, 0 };
+
+//-----------------------------
+//---- static functions
+
+// set pixel p of a packed row
+static inline void packed_set(u32* row, u32 p, u8 v) {
+  u8* b = (u8*)row + ((p >> 3) << 2) + (p & 3);
+  if(p & 4) {
+    *b = (*b & 0x0f) | (v << 4);
+  } else {
+    *b = (*b & 0xf0) | (v & 0xf);
+  }
+}
+
+// unpack 8 pixels to the target
+static inline void packed_put8(u8* dst, u32 px) {
+  const u32 lo = px & FONT_AA_NIB;
+  const u32 hi = (px >> 4) & FONT_AA_NIB;
+  if(((size_t)dst & 3) == 0) {
+    ((u32*)dst)[0] = lo;
+    ((u32*)dst)[1] = hi;
+  } else {
+    memcpy(dst, &lo, 4);
+    memcpy(dst + 4, &hi, 4);
   }
-#else
-  //  gl = FONT_AA[ch - FONT_ASCII_OFFSET].glyph.data;
-  /// flaarggg
-  //  print_dbg("\r\n render glyph: ");
-  //  print_dbg_char(ch);
-  //  print_dbg(" ( 0x");
-  //  print_dbg_hex((u32)ch);
-  
+}
+
+// unpack n < 8 pixels to the target
+static inline void packed_put_part(u8* dst, u32 px, u8 n) {
+  u8 tmp[8];
+  packed_put8(tmp, px);
+  memcpy(dst, tmp, n);
+}
+
+// pack 8 target pixels
+static inline u32 packed_get8(const u8* src) {
+  u32 px;
+  u8* b = (u8*)&px;
+  b[0] = (src[0] & 0xf) | (src[4] << 4);
+  b[1] = (src[1] & 0xf) | (src[5] << 4);
+  b[2] = (src[2] & 0xf) | (src[6] << 4);
+  b[3] = (src[3] & 0xf) | (src[7] << 4);
+  return px;
+}
+
+// glyph index of a character
+static inline u8 glyph_index(char ch) {
+  u8 idx;
   ////////
   /// FIXME: font is missing ` or _ or something
   if(ch > 95) { ch--; }
   ////////
-  gl = FONT_AA[ch - FONT_ASCII_OFFSET].glyph.data;
-#endif
-  /// copy glyph to buffer...
-  p = (char*)buf;
-  nextRowBytes = w - FONT_AA_CHARW;
-  //  print_dbg("\r\n");
-  //  print_dbg("\r\n");
-
-  if(inv) {
-    // loop over rows
-    for(i=0; i<FONT_AA_CHARH; i++) {
-      // loop over columns
-      for(j=0; j<FONT_AA_CHARW; j++) {
-	//	print_dbg_char(*gl + 0x20);
-	//      print_dbg(dbgStr[(u32)(*gl)]);
-	//	print_dbg(" ");
-	// copy/invert pixel and advance pointers
-	*p++ = 0xf - *gl++;
-      }
-      //      print_dbg("\r\n");
-      // reset column and advance row
-      p += nextRowBytes;
+  idx = (u8)(ch - FONT_ASCII_OFFSET);
+  // unknown characters get a space
+  return idx < FONT_AA_NGLYPHS ? idx : 0;
+}
+
+// copy a glyph from the atlas; mask is 0, or all ones to invert
+static inline u8* glyph_blit(const glyphAa* g, u8* buf, u8 w, u32 mask) {
+  u8* p = buf;
+  u8 i;
+  for(i=0; i<FONT_AA_CHARH; i++) {
+    packed_put8(p, g->rows[i].w ^ mask);
+    p[8] = ((g->last[i >> 1] >> ((i & 1) << 2)) ^ mask) & 0xf;
+    p += w;
+  }
+  return buf + FONT_AA_CHARW;
+}
+
+// find a cached string, or 0
+static stringAa* cache_find(const char* str, u8 len, u8 inv) {
+  stringAa* e;
+  u8 i;
+  for(i=0; i<FONT_AA_CACHE_ENTRIES; i++) {
+    e = &(cache[i]);
+    if(e->used && e->len == len && e->inv == inv && e->font == (const void*)FONT_AA
+       && memcmp(e->str, str, len) == 0) {
+      return e;
     }
-    // return original buf pointer plus glyph width
-  } else {
-    // loop over rows
-    for(i=0; i<FONT_AA_CHARH; i++) {
-      // loop over columns
-      for(j=0; j<FONT_AA_CHARW; j++) {
-	//	print_dbg_char(*gl + 0x20);
-	//      print_dbg(dbgStr[(u32)(*gl)]);
-	//	print_dbg(" ");
-	// copy pixel and advance pointers
-	*p++ = *gl++;
-      }
-      //      print_dbg("\r\n");
-      // reset column and advance row
-      p += nextRowBytes;
+  }
+  return 0;
+}
+
+// note a miss; return 1 if the string missed recently
+static u8 cache_seen(const char* str, u8 len, u8 inv) {
+  u32 h = 2166136261u ^ inv;
+  u8 i;
+  for(i=0; i<len; i++) {
+    h = (h ^ (u8)str[i]) * 16777619u;
+  }
+  // 0 marks an empty slot
+  if(h == 0) { h = 1; }
+  for(i=0; i<FONT_AA_CACHE_SEEN; i++) {
+    if(cacheSeen[i] == h) { return 1; }
+  }
+  cacheSeen[cacheSeenIdx] = h;
+  cacheSeenIdx = (cacheSeenIdx + 1) % FONT_AA_CACHE_SEEN;
+  return 0;
+}
+
+// copy rendered pixels from the target into the least recently used entry
+static stringAa* cache_store(const char* str, u8 len, u8 inv, const u8* buf, u8 w) {
+  const u32 px = (u32)len * FONT_AA_CHARW;
+  stringAa* e = &(cache[0]);
+  u32 k;
+  u8 i;
+  for(i=1; i<FONT_AA_CACHE_ENTRIES; i++) {
+    if(cache[i].used < e->used) { e = &(cache[i]); }
+  }
+  e->font = (const void*)FONT_AA;
+  e->inv = inv;
+  e->len = len;
+  memcpy(e->str, str, len);
+  for(i=0; i<FONT_AA_CHARH; i++) {
+    for(k=0; k + 8 <= px; k += 8) {
+      e->rows[i][k >> 3] = packed_get8(buf + k);
+    }
+    for(; k<px; k++) {
+      packed_set(e->rows[i], k, buf[k]);
     }
+    buf += w;
   }
-  // return original buf pointer plus glyph width
-  return buf + FONT_AA_CHARW;
-  //#endif
+  return e;
+}
+
+// copy a cached string to the target
+static u8* cache_blit(const stringAa* e, u8* buf, u8 w) {
+  const u32 px = (u32)e->len * FONT_AA_CHARW;
+  const u32 words = px >> 3;
+  const u8 rem = px & 7;
+  const u32* src;
+  u8* p;
+  u32 k;
+  u8 i;
+  for(i=0; i<FONT_AA_CHARH; i++) {
+    src = e->rows[i];
+    p = buf + (u32)i * w;
+    for(k=0; k<words; k++) {
+      packed_put8(p, *src++);
+      p += 8;
+    }
+    if(rem) { packed_put_part(p, *src, rem); }
+  }
+  return buf + px;
+}
+
+//-----------------------------
+//---- external functions
+
+// render an anti-aliased (4-bit) glyph to a buffer
+// arguments are character, buffer, target row size, invert flag
+extern u8* font_glyph_aa(char ch, u8* buf, u8 w, u8 inv) {
+  return glyph_blit(&(atlas[glyph_index(ch)]), buf, w, inv ? 0xffffffff : 0);
 }
 
 // render a string of packed glyphs to a buffer
 extern u8* font_string_aa(const char* str, u8* buf, u32 size, u8 w, u8 inv) {
   u8* max = buf + size;
-  // print_dbg("\r\n antialiased string \"");
-  // print_dbg(str);
-  // print_dbg("\" font w, h: (");
-  // print_dbg_ulong(FONT_AA_CHARW);
-  // print_dbg(" , ");
-  // print_dbg_ulong(FONT_AA_CHARH);
-  // print_dbg(" ) , buf w: ");
-  // print_dbg_ulong(w);
+  const u32 mask = inv ? 0xffffffff : 0;
+  stringAa* e;
+  u8* p = buf;
+  u32 len = 0;
+  u8 cached;
 
   /// FIXME: this bounds check looks wrong
-  while (buf < max) {
-    if (*str == 0) {
+  // count the glyphs that would be drawn
+  while (p < max) {
+    if (str[len] == 0) {
       // end of string
       break;
     }
-    buf = font_glyph_aa(*str, buf, w, inv);
-    // 1-column space between chars
-    //    buf++;
-    //// cutting the fonts with space included
-    //// so that background doesn't bleed through here
+    p += FONT_AA_CHARW;
+    len++;
+  }
+  if(len == 0) { return buf; }
+
+  inv = inv ? 1 : 0;
+  // cache strings that fit in a row
+  cached = (len <= FONT_AA_CACHE_CHARS) && (len * FONT_AA_CHARW <= w);
+
+  if(cached) {
+    e = cache_find(str, (u8)len, inv);
+    if(e != 0) {
+      ++(stats.hits);
+      e->used = ++cacheClock;
+      return cache_blit(e, buf, w);
+    }
+    ++(stats.misses);
+    // strings seen once (a changing value) aren't worth storing
+    cached = cache_seen(str, (u8)len, inv);
+  }
+
+  // draw each glyph from the atlas
+  //// cutting the fonts with space included
+  //// so that background doesn't bleed through here
+  p = buf;
+  while(*str != 0 && p < max) {
+    p = glyph_blit(&(atlas[glyph_index(*str)]), p, w, mask);
     str++;
   }
-  return buf;  
+
+  if(cached) {
+    e = cache_store(str - len, (u8)len, inv, buf, w);
+    e->used = ++cacheClock;
+  }
+  return p;
+}
+
+// cache counters
+extern void font_aa_get_stats(fontAaStats* st) {
+  *st = stats;
+}
+
+extern void font_aa_clear_stats(void) {
+  stats.hits = 0;
+  stats.misses = 0;
 }
@@ -65,6 +65,12 @@ extern void font_string_region_clip(region* reg, const char* str, u8 x, u8 y, u8
 
 ///--- anti-aliased
 
+// string cache counters
+typedef struct _fontAaStats {
+  u32 hits;
+  u32 misses;
+} fontAaStats;
+
 // render an anti-aliased (4-bit) glyph to a buffer
 // arguments are character, buffer, target row size, invert flag
 extern u8* font_glyph_aa(char ch, u8* buf, u8 w, u8 invert);
@@ -72,6 +78,10 @@ extern u8* font_glyph_aa(char ch, u8* buf, u8 w, u8 invert);
 // render a string of ant-aliased glyphs to a buffer
 extern u8* font_string_aa(const char* str, u8* buf, u32 size, u8 w, u8 invert);
 
+// string cache counters
+extern void font_aa_get_stats(fontAaStats* st);
+extern void font_aa_clear_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,6 +39,7 @@
 #include "app.h"
 #include "bfin.h"
 //#include "conf_tc_irq.h"
+#include "control.h"
 #include "encoders.h"
 #include "events.h"
 #include "filesystem.h"
@@ -364,6 +365,8 @@ void check_events(void) {
   if( event_next(&e) ) {
     (app_event_handlers)[e.type](e.data);
   }
+  // send param changes from this tick as one batch
+  ctl_param_flush();
 }
 
 // !!!!!!!!!!!!!
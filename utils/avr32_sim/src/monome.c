@@ -17,11 +17,36 @@
 #define MONOME_SERSTR_LEN 9
 // tx buffer length
 #define MONOME_TX_BUF_LEN 72
+// largest transfer: one full-speed usb bulk packet
+#define MONOME_TX_PACKET 64
+// bytes sent per refresh, at most (two packets);
+// changes past this are sent on the next refresh
+#define MONOME_TX_BUDGET 128
+
+// mext led messages, and their sizes
+#define MEXT_LEVEL_SET 0x18
+#define MEXT_LEVEL_MAP 0x1A
+#define MEXT_LEVEL_ROW 0x1B
+#define MEXT_LEVEL_COL 0x1C
+#define MEXT_RING_SET  0x90
+#define MEXT_RING_MAP  0x92
+#define MEXT_SET_BYTES 4
+#define MEXT_LINE_BYTES 7
+#define MEXT_MAP_BYTES 35
+#define MEXT_RING_SET_BYTES 4
+#define MEXT_RING_MAP_BYTES 34
 
 // level above which an LED must be set to be displayed on mono-brightness grid
 #define VB_CUTOFF 7
 //------- typedefs
 
+// how a mext grid quadrant is updated
+typedef enum {
+  eMextRows,  // per changed row, a row or single-led set
+  eMextCols,  // per changed column, a column or single-led set
+  eMextMap    // the whole quadrant
+} eMextUpdate;
+
 //--- descriptor types
 
 // protocol enumeration
@@ -89,6 +114,17 @@ static u8 rxBytes;
 static event_t ev;
 // local tx buffer
 static u8 txBuf[MONOME_TX_BUF_LEN];
+// bytes queued in tx buffer
+static u8 txLen = 0;
+
+// led levels last sent to the device,
+// and the frames (quadrants or rings) for which they are known
+static u8 ledSent[MONOME_MAX_LED_BYTES];
+static u8 ledSentValid = 0;
+// frame to check first on the next refresh
+static u8 frameFirst = 0;
+// tx counters
+static monomeTxStats txStats = { 0, 0, 0, 0 };
 
 //---------------------------------------------
 //------ static function declarations
@@ -116,6 +152,11 @@ static void set_intense_mext(u8 level);
 /* static void grid_led_series(u8 x, u8 y, u8 val); */
 /* static void grid_led_mext(u8 x, u8 y, u8 val); */
 
+static void tx_send(u8 n);
+static void tx_flush(void);
+static u8* tx_reserve(u8 n);
+static void grid_refresh_mext(void);
+
 static void grid_map_40h(u8 x, u8 y, const u8* data);
 static void grid_map_series(u8 x, u8 y, const u8* data);
 static void grid_map_mext(u8 x, u8 y, const u8* data);
@@ -282,7 +323,16 @@ u8 check_monome_device_desc(char* mstr, char* pstr, char* sstr) {
 // check dirty flags and refresh leds
 void monome_grid_refresh(void) {
   // may need to wait after each quad until tx transfer is complete
-  u8 busy = ftdi_tx_busy();
+  u8 busy;
+  u32 bytes = txStats.bytes;
+
+  if(mdesc.protocol == eProtocolMext) {
+    // only send what changed
+    grid_refresh_mext();
+    return;
+  }
+
+  busy = ftdi_tx_busy();
 
   // check quad 0
   if( monomeFrameDirty & 0b0001 ) {
@@ -319,26 +369,74 @@ void monome_grid_refresh(void) {
     }
   }
   while( busy ) { busy = ftdi_tx_busy(); }
+  txStats.lastBytes = txStats.bytes - bytes;
+  if(txStats.lastBytes) { ++(txStats.refreshes); }
 }
 
 
 // check flags and refresh arc
+// each dirty ring is sent as single-led sets, or a map if that's smaller.
 void monome_arc_refresh(void) {
-  // may need to wait after each quad until tx transfer is complete
-  u8 busy = ftdi_tx_busy();
-  u8 i;
-
-  for(i=0; i<mdesc.encs; i++) {
-    if(monomeFrameDirty & (1<<i)) {
-      //      if(i==1) print_dbg("\r\nsecond");
-      while(busy) { busy = ftdi_tx_busy(); }
-      (*monome_ring_map)(i, monomeLedBuffer + (i<<6));
-      monomeFrameDirty &= ~(1<<i);
-      busy = 1;
+  const u8* data;
+  u8* sent;
+  u8* ptx;
+  u16 cost;
+  u16 bytes = 0;
+  u8 left = 0;
+  u8 i, n, k;
+
+  for(k=0; k<mdesc.encs; k++) {
+    n = (frameFirst + k) % mdesc.encs;
+    if(!(monomeFrameDirty & (1<<n))) { continue; }
+    data = monomeLedBuffer + (n<<6);
+    sent = ledSent + (n<<6);
+    if(ledSentValid & (1<<n)) {
+      cost = 0;
+      for(i=0; i<64; i++) {
+	if(data[i] != sent[i]) { cost += MEXT_RING_SET_BYTES; }
+      }
+      if(cost > MEXT_RING_MAP_BYTES) { cost = MEXT_RING_MAP_BYTES; }
+    } else {
+      cost = MEXT_RING_MAP_BYTES;
+    }
+    if(cost == 0) { continue; }
+    if(bytes > 0 && bytes + cost > MONOME_TX_BUDGET) {
+      // out of budget, next time
+      if(left == 0) { frameFirst = n; }
+      left |= (1<<n);
+      ++(txStats.deferred);
+      continue;
+    }
+    if(cost == MEXT_RING_MAP_BYTES) {
+      ptx = tx_reserve(MEXT_RING_MAP_BYTES);
+      *ptx++ = MEXT_RING_MAP;
+      *ptx++ = n;
+      // smash 64 LEDs together, nibbles
+      for(i=0; i<64; i+=2) {
+	*ptx++ = (data[i] << 4) | (data[i+1] & 0xf);
+      }
+      memcpy(sent, data, 64);
+    } else {
+      for(i=0; i<64; i++) {
+	if(data[i] == sent[i]) { continue; }
+	ptx = tx_reserve(MEXT_RING_SET_BYTES);
+	*ptx++ = MEXT_RING_SET;
+	*ptx++ = n;
+	*ptx++ = i;
+	*ptx = data[i] & 0xf;
+	sent[i] = data[i];
+      }
     }
+    ledSentValid |= (1<<n);
+    bytes += cost;
   }
+  tx_flush();
+  // wait until tx transfer is complete
+  while( ftdi_tx_busy() ) { ;; }
 
-  while( busy ) { busy = ftdi_tx_busy(); }
+  monomeFrameDirty = left;
+  txStats.lastBytes = bytes;
+  if(bytes) { ++(txStats.refreshes); }
 }
 
 
@@ -503,6 +601,17 @@ u8 monome_is_vari(void) {  return mdesc.vari; }
 
 eMonomeDevice monome_device(void) { return mdesc.device; }
 
+void monome_get_tx_stats(monomeTxStats* st) {
+  *st = txStats;
+}
+
+void monome_clear_tx_stats(void) {
+  txStats.refreshes = 0;
+  txStats.bytes = 0;
+  txStats.lastBytes = 0;
+  txStats.deferred = 0;
+}
+
 //=============================================
 //------ static function definitions
 
@@ -516,6 +625,10 @@ static inline void set_funcs(void) {
   monome_ring_map = ringMapFuncs[mdesc.protocol];
   monome_set_intense = intenseFuncs[mdesc.protocol];
   monome_refresh = refreshFuncs[mdesc.device == eDeviceArc];   // toggle on grid vs arc
+  // new device; what it shows is unknown
+  ledSentValid = 0;
+  frameFirst = 0;
+  txLen = 0;
 }
 
 /////////////////////////////////////////////////////
@@ -793,6 +906,213 @@ static void read_serial_mext(void) {
 
 //--- tx
 
+// send n bytes from the tx buffer
+static void tx_send(u8 n) {
+  ftdi_write(txBuf, n);
+  txStats.bytes += n;
+}
+
+// send queued messages
+static void tx_flush(void) {
+  if(txLen > 0) {
+    tx_send(txLen);
+    txLen = 0;
+  }
+}
+
+// queue a message of n bytes, return where to write it.
+// messages are batched into packets.
+static u8* tx_reserve(u8 n) {
+  u8* ptx;
+  if(txLen + n > MONOME_TX_PACKET) {
+    tx_flush();
+  }
+  if(txLen == 0) {
+    // buffer may still be in use by the last transfer
+    while( ftdi_tx_busy() ) { ;; }
+  }
+  ptx = txBuf + txLen;
+  txLen += n;
+  return ptx;
+}
+
+// count set bits
+static inline u8 bit_count(u8 b) {
+  u8 n = 0;
+  while(b) {
+    b &= b - 1;
+    n++;
+  }
+  return n;
+}
+
+// bytes to send the changes of 8 lines (rows or columns),
+// given a mask of changed leds on each
+static inline u16 mext_lines_cost(const u8* mask) {
+  u16 cost = 0;
+  u8 i;
+  for(i=0; i<MONOME_QUAD_LEDS; i++) {
+    if(mask[i] == 0) { continue; }
+    cost += (bit_count(mask[i]) == 1) ? MEXT_SET_BYTES : MEXT_LINE_BYTES;
+  }
+  return cost;
+}
+
+// compare a quadrant with what was sent;
+// return cost in bytes of the cheapest update (0 if none), and which it is
+static u16 grid_quad_diff(u8 x0, u8 y0, u8* rowMask, u8* colMask, eMextUpdate* how) {
+  const u8 q = (x0 > 7) | ((y0 > 7) << 1);
+  const u8* data = monomeLedBuffer + monome_xy_idx(x0, y0);
+  const u8* sent = ledSent + monome_xy_idx(x0, y0);
+  u16 costRows, costCols;
+  u8 i, j;
+
+  for(i=0; i<MONOME_QUAD_LEDS; i++) {
+    colMask[i] = 0;
+  }
+  *how = eMextMap;
+  if(!(ledSentValid & (1<<q))) {
+    return MEXT_MAP_BYTES;
+  }
+  for(j=0; j<MONOME_QUAD_LEDS; j++) {
+    rowMask[j] = 0;
+    for(i=0; i<MONOME_QUAD_LEDS; i++) {
+      if(data[i] != sent[i]) {
+	rowMask[j] |= (1 << i);
+	colMask[i] |= (1 << j);
+      }
+    }
+    data += MONOME_LED_ROW_BYTES;
+    sent += MONOME_LED_ROW_BYTES;
+  }
+  costRows = mext_lines_cost(rowMask);
+  costCols = mext_lines_cost(colMask);
+  if(costRows == 0) {
+    return 0;
+  }
+  if(costRows <= costCols && costRows < MEXT_MAP_BYTES) {
+    *how = eMextRows;
+    return costRows;
+  }
+  if(costCols < MEXT_MAP_BYTES) {
+    *how = eMextCols;
+    return costCols;
+  }
+  return MEXT_MAP_BYTES;
+}
+
+// pack 8 leds at given stride into 4 bytes of nibbles
+static inline void mext_pack_line(u8* ptx, const u8* data, u8 stride) {
+  u8 i;
+  for(i=0; i<4; i++) {
+    *ptx++ = (data[0] << 4) | (data[stride] & 0xf);
+    data += stride << 1;
+  }
+}
+
+// queue a single-led level set
+static void mext_level_set(u8 x, u8 y) {
+  const u32 idx = monome_xy_idx(x, y);
+  u8* ptx = tx_reserve(MEXT_SET_BYTES);
+  *ptx++ = MEXT_LEVEL_SET;
+  *ptx++ = x;
+  *ptx++ = y;
+  *ptx = monomeLedBuffer[idx] & 0xf;
+  ledSent[idx] = monomeLedBuffer[idx];
+}
+
+// queue changes of a quadrant
+static void grid_quad_send(u8 x0, u8 y0, eMextUpdate how, const u8* rowMask, const u8* colMask) {
+  const u32 idx = monome_xy_idx(x0, y0);
+  u8* ptx;
+  u8 i, j;
+
+  if(how == eMextMap) {
+    ptx = tx_reserve(MEXT_MAP_BYTES);
+    *ptx++ = MEXT_LEVEL_MAP;
+    *ptx++ = x0;
+    *ptx++ = y0;
+    for(j=0; j<MONOME_QUAD_LEDS; j++) {
+      mext_pack_line(ptx, monomeLedBuffer + idx + (j << MONOME_LED_ROW_LS), 1);
+      memcpy(ledSent + idx + (j << MONOME_LED_ROW_LS),
+	     monomeLedBuffer + idx + (j << MONOME_LED_ROW_LS), MONOME_QUAD_LEDS);
+      ptx += 4;
+    }
+    ledSentValid |= 1 << ((x0 > 7) | ((y0 > 7) << 1));
+  } else if(how == eMextRows) {
+    for(j=0; j<MONOME_QUAD_LEDS; j++) {
+      if(rowMask[j] == 0) { continue; }
+      if(bit_count(rowMask[j]) == 1) {
+	for(i=0; !(rowMask[j] & (1 << i)); i++) { ;; }
+	mext_level_set(x0 + i, y0 + j);
+	continue;
+      }
+      ptx = tx_reserve(MEXT_LINE_BYTES);
+      *ptx++ = MEXT_LEVEL_ROW;
+      *ptx++ = x0;
+      *ptx++ = y0 + j;
+      mext_pack_line(ptx, monomeLedBuffer + idx + (j << MONOME_LED_ROW_LS), 1);
+      memcpy(ledSent + idx + (j << MONOME_LED_ROW_LS),
+	     monomeLedBuffer + idx + (j << MONOME_LED_ROW_LS), MONOME_QUAD_LEDS);
+    }
+  } else {
+    for(i=0; i<MONOME_QUAD_LEDS; i++) {
+      if(colMask[i] == 0) { continue; }
+      if(bit_count(colMask[i]) == 1) {
+	for(j=0; !(colMask[i] & (1 << j)); j++) { ;; }
+	mext_level_set(x0 + i, y0 + j);
+	continue;
+      }
+      ptx = tx_reserve(MEXT_LINE_BYTES);
+      *ptx++ = MEXT_LEVEL_COL;
+      *ptx++ = x0 + i;
+      *ptx++ = y0;
+      mext_pack_line(ptx, monomeLedBuffer + idx + i, MONOME_LED_ROW_BYTES);
+      for(j=0; j<MONOME_QUAD_LEDS; j++) {
+	ledSent[idx + i + (j << MONOME_LED_ROW_LS)] = monomeLedBuffer[idx + i + (j << MONOME_LED_ROW_LS)];
+      }
+    }
+  }
+}
+
+// send what changed since the last refresh.
+// every quadrant is compared with what the grid shows,
+// so the dirty flags only say that a refresh is wanted.
+static void grid_refresh_mext(void) {
+  const u8 quads = 1 | ((mdesc.cols > 8) << 1) | ((mdesc.rows > 8) << 2)
+    | (((mdesc.cols > 8) && (mdesc.rows > 8)) << 3);
+  u8 rowMask[MONOME_QUAD_LEDS];
+  u8 colMask[MONOME_QUAD_LEDS];
+  eMextUpdate how;
+  u16 cost;
+  u16 bytes = 0;
+  u8 left = 0;
+  u8 i, q;
+
+  for(i=0; i<MONOME_GRID_MAX_FRAMES; i++) {
+    q = (frameFirst + i) & 3;
+    if(!(quads & (1<<q))) { continue; }
+    cost = grid_quad_diff((q & 1) << 3, (q & 2) << 2, rowMask, colMask, &how);
+    if(cost == 0) { continue; }
+    if(bytes > 0 && bytes + cost > MONOME_TX_BUDGET) {
+      // out of budget, next time
+      if(left == 0) { frameFirst = q; }
+      left |= (1<<q);
+      ++(txStats.deferred);
+      continue;
+    }
+    grid_quad_send((q & 1) << 3, (q & 2) << 2, how, rowMask, colMask);
+    bytes += cost;
+  }
+  tx_flush();
+  // wait until tx transfer is complete
+  while( ftdi_tx_busy() ) { ;; }
+
+  monomeFrameDirty = left;
+  txStats.lastBytes = bytes;
+  if(bytes) { ++(txStats.refreshes); }
+}
+
 ///// not using per-led updates.  
 /* static void grid_led_40h(u8 x, u8 y, u8 val) { */
 /*   // TODO */
@@ -846,7 +1166,7 @@ static void grid_map_mext( u8 x, u8 y, const u8* data ) {
     data += MONOME_QUAD_LEDS; // skip the rest of the row to get back in target quad
     // ptx++;
   }
-  ftdi_write(txBuf, 32 + 3);
+  tx_send(32 + 3);
 }
 
 
@@ -878,7 +1198,7 @@ static void grid_map_40h(u8 x, u8 y, const u8* data) {
     // print_dbg(" row data: 0x");
     // print_dbg_hex(txBuf[(i*2) + 1]);
   }
-  ftdi_write(txBuf, 16);
+  tx_send(16);
 }
 
 static void grid_map_series(u8 x, u8 y, const u8* data) {
@@ -909,7 +1229,7 @@ static void grid_map_series(u8 x, u8 y, const u8* data) {
     data += MONOME_QUAD_LEDS; // skip the rest of the row to get back in target quad
     ++ptx;
   }
-  ftdi_write(txBuf, MONOME_QUAD_LEDS + 1);  
+  tx_send(MONOME_QUAD_LEDS + 1);
 }
 
 /* static void grid_map_level_mext(u8 x, u8 y, const u8* data) { */
@@ -935,7 +1255,7 @@ static void ring_map_mext(u8 n, u8* data) {
     ptx++;
   }
 
-  ftdi_write(txBuf, 32 + 2);
+  tx_send(32 + 2);
 }
 
 static void set_intense_series(u8 v) {
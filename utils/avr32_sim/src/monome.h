@@ -48,6 +48,18 @@ extern "C" {
 // map is varibright, 4 bytes per led, 64 leds
 #define MONOME_RING_MAP_SIZE  32
 
+// tx counters
+typedef struct _monomeTxStats {
+  // refreshes that sent anything
+  u32 refreshes;
+  // bytes sent
+  u32 bytes;
+  // bytes sent by the last refresh
+  u32 lastBytes;
+  // frames put off to a later refresh, over the tx budget
+  u32 deferred;
+} monomeTxStats;
+
 // device enumeration
 typedef enum {
   eDeviceGrid,   /// any grid device
@@ -122,7 +134,9 @@ void set_monome_device_desc_osc_dummy(u8 cols, u8 rows);
 // check monome device  from FTDI string descriptors
 extern u8 check_monome_device_desc(char* mstr, char* pstr, char* sstr);
 
-// check dirty flags and refresh leds
+// check dirty flags and refresh leds.
+// mext grids are sent only what changed since the last refresh;
+// frames over the tx budget stay dirty for the next one.
 extern void monome_grid_refresh(void);
 
 // check dirty flags and refresh leds
@@ -210,6 +224,10 @@ extern u8 monome_is_vari(void);
 
 extern eMonomeDevice monome_device(void);
 
+// tx counters
+extern void monome_get_tx_stats(monomeTxStats* st);
+extern void monome_clear_tx_stats(void);
+
 
 #ifdef __cplusplus
 }
@@ -196,7 +196,13 @@ void scroll_region_back(scroll* scr, region* reg) {
 
 // draw scroll to screen
 extern void scroll_draw(scroll* scr) {
-  screen_draw_region_offset(0, 0, scr->reg->w, scr->reg->h, scr->reg->len, 
-			    scr->reg->data, scr->byteOff + scr->drawSpace);
+  scroll_compose(scr);
+  screen_flush();
+}
+
+// compose scroll into the screen; sent on the next flush
+extern void scroll_compose(scroll* scr) {
+  screen_compose_region_offset(0, 0, scr->reg->w, scr->reg->h, scr->reg->len, 
+			       scr->reg->data, scr->byteOff + scr->drawSpace);
   scr->reg->dirty = 0;
 }
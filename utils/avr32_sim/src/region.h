@@ -69,6 +69,8 @@ extern void scroll_region_back(scroll* scr, region* reg);
 
 // draw scroll to screen
 extern void scroll_draw(scroll* scr);
+// compose scroll into the screen, without sending
+extern void scroll_compose(scroll* scr);
  
 // allocate and initialize a screen region
 extern void region_alloc(region* reg);
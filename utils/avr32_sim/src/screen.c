@@ -1,6 +1,13 @@
 /* screen.c
    avr32
    aleph
+
+   drawing goes through a compositor:
+   a packed copy of the screen (2px per byte, as the OLED takes them)
+   is kept here. drawing a region packs it into that copy, and only
+   the spans of rows that changed are marked dirty. dirty spans on consecutive
+   rows become rectangles, and rectangles are merged where one transfer
+   costs less than two. a flush sends what is dirty.
 */
 
 
@@ -24,18 +31,43 @@
 #include "global.h"
 #include "screen.h"
 
+//-----------------------------
+//---- defines
+
+// cost of starting a transfer (rect commands), in data bytes
+#define SCREEN_RECT_COST 6
+
+//-----------------------------
+//---- types
+
+// dirty rectangle, in byte columns and rows
+typedef struct _screenRect {
+  u8 x;
+  u8 y;
+  u8 w;
+  u8 h;
+} screenRect;
+
 //-----------------------------
 //---- variables
 // const U8 lines[CHAR_ROWS] = { 0, 8, 16, 24, 32, 40, 48, 56 };
 
-// screen buffer
-// static U8 screenBuf[GRAM_BYTES];
+// packed screen contents, row-major, in drawing orientation
+static u8 screenFb[GRAM_BYTES];
+// transfer buffer: packed and reversed
+static u8 screenBuf[GRAM_BYTES];
 
-// common temp vars
-#if 0
-static u32 i, j;
-static u8* pScr; // movable pointer to screen buf
-static u32 nb; // count of destination bytes
+// dirty rectangles
+static screenRect dirtyRects[SCREEN_DIRTY_RECTS];
+static u8 numDirty = 0;
+
+static screenStats stats = { 0, 0, 0 };
+
+#if 1
+// simulated graphics RAM and its write window
+static u8 gram[GRAM_BYTES];
+static screenRect gramWin = { 0, 0, SCREEN_ROW_BYTES, SCREEN_COL_PX };
+static u32 gramPos = 0;
 #endif
 
 //static u32 pos;
@@ -44,6 +76,7 @@ static u32 nb; // count of destination bytes
 
 static void write_command(U8 c);
 static void write_command(U8 c) {
+  ++(stats.commands);
 #if 1 
 #else
   spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
@@ -59,6 +92,12 @@ static void screen_set_rect(u8 x, u8 y, u8 w, u8 h);
 
 void screen_set_rect(u8 x, u8 y, u8 w, u8 h) {
 #if 1
+  stats.commands += 6;
+  gramWin.x = x;
+  gramWin.y = y;
+  gramWin.w = w;
+  gramWin.h = h;
+  gramPos = 0;
 #else
  // set column address
   write_command(0x15);		// command
@@ -153,95 +192,169 @@ void init_oled(void) {
 }
 
 
-// draw data given target rect
-// assume x-offset and width are both even!
- void screen_draw_region(u8 x, u8 y, u8 w, u8 h, u8* data) {
-#if 1
-#else
-  // 1 row address = 2 horizontal pixels
-  
-  // physical screen memory: 2px = 1byte
-  w >>= 1;
-  x >>= 1;
-  nb = w * h;
+//-----------------------------
+//---- compositor
 
-  /// the screen is mounted upside down!
-  // copy, pack, and reverse into the top of the screen buffer
-  // 2 bytes input -> 1 byte output
-    pScr = (u8*)screenBuf + nb - 1;
-  for(j=0; j<h; j++) {
-    for(i=0; i<w; i++) {
-      // 2 bytes input per 1 byte output
-      *pScr = (0xf0 & ((*data) << 4) );
-      data++;
-      *pScr |= ((*data) & 0xf);
-      data++;
-      pScr--;
+static inline u16 rect_area(const screenRect* r) {
+  return (u16)(r->w) * (u16)(r->h);
+}
+
+static void rect_union(const screenRect* a, const screenRect* b, screenRect* u) {
+  u8 x1 = a->x + a->w > b->x + b->w ? a->x + a->w : b->x + b->w;
+  u8 y1 = a->y + a->h > b->y + b->h ? a->y + a->h : b->y + b->h;
+  u->x = a->x < b->x ? a->x : b->x;
+  u->y = a->y < b->y ? a->y : b->y;
+  u->w = x1 - u->x;
+  u->h = y1 - u->y;
+}
+
+// what merging two rectangles would add to the transfer (may be negative)
+static s32 rect_merge_cost(const screenRect* a, const screenRect* b) {
+  screenRect u;
+  rect_union(a, b, &u);
+  return (s32)rect_area(&u) - rect_area(a) - rect_area(b) - SCREEN_RECT_COST;
+}
+
+// add a dirty rectangle, merging where that is cheaper
+static void screen_mark(screenRect r) {
+  s32 cost, best;
+  u8 i, bi;
+  u8 merged = 1;
+  // merge with anything it pays to merge with, until nothing does
+  while(merged) {
+    merged = 0;
+    for(i=0; i<numDirty; ++i) {
+      if(rect_merge_cost(&r, &(dirtyRects[i])) <= 0) {
+	rect_union(&r, &(dirtyRects[i]), &r);
+	dirtyRects[i] = dirtyRects[--numDirty];
+	merged = 1;
+	break;
+      }
     }
   }
-  
-  // flip the screen coordinates 
-  x = SCREEN_ROW_BYTES - x - w;
-  y = SCREEN_COL_BYTES - y - h;
-  
-  // set drawing region
-  screen_set_rect(x, y, w, h);
-  // select chip for data
-  spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
-  // register select high for data
-  gpio_set_gpio_pin(OLED_REGISTER_PIN);
-  // send data
-  for(i=0; i<(nb); i++) {
-    spi_write(OLED_SPI, screenBuf[i]);
+  if(numDirty == SCREEN_DIRTY_RECTS) {
+    // full; merge with the one that grows least
+    best = rect_merge_cost(&r, &(dirtyRects[0]));
+    bi = 0;
+    for(i=1; i<numDirty; ++i) {
+      cost = rect_merge_cost(&r, &(dirtyRects[i]));
+      if(cost < best) { best = cost; bi = i; }
+    }
+    rect_union(&r, &(dirtyRects[bi]), &r);
+    dirtyRects[bi] = dirtyRects[--numDirty];
   }
-  spi_unselectChip(OLED_SPI, OLED_SPI_NPCS);
-#endif
+  dirtyRects[numDirty++] = r;
 }
 
-// draw data at given rectangle, with starting byte offset within the region data.
-// will wrap to beginning of region
-// useful for scrolling buffers
-void screen_draw_region_offset(u8 x, u8 y, u8 w, u8 h, u32 len, u8* data, u32 off) {
-#if 1
-#else
-  // store region bounds  for wrapping
-  // inclusive lower bound
-  u8* const dataStart = data;
-  // exclusive upper bound
-  u8* const dataEnd = data + len - 1;
-  // begin at specified offset in region
-  data += off;
+// pack region data into the screen buffer, marking what changed.
+// data pixel (i, j) is at (off + j*w + i) mod len.
+static void screen_compose(u8 x, u8 y, u8 w, u8 h, u32 len, const u8* data, u32 off) {
+  const u8* src;
+  u8* dst;
+  u8 b;
+  u32 k;
+  u8 i, j;
+  // changed byte columns in this row, [lo, hi)
+  u8 lo, hi;
+  // open rectangle, on rows above this one
+  screenRect r = { 0, 0, 0, 0 };
+  // region pixels per row
+  const u8 pw = w;
 
   // 1 row address = 2 horizontal pixels
   // physical screen memory: 2px = 1byte
   w >>= 1;
   x >>= 1;
-  nb = len >> 1;
-
-  /// the screen is mounted upside down!
-  // copy, pack, and reverse into the top of the screen buffer
-  // 2 bytes input -> 1 byte output
-  pScr = (u8*)screenBuf + nb - 1;
+  // clip
+  if(x >= SCREEN_ROW_BYTES || y >= SCREEN_COL_PX) { return; }
+  if(x + w > SCREEN_ROW_BYTES) { w = SCREEN_ROW_BYTES - x; }
+  if(y + h > SCREEN_COL_PX) { h = SCREEN_COL_PX - y; }
 
   for(j=0; j<h; j++) {
-    for(i=0; i<w; i++) {
-      // 2 bytes input per 1 byte output
-      *pScr = (0xf0 & ((*data) << 4) );
-      data++;
-      if(data > dataEnd) { data = dataStart; }
-      *pScr |= ((*data) & 0xf);
-      data++;
-      if(data > dataEnd) { data = dataStart; }
-      pScr--;
+    dst = screenFb + (u32)(y + j) * SCREEN_ROW_BYTES + x;
+    k = (off + (u32)j * pw) % len;
+    lo = w;
+    hi = 0;
+    if(k + (w << 1) <= len) {
+      src = data + k;
+      for(i=0; i<w; i++) {
+	// 2 bytes input per 1 byte output
+	b = (0xf0 & (src[0] << 4)) | (src[1] & 0xf);
+	src += 2;
+	if(dst[i] != b) {
+	  dst[i] = b;
+	  if(i < lo) { lo = i; }
+	  hi = i + 1;
+	}
+      }
+    } else {
+      // row wraps around the end of the data
+      for(i=0; i<w; i++) {
+	b = 0xf0 & (data[k] << 4);
+	if(++k == len) { k = 0; }
+	b |= data[k] & 0xf;
+	if(++k == len) { k = 0; }
+	if(dst[i] != b) {
+	  dst[i] = b;
+	  if(i < lo) { lo = i; }
+	  hi = i + 1;
+	}
+      }
+    }
+
+    if(hi == 0) {
+      // no change; close the open rectangle
+      if(r.h > 0) { screen_mark(r); r.h = 0; }
+      continue;
+    }
+    lo += x;
+    hi += x;
+    if(r.h > 0 && lo < r.x + r.w && r.x < hi) {
+      // overlaps the span above; grow
+      if(lo < r.x) { r.w += r.x - lo; r.x = lo; }
+      if(hi > r.x + r.w) { r.w = hi - r.x; }
+      ++r.h;
+    } else {
+      if(r.h > 0) { screen_mark(r); }
+      r.x = lo;
+      r.y = y + j;
+      r.w = hi - lo;
+      r.h = 1;
     }
   }
-  
-  // flip the screen coordinates 
-  x = SCREEN_ROW_BYTES - x - w;
-  y = SCREEN_COL_BYTES - y - h;
-  
+  if(r.h > 0) { screen_mark(r); }
+}
+
+// send a rectangle of the screen buffer
+static void screen_send(const screenRect* r) {
+  const u32 nb = rect_area(r);
+  const u8* src;
+  u8* pScr = screenBuf;
+  u32 i;
+  u8 j;
+
+  /// the screen is mounted upside down!
+  // copy rows and bytes in reverse
+  for(j=r->h; j>0; j--) {
+    src = screenFb + (u32)(r->y + j - 1) * SCREEN_ROW_BYTES + r->x + r->w;
+    for(i=0; i<r->w; i++) {
+      *pScr++ = *(--src);
+    }
+  }
+
+  // flip the screen coordinates
   // set drawing region
-  screen_set_rect(x, y, w, h);
+  screen_set_rect(SCREEN_ROW_BYTES - r->x - r->w, SCREEN_COL_BYTES - r->y - r->h, r->w, r->h);
+  stats.bytes += nb;
+  ++(stats.rects);
+#if 1
+  // fill the write window, as the OLED does
+  for(i=0; i<nb; i++) {
+    gram[(u32)(gramWin.y + gramPos / gramWin.w) * SCREEN_ROW_BYTES
+	 + gramWin.x + gramPos % gramWin.w] = screenBuf[i];
+    ++gramPos;
+  }
+#else
   // select chip for data
   spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
   // register select high for data
@@ -254,22 +367,69 @@ void screen_draw_region_offset(u8 x, u8 y, u8 w, u8 h, u32 len, u8* data, u32 of
 #endif
 }
 
+// compose data at given rectangle; sent on the next flush
+// assume x-offset and width are both even!
+void screen_compose_region(u8 x, u8 y, u8 w, u8 h, u8* data) {
+  screen_compose(x, y, w, h, (u32)w * (u32)h, data, 0);
+}
+
+// compose data with starting byte offset, wrapping to the beginning of the data
+void screen_compose_region_offset(u8 x, u8 y, u8 w, u8 h, u32 len, u8* data, u32 off) {
+  screen_compose(x, y, w, h, len, data, off);
+}
+
+// send everything dirty
+void screen_flush(void) {
+  u8 i;
+  for(i=0; i<numDirty; i++) {
+    screen_send(&(dirtyRects[i]));
+  }
+  numDirty = 0;
+}
+
+// draw data given target rect
+// assume x-offset and width are both even!
+void screen_draw_region(u8 x, u8 y, u8 w, u8 h, u8* data) {
+  screen_compose_region(x, y, w, h, data);
+  screen_flush();
+}
+
+// draw data at given rectangle, with starting byte offset within the region data.
+// will wrap to beginning of region
+// useful for scrolling buffers
+void screen_draw_region_offset(u8 x, u8 y, u8 w, u8 h, u32 len, u8* data, u32 off) {
+  screen_compose_region_offset(x, y, w, h, len, data, off);
+  screen_flush();
+}
+
 
  // clear OLED RAM and local screenbuffer
 void screen_clear(void) {
-#if 1
-#else
-  spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
-  // pull register select high to write data
-  gpio_set_gpio_pin(OLED_REGISTER_PIN);
-  for(i=0; i<GRAM_BYTES; i++) { 
-    screenBuf[i] = 0;
-    spi_write(OLED_SPI, 0);
+  screenRect r = { 0, 0, SCREEN_ROW_BYTES, SCREEN_COL_PX };
+  u32 i;
+  for(i=0; i<GRAM_BYTES; i++) {
+    screenFb[i] = 0;
   }
-  spi_unselectChip(OLED_SPI, OLED_SPI_NPCS);
-#endif
+  numDirty = 0;
+  screen_send(&r);
+}
+
+void screen_get_stats(screenStats* st) {
+  *st = stats;
 }
 
+void screen_clear_stats(void) {
+  stats.bytes = 0;
+  stats.rects = 0;
+  stats.commands = 0;
+}
+
+#if 1
+const u8* screen_gram(void) {
+  return gram;
+}
+#endif
+
 
 // startup screen
 void screen_startup(void) {
@@ -40,6 +40,22 @@ extern "C" {
 // bytes in graphics RAM
 #define GRAM_BYTES  4096 // 2 pixels per byte
 #define GRAM_BYTES_1  4095
+
+// dirty rectangles kept between flushes
+#define SCREEN_DIRTY_RECTS 8
+
+//-----------------------------
+//---- types
+
+// transfer counters
+typedef struct _screenStats {
+  // pixel data bytes sent
+  u32 bytes;
+  // rectangles sent
+  u32 rects;
+  // command bytes sent
+  u32 commands;
+} screenStats;
 //-----------------------------
 //----  functions
 
@@ -52,6 +68,14 @@ extern void screen_draw_region(u8 x, u8 y, u8 w, u8 h, u8* data);
 // useful for scrolling buffers
 extern void screen_draw_region_offset(u8 x, u8 y, u8 w, u8 h, u32 len, u8* data, u32 off);
 
+// compose data at given rectangle into the screen buffer;
+// changes are sent on the next flush (or draw)
+extern void screen_compose_region(u8 x, u8 y, u8 w, u8 h, u8* data);
+// same, with starting byte offset and wrapping, as screen_draw_region_offset
+extern void screen_compose_region_offset(u8 x, u8 y, u8 w, u8 h, u32 len, u8* data, u32 off);
+// send everything composed since the last flush
+extern void screen_flush(void);
+
 // draw the whole screen
 // extern void screen_draw_full(u8 x, u8 y, u8 w, u8 h, u8* data);
 // clear the whole screen
@@ -60,6 +84,14 @@ extern void screen_clear(void);
 // show startup screen
 void screen_startup(void);
 
+// transfer counters
+extern void screen_get_stats(screenStats* st);
+extern void screen_clear_stats(void);
+#ifndef ARCH_AVR32
+// simulated OLED graphics RAM, as the panel holds it
+extern const u8* screen_gram(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,6 +2,14 @@
  * aleph-avr32
  *
  * ultra-simple software timers.
+ *
+ * timers live in a hierarchical timing wheel:
+ * TIMER_WHEEL_LEVELS levels of TIMER_WHEEL_SLOTS slots each.
+ * level 0 has one slot per tick; a slot on level n covers
+ * TIMER_WHEEL_SLOTS^n ticks. a timer goes in the lowest level
+ * whose span covers its delay, and is moved down ("cascaded")
+ * when the lower levels wrap around to its slot.
+ * each tick runs one level-0 slot, which holds only timers due on that tick.
  */
 
 // asf
@@ -11,14 +19,100 @@
 #include "timers.h"
 
 //-----------------------------------------------
-//---- static variables
+//---- defines
+
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_MASK (TIMER_WHEEL_SLOTS - 1)
+#define TIMER_WHEEL_LEVELS 4
+// longest delay that can be placed directly (2^24 ticks);
+// longer timers are re-placed as they cascade
+#define TIMER_WHEEL_SPAN (1 << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS))
 
+//-----------------------------------------------
+//---- static variables
 
-// 2-way linked list of timers
-static volatile softTimer_t* head = NULL;
-static volatile softTimer_t* tail = NULL;
+// each slot is a 2-way circular list of timers
+static softTimer_t* volatile wheel[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+// expired timer whose callback is running;
+// it stays linked (but in no slot) until the callback returns
+static softTimer_t* volatile running = NULL;
 static volatile u32 num = 0;
+// next tick to process
 static volatile u32 now = 0;
+// tick count at last time_clear()
+static volatile u32 epoch = 0;
+
+//-----------------------------------------------
+//---- static functions
+
+// append to a slot list
+static void timer_link(softTimer_t* t) {
+  u32 delta = t->due - now;
+  u32 when = t->due;
+  u8 lev = 0;
+  softTimer_t* volatile* slot;
+  softTimer_t* head;
+
+  if(delta >= TIMER_WHEEL_SPAN) {
+    // as far out as the wheel goes
+    delta = TIMER_WHEEL_SPAN - 1;
+    when = now + delta;
+  }
+  while(delta >= TIMER_WHEEL_SLOTS) {
+    delta >>= TIMER_WHEEL_BITS;
+    ++lev;
+  }
+  slot = &(wheel[lev][(when >> (TIMER_WHEEL_BITS * lev)) & TIMER_WHEEL_MASK]);
+
+  head = *slot;
+  if(head == NULL) {
+    t->next = t->prev = t;
+    *slot = t;
+  } else {
+    t->next = head;
+    t->prev = head->prev;
+    head->prev->next = t;
+    head->prev = t;
+  }
+  t->slot = slot;
+}
+
+// take out of its slot list
+static void timer_unlink(softTimer_t* t) {
+  softTimer_t* volatile* slot = t->slot;
+  if(t->next == t) {
+    *slot = NULL;
+  } else {
+    (t->next)->prev = t->prev;
+    (t->prev)->next = t->next;
+    if(*slot == t) { *slot = t->next; }
+  }
+  t->slot = NULL;
+}
+
+// move a slot's timers to lower levels
+static void timer_cascade(softTimer_t* volatile* slot) {
+  softTimer_t* t = *slot;
+  softTimer_t* next;
+  if(t == NULL) { return; }
+  // break the circle, and relink in order
+  (t->prev)->next = NULL;
+  *slot = NULL;
+  while(t != NULL) {
+    next = t->next;
+    timer_link(t);
+    t = next;
+  }
+}
+
+// place a linked timer again, unless its callback is running
+static void timer_reschedule(softTimer_t* t, u32 due) {
+  if( (t->next == NULL) || (t->slot == NULL) ) { return; }
+  timer_unlink(t);
+  t->due = due;
+  timer_link(t);
+}
 
 //------------------------------
 //--- extern functions
@@ -27,66 +121,28 @@ void init_timers(void) {
   ;; // nothing to do
 }
 
-u8 timer_already_linked (softTimer_t* t) {
-  int i;
-  softTimer_t *this = head;
-  for(i=0; i < num; i++) {
-    if(this == t) {
-      return 1;
-    }
-    this = this->next;
-  }
-  return 0;
-}
-
 // set a periodic timer with a callback
 // return 1 if set, 0 if not
 u8 timer_add( softTimer_t* t, u32 ticks, timer_callback_t callback, void* obj) {
-  //  int i;
-  int ret;
-
   // disable timer interrupts
   // cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
 
-  // print_dbg("\r\n timer_add, @ 0x");
-  // print_dbg_hex((u32)t);
-
-  if(!timer_already_linked(t)) {
-    // print_dbg(" ; timer is unlinked ");
-    // is list empty?
-    if( (head == NULL) || (tail == NULL) || (num == 0)) {
-      // print_dbg(" ; list was empty ");
-      head = tail = t;
-      t->next = t->prev = t;
-      num = 1;
-      // print_dbg(" ; added timer as sole element ");
-
-    } else {
-      // list not empty, add to tail
-      tail->next = t;
-      head->prev = t;
-      t->prev = tail;
-      t->next = head;
-      tail = t;
-      ++num; 
-
-    } 
-    t->callback = callback; 
-    t->caller = obj;
-    if(ticks < 1) { ticks = 1; }
-    t->ticksRemain = ticks;
-    t->ticks = ticks;
-    ret = 1;
-    // print_dbg(" ; added timer to tail ; new count: ");
-    // print_dbg_ulong(num);
-  } else {
-    // print_dbg(" ; timer was already linked, aborting ");
-    ret = 0;
+  if(t->next != NULL) {
+    // timer was already linked
+    return 0;
   }
+  t->callback = callback;
+  t->caller = obj;
+  if(ticks < 1) { ticks = 1; }
+  t->ticks = ticks;
+  // fires on the ticks'th call to process_timers()
+  t->due = now + ticks - 1;
+  timer_link(t);
+  ++num;
 
   // enable timer interrupts
   // cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
-  return ret;
+  return 1;
 }
 
 void pause_timers (void) {
@@ -100,131 +156,121 @@ void start_timers (void) {
 // remove a timer from the list
 // return 1 if removed, 0 if not found
 u8 timer_remove( softTimer_t* t) {
-  int i;
-  volatile softTimer_t* pt = NULL;
-  u8 found = 0;
-
   // disable timer interrupts
   // cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
 
   // not linked
   if( (t->next == NULL) || (t->prev == NULL)) { return 0; }
 
-  // check head
-  if(t == head) { 
-    found = 1;
-    head = t->next;
-  }
-  // check tail
-  else if(t == tail) { 
-    found = 1;
-    tail = t->prev; 
+  if(t == running) {
+    // removed from its own callback
+    running = NULL;
   } else {
-    // search 
-    pt = head;
-    for(i=0; i<num; ++i) {
-      if(pt == t) {
-	// found it
-	found = 1;
-	break;
-      }
-      pt = pt->next;
-    }
-  }
-  if(found) {
-    // unlink and decrement
-    (t->next)->prev = t->prev;
-    (t->prev)->next = t->next;
-    t->next = t->prev = 0;
-    --num;
-    if(num == 0) {
-      head = NULL;
-      tail = NULL;
-    }
+    timer_unlink(t);
   }
+  t->next = t->prev = NULL;
+  --num;
 
   // enable timer interrupts
   // cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
-  return found;
+  return 1;
 }
 
 
 // clear the list
-//// ???? ???
 void timers_clear(void) {
-  int i;
-  volatile softTimer_t* pt;
-  if(head != NULL) {
-    // print_dbg("\r\n clearing timer list, size: ");
-    // print_dbg_ulong(num);
-
-    pt = head;
-    // ??? will it work ???
-    for(i=0; i<num; ++i) {       
-      pt->prev = NULL;
-      pt = pt->next;
-      pt->prev->next = NULL;
-    }	 
+  u8 lev;
+  u8 i;
+  softTimer_t* t;
+  softTimer_t* next;
+  for(lev=0; lev<TIMER_WHEEL_LEVELS; ++lev) {
+    for(i=0; i<TIMER_WHEEL_SLOTS; ++i) {
+      t = wheel[lev][i];
+      if(t == NULL) { continue; }
+      (t->prev)->next = NULL;
+      while(t != NULL) {
+	next = t->next;
+	t->next = t->prev = NULL;
+	t->slot = NULL;
+	t = next;
+      }
+      wheel[lev][i] = NULL;
+    }
+  }
+  if(running != NULL) {
+    running->next = running->prev = NULL;
+    running = NULL;
   }
-  head = NULL;
-  tail = NULL;
   num = 0;
 }
 
-// process the timer list, presumably from TC interrupt
+// process one tick, presumably from TC interrupt
 void process_timers( void ) {
+  const u32 idx = now & TIMER_WHEEL_MASK;
+  softTimer_t* volatile* slot;
+  softTimer_t* t;
   u32 i;
-  volatile softTimer_t* t = head;
-
-  //  print_dbg("\r\n processing timers. head: 0x");
-  //  print_dbg_hex((u32)head);
-
-  // ... important...  
-  if ( (head == NULL) || (tail == NULL) || (num == 0) ) { 
-    //    print_dbg("\r\n processing empty timer list");
-    return; 
-  }
+  u8 lev;
+
+  if(num > 0) {
+    // lower levels wrapped; bring down the next slot of each
+    if(idx == 0) {
+      for(lev=1; lev<TIMER_WHEEL_LEVELS; ++lev) {
+	i = (now >> (TIMER_WHEEL_BITS * lev)) & TIMER_WHEEL_MASK;
+	timer_cascade(&(wheel[lev][i]));
+	if(i != 0) { break; }
+      }
+    }
 
-  for(i = 0; i<num; ++i) {
-    --(t->ticksRemain);
-    if(t->ticksRemain == 0) {
-      (*(t->callback))(t->caller);   
-      t->ticksRemain = t->ticks;
-      //      print_dbg("\r\n triggered timer callback @ 0x");
-      //      print_dbg_hex((u32)t);
+    // everything in this slot is due now
+    slot = &(wheel[0][idx]);
+    while( (t = *slot) != NULL ) {
+      timer_unlink(t);
+      running = t;
+      (*(t->callback))(t->caller);
+      if(running == t) {
+	// still set; the callback may have changed the period
+	running = NULL;
+	if(t->ticks < 1) { t->ticks = 1; }
+	t->due = now + t->ticks;
+	timer_link(t);
+      }
     }
-    t = t->next;
-    
-    //    print_dbg("; advanced list pointer, now: 0x");
-    //    print_dbg_hex((u32)t);
   }
+  ++now;
 }
 
 
 void timer_set(softTimer_t* timer, u32 ticks) {
+  if(ticks < 1) { ticks = 1; }
   timer->ticks = ticks;
-  if(timer->ticksRemain > ticks) timer->ticksRemain = ticks;
+  // ticks remaining, counting this one
+  if(timer->due - now + 1 > ticks) {
+    timer_reschedule(timer, now + ticks - 1);
+  }
 }
 
 void timer_reset(softTimer_t* timer) {
-  timer->ticksRemain = timer->ticks;
+  if(timer->ticks < 1) { timer->ticks = 1; }
+  timer_reschedule(timer, now + timer->ticks - 1);
 }
 
 void timer_reset_set(softTimer_t* timer, u32 ticks) {
+  if(ticks < 1) { ticks = 1; }
   timer->ticks = ticks;
-  timer->ticksRemain = ticks;
+  timer_reset(timer);
 }
 
 void timer_manual(softTimer_t* timer) {
-  timer->ticksRemain = 1;
+  timer_reschedule(timer, now);
 }
 
 
 
 u32 time_now() {
-  return now;
+  return now - epoch;
 }
 
 void time_clear() {
-  now = 0;
+  epoch = now;
 }
@@ -2,6 +2,10 @@
  * aleph
  *
  * ultra-simple software timer API
+ *
+ * timers are kept in a hierarchical timing wheel,
+ * so adding, removing and expiring a timer take constant time,
+ * and a tick with nothing due costs the same however many timers are set.
  */
 
 
@@ -16,17 +20,22 @@
 // callback function
 typedef void (*timer_callback_t)( void* caller );
 
-// timer class, element in linked list
+// timer class, element in a wheel slot list.
+// a timer is unlinked when next is NULL;
+// set next = NULL before the first timer_add().
 typedef volatile struct _softTimer {
-  // decreasing count of ticks remaining
-  u32 ticksRemain;
-  // interval in ticks
+  // tick count at which the timer fires
+  u32 due;
+  // interval in ticks;
+  // may be changed directly, takes effect on the next period
   u32 ticks;
   // callback function pointer
-  timer_callback_t callback;   	
+  timer_callback_t callback;
   // links
   volatile struct _softTimer* next;
   volatile struct _softTimer* prev;
+  // wheel slot holding this timer
+  volatile struct _softTimer* volatile* slot;
   // arbitrary argument to differentiate different callers
   void* caller;
 } softTimer_t;
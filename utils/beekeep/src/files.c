@@ -287,7 +287,7 @@ void files_store_scene(u8 idx) {
 void files_store_scene_name(const char* name) {
   FILE* f = fopen(name, "w");
   scene_write_buf();
-  fwrite((const void*)sceneData, sizeof(sceneData_t), 1, f);
+  fwrite((const void*)sceneData, scene_get_buf_size(), 1, f);
   fclose(f);
 }
 
@@ -58,7 +58,8 @@ static void net_read_json_scene(json_t* o) {
  sceneData->desc.beesVersion.maj = json_integer_value(json_object_get(p, "maj"));
   sceneData->desc.beesVersion.min = json_integer_value(json_object_get(p, "min"));
   sceneData->desc.beesVersion.rev = json_integer_value(json_object_get(p, "rev"));
- 
+  // propagation mode (absent in older files: recursive)
+  net_set_prop_mode((net_prop_t)json_integer_value(json_object_get(o, "propagation")));
 }
 
 static void net_read_json_ops(json_t* o) { 
@@ -173,7 +174,7 @@ static void net_read_json_params(json_t* o) {
   int count = json_array_size( o );
   //  json_t* arr;
 
-  net->numParams = count;
+  net_set_num_params(count);
   //  arr = json_object_get(o, "data");
   for(i=0; i<count; i++) {
     json_t* p = json_array_get(o, i);
@@ -156,7 +156,7 @@ static void net_read_json_params(json_t* o) {
   int v;
   pnode_t* param;
   int count = json_integer_value(json_object_get(o, "count"));
-  net->numParams = count;
+  net_set_num_params(count);
   arr = json_object_get(o, "data");
   for(i=0; i<count; i++) {
     p = json_array_get(arr, i);
@@ -58,6 +58,7 @@ static json_t* net_write_json_scene(void) {
   json_object_set(p, "min", json_integer(sceneData->desc.beesVersion.min));
   json_object_set(p, "rev", json_integer(sceneData->desc.beesVersion.rev));
   json_object_set(o, "beesVersion", p);  
+  json_object_set(o, "propagation", json_integer(net_get_prop_mode()));
   return o;
 }
 
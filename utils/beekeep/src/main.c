@@ -8,7 +8,9 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <gtk/gtk.h>
 #include "getopt.h"
 
@@ -21,15 +23,73 @@
 #include "ui.h"
 #include "ui_files.h"
 
+// events per propagation mode in bench
+#define BENCH_EVENTS 100000
+
+static double bench_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// drive one input of the loaded scene with both propagation engines,
+// report time per event and activations (hops) per second.
+// default input is the target of the first encoder.
+static void bench_scene(s16 inIdx, u32 events) {
+  static const char* modeName[eNetPropNumModes] = { "recursive", "queue" };
+  const net_prop_stats_t* stats = net_get_prop_stats();
+  net_prop_t mode0 = net_get_prop_mode();
+  net_prop_t mode;
+  double t;
+  u32 i, drops, hops;
+
+  if(inIdx < 0) {
+    inIdx = net_get_target(net_op_out_idx(0, 0));
+  }
+  if(inIdx < 0) {
+    printf("\r\n bench: no target input, nothing to do\n");
+    return;
+  }
+  printf("\r\n bench: %d ops, input %d (%s), %u events\n",
+	 net_num_ops(), inIdx, net_in_name(inIdx), events);
+
+  for(mode = eNetPropRecursive; mode < eNetPropNumModes; mode++) {
+    net_set_prop_mode(mode);
+    drops = stats->overflow + stats->budget + stats->cycle;
+    hops = stats->delivered;
+    t = bench_now();
+    for(i=0; i<events; i++) {
+      net_activate_in(inIdx, (io_t)(i & 0x7fff), NULL);
+    }
+    t = bench_now() - t;
+    hops = stats->delivered - hops;
+    printf("  %-10s %10.1f ns/event %12.0f activations/s %6.1f per event %u dropped\n",
+	   modeName[mode],
+	   t * 1e9 / (double)events,
+	   (double)hops / t,
+	   (double)hops / (double)events,
+	   stats->overflow + stats->budget + stats->cycle - drops);
+  }
+  net_set_prop_mode(mode0);
+}
+
 int main (int argc, char **argv)
 {
   char path[64];
   char ext[16];
   void* fp;
   bool arg = 0;
+  bool bench = 0;
 
   setbuf(stdout, NULL);
 
+  // headless: beekeep --bench scene [input] [events]
+  if(argc > 2 && strcmp(argv[1], "--bench") == 0) {
+    bench = 1;
+    argv++;
+    argc--;
+  }
+
   if(argc < 2) {
     // start with blank scene, use working directory
   } else {
@@ -54,6 +114,12 @@ int main (int argc, char **argv)
 	strip_filename(path, 64);
 	strcpy(workingDir, path);
   }
+
+  if(bench) {
+    bench_scene(argc > 2 ? atoi(argv[2]) : -1,
+		argc > 3 ? (u32)atoi(argv[3]) : BENCH_EVENTS);
+    return 0;
+  }
   
   printf("\r\n working directory now: %s", workingDir);
 
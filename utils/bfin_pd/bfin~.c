@@ -1,20 +1,26 @@
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "m_pd.h"
-#include "module.h"
-#include "fract2float_conv.h"
+#include "module_host.h"
 #include "fix.h"
-#include "fract_math.h"
-#include "params.h"
 #include "param_scaler.h"
 
+// descriptor entries allocated per object
+#define BFIN_TILDE_MAX_PARAMS 256
+
 static t_class *bfin_tilde_class;
 
+// each object runs its own instance of a module plugin
+// (make plugin in the module's directory): [bfin~ path/to/lines.so]
 typedef struct _bfin_tilde {
   t_object  x_obj;
-  t_sample f_pan;
   t_sample f;
 
+  ModuleHost* mod;
+  ParamDesc* desc;
+  int numParams;
+
   t_inlet *x_in[4];
   t_outlet *x_out[4];
 } t_bfin_tilde;
@@ -30,19 +36,10 @@ t_int *bfin_tilde_perform(t_int *w) {
   t_sample  *out2 =    (t_sample *)(w[8]);
   t_sample  *out3 =    (t_sample *)(w[9]);
   int          n =           (int)(w[10]);
-  /* t_sample f_pan = (x->f_pan<0)?0.0:(x->f_pan>1)?1.0:x->f_pan;   */
-
-  while (n--) {
-    in[0] = float_to_fr32(*in0++);
-    in[1] = float_to_fr32(*in1++);
-    in[2] = float_to_fr32(*in2++);
-    in[3] = float_to_fr32(*in3++);
-    module_process_frame();
-    *out0++ = fr32_to_float(out[0]);
-    *out1++ = fr32_to_float(out[1]);
-    *out2++ = fr32_to_float(out[2]);
-    *out3++ = fr32_to_float(out[3]);
-  }
+  const f32* ins[4] = { in0, in1, in2, in3 };
+  f32* outs[4] = { out0, out1, out2, out3 };
+
+  module_host_process(x->mod, ins, outs, n);
 
   return (w+11);
 }
@@ -56,23 +53,38 @@ void bfin_tilde_dsp(t_bfin_tilde *x, t_signal **sp) {
 
 void bfin_tilde_free(t_bfin_tilde *x) {
   int i;
-  for(i=0; i < 4; i++) {
+  for(i=1; i < 4; i++) {
     inlet_free(x->x_in[i]);
+  }
+  for(i=0; i < 4; i++) {
     outlet_free(x->x_out[i]);
   }
+  module_host_free(x->mod);
+  free(x->desc);
 }
 
-ParamDesc* desc = NULL;
-void *bfin_tilde_new(t_floatarg f) {
-  SDRAM_ADDRESS = malloc(SDRAM_SIZE);
-  module_init();
-  desc = malloc(1024*1024);
-  if(desc) {
-    fill_param_desc(desc);
+void *bfin_tilde_new(t_symbol *s) {
+  ModuleHost* mod;
+  if(s == NULL || *(s->s_name) == '\0') {
+    pd_error(0, "bfin~: needs a module plugin, e.g. [bfin~ lines.so]");
+    return NULL;
+  }
+  mod = module_host_new(s->s_name);
+  if(mod == NULL) {
+    pd_error(0, "bfin~: can't load %s", s->s_name);
+    return NULL;
   }
   t_bfin_tilde *x = (t_bfin_tilde *)pd_new(bfin_tilde_class);
 
-  x->f_pan = f;
+  x->mod = mod;
+  x->numParams = (int)module_host_num_params(mod);
+  if(x->numParams > BFIN_TILDE_MAX_PARAMS) {
+    x->numParams = BFIN_TILDE_MAX_PARAMS;
+  }
+  x->desc = calloc(BFIN_TILDE_MAX_PARAMS, sizeof(ParamDesc));
+  if(x->desc == NULL || !module_host_fill_desc(mod, x->desc)) {
+    x->numParams = 0;
+  }
 
   int i;
   x->x_out[0]=outlet_new(&x->x_obj, &s_signal);
@@ -85,6 +97,7 @@ void *bfin_tilde_new(t_floatarg f) {
 }
 
 void bfin_tilde_handle_message(t_bfin_tilde *x, t_symbol *s, int argc, t_atom *argv) {
+  ParamDesc* desc = x->desc;
   int i;
   /* printf("symbolarg: %s, ", s->s_name); */
   /* for(i=0; i < argc; i++) { */
@@ -97,11 +110,15 @@ void bfin_tilde_handle_message(t_bfin_tilde *x, t_symbol *s, int argc, t_atom *a
   /* } */
   /* printf("\n"); */
 
+  if(x->numParams == 0) {
+    post("bfin~: module has no param descriptor");
+    return;
+  }
   if(s == gensym("param") && argc >= 2){
     /* printf("setting param: %d, %d\n", (int)atom_getfloat(&argv[0]), (int)atom_getfloat(&argv[1])); */
     int paramIdx = (int)atom_getfloat(&argv[0]);
-    if(paramIdx >= eParamNumParams) {
-      paramIdx = eParamNumParams-1;
+    if(paramIdx >= x->numParams) {
+      paramIdx = x->numParams-1;
       post("param out of range");
     }
     if(paramIdx < 0) {
@@ -120,7 +137,7 @@ void bfin_tilde_handle_message(t_bfin_tilde *x, t_symbol *s, int argc, t_atom *a
       ioVal = tmp.inMin;
     }
     s32 bfin_val = scaler_get_value(&tmp, ioVal);
-    module_set_param(paramIdx, bfin_val);
+    module_host_set_param(x->mod, paramIdx, bfin_val);
     char paramString[256] = {0};
     scaler_get_str(paramString, &tmp, ioVal);
     char mess[256];
@@ -130,7 +147,7 @@ void bfin_tilde_handle_message(t_bfin_tilde *x, t_symbol *s, int argc, t_atom *a
   }
   if(s == gensym("describe")) {
     if (argc == 0) {
-      for(i=0; i < eParamNumParams; i++) {
+      for(i=0; i < x->numParams; i++) {
 	ParamScaler tmp = {.desc = &(desc[i])};
 	tmp.inMin = scaler_get_in(&tmp, desc[i].min);
 	tmp.inMax = scaler_get_in(&tmp, desc[i].max);
@@ -143,8 +160,8 @@ void bfin_tilde_handle_message(t_bfin_tilde *x, t_symbol *s, int argc, t_atom *a
     }
     else {
       i = (io_t)atom_getfloat(&argv[0]);
-      if(i >= eParamNumParams) {
-	i = eParamNumParams - 1;
+      if(i >= x->numParams) {
+	i = x->numParams - 1;
       }
       if(i < 0) {
 	i = 0;
@@ -166,7 +183,7 @@ void bfin_tilde_setup(void) {
 			       (t_newmethod)bfin_tilde_new,
 			       0, sizeof(t_bfin_tilde),
 			       CLASS_DEFAULT,
-			       A_DEFFLOAT, 0);
+			       A_DEFSYM, 0);
 
   class_addmethod(bfin_tilde_class,
 		  (t_method)bfin_tilde_dsp, gensym("dsp"), 0);
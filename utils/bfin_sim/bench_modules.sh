@@ -0,0 +1,23 @@
+#!/bin/sh
+# build the offline renderer for every module that has one,
+# and print a --bench line for each.
+#
+# usage: utils/bfin_sim/bench_modules.sh [frames]
+# run from anywhere; modules that fail to build are reported and skipped.
+
+cd "$(dirname "$0")/../../modules" || exit 1
+modules=$(pwd)
+
+frames=${1:-960000}
+# some modules write test tables from module_init() on linux
+scratch=${TMPDIR:-/tmp}
+
+for mk in */Makefile; do
+    dir=$(dirname "$mk")
+    grep -q '^render:' "$mk" || continue
+    if ! make -C "$dir" render > "/tmp/${dir}_render.log" 2>&1; then
+	echo "$dir: build failed (see /tmp/${dir}_render.log)"
+	continue
+    fi
+    (cd "$scratch" && "$modules/$dir/${dir}_render" --bench -n "$frames")
+done
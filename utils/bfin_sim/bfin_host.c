@@ -0,0 +1,157 @@
+/* bfin_host.c
+   aleph-bfin-sim
+
+   run several module instances in one process, each on its own thread.
+
+   usage: bfin_host [-n frames] plugin[:count] ...
+
+   plugins are built with "make plugin" in a module directory.
+   every instance gets the same fixed-seed noise input,
+   so instances of the same module must produce identical output;
+   a mismatch means state leaked between instances.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "module_host.h"
+
+// default frames per instance
+#define HOST_DEFAULT_FRAMES (48000 * 10)
+// frames processed per call
+#define HOST_CHUNK 1024
+// max instances
+#define HOST_MAX_INSTANCES 64
+
+typedef struct _hostInstance {
+  const char* path;
+  ModuleHost* mod;
+  pthread_t thread;
+  u32 frames;
+  // result
+  u32 sum;
+  double sec;
+} hostInstance;
+
+static hostInstance inst[HOST_MAX_INSTANCES];
+static u32 numInst = 0;
+
+static double now_sec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void* run_instance(void* arg) {
+  hostInstance* hi = (hostInstance*)arg;
+  fract32 in[MODULE_HOST_IN_PORTS][HOST_CHUNK];
+  fract32 out[MODULE_HOST_OUT_PORTS][HOST_CHUNK];
+  const fract32* ins[MODULE_HOST_IN_PORTS];
+  fract32* outs[MODULE_HOST_OUT_PORTS];
+  u32 seed = 0x1234567;
+  u32 sum = 0;
+  u32 done, n, i, ch;
+  double t0;
+
+  for(ch=0; ch<MODULE_HOST_IN_PORTS; ch++) { ins[ch] = in[ch]; }
+  for(ch=0; ch<MODULE_HOST_OUT_PORTS; ch++) { outs[ch] = out[ch]; }
+
+  t0 = now_sec();
+  for(done = 0; done < hi->frames; done += n) {
+    n = hi->frames - done;
+    if(n > HOST_CHUNK) { n = HOST_CHUNK; }
+    // -12dB white noise
+    for(i=0; i<n; i++) {
+      for(ch=0; ch<MODULE_HOST_IN_PORTS; ch++) {
+	seed = seed * 1664525 + 1013904223;
+	in[ch][i] = (fract32)seed >> 2;
+      }
+    }
+    module_host_process_fr32(hi->mod, ins, outs, n);
+    for(i=0; i<n; i++) {
+      for(ch=0; ch<MODULE_HOST_OUT_PORTS; ch++) {
+	sum = (sum << 5) + (sum >> 27) + (u32)out[ch][i];
+      }
+    }
+  }
+  hi->sec = now_sec() - t0;
+  hi->sum = sum;
+  return NULL;
+}
+
+static void usage(const char* name) {
+  fprintf(stderr, "usage: %s [-n frames] plugin[:count] ...\n", name);
+}
+
+int main(int argc, char* argv[]) {
+  u32 frames = HOST_DEFAULT_FRAMES;
+  u32 i, j, count;
+  u32 fails = 0;
+  char* colon;
+  double t0, t;
+  int a;
+
+  for(a=1; a<argc; a++) {
+    if(strcmp(argv[a], "-n") == 0 && a + 1 < argc) {
+      frames = strtoul(argv[++a], NULL, 0);
+      continue;
+    }
+    if(argv[a][0] == '-') {
+      usage(argv[0]);
+      return 1;
+    }
+    count = 1;
+    colon = strrchr(argv[a], ':');
+    if(colon) {
+      *colon = '\0';
+      count = strtoul(colon + 1, NULL, 0);
+    }
+    for(j=0; j<count; j++) {
+      if(numInst == HOST_MAX_INSTANCES) {
+	fprintf(stderr, "too many instances (max %d)\n", HOST_MAX_INSTANCES);
+	return 1;
+      }
+      inst[numInst].path = argv[a];
+      inst[numInst].mod = module_host_new(argv[a]);
+      if(inst[numInst].mod == NULL) { return 1; }
+      inst[numInst].frames = frames;
+      numInst++;
+    }
+  }
+  if(numInst == 0) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  t0 = now_sec();
+  for(i=0; i<numInst; i++) {
+    pthread_create(&(inst[i].thread), NULL, &run_instance, &(inst[i]));
+  }
+  for(i=0; i<numInst; i++) {
+    pthread_join(inst[i].thread, NULL);
+  }
+  t = now_sec() - t0;
+
+  for(i=0; i<numInst; i++) {
+    printf("%2u %-32s sdram %9u bytes  %7.3fs  sum %08x",
+	   i, inst[i].path, inst[i].mod->sdramBytes, inst[i].sec, inst[i].sum);
+    // compare with the first instance of the same plugin
+    for(j=0; j<i; j++) {
+      if(strcmp(inst[j].path, inst[i].path) == 0) { break; }
+    }
+    if(j < i && inst[j].sum != inst[i].sum) {
+      printf("  MISMATCH with %u", j);
+      fails++;
+    }
+    printf("\n");
+  }
+  printf("%u instances x %u frames in %.3fs (%.1fx realtime each)\n",
+	 numInst, frames, t, (double)frames / 48000.0 / t);
+
+  for(i=0; i<numInst; i++) {
+    module_host_free(inst[i].mod);
+  }
+  return fails ? 1 : 0;
+}
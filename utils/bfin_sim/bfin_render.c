@@ -0,0 +1,528 @@
+/* bfin_render.c
+   aleph-bfin-sim
+
+   headless offline renderer for audio modules.
+   links against a module's sources in place of main.c,
+   so it needs no JACK server and no OSC.
+
+   usage: <module>_render [options] [input] output
+
+   input and output are .wav or raw (interleaved 32-bit float).
+   with no input, the module is fed silence.
+
+   options:
+   -p FILE  param change script (see below)
+   -n N     frames to render (default: input length, or 10s)
+   -c N     channel count of raw input (default 4)
+   -b       benchmark: render noise, print timing, write nothing
+   -l       list parameters and exit
+
+   param script: one change per line, "<time> <param> <value>".
+   time is in frames, or seconds with an 's' suffix ("1.5s").
+   param is an index or a label from the module descriptor.
+   value is a raw ParamValue (decimal, or hex with 0x).
+   '#' starts a comment.
+
+   changes go through the same control queue as the SPI ISR,
+   so they are applied the way the hardware would apply them.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "module.h"
+#include "control.h"
+#include "fract2float_conv.h"
+
+// module name, from the Makefile
+#ifndef NAME
+#define NAME "module"
+#endif
+
+// frames rendered with no input and no -n
+#define RENDER_DEFAULT_FRAMES (SAMPLERATE * 10)
+// frames rendered in bench mode with no -n
+#define RENDER_BENCH_FRAMES (SAMPLERATE * 20)
+// frames read / written per file access
+#define RENDER_CHUNK 1024
+
+// from the module's params.c
+extern void fill_param_desc(ParamDesc* desc);
+
+//-------------------------
+//---- types
+
+// one scheduled param change
+typedef struct _renderEvent {
+  u32 frame;
+  u32 idx;
+  ParamValue val;
+  // line order in the script, breaks ties between changes on one frame
+  u32 seq;
+} renderEvent;
+
+// audio file (wav or raw)
+typedef struct _renderFile {
+  FILE* fp;
+  // 1 if wav
+  u8 wav;
+  // wav sample format: 1 = PCM, 3 = float
+  u16 format;
+  u16 channels;
+  u16 bits;
+  // frames in file (0 if unknown)
+  u32 frames;
+  // position of wav data chunk size field (for writing)
+  long sizePos;
+} renderFile;
+
+//-------------------------
+//---- static variables
+
+static ParamDesc* desc;
+static u32 numParams;
+
+static renderEvent* events;
+static u32 numEvents;
+
+static float chunkBuf[RENDER_CHUNK * OUT_PORTS];
+
+//-------------------------
+//---- static functions
+
+static void usage(const char* name) {
+  fprintf(stderr,
+	  "usage: %s [-p params] [-n frames] [-c channels] [-b] [-l] [input] output\n",
+	  name);
+}
+
+static u8 has_ext(const char* path, const char* ext) {
+  size_t n = strlen(path);
+  size_t m = strlen(ext);
+  return (n >= m) && (strcmp(path + n - m, ext) == 0);
+}
+
+// little-endian helpers (wav is always LE)
+static void put_u16(FILE* fp, u16 x) {
+  fputc(x & 0xff, fp);
+  fputc((x >> 8) & 0xff, fp);
+}
+
+static void put_u32(FILE* fp, u32 x) {
+  put_u16(fp, x & 0xffff);
+  put_u16(fp, x >> 16);
+}
+
+static u32 get_u32(const u8* p) {
+  return (u32)p[0] | ((u32)p[1] << 8) | ((u32)p[2] << 16) | ((u32)p[3] << 24);
+}
+
+static u16 get_u16(const u8* p) {
+  return (u16)(p[0] | (p[1] << 8));
+}
+
+//---- input
+
+// open input. returns 0 on success
+static int open_input(renderFile* f, const char* path, u16 rawChannels) {
+  u8 hdr[16];
+  u8 sz[8];
+  u32 chunkSize;
+  memset(f, 0, sizeof(renderFile));
+  f->fp = fopen(path, "rb");
+  if(f->fp == NULL) {
+    fprintf(stderr, "can't open input %s\n", path);
+    return 1;
+  }
+  if(!has_ext(path, ".wav")) {
+    f->wav = 0;
+    f->format = 3;
+    f->channels = rawChannels;
+    f->bits = 32;
+    return 0;
+  }
+  f->wav = 1;
+  if(fread(hdr, 1, 12, f->fp) != 12
+     || memcmp(hdr, "RIFF", 4) || memcmp(hdr + 8, "WAVE", 4)) {
+    fprintf(stderr, "%s: not a wav file\n", path);
+    return 1;
+  }
+  // walk chunks until "data"
+  while(fread(sz, 1, 8, f->fp) == 8) {
+    chunkSize = get_u32(sz + 4);
+    if(memcmp(sz, "fmt ", 4) == 0) {
+      if(chunkSize < 16 || fread(hdr, 1, 16, f->fp) != 16) { break; }
+      f->format = get_u16(hdr);
+      f->channels = get_u16(hdr + 2);
+      f->bits = get_u16(hdr + 14);
+      // WAVE_FORMAT_EXTENSIBLE: assume the subformat matches the bit depth
+      if(f->format == 0xfffe) { f->format = (f->bits == 32) ? 3 : 1; }
+      fseek(f->fp, chunkSize - 16 + (chunkSize & 1), SEEK_CUR);
+    } else if(memcmp(sz, "data", 4) == 0) {
+      if(f->channels == 0) { break; }
+      // validate before dividing by the frame size
+      if(!((f->format == 1 && (f->bits == 16 || f->bits == 24 || f->bits == 32))
+	   || (f->format == 3 && f->bits == 32))) {
+	fprintf(stderr, "%s: unsupported wav format %d / %d bits\n",
+		path, f->format, f->bits);
+	return 1;
+      }
+      f->frames = chunkSize / (f->channels * (f->bits / 8));
+      return 0;
+    } else {
+      fseek(f->fp, chunkSize + (chunkSize & 1), SEEK_CUR);
+    }
+  }
+  fprintf(stderr, "%s: no audio data\n", path);
+  return 1;
+}
+
+// read up to n frames into dst (IN_PORTS channels, deinterleaved per frame).
+// missing channels are zero. returns frames read
+static u32 read_input(renderFile* f, fract32 dst[][IN_PORTS], u32 n) {
+  u8 raw[4];
+  u32 i, ch, bytes;
+  s32 s;
+  float x;
+  bytes = f->bits / 8;
+  for(i=0; i<n; i++) {
+    for(ch=0; ch<f->channels; ch++) {
+      if(fread(raw, 1, bytes, f->fp) != bytes) { return i; }
+      if(f->format == 3) {
+	if(f->wav) {
+	  u32 u = get_u32(raw);
+	  memcpy(&x, &u, 4);
+	} else {
+	  memcpy(&x, raw, 4);
+	}
+      } else if(bytes == 2) {
+	x = (float)(s16)get_u16(raw) / 32768.f;
+      } else if(bytes == 3) {
+	s = (s32)(((u32)raw[0] << 8) | ((u32)raw[1] << 16) | ((u32)raw[2] << 24));
+	x = (float)s / 2147483648.f;
+      } else {
+	x = (float)(s32)get_u32(raw) / 2147483648.f;
+      }
+      if(ch < IN_PORTS) { dst[i][ch] = float_to_fr32(x); }
+    }
+    for(; ch<IN_PORTS; ch++) {
+      dst[i][ch] = 0;
+    }
+  }
+  return n;
+}
+
+//---- output
+
+static int open_output(renderFile* f, const char* path) {
+  memset(f, 0, sizeof(renderFile));
+  f->fp = fopen(path, "wb");
+  if(f->fp == NULL) {
+    fprintf(stderr, "can't open output %s\n", path);
+    return 1;
+  }
+  f->channels = OUT_PORTS;
+  f->bits = 32;
+  f->format = 3;
+  f->wav = has_ext(path, ".wav");
+  if(f->wav) {
+    // sizes are patched in close_output()
+    fwrite("RIFF", 1, 4, f->fp);
+    put_u32(f->fp, 0);
+    fwrite("WAVEfmt ", 1, 8, f->fp);
+    put_u32(f->fp, 16);
+    put_u16(f->fp, f->format);
+    put_u16(f->fp, f->channels);
+    put_u32(f->fp, SAMPLERATE);
+    put_u32(f->fp, SAMPLERATE * f->channels * 4);
+    put_u16(f->fp, f->channels * 4);
+    put_u16(f->fp, f->bits);
+    fwrite("data", 1, 4, f->fp);
+    f->sizePos = ftell(f->fp);
+    put_u32(f->fp, 0);
+  }
+  return 0;
+}
+
+static void write_output(renderFile* f, const float* src, u32 n) {
+  u32 i, u;
+  if(!f->wav) {
+    fwrite(src, sizeof(float), n * f->channels, f->fp);
+  } else {
+    for(i=0; i < n * f->channels; i++) {
+      memcpy(&u, &(src[i]), 4);
+      put_u32(f->fp, u);
+    }
+  }
+  f->frames += n;
+}
+
+static void close_output(renderFile* f) {
+  u32 bytes = f->frames * f->channels * 4;
+  if(f->wav) {
+    fseek(f->fp, 4, SEEK_SET);
+    put_u32(f->fp, 36 + bytes);
+    fseek(f->fp, f->sizePos, SEEK_SET);
+    put_u32(f->fp, bytes);
+  }
+  fclose(f->fp);
+}
+
+//---- params
+
+static void load_desc(void) {
+  numParams = gModuleData->numParams;
+  desc = calloc(numParams > 0 ? numParams : 1, sizeof(ParamDesc));
+  fill_param_desc(desc);
+}
+
+static void list_params(void) {
+  u32 i;
+  for(i=0; i<numParams; i++) {
+    printf("%3u  %-24s  0x%08x\n", i, desc[i].label,
+	   (u32)gModuleData->paramData[i].value);
+  }
+}
+
+// parse a param index or label. returns numParams if not found
+static u32 parse_param(const char* s) {
+  char* end;
+  u32 i;
+  i = strtoul(s, &end, 0);
+  if(*end == '\0') { return i < numParams ? i : numParams; }
+  for(i=0; i<numParams; i++) {
+    if(strcmp(s, desc[i].label) == 0) { return i; }
+  }
+  return numParams;
+}
+
+static int compare_events(const void* a, const void* b) {
+  const renderEvent* ea = a;
+  const renderEvent* eb = b;
+  if(ea->frame != eb->frame) { return (ea->frame < eb->frame) ? -1 : 1; }
+  // keep file order for changes on the same frame
+  if(ea->seq != eb->seq) { return (ea->seq < eb->seq) ? -1 : 1; }
+  return 0;
+}
+
+// load param script. returns 0 on success
+static int load_script(const char* path) {
+  FILE* fp;
+  char line[256];
+  char tstr[64], pstr[64], vstr[64];
+  char* end;
+  u32 lineNum = 0;
+  u32 cap = 64;
+  double t;
+  renderEvent* ev;
+
+  fp = fopen(path, "r");
+  if(fp == NULL) {
+    fprintf(stderr, "can't open param script %s\n", path);
+    return 1;
+  }
+  events = malloc(cap * sizeof(renderEvent));
+  while(fgets(line, sizeof(line), fp)) {
+    lineNum++;
+    if((end = strchr(line, '#')) != NULL) { *end = '\0'; }
+    if(sscanf(line, "%63s %63s %63s", tstr, pstr, vstr) != 3) { continue; }
+    if(numEvents == cap) {
+      cap *= 2;
+      events = realloc(events, cap * sizeof(renderEvent));
+    }
+    ev = &(events[numEvents]);
+    t = strtod(tstr, &end);
+    if(*end == 's') {
+      ev->frame = (u32)(t * SAMPLERATE + 0.5);
+    } else {
+      ev->frame = (u32)t;
+    }
+    ev->idx = parse_param(pstr);
+    if(ev->idx == numParams) {
+      fprintf(stderr, "%s:%u: unknown param %s\n", path, lineNum, pstr);
+      fclose(fp);
+      return 1;
+    }
+    ev->val = (ParamValue)strtoll(vstr, NULL, 0);
+    ev->seq = numEvents;
+    numEvents++;
+  }
+  fclose(fp);
+  // qsort isn't stable; seq keeps file order within a frame
+  qsort(events, numEvents, sizeof(renderEvent), compare_events);
+  return 0;
+}
+
+// same path as spi_set_param() on the blackfin
+static void render_set_param(u32 idx, ParamValue val) {
+  gModuleData->paramData[idx].value = val;
+  ctl_param_change(idx, val);
+}
+
+//---- processing
+
+// process n frames from src (may be NULL for silence) to dst.
+// ev points to the next pending event and is advanced.
+static void render_frames(fract32 src[][IN_PORTS], float* dst, u32 n,
+			  u32 frame, u32* ev) {
+  u32 i, ch;
+  for(i=0; i<n; i++) {
+    while(*ev < numEvents && events[*ev].frame <= frame + i) {
+      render_set_param(events[*ev].idx, events[*ev].val);
+      (*ev)++;
+    }
+    for(ch=0; ch<IN_PORTS; ch++) {
+      in[ch] = src ? src[i][ch] : 0;
+    }
+    ctl_next_frame();
+    module_process_frame();
+    if(dst) {
+      for(ch=0; ch<OUT_PORTS; ch++) {
+	*dst++ = fr32_to_float(out[ch]);
+      }
+    }
+  }
+}
+
+static double now_sec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// render noise without file i/o and report timing
+static void bench(u32 frames) {
+  static fract32 noise[RENDER_CHUNK][IN_PORTS];
+  u32 seed = 0x1234567;
+  u32 i, ch, n;
+  u32 done = 0;
+  u32 ev = 0;
+  double t0, t, ns, fps;
+
+  // -12dB white noise, fixed seed so runs are comparable
+  for(i=0; i<RENDER_CHUNK; i++) {
+    for(ch=0; ch<IN_PORTS; ch++) {
+      seed = seed * 1664525 + 1013904223;
+      noise[i][ch] = (fract32)seed >> 2;
+    }
+  }
+
+  t0 = now_sec();
+  while(done < frames) {
+    n = frames - done;
+    if(n > RENDER_CHUNK) { n = RENDER_CHUNK; }
+    render_frames(noise, NULL, n, done, &ev);
+    done += n;
+  }
+  t = now_sec() - t0;
+
+  ns = t * 1e9 / (double)frames;
+  fps = (double)frames / t;
+  printf("%-12s %10.1f ns/frame %14.0f frames/s %10.1fx realtime\n",
+	 NAME, ns, fps, fps / (double)SAMPLERATE);
+}
+
+//-------------------------
+//---- main
+
+int main(int argc, char* argv[]) {
+  static fract32 inChunk[RENDER_CHUNK][IN_PORTS];
+  const char* script = NULL;
+  const char* inPath = NULL;
+  const char* outPath = NULL;
+  renderFile fin, fout;
+  u32 frames = 0;
+  u16 rawChannels = IN_PORTS;
+  u8 doBench = 0;
+  u8 doList = 0;
+  u32 done, n, got, ev;
+  int i;
+
+  for(i=1; i<argc; i++) {
+    if(strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+      script = argv[++i];
+    } else if(strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      frames = strtoul(argv[++i], NULL, 0);
+    } else if(strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      rawChannels = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "-b") == 0 || strcmp(argv[i], "--bench") == 0) {
+      doBench = 1;
+    } else if(strcmp(argv[i], "-l") == 0) {
+      doList = 1;
+    } else if(argv[i][0] == '-') {
+      usage(argv[0]);
+      return 1;
+    } else if(outPath == NULL) {
+      outPath = argv[i];
+    } else if(inPath == NULL) {
+      inPath = outPath;
+      outPath = argv[i];
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  //Allocate module memory & initialise
+  SDRAM_ADDRESS = calloc(1, module_sdram_bytes());
+  if(SDRAM_ADDRESS == NULL) {
+    fprintf(stderr, "can't allocate SDRAM\n");
+    return 1;
+  }
+  module_init();
+  load_desc();
+
+  if(doList) {
+    list_params();
+    return 0;
+  }
+  if(script && load_script(script)) {
+    return 1;
+  }
+  if(doBench) {
+    bench(frames ? frames : RENDER_BENCH_FRAMES);
+    return 0;
+  }
+  if(outPath == NULL) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  memset(&fin, 0, sizeof(fin));
+  if(inPath) {
+    if(open_input(&fin, inPath, rawChannels)) { return 1; }
+    if(frames == 0) { frames = fin.frames; }
+  }
+  if(frames == 0) { frames = RENDER_DEFAULT_FRAMES; }
+  if(open_output(&fout, outPath)) { return 1; }
+
+  done = 0;
+  ev = 0;
+  while(done < frames) {
+    n = frames - done;
+    if(n > RENDER_CHUNK) { n = RENDER_CHUNK; }
+    if(fin.fp) {
+      got = read_input(&fin, inChunk, n);
+      // past the end of input: feed silence
+      for(; got < n; got++) {
+	memset(inChunk[got], 0, sizeof(inChunk[got]));
+      }
+    } else {
+      memset(inChunk, 0, n * sizeof(inChunk[0]));
+    }
+    render_frames(inChunk, chunkBuf, n, done, &ev);
+    write_output(&fout, chunkBuf, n);
+    done += n;
+  }
+
+  close_output(&fout);
+  if(fin.fp) {
+    // further reads just return 0
+    fclose(fin.fp);
+  }
+  fprintf(stderr, "%s: rendered %u frames, %u param changes\n",
+	  NAME, done, ev);
+  return 0;
+}
@@ -14,4 +14,26 @@ fract16 float_to_fr16 (float _x);
 float   fr32_to_float (fract32 _x);
 float   fr16_to_float (fract16 _x);
 
+// whole buffers at a time, for host audio bridges.
+// branch-free so the loops vectorize.
+// full scale is exactly 2^31, so +1.0 clips to the largest float
+// below it (0x7fffff80); float has no more precision than that anyway.
+static inline void float_to_fr32_block(const float* src, fract32* dst, u32 n) {
+  u32 i;
+  float x;
+  for(i=0; i<n; i++) {
+    x = src[i] * 2147483648.f;
+    x = x < -2147483648.f ? -2147483648.f : x;
+    x = x > 2147483520.f ? 2147483520.f : x;
+    dst[i] = (fract32)x;
+  }
+}
+
+static inline void fr32_to_float_block(const fract32* src, float* dst, u32 n) {
+  u32 i;
+  for(i=0; i<n; i++) {
+    dst[i] = (float)src[i] * (1.f / 2147483648.f);
+  }
+}
+
 #endif /* _FRACT2FLOAT_CONV_H */
@@ -4,12 +4,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
+#include <pthread.h>
 
 #include <jack/jack.h>
 #include <math.h>
 #include "module.h"
+#include "control.h"
 #include "lo/lo.h"
 #include "fract2float_conv.h"
+#include "module_block.h"
 
 jack_client_t *client;
 
@@ -20,6 +23,14 @@ jack_nframes_t latency = 1024;
 jack_port_t *input_ports[IN_PORTS];
 jack_port_t *output_ports[OUT_PORTS];
 
+// param changes arrive on the OSC thread and drain on the JACK thread
+pthread_mutex_t ctl_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// planar fract32 staging for process_block
+#define BLOCK_CHUNK 256
+fract32 block_in[IN_PORTS][BLOCK_CHUNK];
+fract32 block_out[OUT_PORTS][BLOCK_CHUNK];
+
 /**
  * The process callback for this JACK application is called in a
  * special realtime thread once for each audio cycle.
@@ -39,7 +50,10 @@ int process_block (jack_nframes_t nframes, void *arg) {
 
   jack_default_audio_sample_t* jack_in[IN_PORTS];
   jack_default_audio_sample_t* jack_out[OUT_PORTS];
-  int i, j;
+  const fract32* ins[IN_PORTS];
+  fract32* outs[OUT_PORTS];
+  jack_nframes_t done, n;
+  int j;
   //First get an input buffer for each jack input
   for (j=0; j < IN_PORTS; j++) {
     jack_out[j] = jack_port_get_buffer (output_ports[j], nframes);
@@ -48,20 +62,35 @@ int process_block (jack_nframes_t nframes, void *arg) {
   for (j=0; j < OUT_PORTS; j++) {
       jack_in[j] = jack_port_get_buffer (input_ports[j], nframes);
   }
+  for (j=0; j < IN_PORTS; j++) {
+    ins[j] = block_in[j];
+  }
+  for (j=0; j < OUT_PORTS; j++) {
+    outs[j] = block_out[j];
+  }
+
+  // don't block the audio thread;
+  // if the OSC thread has the queue, apply changes next time.
+  int ctl = (pthread_mutex_trylock(&ctl_lock) == 0);
 
-  //Then run module_process_frame, priming ins from jack_in, copying
-  //outs back to jack_out
-  for (i=0; i < nframes; i++) {
+  //Then convert whole buffers from jack_in, run the module on them,
+  //and convert back to jack_out
+  for (done = 0; done < nframes; done += n) {
+    n = nframes - done;
+    if (n > BLOCK_CHUNK) {
+      n = BLOCK_CHUNK;
+    }
     for (j=0; j < IN_PORTS; j++) {
-      in[j] = float_to_fr32(*(jack_in[j] + i));
-      /* in[j] = 0; */
+      float_to_fr32_block(jack_in[j] + done, block_in[j], n);
     }
-    module_process_frame();
+    module_process_frames(ins, outs, n, ctl);
     for (j=0; j < OUT_PORTS; j++) {
-      *(jack_out[j] + i) = fr32_to_float(out[j]);
-      /* out[j] = 0; */
+      fr32_to_float_block(block_out[j], jack_out[j] + done, n);
     }
   }
+  if (ctl) {
+    pthread_mutex_unlock(&ctl_lock);
+  }
   return 0;      
 }
 
@@ -79,7 +108,7 @@ void error(int num, const char *m, const char *path);
 
 int main (int argc, char *argv[]) {
   //Allocate module memory & initialise
-  SDRAM_ADDRESS = malloc(SDRAM_SIZE);
+  SDRAM_ADDRESS = calloc(1, module_sdram_bytes());
   module_init();
 
   //fire up osc server for module
@@ -257,8 +286,14 @@ int generic_handler(const char *path, const char *types, lo_arg ** argv,
 
 int foo_handler(const char *path, const char *types, lo_arg ** argv,
                 int argc, void *data, void *user_data) {
-  printf("received param %d %d\n", argv[0]->i, argv[1]->i);
-  module_set_param(argv[0]->i, argv[1]->i);
+  u32 pending;
+  pthread_mutex_lock(&ctl_lock);
+  // queue like the SPI ISR does
+  ctl_param_change(argv[0]->i, argv[1]->i);
+  pending = ctl_num_pending();
+  pthread_mutex_unlock(&ctl_lock);
+  printf("received param %d %d (pending: %u)\n",
+	 argv[0]->i, argv[1]->i, pending);
   return 0;
 }
 
@@ -0,0 +1,70 @@
+/* module_block.c
+   aleph-bfin-sim
+
+   see module_block.h.
+
+   frame modules get the port arrays primed per frame, as from the
+   audio ISR. block modules (module_custom.h defines MODULE_BLOCKSIZE)
+   get bfin_lib_block's buffer_t layout, which is already planar.
+*/
+
+#include <string.h>
+
+#include "control.h"
+#include "module.h"
+#include "module_block.h"
+
+#ifdef MODULE_BLOCKSIZE
+
+// as in bfin_lib_block/src/audio.h
+typedef fract32 buffer_t[IN_PORTS][MODULE_BLOCKSIZE];
+extern void module_process_block(buffer_t* inChannels, buffer_t* outChannels);
+
+static buffer_t blockIn;
+static buffer_t blockOut;
+// frames collected in the current block
+static u32 blockPos = 0;
+
+void module_process_frames(const fract32* const* ins,
+			   fract32* const* outs, u32 frames, u8 ctl) {
+  u32 done, n, i, j;
+  for(done = 0; done < frames; done += n) {
+    n = MODULE_BLOCKSIZE - blockPos;
+    if(n > frames - done) { n = frames - done; }
+    for(j=0; j<IN_PORTS; j++) {
+      memcpy(&(blockIn[j][blockPos]), ins[j] + done, n * sizeof(fract32));
+    }
+    for(j=0; j<OUT_PORTS; j++) {
+      memcpy(outs[j] + done, &(blockOut[j][blockPos]), n * sizeof(fract32));
+    }
+    blockPos += n;
+    if(blockPos == MODULE_BLOCKSIZE) {
+      if(ctl) {
+	for(i=0; i<MODULE_BLOCKSIZE; i++) { ctl_next_frame(); }
+      }
+      module_process_block(&blockIn, &blockOut);
+      blockPos = 0;
+    }
+  }
+}
+
+#else
+
+void module_process_frames(const fract32* const* ins,
+			   fract32* const* outs, u32 frames, u8 ctl) {
+  u32 i, j;
+  for(i=0; i<frames; i++) {
+    for(j=0; j<IN_PORTS; j++) {
+      in[j] = ins[j][i];
+    }
+    if(ctl) {
+      ctl_next_frame();
+    }
+    module_process_frame();
+    for(j=0; j<OUT_PORTS; j++) {
+      outs[j][i] = out[j];
+    }
+  }
+}
+
+#endif
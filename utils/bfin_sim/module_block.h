@@ -0,0 +1,22 @@
+/* module_block.h
+   aleph-bfin-sim
+
+   block entry point for host audio bridges (jack, pd, module_host).
+   the host converts whole buffers to planar fract32
+   (float_to_fr32_block) and hands them over in one call,
+   instead of converting and calling per sample.
+*/
+
+#ifndef _ALEPH_BFIN_SIM_MODULE_BLOCK_H_
+#define _ALEPH_BFIN_SIM_MODULE_BLOCK_H_
+
+#include "types.h"
+
+// process frames of planar fract32, IN_PORTS / OUT_PORTS channels.
+// no channel pointer may be NULL.
+// if ctl is set, the control queue is ticked once per frame.
+// block modules (MODULE_BLOCKSIZE) run a block behind.
+extern void module_process_frames(const fract32* const* ins,
+				  fract32* const* outs, u32 frames, u8 ctl);
+
+#endif // header guard
@@ -0,0 +1,226 @@
+/* module_host.c
+   aleph-bfin-sim
+
+   private plugin instances; see module_host.h.
+
+   dlopen() returns the same handle for the same file,
+   so each instance loads its own temporary copy of the plugin.
+   the copy is unlinked as soon as it is mapped.
+*/
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "fract2float_conv.h"
+#include "module_host.h"
+
+// SDRAM for modules that don't declare a footprint
+#define MODULE_HOST_SDRAM_DEFAULT 0x07ffffff
+
+//-------------------------
+//---- static functions
+
+// copy the plugin to a fresh temp file and open it there
+static void* open_copy(const char* path) {
+  char tmp[256];
+  const char* dir = getenv("TMPDIR");
+  char buf[4096];
+  FILE* src;
+  FILE* dst;
+  size_t n;
+  int fd;
+  void* lib;
+
+  src = fopen(path, "rb");
+  if(src == NULL) {
+    perror(path);
+    return NULL;
+  }
+  snprintf(tmp, sizeof(tmp), "%s/aleph_module_XXXXXX", dir ? dir : "/tmp");
+  fd = mkstemp(tmp);
+  if(fd < 0 || (dst = fdopen(fd, "wb")) == NULL) {
+    perror(tmp);
+    fclose(src);
+    return NULL;
+  }
+  while((n = fread(buf, 1, sizeof(buf), src)) > 0) {
+    fwrite(buf, 1, n, dst);
+  }
+  fclose(src);
+  fclose(dst);
+
+  lib = dlopen(tmp, RTLD_NOW | RTLD_LOCAL);
+  unlink(tmp);
+  if(lib == NULL) {
+    fprintf(stderr, "%s: %s\n", path, dlerror());
+  }
+  return lib;
+}
+
+static void* need_sym(ModuleHost* h, const char* path, const char* name) {
+  void* sym = dlsym(h->lib, name);
+  if(sym == NULL) {
+    fprintf(stderr, "%s: no symbol %s\n", path, name);
+  }
+  return sym;
+}
+
+// run one chunk from inBuf to outBuf.
+// ctl: drain the control queue (we hold the lock).
+static void run_chunk(ModuleHost* h, u32 n, u8 ctl) {
+  const fract32* ins[MODULE_HOST_IN_PORTS];
+  fract32* outs[MODULE_HOST_OUT_PORTS];
+  u32 i, j;
+  if(h->process_frames) {
+    for(j=0; j<MODULE_HOST_IN_PORTS; j++) { ins[j] = h->inBuf[j]; }
+    for(j=0; j<MODULE_HOST_OUT_PORTS; j++) { outs[j] = h->outBuf[j]; }
+    h->process_frames(ins, outs, n, ctl);
+    return;
+  }
+  // plugin without module_block.c
+  for(i=0; i<n; i++) {
+    for(j=0; j<MODULE_HOST_IN_PORTS; j++) { h->in[j] = h->inBuf[j][i]; }
+    if(ctl) {
+      h->next_frame();
+    }
+    h->process_frame();
+    for(j=0; j<MODULE_HOST_OUT_PORTS; j++) { h->outBuf[j][i] = h->out[j]; }
+  }
+}
+
+// lock the control queue if nobody is queueing, and run a chunk
+static void process_chunk(ModuleHost* h, u32 n) {
+  // don't block on a param change in progress;
+  // pending changes are applied on the next chunk.
+  u8 ctl = (pthread_mutex_trylock(&(h->ctlLock)) == 0);
+  run_chunk(h, n, ctl);
+  if(ctl) {
+    pthread_mutex_unlock(&(h->ctlLock));
+  }
+}
+
+//-------------------------
+//---- external functions
+
+ModuleHost* module_host_new(const char* path) {
+  ModuleHost* h;
+  void (*init)(void);
+  void** sdramAddress;
+  const u32* sdramBytes;
+
+  h = calloc(1, sizeof(ModuleHost));
+  if(h == NULL) { return NULL; }
+  h->lib = open_copy(path);
+  if(h->lib == NULL) {
+    free(h);
+    return NULL;
+  }
+
+  init = (void (*)(void))need_sym(h, path, "module_init");
+  sdramAddress = (void**)need_sym(h, path, "SDRAM_ADDRESS");
+  h->in = (fract32*)need_sym(h, path, "in");
+  h->out = (fract32*)need_sym(h, path, "out");
+  h->process_frame = (void (*)(void))need_sym(h, path, "module_process_frame");
+  h->process_frames = (void (*)(const fract32* const*, fract32* const*, u32, u8))
+    dlsym(h->lib, "module_process_frames");
+  h->next_frame = (void (*)(void))need_sym(h, path, "ctl_next_frame");
+  h->param_change = (u8 (*)(u32, u32))need_sym(h, path, "ctl_param_change");
+  if(init == NULL || sdramAddress == NULL || h->in == NULL || h->out == NULL
+     || h->process_frame == NULL || h->next_frame == NULL
+     || h->param_change == NULL) {
+    dlclose(h->lib);
+    free(h);
+    return NULL;
+  }
+  // optional
+  h->fill_param_desc = (void (*)(ParamDesc*))dlsym(h->lib, "fill_param_desc");
+  h->num_params = (u32 (*)(void))dlsym(h->lib, "module_get_num_params");
+  sdramBytes = (const u32*)dlsym(h->lib, "moduleSdramBytes");
+
+  h->sdramBytes = sdramBytes ? *sdramBytes : MODULE_HOST_SDRAM_DEFAULT;
+  h->sdram = calloc(1, h->sdramBytes ? h->sdramBytes : 1);
+  if(h->sdram == NULL) {
+    fprintf(stderr, "%s: can't allocate %u bytes of SDRAM\n", path, h->sdramBytes);
+    dlclose(h->lib);
+    free(h);
+    return NULL;
+  }
+  pthread_mutex_init(&(h->ctlLock), NULL);
+
+  *sdramAddress = h->sdram;
+  init();
+  return h;
+}
+
+void module_host_free(ModuleHost* h) {
+  if(h == NULL) { return; }
+  dlclose(h->lib);
+  pthread_mutex_destroy(&(h->ctlLock));
+  free(h->sdram);
+  free(h);
+}
+
+u8 module_host_set_param(ModuleHost* h, u32 idx, ParamValue val) {
+  u8 ret;
+  pthread_mutex_lock(&(h->ctlLock));
+  ret = h->param_change(idx, (u32)val);
+  pthread_mutex_unlock(&(h->ctlLock));
+  return ret;
+}
+
+u32 module_host_num_params(ModuleHost* h) {
+  return h->num_params ? h->num_params() : 0;
+}
+
+u8 module_host_fill_desc(ModuleHost* h, ParamDesc* desc) {
+  if(h->fill_param_desc == NULL) { return 0; }
+  h->fill_param_desc(desc);
+  return 1;
+}
+
+void module_host_process(ModuleHost* h, const f32* const* in,
+			 f32* const* out, u32 frames) {
+  u32 j, n, done;
+  for(done = 0; done < frames; done += n) {
+    n = frames - done;
+    if(n > MODULE_HOST_CHUNK) { n = MODULE_HOST_CHUNK; }
+    for(j=0; j<MODULE_HOST_IN_PORTS; j++) {
+      if(in && in[j]) {
+	float_to_fr32_block(in[j] + done, h->inBuf[j], n);
+      } else {
+	memset(h->inBuf[j], 0, n * sizeof(fract32));
+      }
+    }
+    process_chunk(h, n);
+    if(out) {
+      for(j=0; j<MODULE_HOST_OUT_PORTS; j++) {
+	if(out[j]) { fr32_to_float_block(h->outBuf[j], out[j] + done, n); }
+      }
+    }
+  }
+}
+
+void module_host_process_fr32(ModuleHost* h, const fract32* const* in,
+			      fract32* const* out, u32 frames) {
+  u32 j, n, done;
+  for(done = 0; done < frames; done += n) {
+    n = frames - done;
+    if(n > MODULE_HOST_CHUNK) { n = MODULE_HOST_CHUNK; }
+    for(j=0; j<MODULE_HOST_IN_PORTS; j++) {
+      if(in && in[j]) {
+	memcpy(h->inBuf[j], in[j] + done, n * sizeof(fract32));
+      } else {
+	memset(h->inBuf[j], 0, n * sizeof(fract32));
+      }
+    }
+    process_chunk(h, n);
+    if(out) {
+      for(j=0; j<MODULE_HOST_OUT_PORTS; j++) {
+	if(out[j]) { memcpy(out[j] + done, h->outBuf[j], n * sizeof(fract32)); }
+      }
+    }
+  }
+}
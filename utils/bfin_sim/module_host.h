@@ -0,0 +1,81 @@
+/* module_host.h
+   aleph-bfin-sim
+
+   run any number of module instances in one host process.
+
+   a module is built as a plugin (make plugin in its directory:
+   the module and its sim sources as one shared object).
+   module code keeps its hardware layout (file-scope state, the
+   in[] / out[] ports, a pointer into SDRAM), so each instance
+   is given a private copy of the plugin: its own data segment,
+   its own control queue, and SDRAM sized to the module's
+   declared footprint (MODULE_SDRAM) instead of all 128MB.
+
+   instances share nothing, so separate instances can be
+   processed on separate threads. on one instance,
+   module_host_set_param may be called from any thread
+   (it plays the SPI ISR); other calls must not overlap.
+*/
+
+#ifndef _ALEPH_BFIN_SIM_MODULE_HOST_H_
+#define _ALEPH_BFIN_SIM_MODULE_HOST_H_
+
+#include <pthread.h>
+
+#include "param_common.h"
+#include "types.h"
+
+// ports per instance, as in module.h
+#define MODULE_HOST_IN_PORTS 4
+#define MODULE_HOST_OUT_PORTS 4
+// frames processed per control queue lock
+#define MODULE_HOST_CHUNK 256
+
+typedef struct _moduleHost {
+  // handle of this instance's copy of the plugin
+  void* lib;
+  // instance SDRAM
+  void* sdram;
+  u32 sdramBytes;
+  // the instance's port arrays
+  fract32* in;
+  fract32* out;
+  // module entry points
+  void (*process_frame)(void);
+  void (*process_frames)(const fract32* const* ins, fract32* const* outs,
+			 u32 frames, u8 ctl);
+  void (*next_frame)(void);
+  u8 (*param_change)(u32 idx, u32 val);
+  void (*fill_param_desc)(ParamDesc* desc);
+  u32 (*num_params)(void);
+  // guards the instance's control queue
+  pthread_mutex_t ctlLock;
+  // planar fract32 staging, one chunk deep
+  fract32 inBuf[MODULE_HOST_IN_PORTS][MODULE_HOST_CHUNK];
+  fract32 outBuf[MODULE_HOST_OUT_PORTS][MODULE_HOST_CHUNK];
+} ModuleHost;
+
+// load a private instance of a module plugin and initialize it.
+// returns NULL (and prints why) on failure.
+extern ModuleHost* module_host_new(const char* path);
+// release an instance
+extern void module_host_free(ModuleHost* h);
+
+// queue a param change, as from the SPI ISR.
+// returns CTL_REQUEST_FULL if the queue was full.
+extern u8 module_host_set_param(ModuleHost* h, u32 idx, ParamValue val);
+// number of params in the module's descriptor (0 if unknown)
+extern u32 module_host_num_params(ModuleHost* h);
+// fill a descriptor array from the module's params.c.
+// returns 0 if the module has none.
+extern u8 module_host_fill_desc(ModuleHost* h, ParamDesc* desc);
+
+// process frames of planar float audio.
+// in may be NULL (silence); either may have NULL channels.
+extern void module_host_process(ModuleHost* h, const f32* const* in,
+				f32* const* out, u32 frames);
+// the same, for planar fract32
+extern void module_host_process_fr32(ModuleHost* h, const fract32* const* in,
+				     fract32* const* out, u32 frames);
+
+#endif // header guard
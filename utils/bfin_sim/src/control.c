@@ -2,111 +2,109 @@
 #include "control.h"
 #include "module.h"
 
+/*
+  param changes from the SPI ISR are queued here,
+  and applied from the audio ISR at a bounded rate.
 
-///// FIXME! 
+  the queue is an ordered set:
+  a change to a param that is already pending just updates the value,
+  so a burst of changes to one param costs one module_set_param().
 
-/*
-  there is no buffer or separate task for control changes.
-  they are set directly from the SPI ISR!
-  very bad.
+  the SPI ISR is the only writer and the audio ISR the only reader.
+  each index is stored by one side only, so there is no shared counter.
+  the audio ISR has higher priority and can preempt the SPI ISR,
+  so the producer masks interrupts where it touches a pending entry.
  */
 
-#if 0
+#ifdef ARCH_BFIN
+// mask interrupts, saving IMASK in m / restore IMASK from m
+#define CTL_IRQ_SAVE(m)    asm volatile ("cli %0; csync;" : "=d"(m))
+#define CTL_IRQ_RESTORE(m) asm volatile ("sti %0; csync;" : : "d"(m))
+#else
+// host builds lock around the queue instead
+#define CTL_IRQ_SAVE(m)    (m) = 0
+#define CTL_IRQ_RESTORE(m) (void)(m)
+#endif
 
-// ordered set of param changes
+// ordered set of param changes (ring)
 static ctlEvent_t ctlBuf[CTL_BUF_SIZE];
-// dirty flags
-static u8 paramsDirty[DIRTY_BYTES];
-// count of param change events
-static s32 evCount = 0;
-// audio frames since last update
-static u32 frameCount = 0;
-
-// get dirty flag for param idx (inlined in header)
-//extern u8 get_param_dirty(u32 idx);
-
-static inline u8 get_param_dirty(u32 idx) {
-  //return BITTEST(paramsDirty, idx);
-  return paramsDirty[idx] > 0;
-}
-static void set_param_dirty(u32 idx) {
-  //      BITSET(paramsDirty, idx);
-  paramsDirty[idx] = 1;
-
-}
-// clear dirty flag
-static void clear_param_dirty(u32 idx) {
+// queue position of each pending param (+1; 0 == not pending)
+static volatile u8 paramsDirty[DIRTY_BYTES];
+// write count, stored only by the producer
+static volatile u32 wrIdx = 0;
+// read count, stored by the consumer
+// (and by the producer, masked, on overflow)
+static volatile u32 rdIdx = 0;
+
+// apply the change at the read position (consumer side)
+static void ctl_apply_next(void) {
+  const u32 pos = rdIdx & CTL_BUF_MASK;
+  const u8 idx = ctlBuf[pos].idx;
+  // clear the flag first, so the value can't be updated after it's read
   paramsDirty[idx] = 0;
+  module_set_param(idx, ctlBuf[pos].val);
+  rdIdx = rdIdx + 1;
 }
-// clear all dirty flags
-/* static void clear_all_param_dirty(void) { */
-/*   memset(paramsDirty, 0, NUM_PARAMS); */
-/* } */
 
 // request a parameter change.
 extern u8 ctl_param_change(u32 idx, u32 val) {
-  u32 i;
-  if(get_param_dirty(idx)) {
-    // search for event with this param idx
-    for(i=0; i<evCount; i++) {
-      if(ctlBuf[i].idx == idx) {
-	ctlBuf[i].val = (ParamValue)val;
-	break;
-      }
-    }
+  u32 pos;
+  u32 imask;
+  if(idx >= DIRTY_BYTES) { return CTL_REQUEST_FULL; }
+
+  // the consumer may take this entry between the check and the store
+  CTL_IRQ_SAVE(imask);
+  if(paramsDirty[idx] > 0) {
+    // already pending; replace the value
+    ctlBuf[paramsDirty[idx] - 1].val = (ParamValue)val;
+    CTL_IRQ_RESTORE(imask);
     return CTL_REQUEST_OK;
-  } else {
-    // add a new event
-    if(evCount < CTL_BUF_SIZE_1) {
-      ctlBuf[evCount].idx = idx;
-      ctlBuf[evCount].val = (ParamValue)val;
-      evCount++; 
-      // update dirty flag
-      set_param_dirty(idx);
-      return 0;
-    } else {
-      return 1;
-    }
   }
+  if((wrIdx - rdIdx) >= CTL_BUF_SIZE) {
+    // the ready pin holds off the avr32 while the queue is full,
+    // so this only happens if the sender ignored it.
+    // make room by applying the oldest change, which keeps the order.
+    ctl_apply_next();
+  }
+  CTL_IRQ_RESTORE(imask);
+
+  // add a new event; the reader can't see it until wrIdx moves
+  pos = wrIdx & CTL_BUF_MASK;
+  ctlBuf[pos].idx = idx;
+  ctlBuf[pos].val = (ParamValue)val;
+  paramsDirty[idx] = pos + 1;
+  wrIdx = wrIdx + 1;
+  return CTL_REQUEST_OK;
 }
 
-// execute the last param change
-extern void ctl_do_last_change(void) {
-  static u32 idx;
-  idx = ctlBuf[evCount - 1].idx;
-  module_set_param(idx, ctlBuf[evCount - 1].val);
-  clear_param_dirty(idx);
-  evCount--;
-}
-
-
-
-// execute the last param change
-//// warning: no lower bounds check on evCount
-extern void ctl_perform_last_change(void) {
-  static s32 idx;
-  if(evCount == 0) { return; }
-  idx = ctlBuf[--evCount].idx;
-  module_set_param(idx, ctlBuf[evCount].val);
-  clear_param_dirty(idx);
+// execute the oldest pending param change
+extern void ctl_perform_next_change(void) {
+  if(wrIdx == rdIdx) { return; }
+  ctl_apply_next();
 }
 
 // attempt to execute all pending param changes
 extern void ctl_perform_all_changes(void) {
-  while(evCount > 0) {
-    ctl_perform_last_change();
+  while(wrIdx != rdIdx) {
+    ctl_apply_next();
   }
 }
 
 // tick every audio frame
 extern void ctl_next_frame(void) {
-  frameCount++;
-  if(frameCount == CTL_BUF_SIZE) {
-    frameCount = 0;
-  }
-  if(evCount > 0) {
-    ctl_do_last_change();
+  u32 n = CTL_CHANGES_PER_FRAME;
+  while((wrIdx != rdIdx) && (n > 0)) {
+    ctl_apply_next();
+    n--;
   }
 }
 
-#endif
+// count of pending param changes
+extern u32 ctl_num_pending(void) {
+  return wrIdx - rdIdx;
+}
+
+// non-zero if a new param change can be queued
+extern u8 ctl_param_ready(void) {
+  return (wrIdx - rdIdx) < CTL_BUF_SIZE;
+}
@@ -6,8 +6,8 @@
   
   define a control rate for the blackfin.
   parameter changes are stored in a set structure.
-  dirty flags for each parameter are stored in a bit array,
-  so that only the most recent value of a given parameter can be processed.
+  each parameter has a dirty flag holding its place in the queue,
+  so that only the most recent value of a given parameter is processed.
   
  */
 
@@ -21,17 +21,18 @@
 //---------------------------------------------
 //---- definitions / types
 
-// depth of FIFO
-#define CTL_BUF_SIZE 32
-#define CTL_BUF_SIZE_1 31
-// process at most 1 control change per audio sample
-// so keep (buf size < (samplerate / control rate))
-// frame divisor (sr / kr)
-#define CTL_FRAME_DIV 48
+// depth of FIFO (power of 2)
+#define CTL_BUF_SIZE 64
+#define CTL_BUF_MASK (CTL_BUF_SIZE - 1)
+// max param changes applied per audio frame.
+// keep (buf size / changes per frame) well under a control period,
+// so a full queue drains quickly.
+#define CTL_CHANGES_PER_FRAME 1
 
-// byes in the dirty-flag bitfield
-//#define DIRTY_BYTES (BITNSLOTS(NUM_PARAMS))
-#define DIRTY_BYTES NUM_PARAMS
+// entries in the dirty-flag table.
+// param indices are single bytes on the wire,
+// so this doesn't depend on the module's param count.
+#define DIRTY_BYTES 256
 
 //-- return values
 // added request
@@ -45,26 +46,21 @@ typedef struct _ctlEvent {
   ParamValue val;
 } ctlEvent_t;
 
-//---------------------------------------------
-//---- variables
-
-
-//-----------------------
-//----- functions
-
-/* // check dirty flag */
-/* inline u8 get_param_dirty(u32 idx) { */
-/*   return BITTEST(paramsDirty, idx); */
-/* } */
-
 
-// add param change to buffer
+// add param change to buffer (call from SPI ISR)
+// if the buffer is full, the oldest change is applied to make room.
+// returns CTL_REQUEST_FULL if the param index is out of range
 extern u8 ctl_param_change(u32 param, u32 value);
-// execute the last param change
-extern void ctl_perform_last_change(void);
+// execute the oldest pending param change
+extern void ctl_perform_next_change(void);
 // attempt to execute all pending param changes
 extern void ctl_perform_all_changes(void);
-// tick every audio frame
+// tick every audio frame (call from audio ISR)
 extern void ctl_next_frame(void);
+// count of pending param changes
+extern u32 ctl_num_pending(void);
+// non-zero if a new param change can be queued
+// (raise the ready pin only when this is true)
+extern u8 ctl_param_ready(void);
 
 #endif // h guard
@@ -58,7 +58,12 @@
 #define LED4_MASK       (0xffff ^ LED4_UNMASK)
 #define LED4_LO		*pFIO_FLAG_D &= LED4_MASK
 #define LED4_HI 	*pFIO_FLAG_D |= LED4_UNMASK
+// keep stdout clean for the offline renderer
+#ifdef BFIN_RENDER
+#define LED4_TOGGLE	;
+#else
 #define LED4_TOGGLE	printf("LED4_TOGGLE\n")
+#endif
 
 
 #endif // h guard
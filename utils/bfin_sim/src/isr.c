@@ -28,7 +28,9 @@ void sport0_rx_isr() {
   READY_LO;
 
   if(!processAudio) { 
-    READY_HI;
+    // keep applying param changes while audio is off
+    ctl_next_frame();
+    if(ctl_param_ready()) { READY_HI; }
     /// if this interrupt came from DMA1, clear it and continue(W1C)
     if(*pDMA1_IRQ_STATUS & 1) { *pDMA1_IRQ_STATUS = 0x0001; }
     return;
@@ -50,6 +52,9 @@ void sport0_rx_isr() {
 
   // module-defined frame processing function
 
+  // apply some pending param changes
+  ctl_next_frame();
+
   module_process_frame();  
 
   /* //// TEST: wire */
@@ -64,7 +69,7 @@ void sport0_rx_isr() {
   /* iTxBuf[2] = iRxBuf[2]; */
   /* iTxBuf[3] = iRxBuf[3]; */
 
-  READY_HI;
+  if(ctl_param_ready()) { READY_HI; }
   /// if this interrupt came from DMA1, clear it and continue(W1C)
   if(*pDMA1_IRQ_STATUS & 1) { *pDMA1_IRQ_STATUS = 0x0001; }
 
@@ -84,6 +89,7 @@ void spi_rx_isr() {
   //  BUSY_HI;
   READY_LO;
   *pSPI_TDBR = spi_process(*pSPI_RDBR);
-  READY_HI;
+  // hold off the avr32 while the param queue is full
+  if(ctl_param_ready()) { READY_HI; }
   //  BUSY_LO;
 }
@@ -76,8 +76,6 @@ int main(void) {
     instead, we are asking avr32 to hold off sending params 
     for as long as the ready-pin is deasserted by frame or control change processing.
     */
-    /// while frame processing 
-    //    ctl_next_frame();	
-    //    ctl_perform_last_change();			
+    /// param changes are drained from the audio ISR (ctl_next_frame())
   }
 }
@@ -1,4 +1,5 @@
 // aleph/common
+#include "param_batch.h"
 #include "param_common.h"
 
 // bfin_lib
@@ -19,14 +20,19 @@ static eSpiByte byte = eCom;
 static u8 com;
 // current param index
 static u8 idx;
+// batched param change decoder
+static ParamBatchDecoder batch;
+// value from batch decoder
+static ParamValue batchVal;
 
 //------ static functions
 static void spi_set_param(u32 idx, ParamValue pv) {
-  //  module_set_param(idx, pv);
-  //  LED4_TOGGLE;
-  // ctl_param_change(idx, pv.u);
+  // set the raw value here,
+  // in case avr32 reads it back immediately...
   gModuleData->paramData[idx].value = pv;
-  module_set_param(idx, pv);
+  // defer to the audio ISR.
+  // the ready pin stays low while the queue is full.
+  ctl_param_change(idx, pv);
 }
 
 //------- function definitions
@@ -42,6 +48,10 @@ u8 spi_process(u8 rx) {
     case MSG_SET_PARAM_COM:
       byte = eSetParamIdx;
       break;
+    case MSG_SET_PARAM_BATCH_COM:
+      param_batch_decode_start(&batch);
+      byte = batch.byte;
+      break;
     case MSG_GET_PARAM_COM:
       byte = eGetParamIdx;
       break;
@@ -111,6 +121,20 @@ u8 spi_process(u8 rx) {
     break;
 
 
+    //---- set param batch
+  case eSetParamBatchCount :
+  case eSetParamBatchIdx :
+  case eSetParamBatchData0 :
+  case eSetParamBatchData1 :
+  case eSetParamBatchData2 :
+  case eSetParamBatchData3 :
+    if(param_batch_decode(&batch, rx, &idx, &batchVal)) {
+      spi_set_param(idx, batchVal);
+    }
+    byte = batch.byte;
+    return 0; // don't care
+    break;
+
     //---- get param
   case eGetParamIdx :
     idx = rx; // set index
@@ -0,0 +1,83 @@
+/* event_burst.c
+
+   events lost while the main loop is busy,
+   for the event queue (avr32_sim/src/events.c)
+   against the single 32-entry fifo it replaced.
+
+   a 1 kHz timer turns 4 encoders (one event each per ms)
+   and posts screen and monome refreshes every 50 ms,
+   usb posts a grid key every 5 ms,
+   and the main loop reads the queue every [stall] ms.
+
+   usage: event_burst [stall ms]
+   exits non-zero if encoder sums are off or a grid key is dropped.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "events.h"
+
+#define TICKS 60000
+// the old fifo held one less than its size
+#define FIFO_EVENTS 31
+
+static u32 fifoFill = 0;
+static u32 fifoDropped = 0;
+static u32 fifoRead = 0;
+
+static void fifo_post(void) {
+  if(fifoFill == FIFO_EVENTS) { ++fifoDropped; } else { ++fifoFill; }
+}
+
+static void post(u8 ctx, etype type, s32 data) {
+  event_t e;
+  e.type = type;
+  e.data = data;
+  event_set_context(ctx);
+  event_post(&e);
+  fifo_post();
+}
+
+int main(int argc, char** argv) {
+  const u32 stall = argc > 1 ? (u32)atoi(argv[1]) : 40;
+  eventQueueStats timer, usb;
+  event_t e;
+  long encPosted = 0, encRead = 0;
+  u32 read = 0;
+  u32 t, i;
+
+  init_events();
+  for(t=1; t<=TICKS; ++t) {
+    for(i=0; i<4; ++i) {
+      post(4, kEventEncoder0 + i, 1);
+      ++encPosted;
+    }
+    if(t % 50 == 0) {
+      post(4, kEventScreenRefresh, 0);
+      post(4, kEventMonomeRefresh, 0);
+    }
+    if(t % 5 == 0) {
+      post(2, kEventMonomeGridKey, t);
+    }
+    if(t % stall == 0) {
+      event_set_context(0);
+      while(event_next(&e)) {
+	++read;
+	if(e.type >= kEventEncoder0 && e.type <= kEventEncoder3) {
+	  encRead += e.data;
+	}
+      }
+      fifoRead += fifoFill;
+      fifoFill = 0;
+    }
+  }
+
+  event_get_stats(4, &timer);
+  event_get_stats(2, &usb);
+  printf("stall %3u ms: fifo read %6u, dropped %6u | "
+	 "queue read %6u, dropped %u, %u coalesced, encoder sum %ld of %ld\n",
+	 stall, fifoRead, fifoDropped, read, timer.dropped + usb.dropped,
+	 event_coalesced(), encRead, encPosted);
+  return encRead != encPosted || usb.dropped > 0;
+}
@@ -0,0 +1,158 @@
+/* event_order.c
+
+   checks that the event queue (avr32_sim/src/events.c)
+   delivers events in the order they were posted, across contexts.
+
+   random events are posted from random contexts, and read back
+   in random amounts, against a model: one fifo, in which a latched
+   event (encoder, adc, refresh, poll) folds into one of its type
+   that is still waiting, and encoder sums of 0 are skipped.
+
+   usage: event_order [rounds] [seed]
+   exits non-zero on any mismatch.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "events.h"
+
+// most events posted per round
+#define MAX_POSTS 20
+// the model is read down when it gets this long,
+// which keeps every queue from filling
+#define MAX_WAITING 40
+#define MODEL_SIZE 64
+
+// how the queue treats each event type
+typedef enum {
+  eQueued,
+  eLatest,
+  eSum,
+} eKind;
+
+static event_t model[MODEL_SIZE];
+static u32 modelPut = 0;
+static u32 modelGet = 0;
+// model index of the waiting event of a latched type, or -1
+static s32 waiting[kNumEventTypes];
+
+static u32 fails = 0;
+static u32 delivered = 0;
+
+static eKind kind(etype t) {
+  switch(t) {
+  case kEventAdc0: case kEventAdc1: case kEventAdc2: case kEventAdc3:
+  case kEventMonomePoll: case kEventMonomeRefresh:
+  case kEventMidiRefresh: case kEventScreenRefresh:
+    return eLatest;
+  case kEventEncoder0: case kEventEncoder1:
+  case kEventEncoder2: case kEventEncoder3:
+    return eSum;
+  default:
+    return eQueued;
+  }
+}
+
+static void fail(const char* what, u32 round, const event_t* got,
+		 const event_t* want) {
+  ++fails;
+  if(fails < 20) {
+    printf("FAIL %s: round %u, got %d/%d, expected %d/%d\n", what, round,
+	   got->type, got->data, want ? want->type : -1, want ? want->data : 0);
+  }
+}
+
+static void model_post(const event_t* e) {
+  const eKind k = kind(e->type);
+  if(k != eQueued && waiting[e->type] >= 0) {
+    event_t* w = &(model[waiting[e->type] % MODEL_SIZE]);
+    if(k == eSum) { w->data += e->data; } else { w->data = e->data; }
+    return;
+  }
+  if(k != eQueued) { waiting[e->type] = modelPut; }
+  model[(modelPut++) % MODEL_SIZE] = *e;
+}
+
+// next event the queue should deliver, or 0
+static event_t* model_next(void) {
+  event_t* e;
+  while(modelGet != modelPut) {
+    e = &(model[(modelGet++) % MODEL_SIZE]);
+    if(kind(e->type) == eQueued) { return e; }
+    waiting[e->type] = -1;
+    if(kind(e->type) != eSum || e->data != 0) { return e; }
+  }
+  return 0;
+}
+
+static void post_random(u32 round) {
+  static s32 serial = 0;
+  event_t e;
+  switch(rand() % 4) {
+  case 0:
+    e.type = kEventEncoder0 + rand() % 4;
+    e.data = (rand() % 2) ? 1 : -1;
+    break;
+  case 1:
+    e.type = (rand() % 2) ? kEventAdc0 + rand() % 4 : kEventScreenRefresh;
+    e.data = rand() % 4096;
+    break;
+  default:
+    e.type = (rand() % 2) ? kEventSwitch0 + rand() % 8 : kEventMonomeGridKey;
+    e.data = ++serial;
+    break;
+  }
+  event_set_context(rand() % EVENT_CONTEXTS);
+  if(!event_post(&e)) {
+    fail("post refused", round, &e, 0);
+    return;
+  }
+  model_post(&e);
+}
+
+static void read_one(u32 round) {
+  event_t got;
+  event_t* want = model_next();
+  event_set_context(0);
+  if(!event_next(&got)) {
+    if(want != 0) { fail("nothing delivered", round, &got, want); }
+    return;
+  }
+  ++delivered;
+  if(want == 0) {
+    fail("unexpected event", round, &got, 0);
+  } else if(got.type != want->type || got.data != want->data) {
+    fail("out of order", round, &got, want);
+  }
+}
+
+int main(int argc, char** argv) {
+  const u32 rounds = argc > 1 ? (u32)atoi(argv[1]) : 200000;
+  u32 r, n, i;
+
+  srand(argc > 2 ? atoi(argv[2]) : 1);
+  init_events();
+  for(i=0; i<kNumEventTypes; ++i) { waiting[i] = -1; }
+
+  for(r=0; r<rounds; ++r) {
+    n = rand() % MAX_POSTS;
+    for(i=0; i<n; ++i) { post_random(r); }
+    // read some, all, or down to a few
+    if(modelPut - modelGet > MAX_WAITING) {
+      n = modelPut - modelGet - 10;
+    } else if(rand() % 2) {
+      n = MODEL_SIZE;
+    } else {
+      n = rand() % (MAX_POSTS + 1);
+    }
+    for(i=0; i<n; ++i) { read_one(r); }
+  }
+  // the queue ends empty
+  while(modelGet != modelPut) { read_one(rounds); }
+  read_one(rounds);
+
+  printf("%u rounds, %u events delivered, %u coalesced, %u failures\n",
+	 rounds, delivered, event_coalesced(), fails);
+  return fails > 0;
+}
@@ -0,0 +1,167 @@
+/* event_stress.c
+
+   the event queue (avr32_sim/src/events.c) under concurrent posting.
+   four threads stand in for interrupt levels, each with its own context,
+   while the main thread reads:
+   - timer: encoder deltas, and a screen refresh every 16 posts.
+   - adc: a rising value; the latest wins.
+   - switches: numbered events, retried until queued.
+   - grid keys: numbered events, dropped when the ring is full.
+
+   checks:
+   - encoder sums match what was posted.
+   - the adc value never goes back, and the last one arrives.
+   - switches arrive in order, each exactly once.
+   - grid keys arrive in order, none twice, all that were queued.
+   - nothing else arrives.
+
+   usage: event_stress [posts per thread]
+   exits non-zero on any failure.
+*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "events.h"
+
+static long posts = 300000;
+static volatile u8 done[EVENT_CONTEXTS];
+
+// totals of what was queued
+static long encPosted = 0;
+static long adcPosted = 0;
+static long swPosted = 0;
+static long keysPosted = 0;
+static long refreshPosted = 0;
+
+static void* timer_thread(void* arg) {
+  event_t e;
+  long i;
+  event_set_context(1);
+  for(i=0; i<posts; ++i) {
+    e.type = kEventEncoder0 + (i & 3);
+    e.data = 1 + (i % 3);
+    if(event_post(&e)) { encPosted += e.data; }
+    if((i & 15) == 0) {
+      e.type = kEventScreenRefresh;
+      e.data = 0;
+      event_post(&e);
+      ++refreshPosted;
+    }
+    if((i & 1023) == 0) { sched_yield(); }
+  }
+  done[1] = 1;
+  return NULL;
+}
+
+static void* adc_thread(void* arg) {
+  event_t e;
+  long i;
+  event_set_context(2);
+  for(i=1; i<=posts; ++i) {
+    e.type = kEventAdc0;
+    e.data = i;
+    if(event_post(&e)) { adcPosted = i; }
+    if((i & 255) == 0) { sched_yield(); }
+  }
+  done[2] = 1;
+  return NULL;
+}
+
+static void* switch_thread(void* arg) {
+  event_t e;
+  long i;
+  event_set_context(3);
+  for(i=1; i<=posts/4; ++i) {
+    e.type = kEventSwitch0;
+    e.data = i;
+    while(!event_post(&e)) { sched_yield(); }
+    ++swPosted;
+  }
+  done[3] = 1;
+  return NULL;
+}
+
+static void* key_thread(void* arg) {
+  event_t e;
+  long i;
+  event_set_context(4);
+  for(i=1; i<=posts; ++i) {
+    e.type = kEventMonomeGridKey;
+    e.data = i;
+    if(event_post(&e)) { ++keysPosted; }
+  }
+  done[4] = 1;
+  return NULL;
+}
+
+int main(int argc, char** argv) {
+  pthread_t th[4];
+  eventQueueStats st;
+  event_t e;
+  long encSum = 0, adcLast = 0, swLast = 0, keyLast = 0;
+  long keys = 0, refreshes = 0, got = 0;
+  u32 fails = 0;
+  u8 all;
+  int i;
+
+  if(argc > 1) { posts = atol(argv[1]); }
+  init_events();
+  pthread_create(&th[0], NULL, &timer_thread, NULL);
+  pthread_create(&th[1], NULL, &adc_thread, NULL);
+  pthread_create(&th[2], NULL, &switch_thread, NULL);
+  pthread_create(&th[3], NULL, &key_thread, NULL);
+
+  do {
+    all = done[1] && done[2] && done[3] && done[4];
+    while(event_next(&e)) {
+      ++got;
+      switch(e.type) {
+      case kEventEncoder0: case kEventEncoder1:
+      case kEventEncoder2: case kEventEncoder3:
+	encSum += e.data;
+	break;
+      case kEventAdc0:
+	if(e.data < adcLast) { ++fails; }
+	adcLast = e.data;
+	break;
+      case kEventSwitch0:
+	if(e.data != swLast + 1) { ++fails; }
+	swLast = e.data;
+	break;
+      case kEventMonomeGridKey:
+	if(e.data <= keyLast) { ++fails; }
+	keyLast = e.data;
+	++keys;
+	break;
+      case kEventScreenRefresh:
+	++refreshes;
+	break;
+      default:
+	++fails;
+      }
+    }
+  } while(!all);
+  for(i=0; i<4; ++i) { pthread_join(th[i], NULL); }
+  // everything was read before the last check of done
+  while(event_next(&e)) { ++fails; }
+
+  printf("%ld events read, %u coalesced\n", got, event_coalesced());
+  printf("encoder sum %ld of %ld, adc %ld of %ld, switches %ld of %ld, "
+	 "keys %ld of %ld, refreshes %ld of %ld\n",
+	 encSum, encPosted, adcLast, adcPosted, swLast, swPosted,
+	 keys, keysPosted, refreshes, refreshPosted);
+  for(i=1; i<EVENT_CONTEXTS; ++i) {
+    event_get_stats(i, &st);
+    printf("context %d: posted %u, dropped %u, high water %u\n",
+	   i, st.posted, st.dropped, st.highWater);
+  }
+  if(encSum != encPosted || adcLast != adcPosted
+     || swLast != swPosted || keys != keysPosted) {
+    ++fails;
+  }
+  printf("%u failures\n", fails);
+  return fails > 0;
+}
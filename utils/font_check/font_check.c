@@ -0,0 +1,195 @@
+/* font_check.c
+
+   checks the anti-aliased text renderer in avr32_sim/src/font.c
+   (glyph atlas, word blitter and string cache)
+   against the one it replaced (old_font_aa.c),
+   and benchmarks a parameter page redraw with each.
+
+   check: random strings at random offsets, inverted or not,
+   rendered with both into separate buffers, which must match
+   byte for byte, along with the returned end pointers.
+   characters past the end of the glyph table ('~' and up) are left out:
+   the old renderer read past the table for them.
+
+   benchmark: a page of params, three rows of 18 px text showing
+   an index and a print_fix16() value, the selected row inverted.
+   each redraw clears the page, renders every row and draws the page
+   to the screen, as after each encoder step;
+   the time for the text alone is reported as well. two cases:
+   - scroll: the selection moves through the params.
+   - edit: the selection stays, and its value changes every redraw.
+
+   usage: font_check [random strings]
+   exits non-zero on any mismatch.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fix.h"
+#include "font.h"
+#include "memory.h"
+#include "region.h"
+#include "screen.h"
+
+#include "old_font_aa.h"
+
+// screen size
+#define SCREEN_W 128
+#define SCREEN_H 64
+// params on the page
+#define PARAMS 256
+// text rows visible on the page
+#define ROWS 3
+// x offset of the value on a row
+#define VAL_X 28
+// redraws per benchmark run
+#define REDRAWS 20000
+
+typedef u8* (*string_aa_fn)(const char* str, u8* buf, u32 size, u8 w, u8 inv);
+
+static u8 bufOld[SCREEN_W * SCREEN_H];
+static u8 bufNew[SCREEN_W * SCREEN_H];
+
+static u32 fails = 0;
+
+// region.c allocates from the heap in memory.c, which isn't linked here
+heap_t alloc_mem(u32 bytes) {
+  return (heap_t)malloc(bytes);
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+//----- equivalence
+
+static void random_string(char* s, u32 n) {
+  u32 i;
+  switch(rand() % 3) {
+  case 0:
+    // a param value
+    print_fix16(s, (fix16_t)rand() - RAND_MAX / 2);
+    break;
+  case 1:
+    // a label, repeated often so the cache is used
+    snprintf(s, n, "%s", (rand() % 2) ? "LEVEL" : "-12.3456");
+    break;
+  default:
+    // anything in the table
+    n = rand() % n;
+    for(i=0; i<n; ++i) {
+      s[i] = (char)(FONT_ASCII_OFFSET + rand() % ('~' - FONT_ASCII_OFFSET));
+    }
+    s[n] = 0;
+    break;
+  }
+}
+
+static void check_strings(u32 count) {
+  char s[20];
+  u32 k, x, y, off, size;
+  u8 inv;
+  u8* endOld;
+  u8* endNew;
+
+  for(k=0; k<count; ++k) {
+    random_string(s, sizeof(s) - 1);
+    inv = rand() % 2;
+    x = rand() % 40;
+    y = rand() % (SCREEN_H - FONT_AA_CHARH);
+    off = y * SCREEN_W + x;
+    // both size checks: running out of buffer, and not
+    size = (rand() % 4) ? sizeof(bufOld) - off : rand() % (SCREEN_W - x);
+    endOld = old_string_aa(s, bufOld + off, size, SCREEN_W, inv);
+    endNew = font_string_aa(s, bufNew + off, size, SCREEN_W, inv);
+    if(endOld - bufOld != endNew - bufNew
+       || memcmp(bufOld, bufNew, sizeof(bufOld)) != 0) {
+      ++fails;
+      if(fails < 20) {
+	printf("FAIL: \"%s\" at %u,%u, size %u, inv %u\n", s, x, y, size, inv);
+      }
+      memcpy(bufNew, bufOld, sizeof(bufOld));
+    }
+  }
+}
+
+//----- page redraw benchmark
+
+static region page = { SCREEN_W, SCREEN_H, SCREEN_W * SCREEN_H, 0, 0, 1, NULL };
+static fix16_t values[PARAMS];
+static char labels[PARAMS][4];
+
+// render the rows around the selection;
+// with full set, also clear the page first and draw it after
+static void page_redraw(string_aa_fn string_aa, u32 sel, u8 full) {
+  char val[FIX_DIG_TOTAL + 1];
+  u32 first = sel > 0 ? sel - 1 : 0;
+  u32 i, off;
+  if(full) { region_fill(&page, 0); }
+  for(i=0; i<ROWS && first + i < PARAMS; ++i) {
+    off = i * FONT_AA_CHARH * SCREEN_W;
+    print_fix16(val, values[first + i]);
+    string_aa(labels[first + i], page.data + off, page.len - off,
+	      SCREEN_W, first + i == sel);
+    string_aa(val, page.data + off + VAL_X, page.len - off - VAL_X,
+	      SCREEN_W, first + i == sel);
+  }
+  if(full) { screen_draw_region(page.x, page.y, page.w, page.h, page.data); }
+}
+
+// ns per redraw
+static double bench(string_aa_fn string_aa, u8 edit, u8 full) {
+  double t0;
+  u32 i, sel = PARAMS / 2;
+  t0 = now_ns();
+  for(i=0; i<REDRAWS; ++i) {
+    if(edit) {
+      values[sel] += 0x100;
+    } else {
+      // scroll down the list and back up
+      sel = i % (2 * PARAMS);
+      if(sel >= PARAMS) { sel = 2 * PARAMS - 1 - sel; }
+    }
+    page_redraw(string_aa, sel, full);
+  }
+  return (now_ns() - t0) / REDRAWS;
+}
+
+static void bench_case(const char* name, u8 edit) {
+  fontAaStats st;
+  double textOld, textNew, fullOld, fullNew;
+  textOld = bench(&old_string_aa, edit, 0);
+  fullOld = bench(&old_string_aa, edit, 1);
+  font_aa_clear_stats();
+  textNew = bench(&font_string_aa, edit, 0);
+  font_aa_get_stats(&st);
+  fullNew = bench(&font_string_aa, edit, 1);
+  printf("%s: text %.0f -> %.0f ns, whole redraw %.0f -> %.0f ns "
+	 "(cache %u hits, %u misses)\n",
+	 name, textOld, textNew, fullOld, fullNew, st.hits, st.misses);
+}
+
+int main(int argc, char** argv) {
+  const u32 count = argc > 1 ? (u32)atoi(argv[1]) : 20000;
+  u32 i;
+
+  srand(1);
+  check_strings(count);
+  printf("%u strings, %u mismatches\n", count, fails);
+
+  region_alloc(&page);
+  for(i=0; i<PARAMS; ++i) {
+    snprintf(labels[i], sizeof(labels[i]), "%u", i);
+    values[i] = (fix16_t)(rand() % 0x200000) - 0x100000;
+  }
+  screen_clear();
+  bench_case("scroll", 0);
+  bench_case("edit", 1);
+
+  return fails > 0;
+}
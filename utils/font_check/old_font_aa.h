@@ -0,0 +1,15 @@
+/* old_font_aa.h
+
+   the anti-aliased string renderer before the glyph atlas,
+   for comparison.
+*/
+
+#ifndef _FONT_CHECK_OLD_FONT_AA_H_
+#define _FONT_CHECK_OLD_FONT_AA_H_
+
+#include "types.h"
+
+extern u8* old_glyph_aa(char ch, u8* buf, u8 w, u8 inv);
+extern u8* old_string_aa(const char* str, u8* buf, u32 size, u8 w, u8 inv);
+
+#endif
@@ -0,0 +1,345 @@
+/* fract_check.c
+
+   checks the inline fract emulation (common/fract32_emu.h)
+   against the blackfin.
+
+   two kinds of check:
+   - reference vectors: results of the bf533 intrinsics for
+     the edge cases that matter (saturation, rounding, shift counts).
+   - a slow model of each instruction, written out step by step
+     the way the hardware does it (mult_fr1x32x32 as the builtin's
+     four partial products through 40-bit accumulators, etc),
+     run over edge values and random inputs.
+
+   usage: fract_check [random iterations]
+   prints each mismatch and exits non-zero if there were any.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fract32_emu.h"
+#include "types.h"
+
+static u32 fails = 0;
+static u32 checks = 0;
+
+#define CHECK(name, got, want, a, b) do {				\
+    long long g_ = (long long)(got), w_ = (long long)(want);		\
+    ++checks;								\
+    if(g_ != w_) {							\
+      ++fails;								\
+      if(fails < 40) {							\
+	printf("FAIL %s(0x%08x, 0x%08x): got 0x%08llx, want 0x%08llx\n", \
+	       name, (u32)(a), (u32)(b),				\
+	       (unsigned long long)g_ & 0xffffffffffULL,		\
+	       (unsigned long long)w_ & 0xffffffffffULL);		\
+      }									\
+    }									\
+  } while(0)
+
+//-----------------------
+//--- reference vectors
+
+typedef struct { s32 a; s32 b; s32 r; } vec32;
+
+static const vec32 addVecs[] = {
+  { 0x7fffffff, 0x00000001, 0x7fffffff },
+  { 0x80000000, 0xffffffff, 0x80000000 },
+  { 0x40000000, 0x40000000, 0x7fffffff },
+  { 0x40000000, 0x3fffffff, 0x7fffffff },
+  { 0xc0000000, 0xc0000000, 0x80000000 },
+  { 0x12345678, 0x01010101, 0x13355779 },
+};
+
+static const vec32 multVecs[] = {
+  // -1 * -1 saturates
+  { 0x80000000, 0x80000000, 0x7fffffff },
+  { 0x80000000, 0x7fffffff, 0x80000001 },
+  { 0x7fffffff, 0x7fffffff, 0x7ffffffe },
+  { 0x40000000, 0x40000000, 0x20000000 },
+  // products truncate toward -inf
+  { 0x00000001, 0x00000001, 0x00000000 },
+  { 0xffffffff, 0x00000001, 0xffffffff },
+  { 0x00010000, 0x00008000, 0x00000001 },
+  { 0xffff0000, 0x00008000, 0xffffffff },
+  { 0x12345678, 0x87654321, 0xeed8ed1a },
+  // both high halves 0x8000: the hi * hi partial product saturates
+  { 0x80000000, 0x80000001, 0x7ffffffe },
+  { 0x80008000, 0x80008000, 0x7ffeffff },
+};
+
+static const vec32 shlVecs[] = {
+  { 0x00000001, 31, 0x7fffffff },
+  { 0x40000000, 1, 0x7fffffff },
+  { 0xc0000000, 1, 0x80000000 },
+  { 0xc0000001, 1, 0x80000002 },
+  { 0x80000000, -31, 0xffffffff },
+  { 0x80000000, -32, 0xffffffff },
+  { 0x7fffffff, -32, 0x00000000 },
+  // only the low 6 bits count: 33 is 0x21 -> -31
+  { 0x40000000, 33, 0x00000000 },
+  // 64 -> 0
+  { 0x12345678, 64, 0x12345678 },
+};
+
+static const vec32 mult16Vecs[] = {
+  { 0x8000, 0x8000, 0x7fff },
+  { 0x8000, 0x7fff, 0x8001 },
+  { 0x4000, 0x4000, 0x2000 },
+  { 0x0001, 0x0001, 0x0000 },
+  { 0xffff, 0x0001, 0xffff },
+};
+
+static const vec32 multr16Vecs[] = {
+  { 0x8000, 0x8000, 0x7fff },
+  { 0x0001, 0x4000, 0x0001 },
+  { 0xffff, 0x4000, 0x0000 },
+  { 0x0001, 0x3fff, 0x0000 },
+};
+
+static const vec32 roundVecs[] = {
+  { 0x7fff8000, 0, 0x7fff },
+  { 0x12348000, 0, 0x1235 },
+  { 0x12347fff, 0, 0x1234 },
+  { 0xffff8000, 0, 0x0000 },
+  { 0x80000000, 0, 0x8000 },
+};
+
+static const vec32 normVecs[] = {
+  { 0x00000000, 0, 31 },
+  { 0xffffffff, 0, 31 },
+  { 0x00000001, 0, 30 },
+  { 0x40000000, 0, 0 },
+  { 0x80000000, 0, 0 },
+  { 0xc0000000, 0, 1 },
+  { 0xc0000001, 0, 1 },
+  { 0xbfffffff, 0, 0 },
+};
+
+static void check_vectors(void) {
+  u32 i;
+  for(i=0; i<sizeof(addVecs)/sizeof(vec32); ++i) {
+    CHECK("add_fr1x32", add_fr1x32(addVecs[i].a, addVecs[i].b),
+	  addVecs[i].r, addVecs[i].a, addVecs[i].b);
+  }
+  for(i=0; i<sizeof(multVecs)/sizeof(vec32); ++i) {
+    CHECK("mult_fr1x32x32", mult_fr1x32x32(multVecs[i].a, multVecs[i].b),
+	  multVecs[i].r, multVecs[i].a, multVecs[i].b);
+  }
+  for(i=0; i<sizeof(shlVecs)/sizeof(vec32); ++i) {
+    CHECK("shl_fr1x32", shl_fr1x32(shlVecs[i].a, shlVecs[i].b),
+	  shlVecs[i].r, shlVecs[i].a, shlVecs[i].b);
+  }
+  for(i=0; i<sizeof(mult16Vecs)/sizeof(vec32); ++i) {
+    CHECK("mult_fr1x16", mult_fr1x16(mult16Vecs[i].a, mult16Vecs[i].b),
+	  (fract16)mult16Vecs[i].r, mult16Vecs[i].a, mult16Vecs[i].b);
+  }
+  for(i=0; i<sizeof(multr16Vecs)/sizeof(vec32); ++i) {
+    CHECK("multr_fr1x16", multr_fr1x16(multr16Vecs[i].a, multr16Vecs[i].b),
+	  (fract16)multr16Vecs[i].r, multr16Vecs[i].a, multr16Vecs[i].b);
+  }
+  for(i=0; i<sizeof(roundVecs)/sizeof(vec32); ++i) {
+    CHECK("round_fr1x32", round_fr1x32(roundVecs[i].a),
+	  (fract16)roundVecs[i].r, roundVecs[i].a, 0);
+  }
+  for(i=0; i<sizeof(normVecs)/sizeof(vec32); ++i) {
+    CHECK("norm_fr1x32", norm_fr1x32(normVecs[i].a),
+	  normVecs[i].r, normVecs[i].a, 0);
+  }
+  CHECK("negate_fr1x32", negate_fr1x32(0x80000000), 0x7fffffff, 0x80000000, 0);
+  CHECK("abs_fr1x32", abs_fr1x32(0x80000000), 0x7fffffff, 0x80000000, 0);
+  CHECK("negate_fr1x16", negate_fr1x16((fract16)0x8000), 0x7fff, 0x8000, 0);
+  CHECK("mult_fr1x32", mult_fr1x32((fract16)0x8000, (fract16)0x8000), 0x7fffffff, 0x8000, 0x8000);
+  CHECK("mult_fr1x32x32NS", mult_fr1x32x32NS(0x80000000, 0x80000000), (s32)0x80000000, 0x80000000, 0x80000000);
+  CHECK("add_fr2x16", add_fr2x16(0x7fff8000, 0x00010001), 0x7fff8001, 0x7fff8000, 0x00010001);
+  CHECK("add_fr2x16", add_fr2x16(0x7fff8000, 0x0001ffff), 0x7fff8000, 0x7fff8000, 0x0001ffff);
+  CHECK("shrl_fr1x16", shrl_fr1x16((fract16)0x8000, 15), 1, 0x8000, 15);
+  CHECK("norm_fr1x16", norm_fr1x16(0), 15, 0, 0);
+  CHECK("norm_fr1x16", norm_fr1x16(1), 14, 1, 0);
+  CHECK("fr40_to_fr32", fr40_to_fr32(mac_fr1x40(0x7fffffff, 0x4000, 0x4000)), 0x7fffffff, 0x7fffffff, 0);
+  CHECK("mac_fr1x40", mac_fr1x40(FR40_MAX, 0x7fff, 0x7fff), FR40_MAX, 0, 0);
+  CHECK("msu_fr1x40", msu_fr1x40(FR40_MIN, 0x7fff, 0x7fff), FR40_MIN, 0, 0);
+}
+
+//-----------------------
+//--- instruction models
+
+static s64 acc_sat(s64 a) {
+  if(a > FR40_MAX) { return FR40_MAX; }
+  if(a < FR40_MIN) { return FR40_MIN; }
+  return a;
+}
+
+// rN = aN, saturated to 32 bits
+static s32 acc_extract(s64 a) {
+  if(a > 0x7fffffffLL) { return 0x7fffffff; }
+  if(a < -0x80000000LL) { return (s32)0x80000000; }
+  return (s32)a;
+}
+
+static s32 ref_sat16(s32 x) {
+  if(x > 0x7fff) { return 0x7fff; }
+  if(x < -0x8000) { return -0x8000; }
+  return x;
+}
+
+static s32 ref_add(s32 a, s32 b) { return acc_extract((s64)a + b); }
+static s32 ref_sub(s32 a, s32 b) { return acc_extract((s64)a - b); }
+
+// the bfin-elf-gcc expansion of __builtin_bfin_mult_fr1x32x32:
+//   A1 = a.l * b.l (FU);  A1 = A1 >> 16;
+//   A1 += a.h * b.l (M), A0 = a.h * b.h;
+//   A1 += b.h * a.l (M);  A1 = A1 >>> 15;
+//   r = (A0 += A1);
+static s32 ref_mult32(s32 a, s32 b, int ns) {
+  s32 ah = a >> 16, bh = b >> 16;
+  u32 al = (u32)a & 0xffff, bl = (u32)b & 0xffff;
+  s64 a1, a0;
+  a1 = (s64)(al * bl);
+  a1 = a1 >> 16;
+  a1 = acc_sat(a1 + (s64)ah * (s64)bl);
+  a1 = acc_sat(a1 + (s64)bh * (s64)al);
+  a1 = a1 >> 15;
+  // fractional multiply, -1 * -1 saturates
+  if(ah == -0x8000 && bh == -0x8000) {
+    a0 = ns ? 0x80000000LL : 0x7fffffffLL;
+  } else {
+    a0 = (s64)ah * bh * 2;
+  }
+  a0 = acc_sat(a0 + a1);
+  return ns ? (s32)(u32)a0 : acc_extract(a0);
+}
+
+// ASHIFT by a 6-bit signed count
+static s32 ref_ashift32(s32 x, int s) {
+  s64 v = x;
+  int i;
+  if(s >= 0) {
+    for(i=0; i<s; ++i) {
+      v = v * 2;
+      if(v > 0x7fffffffLL) { return 0x7fffffff; }
+      if(v < -0x80000000LL) { return (s32)0x80000000; }
+    }
+    return (s32)v;
+  }
+  for(i=0; i<-s; ++i) { v = (v - (v & 1)) / 2; }
+  return (s32)v;
+}
+
+// 16-bit ASHIFT by a 5-bit signed count
+static s32 ref_ashift16(s16 x, int s) {
+  s32 v = x;
+  int i;
+  if(s >= 0) {
+    for(i=0; i<s; ++i) {
+      v = v * 2;
+      if(v != ref_sat16(v)) { return ref_sat16(v); }
+    }
+    return v;
+  }
+  for(i=0; i<-s; ++i) { v = (v - (v & 1)) / 2; }
+  return v;
+}
+
+static int ref_count5(int y) {
+  y &= 0x1f;
+  return y >= 16 ? y - 32 : y;
+}
+
+static int ref_clip(int y, int lo, int hi) {
+  if(y < lo) { return lo; }
+  if(y > hi) { return hi; }
+  return y;
+}
+
+static int ref_count6(int y) {
+  y &= 0x3f;
+  return y >= 32 ? y - 64 : y;
+}
+
+static int ref_signbits32(s32 x) {
+  int n = 0;
+  u32 u = (u32)x;
+  while(n < 31 && (((u >> (30 - n)) & 1) == (u >> 31))) { ++n; }
+  return n;
+}
+
+static s32 ref_mult16(s16 a, s16 b, int rnd) {
+  s32 p;
+  if(a == -0x8000 && b == -0x8000) { return 0x7fff; }
+  p = (s32)a * b * 2;
+  if(rnd) { p += 0x8000; }
+  return ref_sat16(p >> 16);
+}
+
+//-----------------------
+//--- sweep
+
+static u32 rngState = 0x12345678;
+
+static u32 rng(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+static const u32 edges[] = {
+  0x00000000, 0x00000001, 0xffffffff, 0x7fffffff, 0x80000000,
+  0x80000001, 0x7ffffffe, 0x40000000, 0xc0000000, 0x3fffffff,
+  0x0000ffff, 0x00008000, 0x00007fff, 0xffff8000, 0xffff0000,
+  0x00010000, 0x7fff8000, 0x80008000, 0x55555555, 0xaaaaaaaa,
+};
+
+#define NUM_EDGES (sizeof(edges) / sizeof(u32))
+
+static void check_pair(s32 a, s32 b) {
+  s16 ah = (s16)(a >> 16), bl = (s16)b;
+  int s = (int)(b % 70) - 35;
+  int sw = (int)(a % 200) - 100;
+  s32 lanes = (s32)(((u32)(u16)ref_sat16((s16)(a >> 16) + (s16)(b >> 16)) << 16)
+		    | (u16)ref_sat16((s16)a + (s16)b));
+  CHECK("add_fr1x32", add_fr1x32(a, b), ref_add(a, b), a, b);
+  CHECK("sub_fr1x32", sub_fr1x32(a, b), ref_sub(a, b), a, b);
+  CHECK("mult_fr1x32x32", mult_fr1x32x32(a, b), ref_mult32(a, b, 0), a, b);
+  CHECK("mult_fr1x32x32NS", mult_fr1x32x32NS(a, b), ref_mult32(a, b, 1), a, b);
+  CHECK("shl_fr1x32", shl_fr1x32(a, s), ref_ashift32(a, ref_count6(s)), a, s);
+  CHECK("shr_fr1x32", shr_fr1x32(a, s), ref_ashift32(a, ref_count6(-s)), a, s);
+  CHECK("shl_fr1x32_clip", shl_fr1x32_clip(b, sw), ref_ashift32(b, ref_clip(sw, -32, 31)), b, sw);
+  CHECK("shr_fr1x32_clip", shr_fr1x32_clip(b, sw), ref_ashift32(b, ref_clip(-sw, -32, 31)), b, sw);
+  CHECK("shl_fr1x16", shl_fr1x16(ah, s), (s16)ref_ashift16(ah, ref_count5(s)), ah, s);
+  CHECK("shr_fr1x16", shr_fr1x16(ah, s), (s16)ref_ashift16(ah, ref_count5(-s)), ah, s);
+  CHECK("shl_fr1x16_clip", shl_fr1x16_clip(bl, sw), (s16)ref_ashift16(bl, ref_clip(sw, -16, 15)), bl, sw);
+  CHECK("add_fr2x16", add_fr2x16(a, b), lanes, a, b);
+  CHECK("norm_fr1x32", norm_fr1x32(a), ref_signbits32(a), a, 0);
+  CHECK("negate_fr1x32", negate_fr1x32(a), ref_sub(0, a), a, 0);
+  CHECK("mult_fr1x16", mult_fr1x16(ah, bl), (s16)ref_mult16(ah, bl, 0), ah, bl);
+  CHECK("multr_fr1x16", multr_fr1x16(ah, bl), (s16)ref_mult16(ah, bl, 1), ah, bl);
+  CHECK("add_fr1x16", add_fr1x16(ah, bl), (s16)ref_sat16(ah + bl), ah, bl);
+  CHECK("sub_fr1x16", sub_fr1x16(ah, bl), (s16)ref_sat16(ah - bl), ah, bl);
+  CHECK("round_fr1x32", round_fr1x32(a), (s16)ref_sat16(acc_extract(((s64)a + 0x8000) >> 16)), a, 0);
+  CHECK("sat_fr1x32", sat_fr1x32(a), (s16)ref_sat16(a), a, 0);
+  CHECK("mult_fr1x32", mult_fr1x32(ah, bl),
+	(ah == -0x8000 && bl == -0x8000) ? 0x7fffffff : (s32)ah * bl * 2, ah, bl);
+}
+
+int main(int argc, char** argv) {
+  u32 iters = 1000000;
+  u32 i, j;
+  if(argc > 1) { iters = (u32)strtoul(argv[1], NULL, 0); }
+
+  check_vectors();
+  printf("reference vectors: %u checks, %u failed\n", checks, fails);
+
+  for(i=0; i<NUM_EDGES; ++i) {
+    for(j=0; j<NUM_EDGES; ++j) {
+      check_pair((s32)edges[i], (s32)edges[j]);
+    }
+  }
+  for(i=0; i<iters; ++i) {
+    check_pair((s32)rng(), (s32)rng());
+  }
+  printf("total: %u checks, %u failed\n", checks, fails);
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,16 @@
+/* fat_host.h
+
+   fat_io_lib types for 64-bit hosts
+   (the library default makes uint32 an unsigned long)
+*/
+
+#ifndef _ALEPH_LDR_STREAM_FAT_HOST_H_
+#define _ALEPH_LDR_STREAM_FAT_HOST_H_
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+
+#endif
@@ -0,0 +1,18 @@
+/* fat_list.c
+
+   fat_list.h defines its helpers as plain (C99) inline,
+   which emits no out-of-line copies; provide them here for the host build.
+*/
+
+#include "fat_list.h"
+
+extern void fat_list_init(struct fat_list *list);
+extern void fat_list_remove(struct fat_list *list, struct fat_node *node);
+extern void fat_list_insert_after(struct fat_list *list, struct fat_node *node,
+				  struct fat_node *new_node);
+extern void fat_list_insert_before(struct fat_list *list, struct fat_node *node,
+				   struct fat_node *new_node);
+extern void fat_list_insert_first(struct fat_list *list, struct fat_node *node);
+extern void fat_list_insert_last(struct fat_list *list, struct fat_node *node);
+extern int fat_list_is_empty(struct fat_list *list);
+extern struct fat_node *fat_list_pop_head(struct fat_list *list);
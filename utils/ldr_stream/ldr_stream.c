@@ -0,0 +1,208 @@
+/* ldr_stream.c
+
+   host harness for the chunked dsp loader (common/ldr_stream.h).
+
+   mounts an SD card image with the same fat_io_lib the avr32 uses,
+   streams a file from it through the pipeline into a recording sink,
+   and checks the result against a whole-file read.
+
+   usage:
+     ldr_stream <sd image> <path in image> [out]
+     ldr_stream -f <host file> [out]
+
+   with -f the source is a plain host file instead of an image.
+   if [out] is given, the streamed bytes are written there.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fat_filelib.h"
+#include "ldr_stream.h"
+#include "types.h"
+
+//-------------------------
+//--- media
+
+static FILE* img = NULL;
+static u32 mediaReads = 0;
+static u32 mediaSectors = 0;
+
+static int media_read(uint32 sector, uint8* buffer, uint32 sector_count) {
+  ++mediaReads;
+  mediaSectors += sector_count;
+  if(fseek(img, (long)sector * FAT_SECTOR_SIZE, SEEK_SET) != 0) { return 0; }
+  // reads past the end of the image come back as zeros
+  memset(buffer, 0, sector_count * FAT_SECTOR_SIZE);
+  fread(buffer, FAT_SECTOR_SIZE, sector_count, img);
+  return 1;
+}
+
+static int media_write(uint32 sector, uint8* buffer, uint32 sector_count) {
+  // read-only
+  return 0;
+}
+
+//-------------------------
+//--- sources
+
+static u32 read_fat(void* fp, u8* dst, u32 len) {
+  int n = fl_fread(dst, 1, len, fp);
+  return n > 0 ? (u32)n : 0;
+}
+
+static u32 read_host(void* fp, u8* dst, u32 len) {
+  return (u32)fread(dst, 1, len, (FILE*)fp);
+}
+
+//-------------------------
+//--- recording sink
+
+typedef struct {
+  // optional copy of everything sent
+  FILE* out;
+  // running checksum of everything sent
+  u32 sum;
+  u32 bytes;
+  u32 chunks;
+  u32 maxChunk;
+  // chunk handed over but not yet flushed
+  const u8* pending;
+  u32 pendingBytes;
+  // pipeline contract violations
+  u32 errors;
+  u8 begun;
+  u8 ended;
+} Recorder;
+
+// fletcher-32 style running sum over bytes
+static u32 sum_bytes(u32 sum, const u8* p, u32 n) {
+  u32 a = sum & 0xffff;
+  u32 b = sum >> 16;
+  while(n--) {
+    a = (a + *p++) % 0xffff;
+    b = (b + a) % 0xffff;
+  }
+  return (b << 16) | a;
+}
+
+static void rec_begin(LdrSink* sink, u32 size) {
+  Recorder* rec = (Recorder*)sink->ctx;
+  if(rec->begun) { ++rec->errors; }
+  rec->begun = 1;
+}
+
+static void rec_write(LdrSink* sink, const u8* data, u32 len) {
+  Recorder* rec = (Recorder*)sink->ctx;
+  // a new chunk may only arrive once the last one was flushed
+  if(rec->pending != NULL || !rec->begun) { ++rec->errors; }
+  if(len > LDR_STREAM_CHUNK) { ++rec->errors; }
+  rec->pending = data;
+  rec->pendingBytes = len;
+  ++rec->chunks;
+  if(len > rec->maxChunk) { rec->maxChunk = len; }
+}
+
+static void rec_flush(LdrSink* sink) {
+  Recorder* rec = (Recorder*)sink->ctx;
+  if(rec->pending == NULL) { ++rec->errors; return; }
+  rec->sum = sum_bytes(rec->sum, rec->pending, rec->pendingBytes);
+  rec->bytes += rec->pendingBytes;
+  if(rec->out != NULL) { fwrite(rec->pending, 1, rec->pendingBytes, rec->out); }
+  rec->pending = NULL;
+  rec->pendingBytes = 0;
+}
+
+static void rec_end(LdrSink* sink) {
+  Recorder* rec = (Recorder*)sink->ctx;
+  if(rec->pending != NULL || rec->ended) { ++rec->errors; }
+  rec->ended = 1;
+}
+
+//-------------------------
+//--- main
+
+static void usage(void) {
+  fprintf(stderr, "usage: ldr_stream <sd image> <path in image> [out]\n");
+  fprintf(stderr, "       ldr_stream -f <host file> [out]\n");
+}
+
+int main(int argc, char** argv) {
+  static LdrStreamBufs bufs;
+  Recorder rec;
+  LdrSink sink = { &rec_begin, &rec_write, &rec_flush, &rec_end, &rec };
+  u8* whole;
+  u32 size, sent, ref;
+  void* fp;
+  int host = 0;
+  const char* outPath = NULL;
+
+  if(argc < 3) { usage(); return 1; }
+  host = (strcmp(argv[1], "-f") == 0);
+  if(argc > 3) { outPath = argv[3]; }
+
+  memset(&rec, 0, sizeof(rec));
+  if(outPath != NULL) {
+    rec.out = fopen(outPath, "wb");
+    if(rec.out == NULL) { perror(outPath); return 1; }
+  }
+
+  if(host) {
+    fp = fopen(argv[2], "rb");
+    if(fp == NULL) { perror(argv[2]); return 1; }
+    fseek(fp, 0, SEEK_END);
+    size = (u32)ftell(fp);
+    rewind(fp);
+    sent = ldr_stream(&read_host, fp, &sink, &bufs, size);
+    // reference read
+    rewind(fp);
+    whole = malloc(size ? size : 1);
+    ref = (u32)fread(whole, 1, size, fp);
+    fclose(fp);
+  } else {
+    img = fopen(argv[1], "rb");
+    if(img == NULL) { perror(argv[1]); return 1; }
+    fl_init();
+    if(fl_attach_media(&media_read, &media_write) != FAT_INIT_OK) {
+      fprintf(stderr, "%s: not a FAT image\n", argv[1]);
+      return 1;
+    }
+    fp = fl_fopen(argv[2], "r");
+    if(fp == NULL) {
+      fprintf(stderr, "%s: not found in image\n", argv[2]);
+      return 1;
+    }
+    size = ((FL_FILE*)fp)->filelength;
+    mediaReads = mediaSectors = 0;
+    sent = ldr_stream(&read_fat, fp, &sink, &bufs, size);
+    fl_fclose(fp);
+    printf("media reads: %u (%u sectors)\n", mediaReads, mediaSectors);
+    // reference read
+    fp = fl_fopen(argv[2], "r");
+    whole = malloc(size ? size : 1);
+    ref = (u32)read_fat(fp, whole, size);
+    fl_fclose(fp);
+    fl_shutdown();
+    fclose(img);
+  }
+
+  if(rec.out != NULL) { fclose(rec.out); }
+
+  printf("size: %u, sent: %u, chunks: %u (max %u bytes)\n",
+	 size, sent, rec.chunks, rec.maxChunk);
+  printf("buffered: %u bytes\n", (u32)sizeof(bufs));
+
+  if(rec.errors) {
+    printf("FAIL: %u sink contract errors\n", rec.errors);
+    return 1;
+  }
+  if(sent != size || ref != size || rec.bytes != size
+     || sum_bytes(0, whole, ref) != rec.sum) {
+    printf("FAIL: streamed data does not match the file\n");
+    return 1;
+  }
+  printf("ok\n");
+  free(whole);
+  return 0;
+}
@@ -0,0 +1,274 @@
+/* monome_check.c
+
+   checks the mext grid refresh in avr32_sim/src/monome.c
+   (shadow-buffer diff, cheapest message per change, tx budget)
+   against an emulated grid that decodes every message written to ftdi.
+
+   two runs:
+   - kria: a 16x8 grid through a kria-like session at 1 ms steps:
+     16th-note clock at 120 bpm, keys now and then, loop changes,
+     and the refresh timer every 50 ms.
+     compares bytes per refresh with the full quadrant maps
+     sent before (35 bytes for each quadrant flagged dirty).
+   - stress: a 16x16 grid, random frames from a few changed leds
+     to all 256, refreshed until nothing is left to send.
+
+   checks:
+   - the grid matches the led buffer once a refresh leaves nothing dirty.
+   - no write is bigger than a usb packet,
+     and no refresh sends more than the tx budget.
+   - every message decodes.
+
+   usage: monome_check [kria seeds]
+   exits non-zero on any failure.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// the driver is included, to set up a device without a usb connection
+#include "monome.c"
+
+// led levels on the emulated grid
+static u8 grid[MONOME_MAX_LED_BYTES];
+// bytes written since the last reset
+static u32 written = 0;
+static u32 fails = 0;
+
+static void fail(const char* what, u32 n) {
+  ++fails;
+  if(fails < 20) {
+    printf("FAIL %s: %u\n", what, n);
+  }
+}
+
+//----- stubs
+
+void delay_ms(u32 ms) { ;; }
+void print_dbg(const char* str) { ;; }
+void print_dbg_ulong(unsigned long n) { ;; }
+void print_dbg_hex(unsigned long n) { ;; }
+u8 event_post(event_t* e) { return 1; }
+
+static u8 rxBuf[64];
+void ftdi_read(void) { ;; }
+u8* ftdi_rx_buf(void) { return rxBuf; }
+volatile u8 ftdi_rx_bytes(void) { return 0; }
+volatile u8 ftdi_rx_busy(void) { return 0; }
+volatile u8 ftdi_tx_busy(void) { return 0; }
+
+// two leds from a map byte
+static void grid_put2(u8 x, u8 y, u8 b) {
+  grid[(y << 4) | x] = b >> 4;
+  grid[(y << 4) | (x + 1)] = b & 0xf;
+}
+
+// decode mext led messages into the emulated grid
+void ftdi_write(u8* data, u32 bytes) {
+  u32 i = 0;
+  u8 k;
+  written += bytes;
+  if(bytes > MONOME_TX_PACKET) { fail("write bigger than a packet", bytes); }
+  while(i < bytes) {
+    switch(data[i]) {
+    case MEXT_LEVEL_SET:
+      grid[(data[i+2] << 4) | data[i+1]] = data[i+3];
+      i += MEXT_SET_BYTES;
+      break;
+    case MEXT_LEVEL_MAP:
+      for(k=0; k<32; ++k) {
+	grid_put2(data[i+1] + (k & 3) * 2, data[i+2] + (k >> 2), data[i+3+k]);
+      }
+      i += MEXT_MAP_BYTES;
+      break;
+    case MEXT_LEVEL_ROW:
+      for(k=0; k<4; ++k) {
+	grid_put2(data[i+1] + k * 2, data[i+2], data[i+3+k]);
+      }
+      i += MEXT_LINE_BYTES;
+      break;
+    case MEXT_LEVEL_COL:
+      for(k=0; k<4; ++k) {
+	grid[((data[i+2] + 2*k) << 4) | data[i+1]] = data[i+3+k] >> 4;
+	grid[((data[i+2] + 2*k + 1) << 4) | data[i+1]] = data[i+3+k] & 0xf;
+      }
+      i += MEXT_LINE_BYTES;
+      break;
+    default:
+      fail("unknown message", data[i]);
+      return;
+    }
+  }
+}
+
+//----- helpers
+
+static void setup_grid(u8 cols, u8 rows) {
+  init_monome();
+  memset(grid, 0, sizeof(grid));
+  memset(monomeLedBuffer, 0, MONOME_MAX_LED_BYTES);
+  mdesc.cols = cols;
+  mdesc.rows = rows;
+  mdesc.device = eDeviceGrid;
+  mdesc.protocol = eProtocolMext;
+  set_funcs();
+  monome_clear_tx_stats();
+}
+
+// one refresh; checks the budget, and the grid once nothing is left
+static void refresh(u32 leds) {
+  monomeTxStats st;
+  monome_grid_refresh();
+  monome_get_tx_stats(&st);
+  if(st.lastBytes > MONOME_TX_BUDGET) { fail("refresh over budget", st.lastBytes); }
+  if(monomeFrameDirty == 0 && memcmp(grid, monomeLedBuffer, leds) != 0) {
+    fail("grid differs from led buffer", st.refreshes);
+  }
+}
+
+//----- kria session
+
+static u8 trig[16];
+static u8 accent[16];
+static u8 octave[16];
+static u8 pos[3];
+static u8 loopStart[3];
+static u8 loopEnd[3];
+static u8 page;
+
+// kria's trigger page, or its note page
+static void kria_redraw(void) {
+  u8* b = monomeLedBuffer;
+  u8 i, j;
+  memset(b, 0, 128);
+  if(page == 0) {
+    for(i=0; i<16; ++i) {
+      if(trig[i]) { b[i] = 5; }
+      if(accent[i]) { b[16 + i] = 5; }
+      for(j=0; j<=octave[i]; ++j) { b[96 - 16*j + i] = 3; }
+      if(i == pos[0]) { b[i] += 4; }
+      if(i == pos[1]) { b[16 + i] += 4; }
+      if(i == pos[2]) { b[96 - octave[i]*16 + i] += 4; }
+    }
+  } else {
+    for(i=0; i<16; ++i) {
+      b[(6 - (trig[i] % 7)) * 16 + i] = (i == pos[0]) ? 12 : 7;
+    }
+  }
+  // nav row
+  b[112] = 3;
+  b[115 + page] = 12;
+  b[121] = 3;
+  b[122] = 3;
+  b[124] = 3;
+  b[125] = 3;
+  // as op_kria does: the whole grid is flagged
+  monome_set_quadrant_flag(0);
+  monome_set_quadrant_flag(1);
+}
+
+static void kria_key(void) {
+  const u8 k = rand() % 16;
+  switch(rand() % 4) {
+  case 0: trig[k] ^= 1; break;
+  case 1: accent[k] ^= 1; break;
+  case 2: octave[k] = rand() % 5; break;
+  default: if(rand() % 8 == 0) { page ^= 1; } break;
+  }
+  kria_redraw();
+}
+
+static void run_kria(u32 seed) {
+  monomeTxStats st;
+  u32 maps = 0;
+  u32 calls = 0;
+  u32 t;
+  u8 i;
+
+  srand(seed);
+  setup_grid(16, 8);
+  for(i=0; i<16; ++i) {
+    trig[i] = rand() % 2;
+    accent[i] = rand() % 3 == 0;
+    octave[i] = rand() % 5;
+  }
+  for(i=0; i<3; ++i) {
+    pos[i] = 0;
+    loopStart[i] = 0;
+    loopEnd[i] = 15;
+  }
+  page = 0;
+
+  // ten minutes
+  for(t=0; t<600000; ++t) {
+    if(t % 125 == 0) {
+      for(i=0; i<3; ++i) {
+	pos[i] = (pos[i] >= loopEnd[i]) ? loopStart[i] : pos[i] + 1;
+      }
+      kria_redraw();
+    }
+    if(rand() % 400 == 0) { kria_key(); }
+    if(rand() % 3000 == 0) {
+      i = rand() % 3;
+      loopStart[i] = rand() % 8;
+      loopEnd[i] = loopStart[i] + rand() % 8;
+    }
+    if(t % 50 == 0 && monomeFrameDirty) {
+      // quadrant maps the old refresh sent
+      maps += (monomeFrameDirty & 1) + ((monomeFrameDirty >> 1) & 1);
+      ++calls;
+      refresh(128);
+    }
+  }
+
+  monome_get_tx_stats(&st);
+  printf("kria seed %u: %u refreshes, before %.1f bytes each, now %.1f, "
+	 "%u deferred\n", seed, calls,
+	 (double)(maps * MEXT_MAP_BYTES) / calls,
+	 (double)st.bytes / calls, st.deferred);
+}
+
+//----- 256 grid stress
+
+static void run_stress(void) {
+  u32 it, most = 0, mostBytes = 0, n, k;
+  u32 i, c;
+  monomeTxStats st;
+
+  srand(7);
+  setup_grid(16, 16);
+  for(it=0; it<20000; ++it) {
+    k = rand() % 4;
+    if(k == 0) {
+      for(i=0; i<256; ++i) { monomeLedBuffer[i] = rand() & 0xf; }
+    } else {
+      n = 1 + rand() % (k == 1 ? 3 : 40);
+      while(n-- > 0) { monomeLedBuffer[rand() & 0xff] = rand() & 0xf; }
+    }
+    if(rand() % 5 == 0) {
+      c = rand() % 16;
+      for(i=0; i<16; ++i) { monomeLedBuffer[i*16 + c] = rand() & 0xf; }
+    }
+    monomeFrameDirty |= 1;
+    // a full frame takes several refreshes within the budget
+    for(n=0; monomeFrameDirty && n<16; ++n) {
+      written = 0;
+      refresh(256);
+      if(written > mostBytes) { mostBytes = written; }
+    }
+    if(monomeFrameDirty) { fail("refresh never finished", it); }
+    if(n > most) { most = n; }
+  }
+  monome_get_tx_stats(&st);
+  printf("stress: %u frames, %u refreshes, at most %u per frame, "
+	 "at most %u bytes per refresh\n", it, st.refreshes, most, mostBytes);
+}
+
+int main(int argc, char** argv) {
+  const u32 seeds = argc > 1 ? (u32)atoi(argv[1]) : 3;
+  u32 s;
+  for(s=1; s<=seeds; ++s) { run_kria(s); }
+  run_stress();
+  printf("%u failures\n", fails);
+  return fails > 0;
+}
@@ -0,0 +1,59 @@
+/* bfin_side.c
+   param_loopback
+
+   the receiving end: bfin_sim's SPI state machine and param queue,
+   with a module that records every param change it is given.
+
+   the avr32 sim has its own ctl_ functions, so these are renamed.
+ */
+
+#define ctl_param_change bfin_ctl_param_change
+#define ctl_perform_next_change bfin_ctl_perform_next_change
+#define ctl_perform_all_changes bfin_ctl_perform_all_changes
+#define ctl_next_frame bfin_ctl_next_frame
+#define ctl_num_pending bfin_ctl_num_pending
+#define ctl_param_ready bfin_ctl_param_ready
+
+#include "control.c"
+#include "spi.c"
+
+#include "bfin_side.h"
+
+volatile u8 processAudio = 0;
+
+static ParamData paramData[NUM_PARAMS];
+static ModuleData moduleData = { "loopback", paramData, NUM_PARAMS };
+ModuleData* gModuleData = &moduleData;
+
+static bfin_side_param_fn paramFn = NULL;
+// bytes that arrived while READY was low
+static u32 overruns = 0;
+
+void module_set_param(u32 idx, ParamValue v) {
+  if(paramFn != NULL) { (*paramFn)((u8)idx, v); }
+}
+
+void bfin_side_init(bfin_side_param_fn fn) {
+  paramFn = fn;
+}
+
+void bfin_side_rx(u8 b) {
+  if(!ctl_param_ready()) { ++overruns; }
+  spi_process(b);
+}
+
+void bfin_side_frame(void) {
+  ctl_next_frame();
+}
+
+u8 bfin_side_ready(void) {
+  return ctl_param_ready();
+}
+
+u32 bfin_side_pending(void) {
+  return ctl_num_pending();
+}
+
+u32 bfin_side_overruns(void) {
+  return overruns;
+}
@@ -0,0 +1,28 @@
+/* bfin_side.h
+   param_loopback
+
+   the simulated blackfin, as seen from the avr32 side.
+ */
+
+#ifndef _PARAM_LOOPBACK_BFIN_SIDE_H_
+#define _PARAM_LOOPBACK_BFIN_SIDE_H_
+
+#include "param_common.h"
+#include "types.h"
+
+// called for each param change the module applies
+typedef void (*bfin_side_param_fn)(u8 idx, ParamValue val);
+
+extern void bfin_side_init(bfin_side_param_fn fn);
+// one byte from the SPI bus
+extern void bfin_side_rx(u8 b);
+// one audio frame: applies queued param changes
+extern void bfin_side_frame(void);
+// state of the ready pin
+extern u8 bfin_side_ready(void);
+// param changes queued on the bfin
+extern u32 bfin_side_pending(void);
+// bytes received while the ready pin was low
+extern u32 bfin_side_overruns(void);
+
+#endif
@@ -0,0 +1,12 @@
+/* module_custom.h
+   param_loopback
+
+   the simulated bfin has a param for every index on the wire.
+ */
+
+#ifndef _ALEPH_MODULE_CUSTOM_H_
+#define _ALEPH_MODULE_CUSTOM_H_
+
+#define NUM_PARAMS 256
+
+#endif
@@ -0,0 +1,193 @@
+/* param_loopback.c
+
+   end-to-end check of param changes from avr32 to bfin:
+   avr32_sim's pending set (control.c) and batch transport (bfin.c)
+   feed every byte on the bus to bfin_sim's spi_process(),
+   and the bfin applies changes from its queue once per audio frame.
+
+   two runs:
+   - free: the bus sends everything each tick, the bfin keeps up.
+   - ready: the bus is rate limited and gated byte by byte on the
+     bfin's ready pin, and the bfin applies fewer changes than the
+     ui makes, so its queue fills and the avr32's transmit ring
+     pushes back on the pending set.
+
+   checks, for each run:
+   - each param ends at the last value requested for it.
+   - per param, the applied values are the requested ones, in order,
+     with only coalesced (superseded) values missing.
+   - nothing is decoded that wasn't sent.
+   - in the ready run: no byte reaches the bfin while its queue is full,
+     and the transmit ring did refuse frames (backpressure happened).
+
+   reports bytes on the bus against single MSG_SET_PARAM_COM messages,
+   and host throughput of encode + transport + decode.
+
+   usage: param_loopback [ticks]
+   exits non-zero on any mismatch.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bfin.h"
+#include "control.h"
+
+#include "bfin_side.h"
+
+// params touched by the test
+#define NPARAMS 128
+// most requests per param per control tick
+#define MAX_REPEAT 4
+// most params changed per control tick
+#define MAX_BURST 64
+// bytes of a single MSG_SET_PARAM_COM message
+#define SINGLE_MSG_BYTES 6
+
+// every value ever requested for a param, in order
+static ParamValue* sent[NPARAMS];
+static u32 sentCount[NPARAMS];
+static u32 sentMax;
+// how far along sent[] each param's applied values are
+static u32 appliedPos[NPARAMS];
+static ParamValue lastVal[NPARAMS];
+
+static u32 requests;
+static u32 applied;
+static u32 fails = 0;
+
+static void fail(const char* what, u32 idx, s32 val) {
+  ++fails;
+  if(fails < 20) {
+    printf("FAIL %s: param %u, value %d\n", what, idx, val);
+  }
+}
+
+// applied values must appear in sent[], in order
+static void on_param(u8 idx, ParamValue val) {
+  u32 p;
+  ++applied;
+  if(idx >= NPARAMS) {
+    fail("unknown param", idx, val);
+    return;
+  }
+  p = appliedPos[idx];
+  while(p < sentCount[idx] && sent[idx][p] != val) { ++p; }
+  if(p == sentCount[idx]) {
+    fail("value not sent or out of order", idx, val);
+    return;
+  }
+  appliedPos[idx] = p + 1;
+  lastVal[idx] = val;
+}
+
+static void request(u8 idx, ParamValue val) {
+  sent[idx][sentCount[idx]++] = val;
+  ctl_param_change(idx, (u32)val);
+  ++requests;
+}
+
+static void frames(u32 n) {
+  while(n-- > 0) { bfin_side_frame(); }
+}
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// run ticks of random ui changes.
+// each tick, the bus moves up to rate bytes (0: all)
+// and the bfin runs framesPerTick audio frames.
+static void run(const char* name, u32 ticks, u32 rate, u32 framesPerTick,
+		u8 gated) {
+  const u32 bytes0 = bfin_spi_bytes();
+  const u32 full0 = bfin_sim_tx_full();
+  const u32 over0 = bfin_side_overruns();
+  u32 t, i, n, f, bytes, last;
+  u8 idx;
+  double t0, dt;
+
+  for(i=0; i<NPARAMS; ++i) {
+    sentCount[i] = 0;
+    appliedPos[i] = 0;
+  }
+  requests = 0;
+  applied = 0;
+  bfin_sim_set_tx_rate(rate);
+  bfin_sim_set_ready(gated ? &bfin_side_ready : NULL);
+
+  t0 = now_s();
+  for(t=0; t<ticks; ++t) {
+    // a burst of ui changes: some params move several times per tick
+    n = rand() % MAX_BURST;
+    for(i=0; i<n; ++i) {
+      idx = (u8)(rand() % NPARAMS);
+      f = 1 + rand() % MAX_REPEAT;
+      while(f-- > 0 && sentCount[idx] < sentMax) {
+	request(idx, (ParamValue)(rand() - RAND_MAX / 2));
+      }
+    }
+    ctl_param_flush();
+    frames(framesPerTick);
+  }
+  // drain until a pass moves nothing
+  do {
+    last = bfin_spi_bytes();
+    ctl_param_flush();
+    bfin_tx_flush();
+    frames(framesPerTick);
+  } while(bfin_spi_bytes() != last || bfin_side_pending() > 0
+	  || bfin_sim_tx_pending() > 0);
+  dt = now_s() - t0;
+
+  for(i=0; i<NPARAMS; ++i) {
+    if(sentCount[i] > 0 && lastVal[i] != sent[i][sentCount[i] - 1]) {
+      fail("final value", i, lastVal[i]);
+    }
+  }
+
+  bytes = bfin_spi_bytes() - bytes0;
+  printf("%s: %u ticks, %u requests, %u applied (%u coalesced)\n",
+	 name, ticks, requests, applied, requests - applied);
+  printf("  bus: %u bytes batched, %u as single messages (%.2f bytes per request)\n",
+	 bytes, requests * SINGLE_MSG_BYTES, (double)bytes / requests);
+  printf("  ring full %u times, %u bytes sent while not ready\n",
+	 bfin_sim_tx_full() - full0, bfin_side_overruns() - over0);
+  printf("  host: %.0f requests/s through encode, bus and decode\n",
+	 requests / dt);
+
+  if(gated) {
+    if(bfin_side_overruns() != over0) {
+      fail("bytes sent while not ready", 0, bfin_side_overruns() - over0);
+    }
+    if(bfin_sim_tx_full() == full0) {
+      fail("no backpressure on the ring", 0, 0);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  u32 ticks = argc > 1 ? (u32)atoi(argv[1]) : 2000;
+  u32 i;
+
+  sentMax = ticks * MAX_REPEAT * 4;
+  for(i=0; i<NPARAMS; ++i) {
+    sent[i] = malloc(sizeof(ParamValue) * sentMax);
+  }
+  srand(1);
+  bfin_side_init(&on_param);
+  bfin_sim_set_rx_byte(&bfin_side_rx);
+
+  // 1 ms ticks at 48k, unlimited bus
+  run("free", ticks, 0, 48, 0);
+  // slow bfin: fewer changes applied per tick than the ui makes
+  run("ready", ticks, 256, 8, 1);
+
+  printf("%u failures\n", fails);
+  for(i=0; i<NPARAMS; ++i) { free(sent[i]); }
+  return fails > 0;
+}
@@ -173,7 +173,7 @@ static void net_read_json_params(json_t* o) {
   int count = json_array_size( o );
   //  json_t* arr;
 
-  net->numParams = count;
+  net_set_num_params(count);
   //  arr = json_object_get(o, "data");
   for(i=0; i<count; i++) {
     json_t* p = json_array_get(o, i);
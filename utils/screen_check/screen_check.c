@@ -0,0 +1,144 @@
+/* screen_check.c
+
+   checks the screen compositor in avr32_sim/src/screen.c
+   (packed screen copy, dirty rectangles, flush)
+   against a reference image, through the simulated OLED graphics RAM,
+   and counts the pixel bytes each drawing sends.
+
+   two runs:
+   - random: draws at random even offsets and widths, some clipped
+     by the screen edge, with screen_draw_region(), or composed
+     with screen_compose_region() or screen_compose_region_offset()
+     (wrapping data) and flushed now and then.
+     mostly unchanged pixels, as redraws of the same page are.
+     after every flush the graphics RAM must match the image;
+     reports bytes sent, against the whole (clipped) region
+     that every draw sent before.
+   - pixel: a full screen redrawn with one pixel changed
+     must send one byte, where it sent all 4096 before.
+
+   usage: screen_check [random draws]
+   exits non-zero on any failure.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "screen.h"
+
+// reference image, one pixel per byte, in drawing orientation
+static u8 image[SCREEN_COL_PX][SCREEN_ROW_PX];
+// region data
+static u8 data[SCREEN_ROW_PX * SCREEN_COL_PX];
+
+static u32 fails = 0;
+
+static void fail(const char* what, u32 n) {
+  ++fails;
+  if(fails < 20) {
+    printf("FAIL %s: %u\n", what, n);
+  }
+}
+
+// the screen is mounted upside down: graphics RAM is reversed
+static void compare_gram(u32 n) {
+  const u8* gram = screen_gram();
+  u8 x, y, b;
+  for(y=0; y<SCREEN_COL_PX; y++) {
+    for(x=0; x<SCREEN_ROW_BYTES; x++) {
+      b = (image[y][2*x] << 4) | image[y][2*x + 1];
+      if(gram[(SCREEN_COL_PX_1 - y) * SCREEN_ROW_BYTES + SCREEN_ROW_BYTES_1 - x] != b) {
+	fail("graphics RAM differs from image", n);
+	return;
+      }
+    }
+  }
+}
+
+//----- runs
+
+static void run_random(u32 draws) {
+  screenStats st;
+  // bytes the region sends without the compositor
+  u32 before = 0;
+  u32 n, i, j, len, off;
+  u8 x, y, w, h, cw, ch, mode;
+
+  srand(3);
+  memset(image, 0, sizeof(image));
+  screen_clear();
+  screen_clear_stats();
+
+  for(n=0; n<draws; n++) {
+    w = 2 * (1 + rand() % 40);
+    h = 1 + rand() % 40;
+    x = 2 * (rand() % SCREEN_ROW_BYTES);
+    y = rand() % SCREEN_COL_PX;
+    len = (u32)w * h;
+    off = 0;
+    mode = rand() % 3;
+    if(mode == 2) {
+      len += rand() % 50;
+      off = rand() % len;
+    }
+    // mostly the same background, with a few pixels changed
+    for(i=0; i<len; i++) {
+      data[i] = (rand() % 8 == 0) ? rand() & 0xf : ((n & 1) ? 5 : 0);
+    }
+    for(j=0; j<h && y + j < SCREEN_COL_PX; j++) {
+      for(i=0; i<w && x + i < SCREEN_ROW_PX; i++) {
+	image[y + j][x + i] = data[(off + j * w + i) % len] & 0xf;
+      }
+    }
+    cw = (x + w > SCREEN_ROW_PX ? SCREEN_ROW_PX - x : w) >> 1;
+    ch = y + h > SCREEN_COL_PX ? SCREEN_COL_PX - y : h;
+    before += (u32)cw * ch;
+
+    if(mode == 0) {
+      screen_draw_region(x, y, w, h, data);
+      compare_gram(n);
+    } else {
+      if(mode == 1) {
+	screen_compose_region(x, y, w, h, data);
+      } else {
+	screen_compose_region_offset(x, y, w, h, len, data, off);
+      }
+      if(rand() % 4 == 0) {
+	screen_flush();
+	compare_gram(n);
+      }
+    }
+  }
+  screen_flush();
+  compare_gram(n);
+
+  screen_get_stats(&st);
+  printf("random: %u draws, %u bytes in %u rects (%u command bytes), "
+	 "before %u bytes\n", draws, st.bytes, st.rects, st.commands, before);
+}
+
+static void run_pixel(void) {
+  screenStats st;
+  memset(data, 0, sizeof(data));
+  screen_draw_region(0, 0, SCREEN_ROW_PX, SCREEN_COL_PX, data);
+  screen_clear_stats();
+  data[10 * SCREEN_ROW_PX + 33] = 0xf;
+  screen_draw_region(0, 0, SCREEN_ROW_PX, SCREEN_COL_PX, data);
+  screen_get_stats(&st);
+  printf("pixel: %u bytes in %u rects, before %u bytes\n",
+	 st.bytes, st.rects, GRAM_BYTES);
+  if(st.bytes != 1) { fail("bytes for one pixel", st.bytes); }
+  if(st.rects != 1) { fail("rects for one pixel", st.rects); }
+  memset(image, 0, sizeof(image));
+  image[10][33] = 0xf;
+  compare_gram(0);
+}
+
+int main(int argc, char** argv) {
+  const u32 draws = argc > 1 ? (u32)atoi(argv[1]) : 20000;
+  run_random(draws);
+  run_pixel();
+  printf("%u failures\n", fails);
+  return fails > 0;
+}
@@ -0,0 +1,277 @@
+/* stage_check.c
+
+   checks the L1-staged delay taps (dsp/buffer_stage.c)
+   against plain taps on a second copy of the buffer,
+   and counts the SDRAM accesses each makes.
+
+   every frame runs what delayFadeN does: two read taps,
+   then a write, add or mix at the write tap, then the taps move.
+   staged reads must match plain reads exactly,
+   and after buffer_stage_sync() both buffers must match.
+
+   three runs:
+   - steady: one loop, rate 1, reads trailing the write.
+     reports words per copier burst and bursts per frame,
+     against one access per sample for plain taps.
+   - edge: the loop cut below taps near the end of the buffer.
+   - stress: random jumps of every tap, loop changes (including
+     below a tap), rates and divisors, run flags, write modes,
+     and reads landing in the write window.
+
+   built twice: fract32 buffers, and fract16 buffers (BUFFER_16).
+
+   usage: stage_check [stress frames]
+   exits non-zero on any mismatch.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "buffer_stage.h"
+
+// buffer size; small, so taps meet often
+#define FRAMES 4096
+// frames in the steady run
+#define STEADY_FRAMES 480000
+
+static delaySample refData[FRAMES];
+static delaySample stData[FRAMES];
+
+static delayBuffer refBuf;
+static delayBuffer stBuf;
+static bufferStage stage;
+
+// plain taps, and the staged ones
+static delayTapN refRd[2], refWr;
+static delayTapN stRd[2], stWr;
+
+// plain sample accesses
+static u32 plainAccess = 0;
+static u32 fails = 0;
+
+//----- plain taps
+
+#ifdef BUFFER_16
+// buffer16 taps take fract16 levels; load and store as the stage does
+static fract32 plain_read(delayTapN* tap) {
+  return delay_sample_load(tap->buf->data[tap->idx]);
+}
+static void plain_write(delayTapN* tap, fract32 val) {
+  tap->buf->data[tap->idx] = delay_sample_store(val);
+}
+static void plain_mix(delayTapN* tap, fract32 val, fract32 pre) {
+  tap->buf->data[tap->idx] = delay_sample_store
+    (add_fr1x32(mult_fr1x32x32(delay_sample_load(tap->buf->data[tap->idx]), pre), val));
+}
+static void plain_add(delayTapN* tap, fract32 val) {
+  tap->buf->data[tap->idx] = delay_sample_store
+    (add_fr1x32(delay_sample_load(tap->buf->data[tap->idx]), val));
+}
+#else
+#define plain_read buffer_tapN_read
+#define plain_write buffer_tapN_write
+#define plain_mix buffer_tapN_mix
+#define plain_add buffer_tapN_add
+#endif
+
+//----- helpers
+
+static void fail(const char* what, u32 n) {
+  ++fails;
+  if(fails < 20) {
+    printf("FAIL %s: %u\n", what, n);
+  }
+}
+
+static fract32 rand_fr32(void) {
+  return (fract32)(((u32)rand() << 16) ^ (u32)rand());
+}
+
+static void setup(void) {
+  u32 i;
+  u8 k;
+  for(i=0; i<FRAMES; i++) {
+    refData[i] = stData[i] = delay_sample_store(rand_fr32());
+  }
+  delay_buffer_init(&refBuf, refData, FRAMES);
+  delay_buffer_init(&stBuf, stData, FRAMES);
+  buffer_stage_init(&stage, &stBuf);
+  bufferStageMemcpy.bursts = 0;
+  bufferStageMemcpy.words = 0;
+  plainAccess = 0;
+  for(k=0; k<2; k++) {
+    delay_tapN_init(&(refRd[k]), &refBuf);
+    delay_tapN_init(&(stRd[k]), &stBuf);
+    refRd[k].loop = stRd[k].loop = FRAMES;
+  }
+  delay_tapN_init(&refWr, &refBuf);
+  delay_tapN_init(&stWr, &stBuf);
+  refWr.loop = stWr.loop = FRAMES;
+}
+
+// both copies of a tap
+static void tap_pos(delayTapN* a, delayTapN* b, u32 idx) {
+  a->idx = b->idx = idx;
+  a->divCount = b->divCount = 0;
+}
+
+static void tap_rate(delayTapN* a, delayTapN* b, u32 inc, u32 div) {
+  a->inc = b->inc = inc;
+  a->div = b->div = div;
+  a->divCount = b->divCount = 0;
+}
+
+// one frame, as delayFadeN_next()
+static void frame(fract32 in, u8 write, fract32 pre, u8 runRd, u8 runWr, u32 n) {
+  u8 k;
+  fract32 a, b;
+  for(k=0; k<2; k++) {
+    a = plain_read(&(refRd[k]));
+    b = buffer_stage_read(&stage, k, &(stRd[k]));
+    ++plainAccess;
+    if(a != b) { fail(k ? "read 1" : "read 0", n); }
+  }
+  if(write) {
+    if(pre == 0) {
+      plain_write(&refWr, in);
+      buffer_stage_write(&stage, &stWr, in);
+      ++plainAccess;
+    } else if(pre < 0) {
+      plain_add(&refWr, in);
+      buffer_stage_add(&stage, &stWr, in);
+      plainAccess += 2;
+    } else {
+      plain_mix(&refWr, in, pre);
+      buffer_stage_mix(&stage, &stWr, in, pre);
+      plainAccess += 2;
+    }
+  }
+  if(runRd) {
+    for(k=0; k<2; k++) {
+      delay_tapN_next(&(refRd[k]));
+      delay_tapN_next(&(stRd[k]));
+    }
+  }
+  if(runWr) {
+    delay_tapN_next(&refWr);
+    delay_tapN_next(&stWr);
+  }
+}
+
+static void compare_buffers(const char* run) {
+  u32 i, n = 0;
+  buffer_stage_sync(&stage);
+  for(i=0; i<FRAMES; i++) {
+    if(refData[i] != stData[i]) { ++n; }
+  }
+  if(n > 0) {
+    printf("FAIL %s: %u frames differ after sync\n", run, n);
+    ++fails;
+  }
+}
+
+//----- runs
+
+static void run_steady(void) {
+  u32 n;
+  double perBurst, perFrame;
+  setup();
+  // reads 1000 and 3000 frames behind the write
+  tap_pos(&(refRd[0]), &(stRd[0]), FRAMES - 1000);
+  tap_pos(&(refRd[1]), &(stRd[1]), FRAMES - 3000);
+  for(n=0; n<STEADY_FRAMES; n++) {
+    frame(rand_fr32(), 1, (n & 0x10000) ? 0x40000000 : 0, 1, 1, n);
+  }
+  compare_buffers("steady");
+  perBurst = (double)bufferStageMemcpy.words / bufferStageMemcpy.bursts;
+  perFrame = (double)bufferStageMemcpy.bursts / STEADY_FRAMES;
+  printf("steady: %u frames, plain %.2f accesses per frame, "
+	 "staged %.3f bursts per frame, %.1f words per burst, %u direct\n",
+	 STEADY_FRAMES, (double)plainAccess / STEADY_FRAMES,
+	 perFrame, perBurst, stage.direct);
+  // three windows moving at rate 1: about 3 / BUFFER_STAGE_FRAMES bursts
+  if(perBurst < BUFFER_STAGE_FRAMES / 2) { fail("steady words per burst", (u32)perBurst); }
+}
+
+static void run_edge(void) {
+  u32 n;
+  u8 k;
+  setup();
+  for(n=0; n<64; n++) {
+    // taps in the last window of the buffer, then a short loop
+    tap_pos(&(refRd[0]), &(stRd[0]), FRAMES - 1 - (n % 8));
+    tap_pos(&(refRd[1]), &(stRd[1]), FRAMES - 9 - (n % 16));
+    tap_pos(&refWr, &stWr, FRAMES - 2 - (n % 24));
+    refWr.loop = stWr.loop = 100 + n;
+    for(k=0; k<2; k++) { refRd[k].loop = stRd[k].loop = 100 + n; }
+    frame(rand_fr32(), 1, (n & 1) ? -1 : 0, 1, 1, n);
+    frame(rand_fr32(), 1, 0, 1, 1, n);
+    refWr.loop = stWr.loop = FRAMES;
+    for(k=0; k<2; k++) { refRd[k].loop = stRd[k].loop = FRAMES; }
+  }
+  compare_buffers("edge");
+  printf("edge: loop cut below the taps, %u direct\n", stage.direct);
+}
+
+static void run_stress(u32 frames) {
+  u32 n, loop, r;
+  u8 k, write = 1, runRd = 1, runWr = 1;
+  fract32 pre = 0;
+  setup();
+  for(n=0; n<frames; n++) {
+    r = rand() % 4000;
+    if(r < 8) {
+      // jump a read tap, sometimes onto the write tap
+      k = rand() % 2;
+      tap_pos(&(refRd[k]), &(stRd[k]),
+	      (r & 1) ? refWr.idx : rand() % refRd[k].loop);
+    } else if(r < 12) {
+      tap_pos(&refWr, &stWr, rand() % refWr.loop);
+    } else if(r < 14) {
+      // new loop; taps past it wrap on their next step
+      loop = 64 + rand() % (FRAMES - 63);
+      refWr.loop = stWr.loop = loop;
+      for(k=0; k<2; k++) { refRd[k].loop = stRd[k].loop = loop; }
+    } else if(r < 18) {
+      k = rand() % 3;
+      if(k < 2) {
+	tap_rate(&(refRd[k]), &(stRd[k]), 1 + rand() % 3, 1 + rand() % 3);
+      } else {
+	tap_rate(&refWr, &stWr, 1 + rand() % 3, 1 + rand() % 3);
+      }
+    } else if(r < 20) {
+      switch(rand() % 3) {
+      case 0: write ^= 1; break;
+      case 1: runRd ^= 1; break;
+      default: runWr ^= 1; break;
+      }
+    } else if(r < 23) {
+      switch(rand() % 3) {
+      case 0: pre = 0; break;
+      case 1: pre = -1; break;
+      default: pre = rand_fr32() & 0x7fffffff; break;
+      }
+    }
+    frame(rand_fr32(), write, pre, runRd, runWr, n);
+  }
+  compare_buffers("stress");
+  printf("stress: %u frames, plain %u accesses, staged %u bursts of %u words, "
+	 "%u direct\n", frames, plainAccess, bufferStageMemcpy.bursts,
+	 bufferStageMemcpy.words, stage.direct);
+}
+
+int main(int argc, char** argv) {
+  const u32 frames = argc > 1 ? (u32)atoi(argv[1]) : 4000000;
+#ifdef BUFFER_16
+  printf("fract16 buffers\n");
+#else
+  printf("fract32 buffers\n");
+#endif
+  srand(1);
+  run_steady();
+  run_edge();
+  run_stress(frames);
+  printf("%u failures\n", fails);
+  return fails > 0;
+}
@@ -0,0 +1,65 @@
+/* glyph_atlas.c
+   aleph-tabletool
+
+   generate the packed glyph atlas for the anti-aliased font
+   (avr32/src/font_aa.c), from the ume_tgo5_18 font table.
+
+   usage: glyph_atlas > ume_tgo5_18_atlas_inc.c
+
+   each glyph row is 4 bytes with the first 8 pixels:
+   byte k has pixel k in its low nibble and pixel k+4 in its high nibble.
+   the last column is packed 2 rows per byte, even rows low.
+   output is the initializer for
+   const glyphAa atlas[FONT_UME_TG05_18_NGLYPHS],
+   with a preprocessor check against the font header.
+*/
+
+#include <stdio.h>
+
+#include "fonts/ume_tgo5_18.c"
+
+#define W FONT_UME_TGO5_18_W
+#define H FONT_UME_TGO5_18_H
+#define N FONT_UME_TG05_18_NGLYPHS
+
+int main(void) {
+  unsigned char last[(H + 1) >> 1];
+  const char* gl;
+  int i, k, n;
+
+  if(W != 9) {
+    fprintf(stderr, "glyph atlas rows are 8 pixels + 1\n");
+    return 1;
+  }
+
+  printf("// generated by utils/tabletool/glyph_atlas from ume_tgo5_18.c\n");
+  printf("#if FONT_UME_TGO5_18_W != %d || FONT_UME_TGO5_18_H != %d"
+	 " || FONT_UME_TG05_18_NGLYPHS != %d\n", W, H, N);
+  printf("#error \"atlas data doesn't match ume_tgo5_18.h\"\n");
+  printf("#endif\n");
+
+  for(n=0; n<N; n++) {
+    gl = font_ume_tgo5_18[n].glyph.data;
+    printf("// glyph %d\n{ {", n);
+    for(i=0; i<H; i++) {
+      printf("%s{{", (i & 3) ? " " : "\n  ");
+      for(k=0; k<4; k++) {
+	printf("0x%02x%s", ((gl[k] & 0xf) | ((gl[k + 4] & 0xf) << 4)) & 0xff,
+	       k < 3 ? "," : "");
+      }
+      printf("}},");
+      if(i & 1) {
+	last[i >> 1] |= (gl[8] & 0xf) << 4;
+      } else {
+	last[i >> 1] = gl[8] & 0xf;
+      }
+      gl += W;
+    }
+    printf("\n  }, {");
+    for(i=0; i<((H + 1) >> 1); i++) {
+      printf(" 0x%02x,", last[i]);
+    }
+    printf(" } },\n");
+  }
+  return 0;
+}
@@ -0,0 +1,49 @@
+/* grain_window.c
+   aleph-tabletool
+
+   generate the hann window for dsp/grain_cloud.
+
+   usage: grain_window [-b bits] > grain_window_inc.c
+
+   the window has (1 << bits) points, from 0 up to 32767 and back.
+   output is the initializer for the first half of
+   const fract16 window[GRAIN_CLOUD_WIN_SIZE << 1],
+   with a preprocessor check against grain_cloud.h.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int bits = 10;
+
+int main(int argc, char** argv) {
+  int i, n;
+
+  for(i=1; i<argc; i++) {
+    if(strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+      bits = atoi(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: %s [-b bits]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(bits < 4 || bits > 16) {
+    fprintf(stderr, "bits out of range\n");
+    return 1;
+  }
+  n = 1 << bits;
+
+  printf("// generated by utils/tabletool/grain_window\n");
+  printf("#if GRAIN_CLOUD_WIN_BITS != %d\n", bits);
+  printf("#error \"window data doesn't match grain_cloud.h\"\n");
+  printf("#endif\n");
+  printf(" ");
+  for(i=0; i<n; i++) {
+    printf(" %d,", (int)(16383.5 * (1.0 - cos(2.0 * M_PI * (double)i / (double)n))));
+    if((i & 15) == 15 && i < n - 1) { printf("\n "); }
+  }
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,151 @@
+/* wavtab_mip.c
+   aleph-tabletool
+
+   generate mip-mapped wavetable data for dsp/osc_mip.
+
+   usage: wavtab_mip [-b bits] [-l levels] spectra.txt > wavtab_mip_inc.c
+
+   each non-empty line of the spectra file is one waveshape:
+   the amplitudes of harmonics 1, 2, 3 ... (sine phase).
+   '#' starts a comment.
+
+   level l has (1 << (bits - l)) points and keeps harmonics
+   up to (1 << (levels - 1 - l)). every level of a shape is
+   scaled by the peak of level 0, so loudness doesn't jump
+   between levels. output is the initializer for
+   const fract16 tab[shapes][OSC_MIP_SHAPE_SIZE],
+   with a preprocessor check against osc_mip.h.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// max harmonics per shape
+#define HARM_MAX 256
+// max shapes
+#define SHAPE_MAX 32
+
+static double amp[SHAPE_MAX][HARM_MAX];
+static int numHarm[SHAPE_MAX];
+static int numShapes = 0;
+
+static int bits = 10;
+static int levels = 6;
+
+// read the spectra file
+static int read_spectra(const char* path) {
+  char line[4096];
+  char* p;
+  char* end;
+  FILE* f = fopen(path, "r");
+  if(f == NULL) {
+    perror(path);
+    return 0;
+  }
+  while(fgets(line, sizeof(line), f)) {
+    if((p = strchr(line, '#'))) { *p = '\0'; }
+    p = line;
+    numHarm[numShapes] = 0;
+    while(1) {
+      double a = strtod(p, &end);
+      if(end == p) { break; }
+      if(numHarm[numShapes] == HARM_MAX) {
+	fprintf(stderr, "too many harmonics (max %d)\n", HARM_MAX);
+	fclose(f);
+	return 0;
+      }
+      amp[numShapes][numHarm[numShapes]++] = a;
+      p = end;
+    }
+    if(numHarm[numShapes] > 0) {
+      if(++numShapes == SHAPE_MAX) {
+	fprintf(stderr, "too many shapes (max %d)\n", SHAPE_MAX);
+	fclose(f);
+	return 0;
+      }
+    }
+  }
+  fclose(f);
+  return numShapes;
+}
+
+// one band-limited level of one shape, unscaled
+static void fill_level(double* dst, int shape, int level) {
+  int n = 1 << (bits - level);
+  int h = 1 << (levels - 1 - level);
+  int i, k;
+  if(h > numHarm[shape]) { h = numHarm[shape]; }
+  for(i=0; i<n; i++) {
+    double x = 0.0;
+    for(k=0; k<h; k++) {
+      x += amp[shape][k] * sin(2.0 * M_PI * (double)(k + 1) * (double)i / (double)n);
+    }
+    dst[i] = x;
+  }
+}
+
+static void usage(const char* name) {
+  fprintf(stderr, "usage: %s [-b bits] [-l levels] spectra.txt\n", name);
+}
+
+int main(int argc, char* argv[]) {
+  const char* path = NULL;
+  double* buf;
+  double peak, scale, y;
+  int a, s, l, i, n;
+
+  for(a=1; a<argc; a++) {
+    if(strcmp(argv[a], "-b") == 0 && a + 1 < argc) {
+      bits = atoi(argv[++a]);
+    } else if(strcmp(argv[a], "-l") == 0 && a + 1 < argc) {
+      levels = atoi(argv[++a]);
+    } else if(argv[a][0] != '-' && path == NULL) {
+      path = argv[a];
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if(path == NULL || levels < 1 || bits < levels) {
+    usage(argv[0]);
+    return 1;
+  }
+  if(read_spectra(path) == 0) { return 1; }
+
+  buf = malloc(sizeof(double) << bits);
+
+  printf("// generated by utils/tabletool/wavtab_mip from %s\n", path);
+  printf("#if OSC_MIP_BITS != %d || OSC_MIP_LEVELS != %d\n", bits, levels);
+  printf("#error \"table data doesn't match osc_mip.h\"\n");
+  printf("#endif\n");
+
+  for(s=0; s<numShapes; s++) {
+    // scale from the peak of the full-band level
+    fill_level(buf, s, 0);
+    peak = 0.0;
+    for(i=0; i < (1 << bits); i++) {
+      if(fabs(buf[i]) > peak) { peak = fabs(buf[i]); }
+    }
+    scale = peak > 0.0 ? 32767.0 / peak : 0.0;
+
+    printf("// shape %d\n{\n", s);
+    for(l=0; l<levels; l++) {
+      n = 1 << (bits - l);
+      fill_level(buf, s, l);
+      printf("  // level %d\n ", l);
+      for(i=0; i<n; i++) {
+	y = floor(buf[i] * scale + 0.5);
+	if(y > 32767.0) { y = 32767.0; }
+	if(y < -32768.0) { y = -32768.0; }
+	printf(" %d,", (int)y);
+	if((i & 15) == 15 && i < n - 1) { printf("\n "); }
+      }
+      printf("\n");
+    }
+    printf("},\n");
+  }
+  free(buf);
+  return 0;
+}
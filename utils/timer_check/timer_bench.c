@@ -0,0 +1,67 @@
+/* timer_bench.c
+
+   host cost of the soft timers (timers.c) as the number of timers grows.
+   built against the timing wheel in avr32_sim (timer_bench)
+   and the linked list it replaced (timer_bench_list).
+
+   for each count, sets that many timers with random periods
+   of 10 to 999 ticks, and reports the mean cost of timer_add()
+   and of process_timers() per tick.
+
+   usage: timer_bench [ticks]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "timers.h"
+
+#define MAX_TIMERS 1024
+
+static softTimer_t tm[MAX_TIMERS];
+static volatile u32 hits;
+
+static void cb(void* p) {
+  ++hits;
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench(u32 n, u32 ticks) {
+  u32 r = 1;
+  u32 i;
+  double t0, tAdd, tTick;
+
+  for(i=0; i<n; ++i) { tm[i].next = NULL; }
+  hits = 0;
+
+  t0 = now_ns();
+  for(i=0; i<n; ++i) {
+    r = r * 1103515245 + 12345;
+    timer_add(&tm[i], 10 + (r >> 8) % 990, &cb, NULL);
+  }
+  tAdd = now_ns() - t0;
+
+  t0 = now_ns();
+  for(i=0; i<ticks; ++i) { process_timers(); }
+  tTick = now_ns() - t0;
+
+  printf("%5u timers: %8.1f ns/tick, %6.1f ns/add, %u callbacks\n",
+	 n, tTick / ticks, tAdd / n, hits);
+
+  for(i=0; i<n; ++i) { timer_remove(&tm[i]); }
+}
+
+int main(int argc, char** argv) {
+  const u32 ticks = argc > 1 ? (u32)atoi(argv[1]) : 200000;
+  u32 n;
+  for(n=16; n<=MAX_TIMERS; n <<= 1) {
+    bench(n, ticks);
+  }
+  return 0;
+}
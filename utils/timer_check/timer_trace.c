@@ -0,0 +1,202 @@
+/* timer_trace.c
+
+   random workload for the soft timers (timers.c).
+   built twice: against the timing wheel in avr32_sim,
+   and against the linked list it replaced (list/),
+   and `make check` compares the two traces line for line.
+
+   each tick, a few random timers are added, removed,
+   set, reset, fired manually or have their period changed,
+   and some callbacks change their own period.
+   periods span one tick to several wheel levels.
+   the trace is one line per tick that fired anything:
+   "tick: ids", ids sorted, since the order within a tick may differ.
+
+   with x, also exercises what the list implementation can't do,
+   so the trace is not comparable:
+   - callbacks that remove their own timer.
+   - timers_clear() with timers set.
+   - periods around and past 2^24 ticks, each checked to fire on time.
+
+   checks, in both builds:
+   - a timer never fires while it is removed.
+
+   usage: timer_trace [ticks] [seed] [x]
+   exits non-zero on any failure.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "timers.h"
+
+// timers in the workload
+#define NTIMERS 300
+
+static softTimer_t tm[NTIMERS];
+// what each callback does besides being traced
+static u8 mode[NTIMERS];
+// set while a timer should be firing
+static u8 armed[NTIMERS];
+// per timer count of callbacks, for periods chosen in a callback
+static u32 cbCount[NTIMERS];
+
+static int fired[NTIMERS * 4];
+static int nFired;
+static u32 tick;
+
+static u32 rs = 12345;
+static u8 extra = 0;
+static u32 fails = 0;
+
+static void fail(const char* what, u32 tick, int id) {
+  ++fails;
+  if(fails < 20) {
+    fprintf(stderr, "FAIL %s: tick %u, timer %d\n", what, tick, id);
+  }
+}
+
+static u32 rnd(void) {
+  rs = rs * 1103515245 + 12345;
+  return rs >> 8;
+}
+
+// repeatable per callback, whatever order the callbacks of a tick run in
+static u32 cb_rnd(int id) {
+  u32 x = id * 2654435761u + (++cbCount[id]) * 40503u;
+  x ^= x >> 13;
+  x *= 0x5bd1e995;
+  return x ^ (x >> 15);
+}
+
+static void cb(void* p) {
+  const int id = (int)(long)p;
+  if(!armed[id]) { fail("removed timer fired", tick, id); }
+  fired[nFired++] = id;
+  switch(mode[id]) {
+  case 1:
+    if(extra) {
+      timer_remove(&tm[id]);
+      armed[id] = 0;
+    }
+    break;
+  case 2:
+    tm[id].ticks = 1 + cb_rnd(id) % 300;
+    break;
+  case 3:
+    timer_set(&tm[id], 1 + cb_rnd(id) % 50);
+    break;
+  }
+}
+
+static u32 pick_ticks(void) {
+  switch(rnd() % 6) {
+  case 0: return 1 + rnd() % 3;
+  case 1: return 1 + rnd() % 64;
+  // around the first wheel boundaries
+  case 2: return 60 + rnd() % 10;
+  case 3: return 1 + rnd() % 5000;
+  case 4: return 4090 + rnd() % 12;
+  default: return 1 + rnd() % 300000;
+  }
+}
+
+static int cmp_int(const void* a, const void* b) {
+  return *(const int*)a - *(const int*)b;
+}
+
+static void random_op(void) {
+  const int id = rnd() % NTIMERS;
+  switch(rnd() % 8) {
+  case 0: case 1: case 2:
+    mode[id] = rnd() % 4;
+    if(timer_add(&tm[id], pick_ticks(), &cb, (void*)(long)id)) {
+      armed[id] = 1;
+    }
+    break;
+  case 3:
+    timer_remove(&tm[id]);
+    armed[id] = 0;
+    break;
+  case 4:
+    if(tm[id].next) { timer_set(&tm[id], pick_ticks()); }
+    break;
+  case 5:
+    if(tm[id].next) { timer_reset(&tm[id]); }
+    break;
+  case 6:
+    if(tm[id].next) { timer_manual(&tm[id]); }
+    break;
+  case 7:
+    if(tm[id].next) { tm[id].ticks = pick_ticks(); }
+    break;
+  }
+}
+
+//----- long periods
+
+#define NLONG 5
+static softTimer_t longTm[NLONG];
+static const u32 longTicks[NLONG] = { 1, 16777215, 16777216, 16777221, 40000000 };
+static u32 longLast[NLONG];
+static u32 longTick;
+
+static void long_cb(void* p) {
+  const int i = (int)(long)p;
+  if(longTick != longLast[i] + longTicks[i]) {
+    fail("long period off", longTick, i);
+  }
+  longLast[i] = longTick;
+}
+
+// runs each period at least three times
+static void check_long(void) {
+  int i;
+  timers_clear();
+  for(i=0; i<NLONG; ++i) {
+    longTm[i].next = NULL;
+    longLast[i] = 0;
+    timer_add(&longTm[i], longTicks[i], &long_cb, (void*)(long)i);
+  }
+  for(longTick=1; longTick<=130000000; ++longTick) {
+    process_timers();
+  }
+  for(i=0; i<NLONG; ++i) {
+    if(longLast[i] + longTicks[i] <= 130000000) {
+      fail("long period missed", longLast[i], i);
+    }
+  }
+  timers_clear();
+}
+
+int main(int argc, char** argv) {
+  const u32 ticks = argc > 1 ? (u32)atoi(argv[1]) : 200000;
+  u32 ops;
+  int i;
+
+  if(argc > 2) { rs = (u32)atoi(argv[2]); }
+  extra = argc > 3 && strcmp(argv[3], "x") == 0;
+
+  for(i=0; i<NTIMERS; ++i) { tm[i].next = NULL; }
+  for(tick=0; tick<ticks; ++tick) {
+    ops = (rnd() % 8 == 0) ? rnd() % 6 : 0;
+    while(ops-- > 0) { random_op(); }
+    if(extra && tick == ticks / 2) {
+      timers_clear();
+      memset(armed, 0, sizeof(armed));
+    }
+    nFired = 0;
+    process_timers();
+    if(nFired > 0) {
+      qsort(fired, nFired, sizeof(int), &cmp_int);
+      printf("%u:", tick);
+      for(i=0; i<nFired; ++i) { printf(" %d", fired[i]); }
+      printf("\n");
+    }
+  }
+  if(extra) { check_long(); }
+
+  fprintf(stderr, "%u ticks, %u failures\n", ticks, fails);
+  return fails > 0;
+}